@@ -0,0 +1,763 @@
+#ifndef LION_UNICODE_ASYNC_FILE_HPP
+#define LION_UNICODE_ASYNC_FILE_HPP
+
+#include "encoding.hpp"
+#include "utf8.hpp"
+#include "utf16.hpp"
+#include "utf32.hpp"
+#include "utilities.hpp"
+#include "pipeline.hpp"
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <deque>
+#include <unordered_map>
+#include <unordered_set>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <cerrno>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/uio.h>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define LION_UNICODE_HAS_IO_URING 1
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#else
+#define LION_UNICODE_HAS_IO_URING 0
+#endif
+
+namespace lion::unicode
+{
+	enum class io_backend
+	{
+		automatic,
+		io_uring,
+		thread_pool
+	};
+
+	struct io_completion
+	{
+		std::uint64_t user_data = 0;
+		std::int64_t result = 0; // number of bytes transferred, or -errno on failure
+	};
+
+	// Completion-driven file I/O. Reads go into a fixed set of buffers owned by the object (registered
+	// with the kernel when io_uring is used), writes come from caller-owned memory which has to stay
+	// alive until their completion is returned by wait(). When io_uring is not available, or when
+	// io_backend::thread_pool is requested, the requests are served by a pool of pread/pwrite threads.
+	class async_io
+	{
+	public:
+		explicit async_io(unsigned depth = 64, std::size_t buffer_size = default_block_size,
+			io_backend backend = io_backend::automatic, unsigned threads = 4)
+			: depth_(std::max(depth, 1u)), buffer_size_(std::max<std::size_t>(buffer_size, 1)),
+			storage(new char[depth_ * buffer_size_])
+		{
+			if (backend != io_backend::thread_pool && setup_ring()) {
+				return;
+			}
+			for (unsigned i = 0; i < std::max(threads, 1u); ++i) {
+				workers.emplace_back([this]() { work(); });
+			}
+		}
+
+		async_io(const async_io&) = delete;
+		async_io& operator=(const async_io&) = delete;
+
+		~async_io()
+		{
+			if (!workers.empty())
+			{
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					stopping = true;
+				}
+				requests_ready.notify_all();
+				for (std::thread& worker : workers) {
+					worker.join();
+				}
+			}
+#if LION_UNICODE_HAS_IO_URING
+			ring.close();
+#endif
+		}
+
+		bool uses_io_uring() const noexcept { return workers.empty(); }
+
+		// the number of read buffers, which is also the maximum number of reads that can be in flight
+		unsigned depth() const noexcept { return depth_; }
+		std::size_t buffer_size() const noexcept { return buffer_size_; }
+
+		char* buffer(unsigned index) noexcept {
+			return storage.get() + index * buffer_size_;
+		}
+
+		// reads at most buffer_size() bytes at 'offset' of 'fd' into buffer(buffer_index)
+		void read(int fd, unsigned buffer_index, std::uint64_t offset, std::uint64_t user_data) {
+			enqueue(request{ fd, buffer(buffer_index), buffer_size_, offset, user_data, buffer_index, false });
+		}
+
+		void write(int fd, const char* data, std::size_t size, std::uint64_t offset, std::uint64_t user_data) {
+			enqueue(request{ fd, const_cast<char*>(data), size, offset, user_data, 0, true });
+		}
+
+		// hands the requests made since the last call over to the kernel or the worker threads
+		void submit()
+		{
+#if LION_UNICODE_HAS_IO_URING
+			if (uses_io_uring())
+			{
+				ring.enter(0, 0);
+				return;
+			}
+#endif
+			if (staged.empty()) {
+				return;
+			}
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				std::move(staged.begin(), staged.end(), std::back_inserter(requests));
+			}
+			staged.clear();
+			requests_ready.notify_all();
+		}
+
+		// submits pending requests and blocks until at least one completes; returns the number stored in 'completions'
+		std::size_t wait(io_completion* completions, std::size_t max)
+		{
+			if (max == 0) {
+				return 0;
+			}
+#if LION_UNICODE_HAS_IO_URING
+			if (uses_io_uring())
+			{
+				std::size_t count = ring.reap(completions, max);
+				while (count == 0)
+				{
+					ring.enter(1, IORING_ENTER_GETEVENTS);
+					count = ring.reap(completions, max);
+					if (count == 0 && ring.error != 0) {
+						// the ring has stopped and nothing is in flight
+						return 0;
+					}
+				}
+				return count;
+			}
+#endif
+			submit();
+
+			std::unique_lock<std::mutex> lock(mutex);
+			completions_ready.wait(lock, [this]() { return !completed.empty(); });
+
+			const std::size_t count = std::min(max, completed.size());
+			std::copy_n(completed.begin(), count, completions);
+			completed.erase(completed.begin(), completed.begin() + count);
+			return count;
+		}
+
+	private:
+		struct request
+		{
+			int fd;
+			char* data;
+			std::size_t size;
+			std::uint64_t offset;
+			std::uint64_t user_data;
+			unsigned buffer_index;
+			bool write;
+		};
+
+		unsigned depth_;
+		std::size_t buffer_size_;
+		std::unique_ptr<char[]> storage;
+
+		// thread pool fallback
+		std::vector<std::thread> workers;
+		std::vector<request> staged;
+		std::deque<request> requests;
+		std::deque<io_completion> completed;
+		std::mutex mutex;
+		std::condition_variable requests_ready;
+		std::condition_variable completions_ready;
+		bool stopping = false;
+
+		static std::int64_t transfer(const request& req)
+		{
+			std::size_t done = 0;
+			while (done < req.size)
+			{
+				const ssize_t n = req.write
+					? ::pwrite(req.fd, req.data + done, req.size - done, static_cast<off_t>(req.offset + done))
+					: ::pread(req.fd, req.data + done, req.size - done, static_cast<off_t>(req.offset + done));
+				if (n < 0)
+				{
+					if (errno == EINTR) {
+						continue;
+					}
+					return done > 0 ? static_cast<std::int64_t>(done) : -errno;
+				}
+				if (n == 0) {
+					break;
+				}
+				done += static_cast<std::size_t>(n);
+			}
+			return static_cast<std::int64_t>(done);
+		}
+
+		void work()
+		{
+			for (;;)
+			{
+				request req;
+				{
+					std::unique_lock<std::mutex> lock(mutex);
+					requests_ready.wait(lock, [this]() { return stopping || !requests.empty(); });
+					if (requests.empty()) {
+						return;
+					}
+					req = requests.front();
+					requests.pop_front();
+				}
+
+				const io_completion completion{ req.user_data, transfer(req) };
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					completed.push_back(completion);
+				}
+				completions_ready.notify_one();
+			}
+		}
+
+		void enqueue(const request& req)
+		{
+#if LION_UNICODE_HAS_IO_URING
+			if (uses_io_uring())
+			{
+				ring.push(req);
+				return;
+			}
+#endif
+			staged.push_back(req);
+		}
+
+#if LION_UNICODE_HAS_IO_URING
+		// a minimal io_uring driver on top of the raw system calls
+		struct uring
+		{
+			int fd = -1;
+			bool fixed = false;
+
+			unsigned* sq_head = nullptr;
+			unsigned* sq_tail = nullptr;
+			unsigned* sq_mask = nullptr;
+			unsigned* sq_array = nullptr;
+			unsigned sq_entries = 0;
+			io_uring_sqe* sqes = nullptr;
+
+			unsigned* cq_head = nullptr;
+			unsigned* cq_tail = nullptr;
+			unsigned* cq_mask = nullptr;
+			io_uring_cqe* cqes = nullptr;
+
+			void* sq_ptr = MAP_FAILED;
+			void* cq_ptr = MAP_FAILED;
+			std::size_t sq_size = 0;
+			std::size_t cq_size = 0;
+			std::size_t sqes_size = 0;
+
+			unsigned to_submit = 0;
+			int error = 0; // the errno which stopped the ring, with which the requests in it fail
+
+			std::unordered_set<std::uint64_t> in_flight; // pushed and not reaped
+			std::deque<io_completion> reaped;            // taken off the ring and not returned yet
+
+			bool open(unsigned entries, char* buffers, unsigned count, std::size_t buffer_size)
+			{
+				io_uring_params params;
+				std::memset(&params, 0, sizeof(params));
+
+				fd = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+				if (fd < 0) {
+					return false;
+				}
+
+				sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+				cq_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+				const bool single = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+				if (single) {
+					sq_size = cq_size = std::max(sq_size, cq_size);
+				}
+
+				sq_ptr = ::mmap(nullptr, sq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+				if (sq_ptr == MAP_FAILED) {
+					return close();
+				}
+				cq_ptr = single ? sq_ptr
+					: ::mmap(nullptr, cq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+				if (cq_ptr == MAP_FAILED) {
+					return close();
+				}
+				sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+				void* sqes_ptr = ::mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+				if (sqes_ptr == MAP_FAILED) {
+					return close();
+				}
+
+				char* sq = static_cast<char*>(sq_ptr);
+				sq_head = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+				sq_tail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+				sq_mask = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+				sq_array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+				sq_entries = params.sq_entries;
+				sqes = static_cast<io_uring_sqe*>(sqes_ptr);
+
+				char* cq = static_cast<char*>(cq_ptr);
+				cq_head = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+				cq_tail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+				cq_mask = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+				cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+				// registering needs locked memory, which may be limited - plain reads work without it
+				std::vector<iovec> iovecs(count);
+				for (unsigned i = 0; i < count; ++i) {
+					iovecs[i] = iovec{ buffers + i * buffer_size, buffer_size };
+				}
+				fixed = ::syscall(__NR_io_uring_register, fd, IORING_REGISTER_BUFFERS, iovecs.data(), count) == 0;
+
+				// 5.1-5.5 kernels set up a ring but fail every request, so those fall back to the thread pool
+				if (!supports_operations()) {
+					return close();
+				}
+				return true;
+			}
+
+			// whether the kernel has the operations push() uses; IORING_OP_READ and IORING_OP_WRITE came with the
+			// probe in 5.6, so a ring which can't be probed doesn't have them either
+			bool supports_operations() const
+			{
+				constexpr unsigned ops = 256;
+				std::vector<char> space(sizeof(io_uring_probe) + ops * sizeof(io_uring_probe_op), 0);
+				io_uring_probe* probe = reinterpret_cast<io_uring_probe*>(space.data());
+				if (::syscall(__NR_io_uring_register, fd, IORING_REGISTER_PROBE, probe, ops) != 0) {
+					return false;
+				}
+
+				const auto supported = [probe](unsigned op) {
+					return op <= probe->last_op && (probe->ops[op].flags & IO_URING_OP_SUPPORTED) != 0;
+				};
+				return supported(IORING_OP_READ) && supported(IORING_OP_WRITE) && (!fixed || supported(IORING_OP_READ_FIXED));
+			}
+
+			bool close()
+			{
+				if (sqes != nullptr) {
+					::munmap(sqes, sqes_size);
+				}
+				if (cq_ptr != MAP_FAILED && cq_ptr != sq_ptr) {
+					::munmap(cq_ptr, cq_size);
+				}
+				if (sq_ptr != MAP_FAILED) {
+					::munmap(sq_ptr, sq_size);
+				}
+				if (fd >= 0) {
+					::close(fd);
+				}
+				*this = uring{};
+				return false;
+			}
+
+			void push(const request& req)
+			{
+				in_flight.insert(req.user_data);
+				unsigned tail = *sq_tail;
+				while (error == 0 && tail - __atomic_load_n(sq_head, __ATOMIC_ACQUIRE) == sq_entries)
+				{
+					// a busy ring takes no more requests until its completions are taken off
+					if (enter(0, 0) != 0) {
+						collect();
+					}
+				}
+				if (error != 0) {
+					// reap() fails the request
+					return;
+				}
+
+				const unsigned index = tail & *sq_mask;
+				io_uring_sqe& sqe = sqes[index];
+				std::memset(&sqe, 0, sizeof(sqe));
+				sqe.fd = req.fd;
+				sqe.off = req.offset;
+				sqe.addr = reinterpret_cast<std::uint64_t>(req.data);
+				sqe.len = static_cast<std::uint32_t>(req.size);
+				sqe.user_data = req.user_data;
+				if (req.write) {
+					sqe.opcode = IORING_OP_WRITE;
+				}
+				else if (fixed)
+				{
+					sqe.opcode = IORING_OP_READ_FIXED;
+					sqe.buf_index = static_cast<std::uint16_t>(req.buffer_index);
+				}
+				else {
+					sqe.opcode = IORING_OP_READ;
+				}
+
+				sq_array[index] = index;
+				__atomic_store_n(sq_tail, ++tail, __ATOMIC_RELEASE);
+				++to_submit;
+			}
+
+			// returns 0, EAGAIN or EBUSY if it is to be called again once the completions are taken off, or the errno
+			// which stopped the ring
+			int enter(unsigned min_complete, unsigned flags)
+			{
+				while (error == 0)
+				{
+					const long submitted = ::syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, nullptr, 0);
+					if (submitted >= 0)
+					{
+						to_submit -= std::min(to_submit, static_cast<unsigned>(submitted));
+						return 0;
+					}
+					if (errno == EAGAIN || errno == EBUSY) {
+						return errno;
+					}
+					if (errno != EINTR) {
+						error = errno;
+					}
+				}
+				return error;
+			}
+
+			// takes the completions off the ring
+			void collect()
+			{
+				unsigned head = *cq_head;
+				const unsigned tail = __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE);
+				for (; head != tail; ++head)
+				{
+					const io_uring_cqe& cqe = cqes[head & *cq_mask];
+					reaped.push_back(io_completion{ cqe.user_data, cqe.res });
+				}
+				__atomic_store_n(cq_head, head, __ATOMIC_RELEASE);
+			}
+
+			std::size_t reap(io_completion* completions, std::size_t max)
+			{
+				collect();
+				std::size_t count = std::min(max, reaped.size());
+				std::copy_n(reaped.begin(), count, completions);
+				reaped.erase(reaped.begin(), reaped.begin() + static_cast<std::ptrdiff_t>(count));
+				for (std::size_t i = 0; i < count; ++i) {
+					in_flight.erase(completions[i].user_data);
+				}
+
+				// once the ring has stopped, the requests still in it never complete
+				if (count == 0 && error != 0)
+				{
+					for (auto it = in_flight.begin(); it != in_flight.end() && count < max; it = in_flight.erase(it)) {
+						completions[count++] = io_completion{ *it, -error };
+					}
+				}
+				return count;
+			}
+		};
+
+		uring ring;
+
+		bool setup_ring() {
+			return ring.open(depth_ * 2, storage.get(), depth_, buffer_size_);
+		}
+#else
+		bool setup_ring() {
+			return false;
+		}
+#endif
+	};
+
+	// Converts many files to UTFO at once from a single thread, keeping up to io.depth() reads and as many
+	// writes in flight on 'io'. Each file is converted as if by convert_file<UTFO, conv, wrbom>.
+	template<typename UTFO = default_utf, conversion conv = conversion::strict, write_bom wrbom = write_bom::yes>
+	class async_converter
+	{
+		static_assert(std::is_same_v<UTFO, utf8> || std::is_same_v<UTFO, utf16> || std::is_same_v<UTFO, utf32>,
+			"async_converter<UTFO, conv, wrbom> requires UTFO to be one of utf8, utf16, utf32");
+
+	public:
+		explicit async_converter(async_io& io,
+			byte_order order = std::is_same_v<UTFO, utf8> ? byte_order::none : default_byte_order)
+			: io(io), order(order)
+		{}
+
+		void add(std::string input, std::string output)
+		{
+			conversion_result result;
+			result.input = std::move(input);
+			result.output = std::move(output);
+			results.push_back(std::move(result));
+		}
+
+		// runs all added conversions to completion and returns their results in the order they were added
+		std::vector<conversion_result> run()
+		{
+			jobs.clear();
+			jobs.resize(results.size());
+			for (unsigned i = 0; i < io.depth(); ++i) {
+				free_buffers.push_back(i);
+			}
+
+			std::size_t next = 0;
+			std::size_t active = 0;
+			std::vector<io_completion> completions(2 * io.depth());
+			while (next < jobs.size() || active > 0)
+			{
+				while (active < io.depth() && next < jobs.size())
+				{
+					if (start(next++)) {
+						++active;
+					}
+				}
+				issue_reads();
+				if (active == 0) {
+					continue;
+				}
+
+				const std::size_t count = io.wait(completions.data(), completions.size());
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					const std::size_t job = complete(completions[i]);
+					if (finished(job)) {
+						--active;
+					}
+				}
+				issue_writes();
+			}
+			free_buffers.clear();
+			return std::exchange(results, {});
+		}
+
+	private:
+		struct job
+		{
+			int in = -1;
+			int out = -1;
+			std::uint64_t read_offset = 0;
+			std::uint64_t write_offset = 0;
+			std::string head; // bytes kept until the encoding can be determined
+			std::unique_ptr<block_transcoder<UTFO, conv, wrbom>> transcode;
+			bool reading = false;
+			bool eof = false;
+			bool closed = false;
+			std::size_t writes = 0;
+		};
+
+		struct operation
+		{
+			std::size_t job;
+			unsigned buffer;
+			std::uint64_t offset; // for writes
+			std::string data;     // for writes
+			bool write;
+		};
+
+		async_io& io;
+		byte_order order;
+		std::vector<conversion_result> results;
+		std::vector<job> jobs;
+		std::vector<unsigned> free_buffers;
+		std::deque<std::size_t> want_read;
+		std::deque<std::uint64_t> want_write;
+		std::unordered_map<std::uint64_t, operation> operations;
+		std::uint64_t next_id = 0;
+		std::size_t writes_in_flight = 0;
+
+		bool start(std::size_t index)
+		{
+			job& j = jobs[index];
+			conversion_result& result = results[index];
+
+			if (std::is_same_v<UTFO, utf8> != (order == byte_order::none))
+			{
+				result.error = EINVAL;
+				return false;
+			}
+
+			j.in = ::open(result.input.c_str(), O_RDONLY | O_CLOEXEC);
+			if (j.in < 0)
+			{
+				result.error = errno;
+				return false;
+			}
+			j.out = ::open(result.output.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+			if (j.out < 0)
+			{
+				result.error = errno;
+				::close(j.in);
+				return false;
+			}
+			want_read.push_back(index);
+			return true;
+		}
+
+		void issue_reads()
+		{
+			while (!want_read.empty() && !free_buffers.empty())
+			{
+				const std::size_t index = want_read.front();
+				want_read.pop_front();
+
+				const unsigned buffer = free_buffers.back();
+				free_buffers.pop_back();
+
+				const std::uint64_t id = next_id++;
+				operations.emplace(id, operation{ index, buffer, 0, std::string(), false });
+				jobs[index].reading = true;
+				io.read(jobs[index].in, buffer, jobs[index].read_offset, id);
+			}
+			io.submit();
+		}
+
+		void issue_writes()
+		{
+			while (!want_write.empty() && writes_in_flight < io.depth())
+			{
+				const std::uint64_t id = want_write.front();
+				want_write.pop_front();
+
+				const operation& op = operations.at(id);
+				++writes_in_flight;
+				io.write(jobs[op.job].out, op.data.data(), op.data.size(), op.offset, id);
+			}
+			io.submit();
+		}
+
+		void queue_write(std::size_t index, std::string data)
+		{
+			if (data.empty()) {
+				return;
+			}
+			job& j = jobs[index];
+			const std::uint64_t id = next_id++;
+			operations.emplace(id, operation{ index, 0, j.write_offset, std::move(data), true });
+			j.write_offset += operations.at(id).data.size();
+			++j.writes;
+			want_write.push_back(id);
+		}
+
+		void fail(std::size_t index, int error)
+		{
+			if (results[index].error == 0) {
+				results[index].error = error;
+			}
+			jobs[index].eof = true;
+		}
+
+		// feeds 'bytes' to the transcoder of the job, detecting the encoding first if needed
+		void feed(std::size_t index, std::string_view bytes)
+		{
+			job& j = jobs[index];
+			if (!j.transcode)
+			{
+				j.head.append(bytes.data(), bytes.size());
+				if (j.head.size() <= encoding::sample_size && !j.eof) {
+					return;
+				}
+				j.transcode = std::make_unique<block_transcoder<UTFO, conv, wrbom>>(encoding::get(j.head, j.eof), order);
+				bytes = j.head;
+			}
+
+			std::string output;
+			(*j.transcode)(bytes, output, j.eof);
+			results[index].errors = j.transcode->stats().errors;
+			j.head.clear();
+			queue_write(index, std::move(output));
+		}
+
+		std::size_t complete(const io_completion& completion)
+		{
+			auto it = operations.find(completion.user_data);
+			operation op = std::move(it->second);
+			operations.erase(it);
+
+			job& j = jobs[op.job];
+			if (op.write)
+			{
+				--writes_in_flight;
+				--j.writes;
+				if (completion.result < 0) {
+					fail(op.job, static_cast<int>(-completion.result));
+				}
+				else if (completion.result == 0 && !op.data.empty()) {
+					// nothing was written, so queueing the same data again would never end
+					fail(op.job, EIO);
+				}
+				else
+				{
+					results[op.job].bytes_written += static_cast<std::uint64_t>(completion.result);
+					if (static_cast<std::size_t>(completion.result) < op.data.size())
+					{
+						// short write - queue the rest right behind it
+						const std::uint64_t id = next_id++;
+						op.offset += static_cast<std::uint64_t>(completion.result);
+						op.data.erase(0, static_cast<std::size_t>(completion.result));
+						operations.emplace(id, operation{ op.job, 0, op.offset, std::move(op.data), true });
+						++j.writes;
+						want_write.push_front(id);
+					}
+				}
+				return op.job;
+			}
+
+			j.reading = false;
+			free_buffers.push_back(op.buffer);
+			if (completion.result < 0)
+			{
+				fail(op.job, static_cast<int>(-completion.result));
+				return op.job;
+			}
+			if (results[op.job].error != 0) {
+				return op.job;
+			}
+
+			const std::size_t size = static_cast<std::size_t>(completion.result);
+			j.read_offset += size;
+			results[op.job].bytes_read += size;
+			j.eof = size == 0;
+			feed(op.job, std::string_view(io.buffer(op.buffer), size));
+			if (!j.eof) {
+				want_read.push_back(op.job);
+			}
+			return op.job;
+		}
+
+		bool finished(std::size_t index)
+		{
+			job& j = jobs[index];
+			if (j.closed || !j.eof || j.reading || j.writes > 0) {
+				return false;
+			}
+			::close(j.in);
+			if (::close(j.out) != 0) {
+				fail(index, errno);
+			}
+			j.transcode.reset();
+			j.closed = true;
+			return true;
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,513 @@
+#ifndef LION_UNICODE_BATCH_HPP
+#define LION_UNICODE_BATCH_HPP
+
+#include "encoding.hpp"
+#include "ustream.hpp"
+#include "utf8.hpp"
+#include "utf16.hpp"
+#include "utf32.hpp"
+#include "utilities.hpp"
+#include "pipeline.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+
+namespace lion::unicode
+{
+	// A thread pool in which every worker has its own deque of tasks: it takes its own tasks from the back
+	// and, when it runs out, steals from the front of the others. Tasks submitted by a worker go to its own deque.
+	class work_stealing_pool
+	{
+	public:
+		explicit work_stealing_pool(unsigned threads = std::thread::hardware_concurrency())
+		{
+			threads = std::max(threads, 1u);
+			for (unsigned i = 0; i < threads; ++i) {
+				queues.push_back(std::make_unique<queue>());
+			}
+			for (unsigned i = 0; i < threads; ++i) {
+				workers.emplace_back([this, i]() { work(i); });
+			}
+		}
+
+		work_stealing_pool(const work_stealing_pool&) = delete;
+		work_stealing_pool& operator=(const work_stealing_pool&) = delete;
+
+		~work_stealing_pool()
+		{
+			{
+				std::lock_guard<std::mutex> lock(sleep_mutex);
+				stopping = true;
+			}
+			wake.notify_all();
+			for (std::thread& worker : workers) {
+				worker.join();
+			}
+		}
+
+		std::size_t size() const noexcept { return workers.size(); }
+
+		// the task must not throw: nothing would catch it on a worker thread
+		void submit(std::function<void()> task)
+		{
+			const std::size_t index = current_pool == this ? current_index
+				: next_queue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+			{
+				std::lock_guard<std::mutex> lock(queues[index]->mutex);
+				queues[index]->tasks.push_back(std::move(task));
+			}
+			{
+				std::lock_guard<std::mutex> lock(sleep_mutex);
+				++queued;
+			}
+			wake.notify_one();
+		}
+
+		// runs queued tasks on the calling thread until 'pending' drops to zero
+		void wait_until_zero(const std::atomic<std::size_t>& pending)
+		{
+			const std::size_t self = current_pool == this ? current_index : 0;
+			while (pending.load(std::memory_order_acquire) != 0)
+			{
+				if (!run_one(self)) {
+					std::this_thread::yield();
+				}
+			}
+		}
+
+	private:
+		struct queue
+		{
+			std::mutex mutex;
+			std::deque<std::function<void()>> tasks;
+		};
+
+		std::vector<std::unique_ptr<queue>> queues;
+		std::vector<std::thread> workers;
+		std::atomic<std::size_t> next_queue{ 0 };
+
+		std::mutex sleep_mutex;
+		std::condition_variable wake;
+		std::size_t queued = 0;
+		bool stopping = false;
+
+		static inline thread_local work_stealing_pool* current_pool = nullptr;
+		static inline thread_local std::size_t current_index = 0;
+
+		bool take(std::size_t index, bool own, std::function<void()>& task)
+		{
+			queue& q = *queues[index];
+			std::lock_guard<std::mutex> lock(q.mutex);
+			if (q.tasks.empty()) {
+				return false;
+			}
+			if (own)
+			{
+				task = std::move(q.tasks.back());
+				q.tasks.pop_back();
+			}
+			else
+			{
+				task = std::move(q.tasks.front());
+				q.tasks.pop_front();
+			}
+			return true;
+		}
+
+		bool run_one(std::size_t self)
+		{
+			std::function<void()> task;
+			bool found = take(self, true, task);
+			for (std::size_t i = 1; !found && i < queues.size(); ++i) {
+				found = take((self + i) % queues.size(), false, task);
+			}
+			if (!found) {
+				return false;
+			}
+			{
+				std::lock_guard<std::mutex> lock(sleep_mutex);
+				--queued;
+			}
+			task();
+			return true;
+		}
+
+		void work(std::size_t index)
+		{
+			current_pool = this;
+			current_index = index;
+			for (;;)
+			{
+				if (run_one(index)) {
+					continue;
+				}
+				std::unique_lock<std::mutex> lock(sleep_mutex);
+				wake.wait(lock, [this]() { return stopping || queued > 0; });
+				if (stopping && queued == 0) {
+					return;
+				}
+			}
+		}
+	};
+
+	namespace detail
+	{
+		// converts the sequences of 'units' (bytes for utf8) starting in [begin, stop) and returns where the last one ends
+		template<typename UTFI, typename UTFO, conversion conv>
+		std::size_t transcode_range(std::string_view bytes, byte_order in_order, byte_order out_order,
+			std::size_t begin, std::size_t stop, std::string& output, std::uint64_t& errors)
+		{
+			typename UTFO::string_type units;
+			std::size_t end = 0;
+			if constexpr(std::is_same_v<UTFI, utf8> || is_single_byte<UTFI>::value)
+			{
+				const auto first = bytes.cbegin() + begin;
+				end = static_cast<std::size_t>(transcode_units<UTFI, UTFO, conv>(first, bytes.cbegin() + stop, bytes.cend(), units, errors) - bytes.cbegin());
+			}
+			else
+			{
+				// the units which the decoder may read past 'stop' are loaded as well
+				constexpr std::size_t size = sizeof(typename UTFI::char_type);
+				const std::size_t count = bytes.size() / size;
+				const std::size_t limit = std::min(count, stop + decode_reach<UTFI>() - 1);
+
+				typename UTFI::string_type in;
+				in.reserve(limit - std::min(begin, limit));
+				for (std::size_t i = begin; i < limit; ++i) {
+					in.push_back(load_unit<UTFI>(&bytes[i * size], in_order));
+				}
+				const auto first = in.cbegin();
+				end = begin + static_cast<std::size_t>(transcode_units<UTFI, UTFO, conv>(first, first + (std::min(stop, limit) - std::min(begin, limit)), in.cend(), units, errors) - first);
+			}
+
+			if constexpr(std::is_same_v<UTFO, utf8>) {
+				output.append(units);
+			}
+			else {
+				store_units<UTFO>(output, units.begin(), units.end(), out_order);
+			}
+			return end;
+		}
+
+		// the first index at or after 'index' which is likely the start of a sequence
+		template<typename UTFI>
+		std::size_t sync_point(std::string_view bytes, byte_order order, std::size_t index)
+		{
+			if constexpr(std::is_same_v<UTFI, utf8>)
+			{
+				for (std::size_t i = 0; i < 3 && index < bytes.size() && (static_cast<unsigned char>(bytes[index]) & 0xC0) == 0x80; ++i) {
+					++index;
+				}
+			}
+			else if constexpr(std::is_same_v<UTFI, utf16>)
+			{
+				if ((index + 1) * 2 <= bytes.size() && is_low_surrogate(load_unit<utf16>(&bytes[index * 2], order))) {
+					++index;
+				}
+			}
+			return index;
+		}
+
+		// Converts 'bytes' in chunks of about 'chunk_size' bytes in parallel on 'pool'. The chunks start at guessed
+		// sequence boundaries; a chunk whose guess turns out wrong (the previous one ended elsewhere) is redone from the
+		// actual boundary, so the result is always that of a sequential conversion.
+		template<typename UTFI, typename UTFO, conversion conv>
+		std::uint64_t transcode_parallel(work_stealing_pool& pool, std::string_view bytes, byte_order in_order,
+			byte_order out_order, std::size_t chunk_size, std::vector<std::string>& outputs)
+		{
+			constexpr std::size_t size = std::is_same_v<UTFI, utf8> ? 1 : sizeof(typename UTFI::char_type);
+			const std::size_t count = bytes.size() / size;
+			const std::size_t chunk_units = std::max<std::size_t>(chunk_size / size, 1);
+			const std::size_t chunks = std::max<std::size_t>((count + chunk_units - 1) / chunk_units, 1);
+
+			std::vector<std::size_t> starts(chunks + 1);
+			for (std::size_t i = 1; i < chunks; ++i) {
+				starts[i] = std::max(starts[i - 1], sync_point<UTFI>(bytes, in_order, i * chunk_units));
+			}
+			starts[chunks] = count;
+
+			outputs.assign(chunks, std::string());
+			std::vector<std::size_t> ends(chunks);
+			std::vector<std::uint64_t> errors(chunks);
+			std::vector<std::exception_ptr> failures(chunks);
+
+			std::atomic<std::size_t> pending{ chunks };
+			for (std::size_t i = 0; i < chunks; ++i)
+			{
+				pool.submit([&, i]()
+				{
+					try
+					{
+						ends[i] = transcode_range<UTFI, UTFO, conv>(bytes, in_order, out_order, starts[i], starts[i + 1], outputs[i], errors[i]);
+					}
+					catch (...)
+					{
+						failures[i] = std::current_exception();
+					}
+					pending.fetch_sub(1, std::memory_order_release);
+				});
+			}
+			pool.wait_until_zero(pending);
+
+			// rethrown once no chunk refers to this frame any more
+			for (const std::exception_ptr& failure : failures)
+			{
+				if (failure) {
+					std::rethrow_exception(failure);
+				}
+			}
+
+			std::uint64_t total = errors[0];
+			for (std::size_t i = 1; i < chunks; ++i)
+			{
+				if (ends[i - 1] != starts[i])
+				{
+					starts[i] = ends[i - 1];
+					outputs[i].clear();
+					errors[i] = 0;
+					ends[i] = transcode_range<UTFI, UTFO, conv>(bytes, in_order, out_order, starts[i],
+						std::max(starts[i], starts[i + 1]), outputs[i], errors[i]);
+				}
+				total += errors[i];
+			}
+			return total;
+		}
+	}
+
+	struct batch_result
+	{
+		std::vector<conversion_result> files;
+		std::uint64_t bytes_read = 0;
+		std::uint64_t bytes_written = 0;
+		std::uint64_t errors = 0;
+		double seconds = 0;
+
+		double throughput() const noexcept {
+			return seconds > 0 ? bytes_read / seconds : 0;
+		}
+	};
+
+	// Converts many files to UTFO on a work-stealing pool. Every file is converted as by
+	// convert_file<UTFO, conv, wrbom>; files larger than 'chunk_size' are split into chunks converted in parallel.
+	template<typename UTFO = default_utf, conversion conv = conversion::strict, write_bom wrbom = write_bom::yes>
+	class batch_converter
+	{
+		static_assert(std::is_same_v<UTFO, utf8> || std::is_same_v<UTFO, utf16> || std::is_same_v<UTFO, utf32>,
+			"batch_converter<UTFO, conv, wrbom> requires UTFO to be one of utf8, utf16, utf32");
+
+	public:
+		static constexpr std::size_t default_chunk_size = 1 << 22;
+
+		explicit batch_converter(byte_order order = std::is_same_v<UTFO, utf8> ? byte_order::none : default_byte_order,
+			unsigned threads = std::thread::hardware_concurrency(), std::size_t chunk_size = default_chunk_size)
+			: order(order), threads(threads), chunk_size(std::max<std::size_t>(chunk_size, 1))
+		{}
+
+		void add(const std::filesystem::path& input, const std::filesystem::path& output)
+		{
+			conversion_result file;
+			file.input = input.string();
+			file.output = output.string();
+			files.push_back(std::move(file));
+		}
+
+		// adds every regular file below 'input', to be written to the same relative path below 'output'
+		std::error_code add_directory(const std::filesystem::path& input, const std::filesystem::path& output)
+		{
+			std::error_code ec;
+			for (std::filesystem::recursive_directory_iterator it(input, ec), end; !ec && it != end; it.increment(ec))
+			{
+				if (it->is_regular_file(ec)) {
+					add(it->path(), output / std::filesystem::relative(it->path(), input, ec));
+				}
+			}
+			return ec;
+		}
+
+		// converts all added files and returns a result per file, in the order they were added
+		batch_result run()
+		{
+			const auto start = std::chrono::steady_clock::now();
+
+			batch_result result;
+			result.files = std::exchange(files, {});
+			{
+				work_stealing_pool pool(threads);
+				std::atomic<std::size_t> pending{ result.files.size() };
+				for (conversion_result& file : result.files)
+				{
+					pool.submit([this, &pool, &pending, &file]()
+					{
+						try
+						{
+							convert(pool, file);
+						}
+						catch (const std::bad_alloc&)
+						{
+							file.error = ENOMEM;
+						}
+						catch (...)
+						{
+							file.error = EIO;
+						}
+						pending.fetch_sub(1, std::memory_order_release);
+					});
+				}
+				pool.wait_until_zero(pending);
+			}
+
+			for (const conversion_result& file : result.files)
+			{
+				result.bytes_read += file.bytes_read;
+				result.bytes_written += file.bytes_written;
+				result.errors += file.errors;
+			}
+			result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			return result;
+		}
+
+	private:
+		byte_order order;
+		unsigned threads;
+		std::size_t chunk_size;
+		std::vector<conversion_result> files;
+
+		static int last_error() noexcept {
+			return errno != 0 ? errno : EIO;
+		}
+
+		void convert(work_stealing_pool& pool, conversion_result& file)
+		{
+			if (std::is_same_v<UTFO, utf8> != (order == byte_order::none))
+			{
+				file.error = EINVAL;
+				return;
+			}
+
+			errno = 0;
+			uistream in(file.input);
+			if (!in.is_open())
+			{
+				file.error = last_error();
+				return;
+			}
+			std::string bytes;
+			in.seekg(0, std::ios::end);
+			bytes.resize(static_cast<std::size_t>(in.tellg()));
+			in.seekg(0, std::ios::beg);
+			in.read(&bytes[0], bytes.size());
+			if (!in)
+			{
+				file.error = last_error();
+				return;
+			}
+			file.bytes_read = bytes.size();
+
+			const encoding encoding = encoding::get(bytes, true);
+
+			std::vector<std::string> outputs;
+			if (bytes.size() <= chunk_size)
+			{
+				block_transcoder<UTFO, conv, wrbom> transcode(encoding, order);
+				outputs.emplace_back();
+				transcode(bytes, outputs.back(), true);
+				file.errors = transcode.stats().errors;
+			}
+			else
+			{
+				switch (encoding.format)
+				{
+				case format::utf32:
+					file.errors = split<utf32>(pool, bytes, encoding.order, outputs);
+					break;
+				case format::utf16:
+					file.errors = split<utf16>(pool, bytes, encoding.order, outputs);
+					break;
+				case format::ascii:
+					file.errors = split<ascii>(pool, bytes, encoding.order, outputs);
+					break;
+				case format::latin1:
+					file.errors = split<latin1>(pool, bytes, encoding.order, outputs);
+					break;
+				case format::windows1252:
+					file.errors = split<windows1252>(pool, bytes, encoding.order, outputs);
+					break;
+				case format::unknown: // assume ASCII, same as utf8 - only one byte
+				case format::utf8:
+					file.errors = split<utf8>(pool, bytes, encoding.order, outputs);
+					break;
+				}
+			}
+
+			std::filesystem::path parent = std::filesystem::path(file.output).parent_path();
+			if (!parent.empty())
+			{
+				std::error_code ec;
+				std::filesystem::create_directories(parent, ec);
+			}
+
+			errno = 0;
+			uostream out(file.output);
+			if (!out.is_open())
+			{
+				file.error = last_error();
+				return;
+			}
+			for (const std::string& output : outputs)
+			{
+				out.write(output.data(), output.size());
+				file.bytes_written += output.size();
+			}
+			out.flush();
+			if (!out) {
+				file.error = last_error();
+			}
+		}
+
+		template<typename UTFI>
+		std::uint64_t split(work_stealing_pool& pool, std::string& bytes, byte_order in_order, std::vector<std::string>& outputs)
+		{
+			constexpr std::size_t size = std::is_same_v<UTFI, utf8> ? 1 : sizeof(typename UTFI::char_type);
+			if (bytes.size() % size != 0) {
+				bytes.resize((bytes.size() / size + 1) * size); // pad like UTFI::read does
+			}
+
+			const std::uint64_t errors = detail::transcode_parallel<UTFI, UTFO, conv>(pool, bytes, in_order, order, chunk_size, outputs);
+
+			if constexpr(wrbom == write_bom::yes)
+			{
+				const std::string_view bom = detail::bom_for<UTFO>(order);
+
+				std::string head;
+				for (std::size_t i = 0; i < outputs.size() && head.size() < bom.size(); ++i) {
+					head.append(outputs[i], 0, bom.size() - head.size());
+				}
+				if (head.compare(0, bom.size(), bom) != 0) {
+					outputs.insert(outputs.begin(), std::string(bom));
+				}
+			}
+			return errors;
+		}
+	};
+}
+
+#endif
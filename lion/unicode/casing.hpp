@@ -0,0 +1,424 @@
+#ifndef LION_UNICODE_CASING_HPP
+#define LION_UNICODE_CASING_HPP
+
+#include "codepoint.hpp"
+#include "validation.hpp"
+#include "utf8.hpp"
+#include "utf16.hpp"
+#include "utf32.hpp"
+#include "hash.hpp"
+#include "tables/casing.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+namespace lion::unicode
+{
+	// whether to_lower maps a capital sigma at the end of a word to U+03C2, as in SpecialCasing.txt
+	enum class final_sigma : bool
+	{
+		no,
+		yes
+	};
+
+	// the maximum number of code units the case mappings write for one code unit of input
+	constexpr std::size_t max_case_expansion = 3;
+
+	namespace detail
+	{
+		enum class case_mapping
+		{
+			lower,
+			upper,
+			fold
+		};
+
+		constexpr const std::int32_t* case_record(codepoint cp) noexcept
+		{
+			if (cp > codepoint_max()) {
+				cp = codepoint_max();
+			}
+			const std::size_t block = case_stage1[cp >> case_shift];
+			return case_records[case_stage2[(block << case_shift) + (cp & ((1u << case_shift) - 1))]];
+		}
+
+		constexpr bool cased(const std::int32_t* record) noexcept {
+			return (record[3] & 8) != 0;
+		}
+
+		constexpr bool case_ignorable(const std::int32_t* record) noexcept {
+			return (record[3] & 16) != 0;
+		}
+
+		// whether the text up to and including record matches Cased Case_Ignorable*, some codepoints are both
+		constexpr bool after_cased_state(bool after_cased, const std::int32_t* record) noexcept {
+			return cased(record) || (after_cased && case_ignorable(record));
+		}
+
+		template<case_mapping mapping>
+		constexpr unsigned char map_ascii(unsigned char c) noexcept
+		{
+			if constexpr(mapping == case_mapping::upper) {
+				return c >= 'a' && c <= 'z' ? static_cast<unsigned char>(c - 0x20) : c;
+			}
+			else {
+				return c >= 'A' && c <= 'Z' ? static_cast<unsigned char>(c + 0x20) : c;
+			}
+		}
+
+		// maps eight ascii characters at once: 0x20 is added to or removed from the letters of the other case
+		template<case_mapping mapping>
+		constexpr std::uint64_t map_ascii(std::uint64_t word) noexcept
+		{
+			constexpr std::uint64_t ones = 0x0101010101010101ull;
+			constexpr unsigned char first = mapping == case_mapping::upper ? 'a' : 'A';
+			const std::uint64_t above_first = word + ones * (0x80 - first);
+			const std::uint64_t above_last = word + ones * (0x7F - (first + 25));
+			return word ^ (((above_first & ~above_last) & (ones * 0x80)) >> 2);
+		}
+
+		// whether [first, last) starts with case ignorable codepoints followed by a cased one
+		template<typename UTF, typename ForwardIterator>
+		bool followed_by_cased(ForwardIterator first, ForwardIterator last)
+		{
+			while (first != last)
+			{
+				codepoint cp;
+				decode_error error;
+				first = UTF::decode(first, last, cp, error);
+				const std::int32_t* record = case_record(cp);
+				if (cased(record)) {
+					return true;
+				}
+				if (!case_ignorable(record)) {
+					return false;
+				}
+			}
+			return false;
+		}
+
+		template<typename UTF, case_mapping mapping, final_sigma sigma, typename ForwardIterator, typename OutputIterator>
+		OutputIterator map_case(ForwardIterator first, ForwardIterator last, OutputIterator output)
+		{
+			constexpr std::size_t field = static_cast<std::size_t>(mapping);
+
+			// for final_sigma::yes, whether the last codepoint which isn't case ignorable is cased
+			bool after_cased = false;
+			while (first != last)
+			{
+				if constexpr(std::is_same_v<UTF, utf8> && std::is_pointer_v<ForwardIterator> && std::is_pointer_v<OutputIterator>)
+				{
+					const ForwardIterator start = first;
+					for (std::uint64_t word; last - first >= 8; first += 8, output += 8)
+					{
+						std::memcpy(&word, first, 8);
+						if ((word & 0x8080808080808080ull) != 0) {
+							break;
+						}
+						word = map_ascii<mapping>(word);
+						std::memcpy(output, &word, 8);
+					}
+					if constexpr(sigma == final_sigma::yes)
+					{
+						for (ForwardIterator it = first; it != start; )
+						{
+							const std::int32_t* record = case_record(static_cast<unsigned char>(*--it));
+							if (!case_ignorable(record))
+							{
+								after_cased = cased(record);
+								break;
+							}
+						}
+					}
+					if (first == last) {
+						break;
+					}
+				}
+
+				const codepoint unit = static_cast<typename UTF::char_type>(*first);
+				if (unit < 0x80)
+				{
+					*output++ = static_cast<typename UTF::string_view_type::value_type>(map_ascii<mapping>(static_cast<unsigned char>(unit)));
+					++first;
+					if constexpr(sigma == final_sigma::yes)
+					{
+						after_cased = after_cased_state(after_cased, case_record(unit));
+					}
+					continue;
+				}
+
+				codepoint cp;
+				decode_error error;
+				first = UTF::decode(first, last, cp, error);
+				const std::int32_t* record = case_record(cp);
+
+				if constexpr(sigma == final_sigma::yes && mapping == case_mapping::lower)
+				{
+					if (cp == 0x03A3 && after_cased && !followed_by_cased<UTF>(first, last))
+					{
+						output = UTF::encode(0x03C2, output);
+						continue;
+					}
+				}
+				if constexpr(sigma == final_sigma::yes)
+				{
+					after_cased = after_cased_state(after_cased, record);
+				}
+
+				if ((record[3] & (1 << field)) != 0)
+				{
+					const std::size_t offset = static_cast<std::size_t>(record[field]) >> 2;
+					const std::size_t length = static_cast<std::size_t>(record[field]) & 3;
+					for (std::size_t i = 0; i < length; ++i) {
+						output = UTF::encode(case_data[offset + i], output);
+					}
+				}
+				else {
+					output = UTF::encode(static_cast<codepoint>(static_cast<std::int32_t>(cp) + record[field]), output);
+				}
+			}
+			return output;
+		}
+
+		template<typename UTF, case_mapping mapping, final_sigma sigma>
+		typename UTF::string_type map_case(typename UTF::string_view_type view)
+		{
+			typename UTF::string_type result(view.size() * max_case_expansion, 0);
+			auto* end = map_case<UTF, mapping, sigma>(view.data(), view.data() + view.size(), &result[0]);
+			result.resize(static_cast<std::size_t>(end - result.data()));
+			return result;
+		}
+	}
+
+	// the full, unconditional case mappings of the unicode standard, ill-formed sequences are replaced with U+FFFD
+	template<typename UTF, final_sigma sigma = final_sigma::no, typename ForwardIterator, typename OutputIterator>
+	OutputIterator to_lower(ForwardIterator first, ForwardIterator last, OutputIterator output) {
+		return detail::map_case<UTF, detail::case_mapping::lower, sigma>(first, last, output);
+	}
+
+	template<typename UTF, typename ForwardIterator, typename OutputIterator>
+	OutputIterator to_upper(ForwardIterator first, ForwardIterator last, OutputIterator output) {
+		return detail::map_case<UTF, detail::case_mapping::upper, final_sigma::no>(first, last, output);
+	}
+
+	template<typename UTF, typename ForwardIterator, typename OutputIterator>
+	OutputIterator case_fold(ForwardIterator first, ForwardIterator last, OutputIterator output) {
+		return detail::map_case<UTF, detail::case_mapping::fold, final_sigma::no>(first, last, output);
+	}
+
+	template<final_sigma sigma = final_sigma::no>
+	utf8::string_type to_lower(utf8::string_view_type view) {
+		return detail::map_case<utf8, detail::case_mapping::lower, sigma>(view);
+	}
+
+	template<final_sigma sigma = final_sigma::no>
+	utf16::string_type to_lower(utf16::string_view_type view) {
+		return detail::map_case<utf16, detail::case_mapping::lower, sigma>(view);
+	}
+
+	template<final_sigma sigma = final_sigma::no>
+	utf32::string_type to_lower(utf32::string_view_type view) {
+		return detail::map_case<utf32, detail::case_mapping::lower, sigma>(view);
+	}
+
+	inline utf8::string_type to_upper(utf8::string_view_type view) {
+		return detail::map_case<utf8, detail::case_mapping::upper, final_sigma::no>(view);
+	}
+
+	inline utf16::string_type to_upper(utf16::string_view_type view) {
+		return detail::map_case<utf16, detail::case_mapping::upper, final_sigma::no>(view);
+	}
+
+	inline utf32::string_type to_upper(utf32::string_view_type view) {
+		return detail::map_case<utf32, detail::case_mapping::upper, final_sigma::no>(view);
+	}
+
+	inline utf8::string_type case_fold(utf8::string_view_type view) {
+		return detail::map_case<utf8, detail::case_mapping::fold, final_sigma::no>(view);
+	}
+
+	inline utf16::string_type case_fold(utf16::string_view_type view) {
+		return detail::map_case<utf16, detail::case_mapping::fold, final_sigma::no>(view);
+	}
+
+	inline utf32::string_type case_fold(utf32::string_view_type view) {
+		return detail::map_case<utf32, detail::case_mapping::fold, final_sigma::no>(view);
+	}
+
+	namespace detail
+	{
+		// the case folding of [first, last), one codepoint at a time
+		template<typename UTF, typename ForwardIterator>
+		class folded_codepoints
+		{
+		public:
+			folded_codepoints(ForwardIterator first, ForwardIterator last)
+				: first_(first), last_(last)
+			{}
+
+			// whether the next codepoint starts at first(), rather than being the rest of a multiple codepoint folding
+			bool aligned() const noexcept { return pending_ == size_; }
+
+			ForwardIterator& first() noexcept { return first_; }
+			ForwardIterator last() const noexcept { return last_; }
+
+			bool next(codepoint& cp)
+			{
+				if (pending_ != size_)
+				{
+					cp = case_data[pending_++];
+					return true;
+				}
+				if (first_ == last_) {
+					return false;
+				}
+
+				decode_error error;
+				first_ = UTF::decode(first_, last_, cp, error);
+				const std::int32_t* record = case_record(cp);
+				if ((record[3] & 4) != 0)
+				{
+					pending_ = static_cast<std::size_t>(record[2]) >> 2;
+					size_ = pending_ + (static_cast<std::size_t>(record[2]) & 3);
+					cp = case_data[pending_++];
+				}
+				else {
+					cp = static_cast<codepoint>(static_cast<std::int32_t>(cp) + record[2]);
+				}
+				return true;
+			}
+
+		private:
+			ForwardIterator first_;
+			ForwardIterator last_;
+			std::size_t pending_ = 0; // the rest of a folding in case_data
+			std::size_t size_ = 0;
+		};
+
+		template<typename UTF1, typename UTF2, typename ForwardIterator1, typename ForwardIterator2>
+		int caseless_compare(ForwardIterator1 first1, ForwardIterator1 last1, ForwardIterator2 first2, ForwardIterator2 last2)
+		{
+			folded_codepoints<UTF1, ForwardIterator1> left(first1, last1);
+			folded_codepoints<UTF2, ForwardIterator2> right(first2, last2);
+			while (true)
+			{
+				if (left.aligned() && right.aligned())
+				{
+					auto& one = left.first();
+					auto& two = right.first();
+					if constexpr(std::is_same_v<UTF1, utf8> && std::is_same_v<UTF2, utf8> && std::is_pointer_v<ForwardIterator1> && std::is_pointer_v<ForwardIterator2>)
+					{
+						for (std::uint64_t a, b; left.last() - one >= 8 && right.last() - two >= 8; one += 8, two += 8)
+						{
+							std::memcpy(&a, one, 8);
+							std::memcpy(&b, two, 8);
+							if (((a | b) & 0x8080808080808080ull) != 0 || map_ascii<case_mapping::fold>(a) != map_ascii<case_mapping::fold>(b)) {
+								break;
+							}
+						}
+					}
+					for (; one != left.last() && two != right.last(); ++one, ++two)
+					{
+						const codepoint a = static_cast<typename UTF1::char_type>(*one);
+						const codepoint b = static_cast<typename UTF2::char_type>(*two);
+						if ((a | b) >= 0x80) {
+							break;
+						}
+						const unsigned char x = map_ascii<case_mapping::fold>(static_cast<unsigned char>(a));
+						const unsigned char y = map_ascii<case_mapping::fold>(static_cast<unsigned char>(b));
+						if (x != y) {
+							return x < y ? -1 : 1;
+						}
+					}
+				}
+
+				codepoint a;
+				codepoint b;
+				const bool more1 = left.next(a);
+				const bool more2 = right.next(b);
+				if (!more1 || !more2) {
+					return static_cast<int>(more1) - static_cast<int>(more2);
+				}
+				if (a != b) {
+					return a < b ? -1 : 1;
+				}
+			}
+		}
+	}
+
+	// compare the full case foldings of two sequences in any encodings, codepoint by codepoint, without allocating
+	template<typename UTF1, typename UTF2, typename ForwardIterator1, typename ForwardIterator2>
+	int caseless_compare(ForwardIterator1 first1, ForwardIterator1 last1, ForwardIterator2 first2, ForwardIterator2 last2) {
+		return detail::caseless_compare<UTF1, UTF2>(first1, last1, first2, last2);
+	}
+
+	template<typename UTF1, typename UTF2, typename ForwardIterator1, typename ForwardIterator2>
+	bool caseless_equal(ForwardIterator1 first1, ForwardIterator1 last1, ForwardIterator2 first2, ForwardIterator2 last2) {
+		return detail::caseless_compare<UTF1, UTF2>(first1, last1, first2, last2) == 0;
+	}
+
+	template<typename Char1, typename Char2>
+	int caseless_compare(std::basic_string_view<Char1> left, std::basic_string_view<Char2> right)
+	{
+		using UTF1 = typename detail::encoding_of<Char1>::type;
+		using UTF2 = typename detail::encoding_of<Char2>::type;
+		return detail::caseless_compare<UTF1, UTF2>(left.data(), left.data() + left.size(), right.data(), right.data() + right.size());
+	}
+
+	template<typename Char1, typename Char2>
+	bool caseless_equal(std::basic_string_view<Char1> left, std::basic_string_view<Char2> right) {
+		return caseless_compare(left, right) == 0;
+	}
+
+	// the codepoint_hash of the full case folding, equal for every encoding of caseless equal sequences
+	template<typename UTF, typename ForwardIterator>
+	std::uint64_t caseless_hash(ForwardIterator first, ForwardIterator last, std::uint64_t seed = 0)
+	{
+		detail::codepoint_hash_state state(seed);
+		detail::folded_codepoints<UTF, ForwardIterator> folded(first, last);
+		while (true)
+		{
+			if (folded.aligned())
+			{
+				auto& it = folded.first();
+				if constexpr(std::is_same_v<UTF, utf8> && std::is_pointer_v<ForwardIterator>)
+				{
+					for (; state.aligned() && folded.last() - it >= 8; it += 8)
+					{
+						std::uint64_t word = 0;
+						for (std::size_t i = 0; i < 8; ++i) {
+							word |= static_cast<std::uint64_t>(static_cast<unsigned char>(it[i])) << (8 * i);
+						}
+						if ((word & 0x8080808080808080ull) != 0) {
+							break;
+						}
+						state.add_ascii(detail::map_ascii<detail::case_mapping::fold>(word));
+					}
+				}
+				for (; it != folded.last(); ++it)
+				{
+					const codepoint unit = static_cast<typename UTF::char_type>(*it);
+					if (unit >= 0x80) {
+						break;
+					}
+					state.add(detail::map_ascii<detail::case_mapping::fold>(static_cast<unsigned char>(unit)));
+				}
+			}
+			codepoint cp;
+			if (!folded.next(cp)) {
+				return state.digest();
+			}
+			state.add(cp);
+		}
+	}
+
+	template<typename Char>
+	std::uint64_t caseless_hash(std::basic_string_view<Char> view, std::uint64_t seed = 0) {
+		return caseless_hash<typename detail::encoding_of<Char>::type>(view.data(), view.data() + view.size(), seed);
+	}
+}
+
+#endif
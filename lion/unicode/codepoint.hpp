@@ -29,6 +29,20 @@ namespace lion::unicode
 	constexpr bool is_BOM(codepoint cp) noexcept {
 		return cp == 0x0000FEFF;
 	}
+
+	namespace detail
+	{
+		// the hangul syllables are composed of jamo algorithmically, for normalization and collation
+		constexpr codepoint hangul_s_base = 0xAC00;
+		constexpr codepoint hangul_l_base = 0x1100;
+		constexpr codepoint hangul_v_base = 0x1161;
+		constexpr codepoint hangul_t_base = 0x11A7;
+		constexpr codepoint hangul_l_count = 19;
+		constexpr codepoint hangul_v_count = 21;
+		constexpr codepoint hangul_t_count = 28;
+		constexpr codepoint hangul_n_count = hangul_v_count * hangul_t_count;
+		constexpr codepoint hangul_s_count = hangul_l_count * hangul_n_count;
+	}
 }
 
 #endif
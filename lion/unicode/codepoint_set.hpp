@@ -0,0 +1,384 @@
+#ifndef LION_UNICODE_CODEPOINT_SET_HPP
+#define LION_UNICODE_CODEPOINT_SET_HPP
+
+#include "codepoint.hpp"
+#include "validation.hpp"
+#include "utf8.hpp"
+#include "utf16.hpp"
+#include "utf32.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace lion::unicode
+{
+	// An immutable set of codepoints over an image of 32-bit words, which codepoint_set builds and which can be written
+	// to a file and mapped back in place. The BMP is a bitmap of 256 codepoint blocks, with identical blocks stored once,
+	// and the codepoints above it are sorted ranges.
+	class codepoint_set_view
+	{
+	public:
+		static constexpr std::uint32_t magic = 0x5343554C; // "LUCS" in little endian
+		static constexpr std::size_t header_words = 5;
+		static constexpr std::size_t index_words = 64;
+
+		codepoint_set_view() noexcept = default;
+
+		// checks an image and makes view refer to it, the image must outlive the view and be aligned to 4 bytes
+		static bool from_image(const void* data, std::size_t size, codepoint_set_view& view) noexcept
+		{
+			if (reinterpret_cast<std::uintptr_t>(data) % alignof(std::uint32_t) != 0 || size % 4 != 0 || size / 4 < header_words + index_words) {
+				return false;
+			}
+			const auto* words = static_cast<const std::uint32_t*>(data);
+			const std::size_t blocks = words[1];
+			const std::size_t boundaries = words[2];
+			if (words[0] != magic || blocks == 0 || blocks > 256 || boundaries % 2 != 0
+				|| size / 4 != header_words + index_words + 8 * blocks + boundaries) {
+				return false;
+			}
+
+			codepoint_set_view result(words);
+			for (std::size_t i = 0; i < 256; ++i)
+			{
+				if (result.index[i] >= blocks) {
+					return false;
+				}
+			}
+			for (std::size_t i = 0; i < boundaries; ++i)
+			{
+				if (result.boundaries[i] <= (i == 0 ? 0xFFFF : result.boundaries[i - 1]) || result.boundaries[i] > 0x110000) {
+					return false;
+				}
+			}
+
+			// the searches skip what is below these, so they have to agree with the bits and the ranges
+			codepoint lowest = 0x110000;
+			codepoint lowest_missing = 0x110000;
+			for (std::size_t i = 0; i < 0x10000 / 32 && (lowest == 0x110000 || lowest_missing == 0x110000); ++i)
+			{
+				const std::uint32_t word = result.bits[8 * result.index[i >> 3] + (i & 7)];
+				if (lowest == 0x110000 && word != 0) {
+					lowest = static_cast<codepoint>(32 * i + lowest_bit(word));
+				}
+				if (lowest_missing == 0x110000 && word != 0xFFFFFFFF) {
+					lowest_missing = static_cast<codepoint>(32 * i + lowest_bit(~word));
+				}
+			}
+			if (lowest == 0x110000 && boundaries != 0) {
+				lowest = result.boundaries[0];
+			}
+			if (lowest_missing == 0x110000) {
+				lowest_missing = boundaries != 0 && result.boundaries[0] == 0x10000 ? result.boundaries[1] : 0x10000;
+			}
+			if (words[3] != lowest || words[4] != lowest_missing) {
+				return false;
+			}
+
+			view = result;
+			return true;
+		}
+
+		const void* image() const noexcept { return words; }
+		std::size_t image_size() const noexcept { return 4 * image_words; }
+
+		bool contains(codepoint cp) const noexcept
+		{
+			if (cp < 0x10000) {
+				return ((bits[8 * index[cp >> 8] + ((cp >> 5) & 7)] >> (cp & 31)) & 1) != 0;
+			}
+			// inside a range after an odd number of boundaries
+			return ((std::upper_bound(boundaries, boundaries + boundary_count, cp) - boundaries) & 1) != 0;
+		}
+
+		bool empty() const noexcept { return lowest == 0x110000; }
+
+		// the first codepoint of [first, last) which is in the set, ill-formed sequences are tested as U+FFFD
+		template<typename UTF, typename ForwardIterator>
+		ForwardIterator find_first_in(ForwardIterator first, ForwardIterator last) const {
+			return find<UTF, true>(first, last);
+		}
+
+		template<typename UTF, typename ForwardIterator>
+		ForwardIterator find_first_not_in(ForwardIterator first, ForwardIterator last) const {
+			return find<UTF, false>(first, last);
+		}
+
+		template<typename UTF, typename ForwardIterator>
+		bool any_in(ForwardIterator first, ForwardIterator last) const {
+			return find_first_in<UTF>(first, last) != last;
+		}
+
+		template<typename UTF, typename ForwardIterator>
+		bool all_in(ForwardIterator first, ForwardIterator last) const {
+			return find_first_not_in<UTF>(first, last) == last;
+		}
+
+		// the offset of the first codepoint which is in the set, or npos
+		std::size_t find_first_in(utf8::string_view_type view) const { return offset(view, find_first_in<utf8>(view.data(), view.data() + view.size())); }
+		std::size_t find_first_in(utf16::string_view_type view) const { return offset(view, find_first_in<utf16>(view.data(), view.data() + view.size())); }
+		std::size_t find_first_in(utf32::string_view_type view) const { return offset(view, find_first_in<utf32>(view.data(), view.data() + view.size())); }
+
+		std::size_t find_first_not_in(utf8::string_view_type view) const { return offset(view, find_first_not_in<utf8>(view.data(), view.data() + view.size())); }
+		std::size_t find_first_not_in(utf16::string_view_type view) const { return offset(view, find_first_not_in<utf16>(view.data(), view.data() + view.size())); }
+		std::size_t find_first_not_in(utf32::string_view_type view) const { return offset(view, find_first_not_in<utf32>(view.data(), view.data() + view.size())); }
+
+		bool any_in(utf8::string_view_type view) const { return find_first_in(view) != utf8::string_view_type::npos; }
+		bool any_in(utf16::string_view_type view) const { return find_first_in(view) != utf16::string_view_type::npos; }
+		bool any_in(utf32::string_view_type view) const { return find_first_in(view) != utf32::string_view_type::npos; }
+
+		bool all_in(utf8::string_view_type view) const { return find_first_not_in(view) == utf8::string_view_type::npos; }
+		bool all_in(utf16::string_view_type view) const { return find_first_not_in(view) == utf16::string_view_type::npos; }
+		bool all_in(utf32::string_view_type view) const { return find_first_not_in(view) == utf32::string_view_type::npos; }
+
+	private:
+		friend class codepoint_set;
+
+		explicit codepoint_set_view(const std::uint32_t* words) noexcept
+			: words(words),
+			image_words(header_words + index_words + 8 * words[1] + words[2]),
+			index(reinterpret_cast<const unsigned char*>(words + header_words)),
+			bits(words + header_words + index_words),
+			boundaries(bits + 8 * words[1]),
+			boundary_count(words[2]),
+			lowest(words[3]),
+			lowest_missing(words[4])
+		{}
+
+		// the image of the empty set
+		static inline const std::uint32_t empty_image[header_words + index_words + 8] = { magic, 1, 0, 0x110000, 0 };
+
+		const std::uint32_t* words = empty_image;
+		std::size_t image_words = header_words + index_words + 8;
+		const unsigned char* index = reinterpret_cast<const unsigned char*>(empty_image + header_words);
+		const std::uint32_t* bits = empty_image + header_words + index_words;
+		const std::uint32_t* boundaries = nullptr;
+		std::size_t boundary_count = 0;
+		codepoint lowest = 0x110000;  // the first codepoint in the set
+		codepoint lowest_missing = 0; // the first codepoint which isn't
+
+		// the index of the lowest set bit of word, which isn't zero
+		static unsigned lowest_bit(std::uint32_t word) noexcept
+		{
+			unsigned bit = 0;
+			for (; (word & 1) == 0; word >>= 1) {
+				++bit;
+			}
+			return bit;
+		}
+
+		template<typename View, typename Pointer>
+		static std::size_t offset(View view, Pointer position) noexcept {
+			return position == view.data() + view.size() ? View::npos : static_cast<std::size_t>(position - view.data());
+		}
+
+		// whether the eight code units at units are whole codepoints below threshold
+		template<typename UTF, typename Unit>
+		static bool is_below(const Unit* units, codepoint threshold) noexcept
+		{
+			if constexpr(std::is_same_v<UTF, utf8>)
+			{
+				// with the high bit of every byte set, a byte minus the threshold keeps it if the byte isn't below
+				constexpr std::uint64_t ones = 0x0101010101010101ull;
+				constexpr std::uint64_t high = 0x8080808080808080ull;
+				std::uint64_t word;
+				std::memcpy(&word, units, 8);
+				return (((word | high) - ones * std::min<codepoint>(threshold, 0x80)) & high) == 0 && (word & high) == 0;
+			}
+			else
+			{
+				// surrogates and units above the codespace are decoded as U+FFFD, so they are never skipped
+				threshold = std::min<codepoint>(threshold, std::is_same_v<UTF, utf16> ? 0xD800 : 0x110000);
+				bool below = true;
+				for (std::size_t i = 0; i < 8; ++i)
+				{
+					const codepoint unit = static_cast<typename UTF::char_type>(units[i]);
+					below &= unit < threshold;
+					if constexpr(std::is_same_v<UTF, utf32>) {
+						below &= (unit & 0xFFFFF800) != 0xD800;
+					}
+				}
+				return below;
+			}
+		}
+
+		template<typename UTF, bool member, typename ForwardIterator>
+		ForwardIterator find(ForwardIterator first, ForwardIterator last) const
+		{
+			// nothing below the threshold is a member (or a non member), so whole blocks of it are skipped
+			const codepoint threshold = member ? lowest : lowest_missing;
+			while (first != last)
+			{
+				if constexpr(std::is_pointer_v<ForwardIterator>)
+				{
+					for (; last - first >= 8 && is_below<UTF>(first, threshold); first += 8)
+					{}
+					if (first == last) {
+						break;
+					}
+				}
+
+				codepoint cp = static_cast<typename UTF::char_type>(*first);
+				ForwardIterator next = first;
+				if (cp < 0x80) {
+					++next;
+				}
+				else
+				{
+					decode_error error;
+					next = UTF::decode(first, last, cp, error);
+				}
+				if (contains(cp) == member) {
+					break;
+				}
+				first = next;
+			}
+			return first;
+		}
+	};
+
+	class codepoint_set : public codepoint_set_view
+	{
+	public:
+		codepoint_set()
+			: codepoint_set(std::vector<std::pair<codepoint, codepoint>>())
+		{}
+
+		// the union of inclusive ranges, in any order
+		codepoint_set(std::initializer_list<std::pair<codepoint, codepoint>> ranges)
+			: codepoint_set(std::vector<std::pair<codepoint, codepoint>>(ranges))
+		{}
+
+		template<typename InputIterator>
+		codepoint_set(InputIterator first, InputIterator last)
+			: codepoint_set(std::vector<std::pair<codepoint, codepoint>>(first, last))
+		{}
+
+		explicit codepoint_set(std::vector<std::pair<codepoint, codepoint>> ranges)
+			: codepoint_set(build(std::move(ranges)))
+		{}
+
+		// a copy of an image, which needs no alignment
+		static bool from_image(const void* data, std::size_t size, codepoint_set& set)
+		{
+			if (size % 4 != 0 || size / 4 < header_words + index_words) {
+				return false;
+			}
+			std::vector<std::uint32_t> words(size / 4);
+			std::memcpy(words.data(), data, size);
+			codepoint_set_view view;
+			if (!codepoint_set_view::from_image(words.data(), size, view)) {
+				return false;
+			}
+			set = codepoint_set(std::move(words));
+			return true;
+		}
+
+		codepoint_set(const codepoint_set& other)
+			: codepoint_set(std::vector<std::uint32_t>(other.words))
+		{}
+
+		codepoint_set(codepoint_set&& other) noexcept
+			: codepoint_set(std::move(other.words))
+		{
+			other.codepoint_set_view::operator=(codepoint_set_view());
+		}
+
+		codepoint_set& operator=(const codepoint_set& other)
+		{
+			if (this != &other) {
+				*this = codepoint_set(other);
+			}
+			return *this;
+		}
+
+		codepoint_set& operator=(codepoint_set&& other) noexcept
+		{
+			words = std::move(other.words);
+			codepoint_set_view::operator=(codepoint_set_view(words.data()));
+			other.codepoint_set_view::operator=(codepoint_set_view());
+			return *this;
+		}
+
+		const codepoint_set_view& view() const noexcept { return *this; }
+
+	private:
+		std::vector<std::uint32_t> words;
+
+		explicit codepoint_set(std::vector<std::uint32_t>&& image) noexcept
+			: codepoint_set_view(image.data()),
+			words(std::move(image))
+		{}
+
+		static std::vector<std::uint32_t> build(std::vector<std::pair<codepoint, codepoint>> ranges)
+		{
+			// sorted, clamped and merged
+			for (auto& range : ranges) {
+				range.second = std::min<codepoint>(range.second, 0x10FFFF);
+			}
+			ranges.erase(std::remove_if(ranges.begin(), ranges.end(), [](const auto& range) { return range.first > range.second; }), ranges.end());
+			std::sort(ranges.begin(), ranges.end());
+			std::vector<std::pair<codepoint, codepoint>> merged;
+			for (const auto& range : ranges)
+			{
+				if (!merged.empty() && range.first <= merged.back().second + 1) {
+					merged.back().second = std::max(merged.back().second, range.second);
+				}
+				else {
+					merged.push_back(range);
+				}
+			}
+
+			std::vector<std::uint32_t> bitmap(0x10000 / 32);
+			std::vector<std::uint32_t> boundaries;
+			for (const auto& [low, high] : merged)
+			{
+				for (codepoint cp = low; cp <= std::min<codepoint>(high, 0xFFFF); ++cp) {
+					bitmap[cp >> 5] |= std::uint32_t(1) << (cp & 31);
+				}
+				if (high >= 0x10000)
+				{
+					boundaries.push_back(std::max<codepoint>(low, 0x10000));
+					boundaries.push_back(high + 1);
+				}
+			}
+
+			codepoint lowest = merged.empty() ? 0x110000 : merged.front().first;
+			codepoint lowest_missing = merged.empty() || merged.front().first != 0 ? 0 : merged.front().second + 1;
+
+			std::vector<std::uint32_t> image(header_words + index_words);
+			std::vector<std::uint32_t> blocks;
+			unsigned char index[256];
+			for (std::size_t block = 0; block < 256; ++block)
+			{
+				const std::uint32_t* bits = bitmap.data() + 8 * block;
+				std::size_t found = 0;
+				while (found < blocks.size() / 8 && !std::equal(bits, bits + 8, blocks.begin() + 8 * found)) {
+					++found;
+				}
+				if (found == blocks.size() / 8) {
+					blocks.insert(blocks.end(), bits, bits + 8);
+				}
+				index[block] = static_cast<unsigned char>(found);
+			}
+
+			image[0] = magic;
+			image[1] = static_cast<std::uint32_t>(blocks.size() / 8);
+			image[2] = static_cast<std::uint32_t>(boundaries.size());
+			image[3] = lowest;
+			image[4] = lowest_missing;
+			std::memcpy(image.data() + header_words, index, sizeof(index));
+			image.insert(image.end(), blocks.begin(), blocks.end());
+			image.insert(image.end(), boundaries.begin(), boundaries.end());
+			return image;
+		}
+	};
+}
+
+#endif
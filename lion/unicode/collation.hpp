@@ -0,0 +1,237 @@
+#ifndef LION_UNICODE_COLLATION_HPP
+#define LION_UNICODE_COLLATION_HPP
+
+#include "codepoint.hpp"
+#include "validation.hpp"
+#include "utf8.hpp"
+#include "utf16.hpp"
+#include "utf32.hpp"
+#include "tables/collation.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+
+namespace lion::unicode
+{
+	// the levels of the collation elements which are compared
+	enum class collation_strength : unsigned char
+	{
+		primary = 1,   // base letters
+		secondary = 2, // and accents
+		tertiary = 3   // and case and variants
+	};
+
+	// the size of a sort key is at most this many bytes per code unit of the input, plus the level separators: a code unit
+	// has at most the elements of a whole codepoint, each of which writes 2 primary, 2 secondary and 1 tertiary bytes
+	constexpr std::size_t max_sort_key_per_unit = detail::collation_longest_expansion * (2 + 2 + 1);
+
+	namespace detail
+	{
+		constexpr std::uint32_t collation_value(codepoint cp) noexcept
+		{
+			if (cp > codepoint_max()) {
+				cp = codepoint_max();
+			}
+			const std::size_t block = collation_stage1[cp >> collation_shift];
+			return collation_stage2[(block << collation_shift) + (cp & ((1u << collation_shift) - 1))];
+		}
+
+		// the longest contraction which starts with cp and continues at first, whose value replaces that of cp
+		template<typename UTF, typename ForwardIterator>
+		std::uint32_t match_contraction(codepoint cp, std::uint32_t value, ForwardIterator& first, ForwardIterator last)
+		{
+			if (first == last) {
+				return value;
+			}
+			const auto* it = std::lower_bound(std::begin(collation_contractions), std::end(collation_contractions), cp,
+				[](const std::uint32_t (&row)[4], codepoint c) { return row[0] < c; });
+
+			codepoint second;
+			decode_error error;
+			const ForwardIterator after_second = UTF::decode(first, last, second, error);
+			ForwardIterator after_third = after_second;
+			codepoint third = 0;
+			bool decoded = false;
+			bool matched = false;
+			for (; it != std::end(collation_contractions) && (*it)[0] == cp; ++it)
+			{
+				if ((*it)[1] != second) {
+					continue;
+				}
+				if ((*it)[2] == 0)
+				{
+					value = (*it)[3];
+					matched = true;
+					continue;
+				}
+				if (!decoded)
+				{
+					if (after_second == last) {
+						break;
+					}
+					after_third = UTF::decode(after_second, last, third, error);
+					decoded = true;
+				}
+				if ((*it)[2] == third)
+				{
+					first = after_third;
+					return (*it)[3];
+				}
+			}
+			if (matched) {
+				first = after_second;
+			}
+			return value;
+		}
+
+		template<typename Function>
+		void collation_elements_of(codepoint cp, std::uint32_t value, Function& function)
+		{
+			if (const std::size_t count = (value >> 1) & 31; count != 0)
+			{
+				const std::uint32_t* elements = collation_elements + (value >> 6);
+				for (std::size_t i = 0; i < count; ++i) {
+					function(elements[i]);
+				}
+				return;
+			}
+
+			// hangul syllables have the elements of their jamo
+			if (cp >= hangul_s_base && cp < hangul_s_base + hangul_s_count)
+			{
+				const codepoint index = cp - hangul_s_base;
+				const codepoint t = index % hangul_t_count;
+				collation_elements_of(hangul_l_base + index / hangul_n_count, collation_value(hangul_l_base + index / hangul_n_count), function);
+				collation_elements_of(hangul_v_base + (index % hangul_n_count) / hangul_t_count, collation_value(hangul_v_base + (index % hangul_n_count) / hangul_t_count), function);
+				if (t != 0) {
+					collation_elements_of(hangul_t_base + t, collation_value(hangul_t_base + t), function);
+				}
+				return;
+			}
+
+			// everything else has implicit weights, from its script or from the codepoint
+			std::uint32_t first = 0xFBC0 + (cp >> 15);
+			std::uint32_t second = (cp & 0x7FFF) | 0x8000;
+			for (const auto& range : collation_implicit_blocks)
+			{
+				if (cp >= range[0] && cp <= range[1])
+				{
+					first = range[2];
+					second = (cp - range[0]) | 0x8000;
+				}
+			}
+			for (const auto& range : collation_ideographs)
+			{
+				if (cp >= range[0] && cp <= range[1]) {
+					first = range[2] + (cp >> 15);
+				}
+			}
+			function((first << 16) | (0x20 << 5) | 0x02);
+			function(second << 16);
+		}
+
+		// calls function with every collation element of [first, last), without normalizing it
+		template<typename UTF, typename ForwardIterator, typename Function>
+		void for_each_collation_element(ForwardIterator first, ForwardIterator last, Function&& function)
+		{
+			while (first != last)
+			{
+				codepoint cp = static_cast<typename UTF::char_type>(*first);
+				std::uint32_t value;
+				if (cp < 0x80)
+				{
+					// the ascii block is the first of the trie
+					value = collation_stage2[cp];
+					++first;
+				}
+				else
+				{
+					decode_error error;
+					first = UTF::decode(first, last, cp, error);
+					value = collation_value(cp);
+				}
+				if ((value & 1) != 0) {
+					value = match_contraction<UTF>(cp, value, first, last);
+				}
+				collation_elements_of(cp, value, function);
+			}
+		}
+	}
+
+	// writes the sort key of [first, last) in the root collation of the UCA, with non-ignorable variable weighting:
+	// comparing two sort keys with memcmp orders their text like comparing the text with the collation algorithm
+	template<typename UTF, collation_strength strength = collation_strength::tertiary, typename ForwardIterator, typename OutputIterator>
+	OutputIterator sort_key(ForwardIterator first, ForwardIterator last, OutputIterator output)
+	{
+		// one pass over the input per level, the weights of each level are written after those of the previous one
+		detail::for_each_collation_element<UTF>(first, last, [&output](std::uint32_t element)
+		{
+			if (const std::uint32_t primary = element >> 16; primary != 0)
+			{
+				*output++ = static_cast<unsigned char>(primary >> 8);
+				*output++ = static_cast<unsigned char>(primary);
+			}
+		});
+		if constexpr(strength >= collation_strength::secondary)
+		{
+			*output++ = 0;
+			*output++ = 0;
+			detail::for_each_collation_element<UTF>(first, last, [&output](std::uint32_t element)
+			{
+				if (const std::uint32_t secondary = (element >> 5) & 0x7FF; secondary != 0)
+				{
+					*output++ = static_cast<unsigned char>(secondary >> 8);
+					*output++ = static_cast<unsigned char>(secondary);
+				}
+			});
+		}
+		if constexpr(strength >= collation_strength::tertiary)
+		{
+			*output++ = 0;
+			*output++ = 0;
+			detail::for_each_collation_element<UTF>(first, last, [&output](std::uint32_t element)
+			{
+				if (const std::uint32_t tertiary = element & 0x1F; tertiary != 0) {
+					*output++ = static_cast<unsigned char>(tertiary);
+				}
+			});
+		}
+		return output;
+	}
+
+	constexpr std::size_t max_sort_key_size(std::size_t units) noexcept {
+		return units * max_sort_key_per_unit + 4;
+	}
+
+	template<collation_strength strength = collation_strength::tertiary>
+	std::string sort_key(utf8::string_view_type view)
+	{
+		std::string key;
+		key.reserve(2 * view.size() + 4);
+		sort_key<utf8, strength>(view.begin(), view.end(), std::back_inserter(key));
+		return key;
+	}
+
+	template<collation_strength strength = collation_strength::tertiary>
+	std::string sort_key(utf16::string_view_type view)
+	{
+		std::string key;
+		key.reserve(2 * view.size() + 4);
+		sort_key<utf16, strength>(view.begin(), view.end(), std::back_inserter(key));
+		return key;
+	}
+
+	template<collation_strength strength = collation_strength::tertiary>
+	std::string sort_key(utf32::string_view_type view)
+	{
+		std::string key;
+		key.reserve(2 * view.size() + 4);
+		sort_key<utf32, strength>(view.begin(), view.end(), std::back_inserter(key));
+		return key;
+	}
+}
+
+#endif
@@ -0,0 +1,155 @@
+#ifndef LION_UNICODE_COMPARE_HPP
+#define LION_UNICODE_COMPARE_HPP
+
+#include "codepoint.hpp"
+#include "validation.hpp"
+#include "utf8.hpp"
+#include "utf16.hpp"
+#include "utf32.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+namespace lion::unicode
+{
+	namespace detail
+	{
+		// whether a code unit is a whole codepoint by itself
+		template<typename UTF>
+		constexpr bool is_whole(codepoint unit) noexcept
+		{
+			if constexpr(std::is_same_v<UTF, utf8>) {
+				return unit < 0x80;
+			}
+			else if constexpr(std::is_same_v<UTF, utf16>) {
+				return !is_surrogate(unit);
+			}
+			else {
+				return is_valid(unit);
+			}
+		}
+
+		// whether the eight code units at units are whole codepoints
+		template<typename UTF, typename Unit>
+		bool is_whole_block(const Unit* units) noexcept
+		{
+			if constexpr(std::is_same_v<UTF, utf8>)
+			{
+				std::uint64_t word;
+				std::memcpy(&word, units, 8);
+				return (word & 0x8080808080808080ull) == 0;
+			}
+			else
+			{
+				bool whole = true;
+				for (std::size_t i = 0; i < 8; ++i) {
+					whole &= is_whole<UTF>(static_cast<typename UTF::char_type>(units[i]));
+				}
+				return whole;
+			}
+		}
+
+		// advances both sequences up to their first different codepoint, and returns the sign of the difference, or zero if
+		// one of them ended before
+		template<typename UTF1, typename UTF2, typename ForwardIterator1, typename ForwardIterator2>
+		int compare_prefix(ForwardIterator1& first1, ForwardIterator1 last1, ForwardIterator2& first2, ForwardIterator2 last2)
+		{
+			while (first1 != last1 && first2 != last2)
+			{
+				if constexpr(std::is_pointer_v<ForwardIterator1> && std::is_pointer_v<ForwardIterator2>)
+				{
+					// eight codepoints at a time while both sides are ascii, or outside of the surrogates in utf16 and utf32
+					for (; last1 - first1 >= 8 && last2 - first2 >= 8; first1 += 8, first2 += 8)
+					{
+						if (!is_whole_block<UTF1>(first1) || !is_whole_block<UTF2>(first2)) {
+							break;
+						}
+						for (std::size_t i = 0; i < 8; ++i)
+						{
+							const codepoint a = static_cast<typename UTF1::char_type>(first1[i]);
+							const codepoint b = static_cast<typename UTF2::char_type>(first2[i]);
+							if (a != b)
+							{
+								first1 += i;
+								first2 += i;
+								return a < b ? -1 : 1;
+							}
+						}
+					}
+					if (first1 == last1 || first2 == last2) {
+						break;
+					}
+				}
+
+				codepoint a = static_cast<typename UTF1::char_type>(*first1);
+				codepoint b = static_cast<typename UTF2::char_type>(*first2);
+				if (is_whole<UTF1>(a) && is_whole<UTF2>(b))
+				{
+					if (a != b) {
+						return a < b ? -1 : 1;
+					}
+					++first1;
+					++first2;
+					continue;
+				}
+
+				decode_error error;
+				const ForwardIterator1 next1 = UTF1::decode(first1, last1, a, error);
+				const ForwardIterator2 next2 = UTF2::decode(first2, last2, b, error);
+				if (a != b) {
+					return a < b ? -1 : 1;
+				}
+				first1 = next1;
+				first2 = next2;
+			}
+			return 0;
+		}
+	}
+
+	// compare two sequences in any encodings by their codepoints, ill-formed sequences are compared as U+FFFD
+	template<typename UTF1, typename UTF2, typename ForwardIterator1, typename ForwardIterator2>
+	int compare(ForwardIterator1 first1, ForwardIterator1 last1, ForwardIterator2 first2, ForwardIterator2 last2)
+	{
+		if (const int order = detail::compare_prefix<UTF1, UTF2>(first1, last1, first2, last2); order != 0) {
+			return order;
+		}
+		return static_cast<int>(first1 != last1) - static_cast<int>(first2 != last2);
+	}
+
+	template<typename UTF1, typename UTF2, typename ForwardIterator1, typename ForwardIterator2>
+	bool equal(ForwardIterator1 first1, ForwardIterator1 last1, ForwardIterator2 first2, ForwardIterator2 last2) {
+		return compare<UTF1, UTF2>(first1, last1, first2, last2) == 0;
+	}
+
+	// whether the codepoints of [first1, last1) start with those of [first2, last2)
+	template<typename UTF1, typename UTF2, typename ForwardIterator1, typename ForwardIterator2>
+	bool starts_with(ForwardIterator1 first1, ForwardIterator1 last1, ForwardIterator2 first2, ForwardIterator2 last2) {
+		return detail::compare_prefix<UTF1, UTF2>(first1, last1, first2, last2) == 0 && first2 == last2;
+	}
+
+	template<typename Char1, typename Char2>
+	int compare(std::basic_string_view<Char1> left, std::basic_string_view<Char2> right)
+	{
+		using UTF1 = typename detail::encoding_of<Char1>::type;
+		using UTF2 = typename detail::encoding_of<Char2>::type;
+		return compare<UTF1, UTF2>(left.data(), left.data() + left.size(), right.data(), right.data() + right.size());
+	}
+
+	template<typename Char1, typename Char2>
+	bool equal(std::basic_string_view<Char1> left, std::basic_string_view<Char2> right) {
+		return compare(left, right) == 0;
+	}
+
+	template<typename Char1, typename Char2>
+	bool starts_with(std::basic_string_view<Char1> view, std::basic_string_view<Char2> prefix)
+	{
+		using UTF1 = typename detail::encoding_of<Char1>::type;
+		using UTF2 = typename detail::encoding_of<Char2>::type;
+		return starts_with<UTF1, UTF2>(view.data(), view.data() + view.size(), prefix.data(), prefix.data() + prefix.size());
+	}
+}
+
+#endif
@@ -35,7 +35,10 @@ namespace lion::unicode
 		utf32,
 		utf16,
 		utf8,
-		unknown
+		unknown,
+		ascii,
+		latin1,      // ISO-8859-1
+		windows1252
 	};
 
 	enum class byte_order : char16_t
@@ -47,16 +50,100 @@ namespace lion::unicode
 
 	struct encoding
 	{
-		format format = format::unknown;
-		byte_order order = byte_order::none;
+		unicode::format format = unicode::format::unknown;
+		unicode::byte_order order = unicode::byte_order::none;
+
+		// the bytes at the beginning of a file which get() looks at to tell utf8 from legacy text: 4 KiB and the rest of a
+		// sequence which is cut off there
+		static constexpr std::size_t sample_size = 4096 + 3;
+
+		// whether bytes look like utf8: they do unless they have more ill-formed sequences than well-formed multibyte
+		// ones, so that a stray byte doesn't turn utf8 text into legacy text; unless the bytes are complete, a sequence
+		// cut off at their end is accepted, as the rest of it follows them
+		static bool looks_like_utf8(std::string_view bytes, bool complete) noexcept
+		{
+			std::size_t multibyte = 0;
+			std::size_t ill_formed = 0;
+			std::string_view::size_type i = 0;
+			while (i < bytes.size())
+			{
+				const unsigned char byte = static_cast<unsigned char>(bytes[i]);
+				std::string_view::size_type trailing = 0;
+				unsigned char low = 0x80;
+				unsigned char high = 0xBF;
+				if (byte < 0x80)
+				{
+					++i;
+					continue;
+				}
+				else if (byte >= 0xC2 && byte <= 0xDF) {
+					trailing = 1;
+				}
+				else if (byte >= 0xE0 && byte <= 0xEF)
+				{
+					trailing = 2;
+					low = byte == 0xE0 ? 0xA0 : 0x80;
+					high = byte == 0xED ? 0x9F : 0xBF;
+				}
+				else if (byte >= 0xF0 && byte <= 0xF4)
+				{
+					trailing = 3;
+					low = byte == 0xF0 ? 0x90 : 0x80;
+					high = byte == 0xF4 ? 0x8F : 0xBF;
+				}
+				else
+				{
+					++ill_formed;
+					++i;
+					continue;
+				}
+
+				// the sequence ends at the first byte which doesn't continue it
+				std::string_view::size_type j = 1;
+				for (; j <= trailing && i + j < bytes.size(); ++j)
+				{
+					const unsigned char next = static_cast<unsigned char>(bytes[i + j]);
+					if (next < (j == 1 ? low : 0x80) || next > (j == 1 ? high : 0xBF)) {
+						break;
+					}
+				}
+				if (j > trailing) {
+					++multibyte;
+				}
+				else if (i + j < bytes.size() || complete) {
+					++ill_formed;
+				}
+				i += j;
+			}
+			return ill_formed <= multibyte;
+		}
 
 		static encoding get(uistream& in)
 		{
-			char bytes[4] = { 0, 0, 0, 0 };
-			in.read(bytes, 4);
+			// one byte more than the sample tells whether the file goes on after it
+			std::string head(sample_size + 1, '\0');
+			in.seekg(0, std::ios::beg);
+			in.read(&head[0], head.size());
+			head.resize(static_cast<std::string::size_type>(in.gcount()));
 
-			// in.read() will set failbit if there are less than 4 bytes in the file
+			// in.read() will set failbit if the file is shorter than head
 			in.clear();
+			in.seekg(0, std::ios::beg);
+
+			return get(head, head.size() <= sample_size);
+		}
+
+		// 'head' is the beginning of the file - at least its first 100 bytes, or all of it if it is shorter
+		static encoding get(std::string_view head)
+		{
+			return get(head, head.size() < 100);
+		}
+
+		// 'head' is the beginning of the file, and all of it if 'complete'
+		static encoding get(std::string_view head, bool complete)
+		{
+			char bytes[4] = { 0, 0, 0, 0 };
+			head.copy(bytes, 4);
 
 			if (constants::UTF32_LE_BOM.compare(0, 4, bytes, 4) == 0) {
 				return encoding{ format::utf32, byte_order::little };
@@ -75,26 +162,33 @@ namespace lion::unicode
 			}
 			else
 			{
-				std::string segment;
-				in.seekg(0, std::ios::end);
-				if (in.tellg() <= 100) {
-					segment.resize((in.tellg() / 4) * 4); // previous divisible by 4
+				std::string_view segment;
+				if (head.size() <= 100) {
+					segment = head.substr(0, (head.size() / 4) * 4); // previous divisible by 4
 				}
 				else {
-					segment.resize(100);
+					segment = head.substr(0, 100);
 				}
 
-				in.seekg(0, std::ios::beg);
-				in.read(&segment[0], segment.size());
-				in.seekg(0, std::ios::beg);
-
-				if (segment.find('\0') == std::string::npos) {
-					return encoding{ format::utf8 };
+				if (segment.find('\0') == std::string_view::npos)
+				{
+					const std::string_view sample = head.substr(0, sample_size);
+					if (looks_like_utf8(sample, complete && head.size() <= sample_size)) {
+						return encoding{ format::utf8 };
+					}
+					// legacy text: the bytes 0x80..0x9F are C1 controls in latin1 but printable in windows1252
+					for (const char c : sample)
+					{
+						if (static_cast<unsigned char>(c) >= 0x80 && static_cast<unsigned char>(c) <= 0x9F) {
+							return encoding{ format::windows1252 };
+						}
+					}
+					return encoding{ format::latin1 };
 				}
-				if (segment.find("\0\0", 0, 2) == std::string::npos)
+				if (segment.find("\0\0", 0, 2) == std::string_view::npos)
 				{
 					bool big = true;
-					for (std::string::size_type i = 0; i < segment.size(); ++i)
+					for (std::string_view::size_type i = 0; i < segment.size(); ++i)
 					{
 						if (segment[i] == 0)
 						{
@@ -111,7 +205,7 @@ namespace lion::unicode
 				else
 				{
 					bool big = true;
-					for (std::string::size_type i = 0; i < segment.size(); i += 4)
+					for (std::string_view::size_type i = 0; i < segment.size(); i += 4)
 					{
 						if ((!segment[i + 0] && !segment[i + 1] && !segment[i + 2]) ||
 							(!segment[i + 0] && !segment[i + 1]) ||
@@ -0,0 +1,218 @@
+#ifndef LION_UNICODE_ERROR_POLICY_HPP
+#define LION_UNICODE_ERROR_POLICY_HPP
+
+#include "codepoint.hpp"
+#include "validation.hpp"
+#include "utf8.hpp"
+#include "utf16.hpp"
+#include "utf32.hpp"
+#include "compare.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace lion::unicode
+{
+	// what transcode does with an ill-formed sequence: the policy is a type, so that a conversion only contains the
+	// handling it uses
+	struct replace_errors {}; // writes U+FFFD, like conversion::strict
+	struct skip_errors {};    // writes nothing
+	struct stop_on_error {};  // stops before the sequence
+
+	// writes each byte of an ill-formed utf8 sequence as the lone surrogate U+DC80..U+DCFF, and these surrogates back as
+	// the bytes when the output is utf8, so that any bytes survive a round trip through utf16 or utf32; other ill-formed
+	// sequences are replaced with U+FFFD
+	struct escape_errors {};
+
+	enum class error_action
+	{
+		replace,
+		skip,
+		stop
+	};
+
+	// calls handler(offset, error) with the offset of the sequence in code units of the input, and does what it returns
+	template<typename Handler>
+	struct handle_errors
+	{
+		Handler handler;
+	};
+
+	template<typename Handler>
+	handle_errors(Handler) -> handle_errors<Handler>;
+
+	template<typename ForwardIterator, typename OutputIterator>
+	struct transcode_result
+	{
+		ForwardIterator next;   // last, or the ill-formed sequence transcode stopped before
+		OutputIterator output;
+		std::size_t errors = 0; // the ill-formed sequences found, including the one transcode stopped before
+	};
+
+	namespace detail
+	{
+		template<typename Policy>
+		struct is_handler_policy : std::false_type {};
+
+		template<typename Handler>
+		struct is_handler_policy<handle_errors<Handler>> : std::true_type {};
+
+		constexpr bool is_escaped_byte(codepoint cp) noexcept {
+			return cp >= 0xDC80 && cp <= 0xDCFF;
+		}
+
+		template<typename UTFO, typename ErrorPolicy, typename OutputIterator>
+		OutputIterator encode_with(codepoint cp, OutputIterator output)
+		{
+			if constexpr(std::is_same_v<ErrorPolicy, escape_errors> && std::is_same_v<UTFO, utf8>)
+			{
+				if (is_escaped_byte(cp))
+				{
+					*output++ = static_cast<char>(cp & 0xFF);
+					return output;
+				}
+			}
+			return UTFO::encode(cp, output);
+		}
+
+		// the loop of the conversions which check every sequence: block(first, output) writes the eight code units at
+		// first and returns true if it can do so without decoding them, and sink(cp, output) writes cp and returns false
+		// if the output has no such codepoint, which ErrorPolicy then handles like an ill-formed sequence, writing
+		// replacement in place of either
+		template<typename UTFI, typename ErrorPolicy, typename ForwardIterator, typename OutputIterator, typename Block, typename Sink>
+		transcode_result<ForwardIterator, OutputIterator> transcode_checked(ForwardIterator first, ForwardIterator last,
+			OutputIterator output, [[maybe_unused]] ErrorPolicy& policy, codepoint replacement, Block&& block, Sink&& sink)
+		{
+			std::size_t errors = 0;
+			std::size_t offset = 0;
+			while (first != last)
+			{
+				if constexpr(std::is_pointer_v<ForwardIterator>)
+				{
+					const ForwardIterator begin = first;
+					while (last - first >= 8 && block(first, output)) {
+						first += 8;
+					}
+					if constexpr(is_handler_policy<ErrorPolicy>::value) {
+						offset += static_cast<std::size_t>(first - begin);
+					}
+					if (first == last) {
+						break;
+					}
+				}
+
+				const ForwardIterator start = first;
+				codepoint cp = static_cast<typename UTFI::char_type>(*first);
+				decode_error error = decode_error::none;
+				if (is_whole<UTFI>(cp)) {
+					++first;
+				}
+				else {
+					first = UTFI::decode(first, last, cp, error);
+				}
+
+				std::size_t size = 1;
+				if constexpr(is_handler_policy<ErrorPolicy>::value)
+				{
+					size = static_cast<std::size_t>(std::distance(start, first));
+					offset += size;
+				}
+
+				if constexpr(std::is_same_v<ErrorPolicy, escape_errors>)
+				{
+					if (error != decode_error::none)
+					{
+						if constexpr(std::is_same_v<UTFI, utf8>)
+						{
+							// the bytes of ill-formed sequences are never ascii
+							for (ForwardIterator byte = start; byte != first; ++byte) {
+								sink(0xDC00 + static_cast<unsigned char>(*byte), output);
+							}
+							++errors;
+							continue;
+						}
+						else
+						{
+							// an escaped byte of an earlier conversion isn't an error
+							const codepoint unit = static_cast<typename UTFI::char_type>(*start);
+							if (std::next(start) == first && is_escaped_byte(unit))
+							{
+								cp = unit;
+								error = decode_error::none;
+							}
+						}
+					}
+				}
+
+				if (error == decode_error::none && sink(cp, output)) {
+					continue;
+				}
+
+				++errors;
+				if constexpr(std::is_same_v<ErrorPolicy, skip_errors>) {
+					continue;
+				}
+				else if constexpr(std::is_same_v<ErrorPolicy, stop_on_error>) {
+					return transcode_result<ForwardIterator, OutputIterator>{ start, output, errors };
+				}
+				else if constexpr(is_handler_policy<ErrorPolicy>::value)
+				{
+					const error_action action = policy.handler(offset - size, error);
+					if (action == error_action::stop) {
+						return transcode_result<ForwardIterator, OutputIterator>{ start, output, errors };
+					}
+					if (action == error_action::skip) {
+						continue;
+					}
+				}
+				else {
+					static_assert(std::is_same_v<ErrorPolicy, replace_errors> || std::is_same_v<ErrorPolicy, escape_errors>,
+						"unknown error policy");
+				}
+				sink(replacement, output);
+			}
+			return transcode_result<ForwardIterator, OutputIterator>{ first, output, errors };
+		}
+	}
+
+	// converts [first, last) from UTFI to UTFO, checking every sequence, also when both are the same format, and
+	// handling the ill-formed ones as ErrorPolicy says
+	template<typename UTFI, typename UTFO, typename ErrorPolicy = replace_errors, typename ForwardIterator, typename OutputIterator>
+	transcode_result<ForwardIterator, OutputIterator> transcode(ForwardIterator first, ForwardIterator last, OutputIterator output,
+		ErrorPolicy policy = ErrorPolicy())
+	{
+		// eight code units at a time while they are ascii, or in utf16 outside of the surrogates
+		auto block = [](auto units, auto& out)
+		{
+			if constexpr(std::is_same_v<UTFI, utf32>) {
+				return false;
+			}
+			else
+			{
+				if (!detail::is_whole_block<UTFI>(units)) {
+					return false;
+				}
+				if constexpr(std::is_same_v<UTFI, utf8> || !std::is_same_v<UTFO, utf8>) {
+					out = std::copy(units, units + 8, out);
+				}
+				else
+				{
+					for (std::size_t i = 0; i < 8; ++i) {
+						out = utf8::encode(static_cast<typename UTFI::char_type>(units[i]), out);
+					}
+				}
+				return true;
+			}
+		};
+		auto sink = [](codepoint cp, OutputIterator& out)
+		{
+			out = detail::encode_with<UTFO, ErrorPolicy>(cp, out);
+			return true;
+		};
+		return detail::transcode_checked<UTFI>(first, last, output, policy, replacement_character(), block, sink);
+	}
+}
+
+#endif
@@ -0,0 +1,245 @@
+#ifndef LION_UNICODE_HASH_HPP
+#define LION_UNICODE_HASH_HPP
+
+#include "codepoint.hpp"
+#include "validation.hpp"
+#include "utf8.hpp"
+#include "utf16.hpp"
+#include "utf32.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace lion::unicode
+{
+	namespace detail
+	{
+		// the hash of a sequence of codepoints: the codepoints are split into blocks of eight, a block of ascii codepoints
+		// is mixed as one word of their bytes, any other block as four words of two codepoints each
+		class codepoint_hash_state
+		{
+		public:
+			static constexpr std::uint64_t prime1 = 0x9E3779B185EBCA87ull;
+			static constexpr std::uint64_t prime2 = 0xC2B2AE3D27D4EB4Full;
+			static constexpr std::uint64_t prime3 = 0x165667B19E3779F9ull;
+
+			constexpr explicit codepoint_hash_state(std::uint64_t seed = 0) noexcept
+				: hash_(seed + prime3)
+			{}
+
+			// whether the next codepoint starts a block
+			constexpr bool aligned() const noexcept { return size_ == 0; }
+
+			constexpr void add(codepoint cp) noexcept
+			{
+				block_[size_++] = cp;
+				if (size_ == 8)
+				{
+					codepoint any = 0;
+					for (codepoint c : block_) {
+						any |= c;
+					}
+					if (any < 0x80) {
+						add_ascii(block_);
+					}
+					else {
+						add_block(block_);
+					}
+					size_ = 0;
+				}
+			}
+
+			// a whole block while aligned()
+			template<typename Unit>
+			constexpr void add_ascii(const Unit* units) noexcept
+			{
+				std::uint64_t word = 0;
+				for (std::size_t i = 0; i < 8; ++i) {
+					word |= static_cast<std::uint64_t>(units[i]) << (8 * i);
+				}
+				mix(word);
+				length_ += 8;
+			}
+
+			template<typename Unit>
+			constexpr void add_block(const Unit* units) noexcept
+			{
+				for (std::size_t i = 0; i < 8; i += 2) {
+					mix(static_cast<std::uint64_t>(units[i]) | (static_cast<std::uint64_t>(units[i + 1]) << 32));
+				}
+				length_ += 8;
+			}
+
+			// the eight bytes of a little endian word of ascii
+			constexpr void add_ascii(std::uint64_t word) noexcept
+			{
+				mix(word);
+				length_ += 8;
+			}
+
+			constexpr std::uint64_t digest() const noexcept
+			{
+				std::uint64_t hash = hash_;
+				for (std::size_t i = 0; i < size_; i += 2) {
+					hash = mix(hash, static_cast<std::uint64_t>(block_[i]) | (i + 1 < size_ ? static_cast<std::uint64_t>(block_[i + 1]) << 32 : 0));
+				}
+				hash ^= length_ + size_;
+				hash ^= hash >> 33;
+				hash *= prime2;
+				hash ^= hash >> 29;
+				hash *= prime3;
+				hash ^= hash >> 32;
+				return hash;
+			}
+
+		private:
+			static constexpr std::uint64_t rotate(std::uint64_t x, unsigned n) noexcept {
+				return (x << n) | (x >> (64 - n));
+			}
+
+			static constexpr std::uint64_t mix(std::uint64_t hash, std::uint64_t word) noexcept
+			{
+				hash ^= rotate(word * prime2, 31) * prime1;
+				return rotate(hash, 27) * prime1 + 0x85EBCA77C2B2AE63ull;
+			}
+
+			constexpr void mix(std::uint64_t word) noexcept {
+				hash_ = mix(hash_, word);
+			}
+
+			std::uint64_t hash_;
+			std::uint64_t length_ = 0;
+			codepoint block_[8] = {};
+			std::size_t size_ = 0;
+		};
+
+		// adds [first, last) to state, up to an incomplete sequence at the end, which is returned
+		template<typename UTF, typename ForwardIterator>
+		ForwardIterator hash_codepoints(codepoint_hash_state& state, ForwardIterator first, ForwardIterator last)
+		{
+			while (first != last)
+			{
+				if constexpr(std::is_pointer_v<ForwardIterator>)
+				{
+					while (state.aligned() && last - first >= 8)
+					{
+						if constexpr(std::is_same_v<UTF, utf8>)
+						{
+							std::uint64_t word = 0;
+							for (std::size_t i = 0; i < 8; ++i) {
+								word |= static_cast<std::uint64_t>(static_cast<unsigned char>(first[i])) << (8 * i);
+							}
+							if ((word & 0x8080808080808080ull) != 0) {
+								break;
+							}
+							state.add_ascii(word);
+						}
+						else
+						{
+							// ascii or, for a block without surrogates, the bmp
+							codepoint any = 0;
+							for (std::size_t i = 0; i < 8; ++i) {
+								any |= static_cast<codepoint>(first[i]);
+							}
+							if (any < 0x80) {
+								state.add_ascii(first);
+							}
+							else if (any < 0xD800) {
+								state.add_block(first);
+							}
+							else {
+								break;
+							}
+						}
+						first += 8;
+					}
+					if (first == last) {
+						break;
+					}
+				}
+
+				codepoint cp;
+				decode_error error;
+				const ForwardIterator next = UTF::decode(first, last, cp, error);
+				if (error == decode_error::truncated && next == last) {
+					return first;
+				}
+				state.add(cp);
+				first = next;
+			}
+			return first;
+		}
+	}
+
+	// an incremental codepoint_hash, for text which arrives in chunks
+	template<typename UTF>
+	class codepoint_hasher
+	{
+	public:
+		explicit codepoint_hasher(std::uint64_t seed = 0) noexcept
+			: state_(seed)
+		{}
+
+		// a sequence split between two chunks is hashed as if it was whole
+		template<typename ForwardIterator>
+		codepoint_hasher& update(ForwardIterator first, ForwardIterator last)
+		{
+			// completes the sequence which ended the previous chunk, decoding it again from its start
+			while (pending_ != 0 && first != last)
+			{
+				pending_units_[pending_++] = static_cast<typename UTF::char_type>(*first++);
+				typename UTF::char_type* end = pending_units_ + pending_;
+				typename UTF::char_type* rest = detail::hash_codepoints<UTF>(state_, pending_units_, end);
+				pending_ = static_cast<std::size_t>(std::copy(rest, end, pending_units_) - pending_units_);
+			}
+
+			const ForwardIterator rest = detail::hash_codepoints<UTF>(state_, first, last);
+			for (ForwardIterator it = rest; it != last; ++it) {
+				pending_units_[pending_++] = static_cast<typename UTF::char_type>(*it);
+			}
+			return *this;
+		}
+
+		codepoint_hasher& update(typename UTF::string_view_type view) {
+			return update(view.data(), view.data() + view.size());
+		}
+
+		// the hash of everything so far, an incomplete sequence at the end counts as U+FFFD
+		std::uint64_t digest() const noexcept
+		{
+			if (pending_ == 0) {
+				return state_.digest();
+			}
+			detail::codepoint_hash_state state = state_;
+			state.add(replacement_character());
+			return state.digest();
+		}
+
+	private:
+		detail::codepoint_hash_state state_;
+		typename UTF::char_type pending_units_[4] = {};
+		std::size_t pending_ = 0;
+	};
+
+	// a 64-bit hash of the codepoints of [first, last), the same for every encoding of them
+	template<typename UTF, typename ForwardIterator>
+	std::uint64_t codepoint_hash(ForwardIterator first, ForwardIterator last, std::uint64_t seed = 0)
+	{
+		detail::codepoint_hash_state state(seed);
+		first = detail::hash_codepoints<UTF>(state, first, last);
+		if (first != last) {
+			state.add(replacement_character());
+		}
+		return state.digest();
+	}
+
+	template<typename Char>
+	std::uint64_t codepoint_hash(std::basic_string_view<Char> view, std::uint64_t seed = 0) {
+		return codepoint_hash<typename detail::encoding_of<Char>::type>(view.data(), view.data() + view.size(), seed);
+	}
+}
+
+#endif
@@ -0,0 +1,169 @@
+#ifndef LION_UNICODE_IDENTIFIER_HPP
+#define LION_UNICODE_IDENTIFIER_HPP
+
+#include "codepoint.hpp"
+#include "validation.hpp"
+#include "utf8.hpp"
+#include "utf16.hpp"
+#include "utf32.hpp"
+#include "properties.hpp"
+#include "tables/identifier.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace lion::unicode
+{
+	namespace detail
+	{
+		constexpr bool identifier_bit(codepoint cp, unsigned property) noexcept
+		{
+			if (cp > codepoint_max()) {
+				return false;
+			}
+			const std::size_t block = identifier_stage1[cp >> 8];
+			return ((identifier_bits[8 * block + 4 * property + ((cp >> 6) & 3)] >> (cp & 63)) & 1) != 0;
+		}
+
+		constexpr bool is_ascii_white_space(codepoint cp) noexcept {
+			return cp == ' ' || (cp >= '\t' && cp <= '\r');
+		}
+
+		// the bytes of a word, with the high bit of each byte set if it is in [low, high]
+		constexpr std::uint64_t bytes_in_range(std::uint64_t word, unsigned char low, unsigned char high) noexcept
+		{
+			// with the high bit of every byte set beforehand, the subtractions never borrow from the next byte
+			constexpr std::uint64_t ones = 0x0101010101010101ull;
+			const std::uint64_t x = word | (ones * 0x80);
+			return (x - ones * low) & ~(x - ones * (high + 1u)) & (ones * 0x80);
+		}
+
+		// the high bit of each byte set if it is an ascii letter, digit or underscore
+		constexpr std::uint64_t identifier_bytes(std::uint64_t word) noexcept
+		{
+			constexpr std::uint64_t ascii = ~0x8080808080808080ull;
+			const std::uint64_t lower = word | 0x2020202020202020ull;
+			return (bytes_in_range(lower, 'a', 'z') | bytes_in_range(word, '0', '9') | bytes_in_range(word, '_', '_'))
+				& ~(word & ~ascii);
+		}
+
+		constexpr std::uint64_t white_space_bytes(std::uint64_t word) noexcept
+		{
+			constexpr std::uint64_t ascii = ~0x8080808080808080ull;
+			return (bytes_in_range(word, '\t', '\r') | bytes_in_range(word, ' ', ' ')) & ~(word & ~ascii);
+		}
+
+		// the end of the longest prefix of [first, last) whose codepoints satisfy predicate, with 'bytes' classifying eight
+		// bytes of utf8 at a time
+		template<typename UTF, typename ForwardIterator, typename Predicate, typename Bytes>
+		ForwardIterator scan_codepoints(ForwardIterator first, ForwardIterator last, Predicate predicate, Bytes bytes)
+		{
+			// most tokens are short, so the bytes are only classified eight at a time after the first four codepoints
+			std::size_t scanned = 0;
+			while (first != last)
+			{
+				if constexpr(std::is_same_v<UTF, utf8> && std::is_pointer_v<ForwardIterator>)
+				{
+					if (scanned >= 4)
+					{
+						std::uint64_t word;
+						for (; last - first >= 8; first += 8)
+						{
+							std::memcpy(&word, first, 8);
+							if (bytes(word) != 0x8080808080808080ull) {
+								break;
+							}
+						}
+						scanned = 0;
+						if (first == last) {
+							break;
+						}
+					}
+				}
+
+				codepoint cp = static_cast<typename UTF::char_type>(*first);
+				ForwardIterator next = first;
+				if (cp < 0x80) {
+					++next;
+				}
+				else
+				{
+					decode_error error;
+					next = UTF::decode(first, last, cp, error);
+				}
+				if (!predicate(cp)) {
+					break;
+				}
+				first = next;
+				++scanned;
+			}
+			return first;
+		}
+	}
+
+	constexpr bool is_xid_start(codepoint cp) noexcept {
+		return detail::identifier_bit(cp, 0);
+	}
+
+	constexpr bool is_xid_continue(codepoint cp) noexcept {
+		return detail::identifier_bit(cp, 1);
+	}
+
+	// the end of the identifier which starts at first, or first if there is none: an XID_Start codepoint or an underscore,
+	// followed by XID_Continue codepoints, as in the default identifiers of UAX #31
+	template<typename UTF, typename ForwardIterator>
+	ForwardIterator scan_identifier(ForwardIterator first, ForwardIterator last)
+	{
+		if (first == last) {
+			return first;
+		}
+		codepoint cp;
+		decode_error error;
+		const ForwardIterator next = UTF::decode(first, last, cp, error);
+		if (cp != '_' && !is_xid_start(cp)) {
+			return first;
+		}
+		return detail::scan_codepoints<UTF>(next, last, [](codepoint c) { return is_xid_continue(c); }, [](std::uint64_t word) {
+			return detail::identifier_bytes(word);
+		});
+	}
+
+	// the end of the White_Space codepoints which start at first
+	template<typename UTF, typename ForwardIterator>
+	ForwardIterator scan_whitespace(ForwardIterator first, ForwardIterator last)
+	{
+		return detail::scan_codepoints<UTF>(first, last, [](codepoint c) {
+			return c < 0x80 ? detail::is_ascii_white_space(c) : is_white_space(c);
+		}, [](std::uint64_t word) {
+			return detail::white_space_bytes(word);
+		});
+	}
+
+	inline utf8::string_view_type scan_identifier(utf8::string_view_type view) {
+		return view.substr(0, static_cast<std::size_t>(scan_identifier<utf8>(view.data(), view.data() + view.size()) - view.data()));
+	}
+
+	inline utf16::string_view_type scan_identifier(utf16::string_view_type view) {
+		return view.substr(0, static_cast<std::size_t>(scan_identifier<utf16>(view.data(), view.data() + view.size()) - view.data()));
+	}
+
+	inline utf32::string_view_type scan_identifier(utf32::string_view_type view) {
+		return view.substr(0, static_cast<std::size_t>(scan_identifier<utf32>(view.data(), view.data() + view.size()) - view.data()));
+	}
+
+	inline utf8::string_view_type scan_whitespace(utf8::string_view_type view) {
+		return view.substr(0, static_cast<std::size_t>(scan_whitespace<utf8>(view.data(), view.data() + view.size()) - view.data()));
+	}
+
+	inline utf16::string_view_type scan_whitespace(utf16::string_view_type view) {
+		return view.substr(0, static_cast<std::size_t>(scan_whitespace<utf16>(view.data(), view.data() + view.size()) - view.data()));
+	}
+
+	inline utf32::string_view_type scan_whitespace(utf32::string_view_type view) {
+		return view.substr(0, static_cast<std::size_t>(scan_whitespace<utf32>(view.data(), view.data() + view.size()) - view.data()));
+	}
+}
+
+#endif
@@ -0,0 +1,263 @@
+#ifndef LION_UNICODE_JSON_HPP
+#define LION_UNICODE_JSON_HPP
+
+#include "codepoint.hpp"
+#include "validation.hpp"
+#include "utf8.hpp"
+#include "utf16.hpp"
+#include "identifier.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+namespace lion::unicode
+{
+	// whether json_escape writes the non-ascii codepoints as \u escapes, with surrogate pairs above the BMP
+	enum class escape_non_ascii : bool
+	{
+		no,
+		yes
+	};
+
+	namespace detail
+	{
+		constexpr bool is_json_special(unsigned char byte) noexcept {
+			return byte < 0x20 || byte == '"' || byte == '\\' || byte >= 0x80;
+		}
+
+		// the high bit of each byte set if it is a control, a quote, a backslash or not ascii, and maybe of other bytes
+		// before such a byte
+		constexpr std::uint64_t json_special_bytes(std::uint64_t word) noexcept
+		{
+			return bytes_in_range(word, 0x00, 0x1F) | bytes_in_range(word, '"', '"') | bytes_in_range(word, '\\', '\\')
+				| (word & 0x8080808080808080ull);
+		}
+
+		// the first special byte of [data + position, data + size), or size, looked for eight bytes at a time
+		inline std::size_t find_json_special(const char* data, std::size_t position, std::size_t size) noexcept
+		{
+			std::uint64_t word;
+			for (; size - position >= 8; position += 8)
+			{
+				std::memcpy(&word, data + position, 8);
+				if (json_special_bytes(word) != 0) {
+					break;
+				}
+			}
+			while (position < size && !is_json_special(static_cast<unsigned char>(data[position]))) {
+				++position;
+			}
+			return position;
+		}
+
+		inline void append_json_unit(std::string& output, char16_t unit)
+		{
+			constexpr char digits[] = "0123456789abcdef";
+			const char escape[6] = {
+				'\\', 'u', digits[(unit >> 12) & 0xF], digits[(unit >> 8) & 0xF], digits[(unit >> 4) & 0xF], digits[unit & 0xF]
+			};
+			output.append(escape, 6);
+		}
+
+		// reads the four hex digits of a \u escape at data + position
+		inline bool read_json_unit(const char* data, std::size_t size, std::size_t& position, char16_t& unit) noexcept
+		{
+			if (size - position < 4) {
+				return false;
+			}
+			unit = 0;
+			for (std::size_t i = 0; i < 4; ++i)
+			{
+				const char c = data[position + i];
+				unsigned digit;
+				if (c >= '0' && c <= '9') {
+					digit = static_cast<unsigned>(c - '0');
+				}
+				else if (c >= 'a' && c <= 'f') {
+					digit = static_cast<unsigned>(c - 'a' + 10);
+				}
+				else if (c >= 'A' && c <= 'F') {
+					digit = static_cast<unsigned>(c - 'A' + 10);
+				}
+				else {
+					return false;
+				}
+				unit = static_cast<char16_t>((unit << 4) | digit);
+			}
+			position += 4;
+			return true;
+		}
+	}
+
+	// appends text, as the contents of a json string without the quotes, to output: quotes, backslashes and controls
+	// are escaped, and ill-formed sequences are replaced with U+FFFD; the spans between them are copied as they are
+	template<escape_non_ascii esc = escape_non_ascii::no>
+	void json_escape(utf8::string_view_type text, utf8::string_type& output)
+	{
+		const char* const data = text.data();
+		const std::size_t size = text.size();
+		std::size_t start = 0;
+		std::size_t position = 0;
+		while ((position = detail::find_json_special(data, position, size)) != size)
+		{
+			const unsigned char byte = static_cast<unsigned char>(data[position]);
+			if (byte >= 0x80)
+			{
+				codepoint cp;
+				decode_error error;
+				const std::size_t next = static_cast<std::size_t>(utf8::decode(data + position, data + size, cp, error) - data);
+				if constexpr(esc == escape_non_ascii::no)
+				{
+					if (error == decode_error::none)
+					{
+						position = next;
+						continue;
+					}
+				}
+				output.append(data + start, position - start);
+				if constexpr(esc == escape_non_ascii::yes)
+				{
+					char16_t units[2];
+					const char16_t* const end = utf16::encode(cp, units);
+					for (const char16_t* unit = units; unit != end; ++unit) {
+						detail::append_json_unit(output, *unit);
+					}
+				}
+				else {
+					utf8::encode(replacement_character(), std::back_inserter(output));
+				}
+				start = position = next;
+				continue;
+			}
+
+			output.append(data + start, position - start);
+			switch (byte)
+			{
+			case '"':
+				output.append("\\\"", 2);
+				break;
+			case '\\':
+				output.append("\\\\", 2);
+				break;
+			case '\b':
+				output.append("\\b", 2);
+				break;
+			case '\f':
+				output.append("\\f", 2);
+				break;
+			case '\n':
+				output.append("\\n", 2);
+				break;
+			case '\r':
+				output.append("\\r", 2);
+				break;
+			case '\t':
+				output.append("\\t", 2);
+				break;
+			default:
+				detail::append_json_unit(output, byte);
+			}
+			start = position = position + 1;
+		}
+		output.append(data + start, size - start);
+	}
+
+	template<escape_non_ascii esc = escape_non_ascii::no>
+	utf8::string_type json_escape(utf8::string_view_type text)
+	{
+		utf8::string_type result;
+		result.reserve(text.size());
+		json_escape<esc>(text, result);
+		return result;
+	}
+
+	// appends the contents of a json string without the quotes to output, with the escapes replaced by what they stand
+	// for: false if text isn't well-formed utf8, has a quote or a control which isn't escaped, an unknown escape or a
+	// \u escape of a surrogate which isn't part of a pair, then output has what was unescaped before the error
+	inline bool json_unescape(utf8::string_view_type text, utf8::string_type& output)
+	{
+		const char* const data = text.data();
+		const std::size_t size = text.size();
+		std::size_t start = 0;
+		std::size_t position = 0;
+		while ((position = detail::find_json_special(data, position, size)) != size)
+		{
+			const unsigned char byte = static_cast<unsigned char>(data[position]);
+			if (byte >= 0x80)
+			{
+				codepoint cp;
+				decode_error error;
+				const std::size_t next = static_cast<std::size_t>(utf8::decode(data + position, data + size, cp, error) - data);
+				if (error != decode_error::none)
+				{
+					output.append(data + start, position - start);
+					return false;
+				}
+				position = next;
+				continue;
+			}
+
+			output.append(data + start, position - start);
+			if (byte != '\\' || size - position < 2) {
+				return false;
+			}
+			const char escape = data[position + 1];
+			position += 2;
+			switch (escape)
+			{
+			case '"':
+			case '\\':
+			case '/':
+				output.push_back(escape);
+				break;
+			case 'b':
+				output.push_back('\b');
+				break;
+			case 'f':
+				output.push_back('\f');
+				break;
+			case 'n':
+				output.push_back('\n');
+				break;
+			case 'r':
+				output.push_back('\r');
+				break;
+			case 't':
+				output.push_back('\t');
+				break;
+			case 'u':
+			{
+				char16_t units[2];
+				if (!detail::read_json_unit(data, size, position, units[0]) || is_low_surrogate(units[0])) {
+					return false;
+				}
+				if (is_high_surrogate(units[0]))
+				{
+					if (size - position < 2 || data[position] != '\\' || data[position + 1] != 'u') {
+						return false;
+					}
+					position += 2;
+					if (!detail::read_json_unit(data, size, position, units[1]) || !is_low_surrogate(units[1])) {
+						return false;
+					}
+				}
+				codepoint cp;
+				utf16::decode<conversion::lenient>(units, units + 2, cp);
+				utf8::encode(cp, std::back_inserter(output));
+				break;
+			}
+			default:
+				return false;
+			}
+			start = position;
+		}
+		output.append(data + start, size - start);
+		return true;
+	}
+}
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef LION_UNICODE_LITERAL_HPP
+#define LION_UNICODE_LITERAL_HPP
+
+#include "codepoint.hpp"
+#include "validation.hpp"
+#include "utf8.hpp"
+#include "utf16.hpp"
+#include "utf32.hpp"
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace lion::unicode
+{
+	namespace detail
+	{
+		// not constexpr, so that a constant expression which calls it is ill-formed
+		inline void ill_formed_literal() noexcept {}
+
+		// the number of UTFO code units of the utf8 text, which must be well-formed
+		template<typename UTFO>
+		constexpr std::size_t literal_size(utf8::string_view_type text)
+		{
+			const char* first = text.data();
+			const char* const last = text.data() + text.size();
+			std::size_t size = 0;
+			while (first != last)
+			{
+				codepoint cp = 0;
+				decode_error error = decode_error::none;
+				first = utf8::decode(first, last, cp, error);
+				if (error != decode_error::none) {
+					ill_formed_literal();
+				}
+				if constexpr(std::is_same_v<UTFO, utf16>) {
+					size += cp > 0xFFFF ? 2 : 1;
+				}
+				else {
+					size += 1;
+				}
+			}
+			return size;
+		}
+
+		template<typename UTFO, typename Literal>
+		constexpr auto literal_array(Literal literal)
+		{
+			constexpr std::size_t size = literal_size<UTFO>(literal());
+			std::array<typename UTFO::char_type, size> units{};
+
+			const utf8::string_view_type text = literal();
+			const char* first = text.data();
+			const char* const last = text.data() + text.size();
+			typename UTFO::char_type* output = units.data();
+			while (first != last)
+			{
+				codepoint cp = 0;
+				first = utf8::decode(first, last, cp);
+				output = UTFO::encode(cp, output);
+			}
+			return units;
+		}
+	}
+
+	// the utf16 code units of a utf8 string literal, without a terminating null, converted at compile time: literal is a
+	// lambda which returns it, as in to_utf16_array([] { return "text"; }), and an ill-formed literal doesn't compile
+	template<typename Literal>
+	constexpr auto to_utf16_array(Literal literal) {
+		return detail::literal_array<utf16>(literal);
+	}
+
+	template<typename Literal>
+	constexpr auto to_utf32_array(Literal literal) {
+		return detail::literal_array<utf32>(literal);
+	}
+}
+
+#endif
@@ -0,0 +1,464 @@
+#ifndef LION_UNICODE_NORMALIZATION_HPP
+#define LION_UNICODE_NORMALIZATION_HPP
+
+#include "codepoint.hpp"
+#include "validation.hpp"
+#include "utf8.hpp"
+#include "utf16.hpp"
+#include "utf32.hpp"
+#include "tables/normalization.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace lion::unicode
+{
+	enum class normalization_form : unsigned char
+	{
+		nfc,
+		nfd,
+		nfkc,
+		nfkd
+	};
+
+	enum class quick_check_result : unsigned char
+	{
+		yes,
+		no,
+		maybe
+	};
+
+	namespace detail
+	{
+		constexpr std::uint16_t normalization_value(codepoint cp) noexcept
+		{
+			if (cp > codepoint_max()) {
+				cp = codepoint_max();
+			}
+			const std::size_t block = normalization_stage1[cp >> normalization_shift];
+			return normalization_stage2[(block << normalization_shift) + (cp & ((1u << normalization_shift) - 1))];
+		}
+
+		constexpr unsigned char combining_class_of(std::uint16_t value) noexcept {
+			return static_cast<unsigned char>(value & 0xFF);
+		}
+
+		template<normalization_form form>
+		constexpr quick_check_result quick_check_of(std::uint16_t value) noexcept
+		{
+			if constexpr(form == normalization_form::nfd) {
+				return static_cast<quick_check_result>((value >> 8) & 1);
+			}
+			else if constexpr(form == normalization_form::nfkd) {
+				return static_cast<quick_check_result>((value >> 9) & 1);
+			}
+			else if constexpr(form == normalization_form::nfc) {
+				return static_cast<quick_check_result>((value >> 10) & 3);
+			}
+			else {
+				return static_cast<quick_check_result>((value >> 12) & 3);
+			}
+		}
+
+		constexpr bool composes(normalization_form form) noexcept {
+			return form == normalization_form::nfc || form == normalization_form::nfkc;
+		}
+
+		constexpr bool compatibility(normalization_form form) noexcept {
+			return form == normalization_form::nfkc || form == normalization_form::nfkd;
+		}
+
+		// appends the full decomposition of cp
+		template<normalization_form form>
+		void decompose(codepoint cp, std::vector<codepoint>& output)
+		{
+			if (cp >= hangul_s_base && cp < hangul_s_base + hangul_s_count)
+			{
+				const codepoint index = cp - hangul_s_base;
+				output.push_back(hangul_l_base + index / hangul_n_count);
+				output.push_back(hangul_v_base + (index % hangul_n_count) / hangul_t_count);
+				if (index % hangul_t_count != 0) {
+					output.push_back(hangul_t_base + index % hangul_t_count);
+				}
+				return;
+			}
+
+			const std::size_t block = decomposition_stage1[cp >> decomposition_shift];
+			const auto& record = decomposition_records[decomposition_stage2[(block << decomposition_shift) + (cp & ((1u << decomposition_shift) - 1))]];
+			const std::size_t offset = compatibility(form) ? record[2] : record[0];
+			const std::size_t length = compatibility(form) ? record[3] : record[1];
+			if (length == 0) {
+				output.push_back(cp);
+			}
+			else {
+				output.insert(output.end(), decomposition_data + offset, decomposition_data + offset + length);
+			}
+		}
+
+		// the primary composite of first and second, or 0 if there is none
+		inline codepoint compose(codepoint first, codepoint second) noexcept
+		{
+			if (first >= hangul_l_base && first < hangul_l_base + hangul_l_count)
+			{
+				if (second >= hangul_v_base && second < hangul_v_base + hangul_v_count) {
+					return hangul_s_base + ((first - hangul_l_base) * hangul_v_count + (second - hangul_v_base)) * hangul_t_count;
+				}
+				return 0;
+			}
+			if (first >= hangul_s_base && first < hangul_s_base + hangul_s_count && (first - hangul_s_base) % hangul_t_count == 0)
+			{
+				if (second > hangul_t_base && second < hangul_t_base + hangul_t_count) {
+					return first + (second - hangul_t_base);
+				}
+				return 0;
+			}
+
+			const std::uint64_t key = (static_cast<std::uint64_t>(first) << 21) | second;
+			const auto it = std::lower_bound(std::begin(composition_keys), std::end(composition_keys), key);
+			if (it == std::end(composition_keys) || *it != key) {
+				return 0;
+			}
+			return composition_values[it - std::begin(composition_keys)];
+		}
+
+		// sorts every run of non-starters by their combining class, keeping the order of equal classes
+		inline void canonical_order(std::vector<codepoint>& cps)
+		{
+			for (std::size_t i = 1; i < cps.size(); ++i)
+			{
+				const unsigned char ccc = combining_class_of(normalization_value(cps[i]));
+				if (ccc == 0) {
+					continue;
+				}
+				std::size_t j = i;
+				for (; j > 0; --j)
+				{
+					const unsigned char previous = combining_class_of(normalization_value(cps[j - 1]));
+					if (previous == 0 || previous <= ccc) {
+						break;
+					}
+				}
+				std::rotate(cps.begin() + j, cps.begin() + i, cps.begin() + i + 1);
+			}
+		}
+
+		// the canonical composition algorithm of UAX #15
+		inline void canonical_compose(std::vector<codepoint>& cps)
+		{
+			if (cps.empty()) {
+				return;
+			}
+
+			std::size_t starter = 0;
+			unsigned last = combining_class_of(normalization_value(cps[0])) == 0 ? 0 : 256;
+			std::size_t size = 1;
+			for (std::size_t i = 1; i < cps.size(); ++i)
+			{
+				const codepoint cp = cps[i];
+				const std::uint16_t value = normalization_value(cp);
+				const unsigned ccc = combining_class_of(value);
+
+				// only the codepoints with NFC_QC=Maybe are the second codepoint of a composition
+				const codepoint composite = quick_check_of<normalization_form::nfc>(value) == quick_check_result::maybe
+					&& (last < ccc || last == 0) ? compose(cps[starter], cp) : 0;
+				if (composite != 0) {
+					cps[starter] = composite;
+				}
+				else
+				{
+					if (ccc == 0) {
+						starter = size;
+					}
+					last = ccc;
+					cps[size++] = cp;
+				}
+			}
+			cps.resize(size);
+		}
+
+		template<normalization_form form>
+		constexpr bool is_boundary(std::uint16_t value) noexcept {
+			return combining_class_of(value) == 0 && quick_check_of<form>(value) == quick_check_result::yes;
+		}
+
+		// returns the start of the first segment in [first, last) which may not be normalized, or last
+		template<normalization_form form, typename UTF, typename Pointer>
+		Pointer find_unnormalized(Pointer first, Pointer last)
+		{
+			constexpr codepoint minimum = quick_check_minimum[static_cast<std::size_t>(form)];
+
+			Pointer boundary = first;
+			unsigned char last_ccc = 0;
+			while (first != last)
+			{
+				if constexpr(std::is_same_v<UTF, utf8>)
+				{
+					// skip ascii eight bytes at a time
+					const Pointer start = first;
+					for (std::uint64_t word; last - first >= 8; first += 8)
+					{
+						std::memcpy(&word, first, 8);
+						if ((word & 0x8080808080808080ull) != 0) {
+							break;
+						}
+					}
+					while (first != last && static_cast<typename UTF::char_type>(*first) < 0x80) {
+						++first;
+					}
+					if (first != start)
+					{
+						boundary = first - 1;
+						last_ccc = 0;
+						if (first == last) {
+							break;
+						}
+					}
+				}
+				else if (static_cast<codepoint>(*first) < minimum)
+				{
+					boundary = first++;
+					last_ccc = 0;
+					continue;
+				}
+
+				const Pointer position = first;
+				codepoint cp;
+				decode_error error;
+				first = UTF::decode(first, last, cp, error);
+				if (error != decode_error::none) {
+					return boundary;
+				}
+
+				const std::uint16_t value = normalization_value(cp);
+				const unsigned char ccc = combining_class_of(value);
+				if ((ccc != 0 && last_ccc > ccc) || quick_check_of<form>(value) != quick_check_result::yes) {
+					return boundary;
+				}
+				if (ccc == 0) {
+					boundary = position;
+				}
+				last_ccc = ccc;
+			}
+			return last;
+		}
+
+		// decodes and normalizes the segment which starts at first, up to the next boundary; returns its end
+		template<normalization_form form, typename UTF, typename Pointer>
+		Pointer normalize_segment(Pointer first, Pointer last, std::vector<codepoint>& cps)
+		{
+			cps.clear();
+			bool starting = true;
+			while (first != last)
+			{
+				Pointer next;
+				codepoint cp;
+				decode_error error;
+				next = UTF::decode(first, last, cp, error);
+				if (!starting && is_boundary<form>(normalization_value(cp))) {
+					break;
+				}
+				decompose<form>(cp, cps);
+				starting = false;
+				first = next;
+			}
+
+			canonical_order(cps);
+			if constexpr(composes(form)) {
+				canonical_compose(cps);
+			}
+			return first;
+		}
+
+		// whether encoding cps gives exactly [first, last)
+		template<typename UTF, typename Pointer>
+		bool encodes_to(const std::vector<codepoint>& cps, Pointer first, Pointer last)
+		{
+			typename UTF::string_view_type::value_type units[4];
+			for (const codepoint cp : cps)
+			{
+				typename UTF::string_view_type::value_type* end = UTF::encode(cp, units);
+				for (auto* unit = units; unit != end; ++unit, ++first)
+				{
+					if (first == last || *first != *unit) {
+						return false;
+					}
+				}
+			}
+			return first == last;
+		}
+
+		template<normalization_form form, typename UTF>
+		typename UTF::string_view_type normalize(typename UTF::string_view_type input, typename UTF::string_type& buffer)
+		{
+			using pointer = const typename UTF::string_view_type::value_type*;
+
+			const pointer begin = input.data();
+			const pointer last = begin + input.size();
+			pointer first = begin;
+			pointer copied = begin;
+			bool changed = false;
+			std::vector<codepoint> cps;
+			while (true)
+			{
+				const pointer start = find_unnormalized<form, UTF>(first, last);
+				if (start == last) {
+					break;
+				}
+
+				const pointer end = normalize_segment<form, UTF>(start, last, cps);
+				if (!changed && encodes_to<UTF>(cps, start, end))
+				{
+					// a Maybe which turned out to be normalized
+					first = end;
+					continue;
+				}
+
+				if (!changed)
+				{
+					buffer.clear();
+					changed = true;
+				}
+				buffer.append(copied, start);
+				for (const codepoint cp : cps) {
+					UTF::encode(cp, std::back_inserter(buffer));
+				}
+				first = copied = end;
+			}
+
+			if (!changed) {
+				return input;
+			}
+			buffer.append(copied, last);
+			return typename UTF::string_view_type(buffer);
+		}
+	}
+
+	constexpr unsigned char get_combining_class(codepoint cp) noexcept {
+		return detail::combining_class_of(detail::normalization_value(cp));
+	}
+
+	// the quick check algorithm of UAX #15, maybe means that the sequence has to be normalized to be sure
+	template<normalization_form form, typename UTF, typename ForwardIterator>
+	quick_check_result quick_check(ForwardIterator first, ForwardIterator last)
+	{
+		quick_check_result result = quick_check_result::yes;
+		unsigned char last_ccc = 0;
+		while (first != last)
+		{
+			codepoint cp;
+			decode_error error;
+			first = UTF::decode(first, last, cp, error);
+			if (error != decode_error::none) {
+				return quick_check_result::no;
+			}
+
+			const std::uint16_t value = detail::normalization_value(cp);
+			const unsigned char ccc = detail::combining_class_of(value);
+			if (ccc != 0 && last_ccc > ccc) {
+				return quick_check_result::no;
+			}
+			const quick_check_result check = detail::quick_check_of<form>(value);
+			if (check == quick_check_result::no) {
+				return quick_check_result::no;
+			}
+			if (check == quick_check_result::maybe) {
+				result = quick_check_result::maybe;
+			}
+			last_ccc = ccc;
+		}
+		return result;
+	}
+
+	template<normalization_form form>
+	quick_check_result quick_check(utf8::string_view_type view) {
+		return quick_check<form, utf8>(view.begin(), view.end());
+	}
+
+	template<normalization_form form>
+	quick_check_result quick_check(utf16::string_view_type view) {
+		return quick_check<form, utf16>(view.begin(), view.end());
+	}
+
+	template<normalization_form form>
+	quick_check_result quick_check(utf32::string_view_type view) {
+		return quick_check<form, utf32>(view.begin(), view.end());
+	}
+
+	// returns input if it is already normalized, otherwise normalizes it into buffer and returns a view of it
+	template<normalization_form form>
+	utf8::string_view_type normalize(utf8::string_view_type input, utf8::string_type& buffer) {
+		return detail::normalize<form, utf8>(input, buffer);
+	}
+
+	template<normalization_form form>
+	utf16::string_view_type normalize(utf16::string_view_type input, utf16::string_type& buffer) {
+		return detail::normalize<form, utf16>(input, buffer);
+	}
+
+	template<normalization_form form>
+	utf32::string_view_type normalize(utf32::string_view_type input, utf32::string_type& buffer) {
+		return detail::normalize<form, utf32>(input, buffer);
+	}
+
+	// normalizes str in place, returns whether it changed
+	template<normalization_form form>
+	bool normalize(utf8::string_type& str)
+	{
+		utf8::string_type buffer;
+		if (detail::normalize<form, utf8>(str, buffer).data() == str.data()) {
+			return false;
+		}
+		str.swap(buffer);
+		return true;
+	}
+
+	template<normalization_form form>
+	bool normalize(utf16::string_type& str)
+	{
+		utf16::string_type buffer;
+		if (detail::normalize<form, utf16>(str, buffer).data() == str.data()) {
+			return false;
+		}
+		str.swap(buffer);
+		return true;
+	}
+
+	template<normalization_form form>
+	bool normalize(utf32::string_type& str)
+	{
+		utf32::string_type buffer;
+		if (detail::normalize<form, utf32>(str, buffer).data() == str.data()) {
+			return false;
+		}
+		str.swap(buffer);
+		return true;
+	}
+
+	template<normalization_form form>
+	bool is_normalized(utf8::string_view_type view)
+	{
+		utf8::string_type buffer;
+		return detail::normalize<form, utf8>(view, buffer).data() == view.data();
+	}
+
+	template<normalization_form form>
+	bool is_normalized(utf16::string_view_type view)
+	{
+		utf16::string_type buffer;
+		return detail::normalize<form, utf16>(view, buffer).data() == view.data();
+	}
+
+	template<normalization_form form>
+	bool is_normalized(utf32::string_view_type view)
+	{
+		utf32::string_type buffer;
+		return detail::normalize<form, utf32>(view, buffer).data() == view.data();
+	}
+}
+
+#endif
@@ -0,0 +1,486 @@
+#ifndef LION_UNICODE_PIPELINE_HPP
+#define LION_UNICODE_PIPELINE_HPP
+
+#include "codepoint.hpp"
+#include "encoding.hpp"
+#include "ustream.hpp"
+#include "utf8.hpp"
+#include "utf16.hpp"
+#include "utf32.hpp"
+#include "utilities.hpp"
+#include "single_byte.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <array>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+namespace lion::unicode
+{
+	constexpr std::size_t default_block_size = 1 << 18;
+
+	// lock-free ring buffer for exactly one producer thread and one consumer thread
+	template<typename T, std::size_t Capacity>
+	class spsc_queue
+	{
+		static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+			"spsc_queue<T, Capacity> requires Capacity to be a power of two");
+
+		std::array<T, Capacity> slots;
+		alignas(64) std::atomic<std::size_t> head{ 0 };
+		alignas(64) std::atomic<std::size_t> tail{ 0 };
+
+	public:
+		spsc_queue() = default;
+
+		spsc_queue(const spsc_queue&) = delete;
+		spsc_queue& operator=(const spsc_queue&) = delete;
+
+		bool try_push(T&& value)
+		{
+			const std::size_t t = tail.load(std::memory_order_relaxed);
+			if (t - head.load(std::memory_order_acquire) == Capacity) {
+				return false;
+			}
+			slots[t & (Capacity - 1)] = std::move(value);
+			tail.store(t + 1, std::memory_order_release);
+			return true;
+		}
+
+		bool try_pop(T& value)
+		{
+			const std::size_t h = head.load(std::memory_order_relaxed);
+			if (h == tail.load(std::memory_order_acquire)) {
+				return false;
+			}
+			value = std::move(slots[h & (Capacity - 1)]);
+			head.store(h + 1, std::memory_order_release);
+			return true;
+		}
+
+		void push(T&& value)
+		{
+			while (!try_push(std::move(value))) {
+				std::this_thread::yield();
+			}
+		}
+
+		void pop(T& value)
+		{
+			while (!try_pop(value)) {
+				std::this_thread::yield();
+			}
+		}
+	};
+
+	namespace detail
+	{
+		struct block
+		{
+			std::string data;
+			bool last = false;
+		};
+
+		using block_queue = spsc_queue<block, 4>;
+
+		template<typename UTF>
+		typename UTF::char_type load_unit(const char* bytes, byte_order order) noexcept
+		{
+			constexpr std::size_t size = sizeof(typename UTF::char_type);
+
+			typename UTF::char_type unit = 0;
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				const unsigned char byte = static_cast<unsigned char>(bytes[order == byte_order::little ? size - 1 - i : i]);
+				unit = static_cast<typename UTF::char_type>((unit << 8) | byte);
+			}
+			return unit;
+		}
+
+		template<typename UTF, typename ForwardIterator>
+		void store_units(std::string& bytes, ForwardIterator first, ForwardIterator last, byte_order order)
+		{
+			constexpr std::size_t size = sizeof(typename UTF::char_type);
+
+			for (; first != last; ++first)
+			{
+				const auto unit = static_cast<std::uint_least32_t>(*first);
+				char buffer[size];
+				for (std::size_t i = 0; i < size; ++i)
+				{
+					const std::size_t shift = 8 * (order == byte_order::little ? i : size - 1 - i);
+					buffer[i] = static_cast<char>((unit >> shift) & 0xFF);
+				}
+				bytes.append(buffer, size);
+			}
+		}
+
+		// whether [first, last), which was decoded to replacement_character(), actually encodes U+FFFD
+		template<typename UTF, typename ForwardIterator>
+		bool is_encoded_replacement(ForwardIterator first, ForwardIterator last)
+		{
+			if constexpr(std::is_same_v<UTF, utf8>)
+			{
+				return std::distance(first, last) == 3 && static_cast<unsigned char>(*first) == 0xEF &&
+					static_cast<unsigned char>(*std::next(first)) == 0xBF && static_cast<unsigned char>(*std::next(first, 2)) == 0xBD;
+			}
+			else {
+				return std::distance(first, last) == 1 && static_cast<codepoint>(*first) == replacement_character();
+			}
+		}
+
+		// the most code units UTF::decode may look at, past which a sequence can't depend on further input
+		template<typename UTF>
+		constexpr std::size_t decode_reach() noexcept
+		{
+			if constexpr(std::is_same_v<UTF, utf8>) {
+				return 6; // trailing[] goes up to 5 for invalid lead bytes
+			}
+			else if constexpr(std::is_same_v<UTF, utf16>) {
+				return 2;
+			}
+			else {
+				return 1;
+			}
+		}
+
+		// converts the sequences of [first, last) which start before 'stop' like UTFI::to_utf8/16/32<conv> would,
+		// adds the number of ill-formed sequences found on the way to 'errors' (they are only detected with
+		// conversion::strict) and returns the beginning of the unconverted part
+		template<typename UTFI, typename UTFO, conversion conv, typename ForwardIterator>
+		ForwardIterator transcode_units(ForwardIterator first, ForwardIterator stop, ForwardIterator last,
+			typename UTFO::string_type& units, std::uint64_t& errors)
+		{
+			if constexpr(std::is_same_v<UTFI, utf32>)
+			{
+				// utf32::to_* don't replace invalid codepoints, they are only counted
+				for (; first != last && first < stop; ++first)
+				{
+					if constexpr(conv == conversion::strict) {
+						errors += !is_valid(*first);
+					}
+					UTFO::encode(*first, std::back_inserter(units));
+				}
+			}
+			else if constexpr(is_single_byte<UTFI>::value)
+			{
+				// a codepoint per byte, widened in bulk
+				const std::size_t count = static_cast<std::size_t>(stop - first);
+				if (count != 0)
+				{
+					const char* const bytes = &*first;
+					if constexpr(std::is_same_v<UTFI, ascii> && conv == conversion::strict) {
+						errors += static_cast<std::uint64_t>(std::count_if(bytes, bytes + count, [](char byte) { return static_cast<unsigned char>(byte) >= 0x80; }));
+					}
+					const std::size_t size = units.size();
+					units.resize(size + count * (std::is_same_v<UTFO, utf8> ? 3 : 1));
+					const auto* const end = widen<UTFI, UTFO>(bytes, bytes + count, &units[size]);
+					units.resize(static_cast<std::size_t>(end - units.data()));
+					first = stop;
+				}
+			}
+			else if constexpr(std::is_same_v<UTFI, UTFO> && conv == conversion::lenient)
+			{
+				units.append(first, stop);
+				first = stop;
+			}
+			else
+			{
+				while (first != last && first < stop)
+				{
+					const ForwardIterator begin = first;
+
+					codepoint cp;
+					first = UTFI::template decode<conv>(first, last, cp);
+					if constexpr(conv == conversion::strict)
+					{
+						if (cp == replacement_character() && !is_encoded_replacement<UTFI>(begin, first)) {
+							++errors;
+						}
+					}
+					if constexpr(std::is_same_v<UTFI, UTFO>) {
+						units.append(begin, first); // to_utf8/to_utf16 of the same format are plain copies
+					}
+					else {
+						UTFO::encode(cp, std::back_inserter(units));
+					}
+				}
+			}
+			return first;
+		}
+
+		// decodes the complete part of 'pending' as UTFI, appends it to 'output' encoded as UTFO with 'out_order',
+		// removes the consumed bytes from 'pending' and returns the number of ill-formed sequences
+		template<typename UTFI, typename UTFO, conversion conv>
+		std::uint64_t transcode_block(std::string& pending, std::string& output, byte_order in_order, byte_order out_order, bool last)
+		{
+			using in_unit = typename UTFI::char_type;
+			constexpr std::size_t in_size = std::is_same_v<UTFI, utf8> ? 1 : sizeof(in_unit);
+			constexpr std::size_t reach = decode_reach<UTFI>();
+
+			// a sequence is only decoded once everything the decoder may read of it is here, so that
+			// splitting the input into blocks can't change the result
+			const auto stop = [last](const auto& in) {
+				return last ? in.cend() : in.size() >= reach ? in.cend() - (reach - 1) : in.cbegin();
+			};
+
+			std::size_t consumed = 0;
+			std::uint64_t errors = 0;
+			typename UTFO::string_type units;
+			if constexpr(std::is_same_v<UTFI, utf8> || is_single_byte<UTFI>::value)
+			{
+				const auto end = transcode_units<UTFI, UTFO, conv>(pending.cbegin(), stop(pending), pending.cend(), units, errors);
+				consumed = static_cast<std::size_t>(end - pending.cbegin());
+			}
+			else
+			{
+				if (last && pending.size() % in_size != 0) {
+					pending.resize((pending.size() / in_size + 1) * in_size); // pad like UTFI::read does
+				}
+
+				typename UTFI::string_type in;
+				in.reserve(pending.size() / in_size);
+				for (std::size_t i = 0; i + in_size <= pending.size(); i += in_size) {
+					in.push_back(load_unit<UTFI>(&pending[i], in_order));
+				}
+				const auto end = transcode_units<UTFI, UTFO, conv>(in.cbegin(), stop(in), in.cend(), units, errors);
+				consumed = static_cast<std::size_t>(end - in.cbegin()) * in_size;
+			}
+			pending.erase(0, consumed);
+
+			if constexpr(std::is_same_v<UTFO, utf8>) {
+				output.append(units);
+			}
+			else {
+				store_units<UTFO>(output, units.begin(), units.end(), out_order);
+			}
+			return errors;
+		}
+
+		template<typename UTFO>
+		std::string_view bom_for(byte_order order) noexcept
+		{
+			if constexpr(std::is_same_v<UTFO, utf8>) {
+				return constants::UTF8_BOM;
+			}
+			else if constexpr(std::is_same_v<UTFO, utf16>) {
+				return order == byte_order::little ? constants::UTF16_LE_BOM : constants::UTF16_BE_BOM;
+			}
+			else if constexpr(std::is_same_v<UTFO, utf32>) {
+				return order == byte_order::little ? constants::UTF32_LE_BOM : constants::UTF32_BE_BOM;
+			}
+		}
+	}
+
+	struct conversion_result
+	{
+		std::string input;
+		std::string output;
+		int error = 0; // errno value, 0 on success
+		std::uint64_t bytes_read = 0;
+		std::uint64_t bytes_written = 0;
+		std::uint64_t errors = 0; // ill-formed sequences in the input, only counted with conversion::strict
+	};
+
+	struct conversion_stats
+	{
+		std::uint64_t bytes_read = 0;
+		std::uint64_t bytes_written = 0;
+		std::uint64_t errors = 0; // ill-formed sequences in the input, only counted with conversion::strict
+	};
+
+	// Incrementally converts the bytes of a file, given in consecutive blocks, to UTFO with the given byte order,
+	// writing a BOM first in the same way UTFO::write<wrbom> does. Sequences split between blocks are carried over.
+	template<typename UTFO = default_utf, conversion conv = conversion::strict, write_bom wrbom = write_bom::yes>
+	class block_transcoder
+	{
+		static_assert(std::is_same_v<UTFO, utf8> || std::is_same_v<UTFO, utf16> || std::is_same_v<UTFO, utf32>,
+			"block_transcoder<UTFO, conv, wrbom> requires UTFO to be one of utf8, utf16, utf32");
+
+		encoding from;
+		byte_order order;
+		bool bom_pending = wrbom == write_bom::yes;
+		std::string pending;
+		std::string head; // output held back until it is known whether it starts with a BOM
+		conversion_stats counters;
+
+	public:
+		block_transcoder(encoding from, byte_order order)
+			: from(from), order(order)
+		{}
+
+		// appends the converted part of 'bytes' to 'output'; the last block of the file must have 'last' set
+		void operator()(std::string_view bytes, std::string& output, bool last)
+		{
+			pending.append(bytes.data(), bytes.size());
+			counters.bytes_read += bytes.size();
+
+			const std::size_t before = output.size();
+			std::string& target = bom_pending ? head : output;
+			switch (from.format)
+			{
+			case format::utf32:
+				counters.errors += detail::transcode_block<utf32, UTFO, conv>(pending, target, from.order, order, last);
+				break;
+			case format::utf16:
+				counters.errors += detail::transcode_block<utf16, UTFO, conv>(pending, target, from.order, order, last);
+				break;
+			case format::ascii:
+				counters.errors += detail::transcode_block<ascii, UTFO, conv>(pending, target, from.order, order, last);
+				break;
+			case format::latin1:
+				counters.errors += detail::transcode_block<latin1, UTFO, conv>(pending, target, from.order, order, last);
+				break;
+			case format::windows1252:
+				counters.errors += detail::transcode_block<windows1252, UTFO, conv>(pending, target, from.order, order, last);
+				break;
+			case format::unknown: // assume ASCII, same as utf8 - only one byte
+			case format::utf8:
+				counters.errors += detail::transcode_block<utf8, UTFO, conv>(pending, target, from.order, order, last);
+				break;
+			}
+
+			const std::string_view bom = detail::bom_for<UTFO>(order);
+			if (bom_pending && (head.size() >= bom.size() || last))
+			{
+				if (head.compare(0, bom.size(), bom) != 0) {
+					output.append(bom.data(), bom.size());
+				}
+				output.append(head);
+				head.clear();
+				bom_pending = false;
+			}
+			counters.bytes_written += output.size() - before;
+		}
+
+		const conversion_stats& stats() const noexcept {
+			return counters;
+		}
+	};
+
+	// Converts the whole of 'in' to UTFO and writes it to 'out', overlapping the three stages:
+	// a reader thread fills blocks of 'block_size' bytes, the calling thread transcodes them and
+	// a writer thread writes the results. The output is the same as that of
+	// write_file<UTFO, wrbom>(out, read_file<UTFO, conv>(in), order). Returns the statistics of the conversion.
+	template<typename UTFO = default_utf, conversion conv = conversion::strict, write_bom wrbom = write_bom::yes>
+	conversion_stats convert_file(uistream& in, uostream& out,
+		byte_order order = std::is_same_v<UTFO, utf8> ? byte_order::none : default_byte_order,
+		std::size_t block_size = default_block_size)
+	{
+		static_assert(std::is_same_v<UTFO, utf8> || std::is_same_v<UTFO, utf16> || std::is_same_v<UTFO, utf32>,
+			"convert_file<UTFO, conv, wrbom> requires UTFO to be one of utf8, utf16, utf32");
+
+		if (std::is_same_v<UTFO, utf8> != (order == byte_order::none)) {
+			return conversion_stats{};
+		}
+		if (block_size == 0) {
+			block_size = default_block_size;
+		}
+
+		const encoding encoding = encoding::get(in);
+		in.clear();
+		in.seekg(0, std::ios::beg);
+
+		detail::block_queue raw;
+		detail::block_queue encoded;
+
+		// an exception of a stage is rethrown once both threads are joined; until then the other stages are let finish
+		std::exception_ptr read_error;
+		std::exception_ptr write_error;
+		std::exception_ptr transcode_error;
+
+		std::thread reader([&]()
+		{
+			try
+			{
+				for (;;)
+				{
+					detail::block block;
+					block.data.resize(block_size);
+					in.read(&block.data[0], block_size);
+					block.data.resize(static_cast<std::size_t>(in.gcount()));
+					const bool last = !in;
+					block.last = last;
+					raw.push(std::move(block));
+					if (last) {
+						break;
+					}
+				}
+				in.clear();
+			}
+			catch (...)
+			{
+				read_error = std::current_exception();
+				detail::block block;
+				block.last = true;
+				raw.push(std::move(block));
+			}
+		});
+
+		std::thread writer([&]()
+		{
+			detail::block block;
+			try
+			{
+				do
+				{
+					encoded.pop(block);
+					if (!block.data.empty()) {
+						out.write(block.data.data(), block.data.size());
+					}
+				} while (!block.last);
+			}
+			catch (...)
+			{
+				write_error = std::current_exception();
+				while (!block.last) {
+					encoded.pop(block);
+				}
+			}
+		});
+
+		block_transcoder<UTFO, conv, wrbom> transcode(encoding, order);
+		detail::block block;
+		try
+		{
+			do
+			{
+				raw.pop(block);
+
+				detail::block result;
+				result.last = block.last;
+				transcode(block.data, result.data, block.last);
+				encoded.push(std::move(result));
+			} while (!block.last);
+		}
+		catch (...)
+		{
+			transcode_error = std::current_exception();
+			while (!block.last) {
+				raw.pop(block);
+			}
+			detail::block end;
+			end.last = true;
+			encoded.push(std::move(end));
+		}
+
+		reader.join();
+		writer.join();
+		for (const std::exception_ptr& error : { transcode_error, read_error, write_error })
+		{
+			if (error) {
+				std::rethrow_exception(error);
+			}
+		}
+		return transcode.stats();
+	}
+}
+
+#endif
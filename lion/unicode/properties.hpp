@@ -0,0 +1,149 @@
+#ifndef LION_UNICODE_PROPERTIES_HPP
+#define LION_UNICODE_PROPERTIES_HPP
+
+#include "codepoint.hpp"
+#include "tables/properties.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace lion::unicode
+{
+	// the properties of a codepoint, 3 bytes
+	struct properties
+	{
+		general_category category = general_category::unassigned;
+		unicode::script script = unicode::script::unknown;
+		unsigned char flags = 0;
+
+		constexpr bool white_space() const noexcept { return (flags & 1) != 0; }
+		constexpr bool default_ignorable() const noexcept { return (flags & 2) != 0; }
+		constexpr bool emoji() const noexcept { return (flags & 4) != 0; }
+	};
+
+	namespace detail
+	{
+		constexpr std::size_t property_index(codepoint cp) noexcept
+		{
+			if (cp > codepoint_max()) {
+				cp = codepoint_max(); // a noncharacter, with the same properties as any invalid codepoint
+			}
+			const std::size_t block = property_stage1[cp >> property_shift];
+			return property_stage2[(block << property_shift) + (cp & ((1u << property_shift) - 1))];
+		}
+
+		constexpr properties make_properties(std::size_t index) noexcept
+		{
+			const auto& record = property_records[index];
+			return properties{ static_cast<general_category>(record[0]), static_cast<script>(record[1]), record[2] };
+		}
+	}
+
+	constexpr properties get_properties(codepoint cp) noexcept {
+		return detail::make_properties(detail::property_index(cp));
+	}
+
+	constexpr general_category get_general_category(codepoint cp) noexcept {
+		return static_cast<general_category>(detail::property_records[detail::property_index(cp)][0]);
+	}
+
+	constexpr script get_script(codepoint cp) noexcept {
+		return static_cast<script>(detail::property_records[detail::property_index(cp)][1]);
+	}
+
+	constexpr bool is_white_space(codepoint cp) noexcept {
+		return (detail::property_records[detail::property_index(cp)][2] & 1) != 0;
+	}
+
+	constexpr bool is_default_ignorable(codepoint cp) noexcept {
+		return (detail::property_records[detail::property_index(cp)][2] & 2) != 0;
+	}
+
+	constexpr bool is_emoji(codepoint cp) noexcept {
+		return (detail::property_records[detail::property_index(cp)][2] & 4) != 0;
+	}
+
+	constexpr bool is_letter(general_category gc) noexcept {
+		return gc <= general_category::other_letter;
+	}
+
+	constexpr bool is_mark(general_category gc) noexcept {
+		return gc >= general_category::nonspacing_mark && gc <= general_category::enclosing_mark;
+	}
+
+	constexpr bool is_number(general_category gc) noexcept {
+		return gc >= general_category::decimal_number && gc <= general_category::other_number;
+	}
+
+	constexpr bool is_punctuation(general_category gc) noexcept {
+		return gc >= general_category::connector_punctuation && gc <= general_category::other_punctuation;
+	}
+
+	constexpr bool is_symbol(general_category gc) noexcept {
+		return gc >= general_category::math_symbol && gc <= general_category::other_symbol;
+	}
+
+	constexpr bool is_separator(general_category gc) noexcept {
+		return gc >= general_category::space_separator && gc <= general_category::paragraph_separator;
+	}
+
+	constexpr bool is_other(general_category gc) noexcept {
+		return gc >= general_category::control;
+	}
+
+	// writes the properties of every codepoint in [first, last) to output
+	template<typename InputIterator, typename OutputIterator>
+	OutputIterator classify(InputIterator first, InputIterator last, OutputIterator output)
+	{
+		if constexpr(std::is_pointer_v<InputIterator> && std::is_pointer_v<OutputIterator>)
+		{
+			// the trie lookups of four codepoints are independent, so the loads can be in flight at the same time
+			for (; last - first >= 4; first += 4, output += 4)
+			{
+				const std::size_t a = detail::property_index(first[0]);
+				const std::size_t b = detail::property_index(first[1]);
+				const std::size_t c = detail::property_index(first[2]);
+				const std::size_t d = detail::property_index(first[3]);
+				output[0] = detail::make_properties(a);
+				output[1] = detail::make_properties(b);
+				output[2] = detail::make_properties(c);
+				output[3] = detail::make_properties(d);
+			}
+		}
+		for (; first != last; ++first) {
+			*output++ = get_properties(*first);
+		}
+		return output;
+	}
+
+	// the union of the flags of every codepoint in [first, last), and whether any of them is in one of the categories
+	struct classification
+	{
+		std::uint32_t categories = 0; // bit n is set for general_category n
+		unsigned char flags = 0;
+
+		constexpr bool contains(general_category gc) const noexcept {
+			return (categories & (std::uint32_t(1) << static_cast<unsigned>(gc))) != 0;
+		}
+
+		constexpr bool white_space() const noexcept { return (flags & 1) != 0; }
+		constexpr bool default_ignorable() const noexcept { return (flags & 2) != 0; }
+		constexpr bool emoji() const noexcept { return (flags & 4) != 0; }
+	};
+
+	template<typename InputIterator>
+	classification classify(InputIterator first, InputIterator last)
+	{
+		classification result;
+		for (; first != last; ++first)
+		{
+			const auto& record = detail::property_records[detail::property_index(*first)];
+			result.categories |= std::uint32_t(1) << record[0];
+			result.flags |= record[2];
+		}
+		return result;
+	}
+}
+
+#endif
@@ -0,0 +1,200 @@
+#ifndef LION_UNICODE_SANITIZE_HPP
+#define LION_UNICODE_SANITIZE_HPP
+
+#include "codepoint.hpp"
+#include "validation.hpp"
+#include "utf8.hpp"
+#include "utf16.hpp"
+#include "utf32.hpp"
+#include "compare.hpp"
+#include "identifier.hpp"
+#include "error_policy.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace lion::unicode
+{
+	// what sanitize does besides replacing ill-formed sequences with U+FFFD, combined with |
+	enum class sanitize_policy : unsigned
+	{
+		none = 0,
+		strip_controls = 1,      // the Cc codepoints except tab, line feed and carriage return
+		strip_bidi_controls = 2, // the bidi embeddings, overrides and isolates U+202A..U+202E and U+2066..U+2069
+		normalize_newlines = 4,  // CR LF and a lone CR to LF
+		all = 7
+	};
+
+	constexpr sanitize_policy operator|(sanitize_policy a, sanitize_policy b) noexcept {
+		return static_cast<sanitize_policy>(static_cast<unsigned>(a) | static_cast<unsigned>(b));
+	}
+
+	constexpr sanitize_policy operator&(sanitize_policy a, sanitize_policy b) noexcept {
+		return static_cast<sanitize_policy>(static_cast<unsigned>(a) & static_cast<unsigned>(b));
+	}
+
+	namespace detail
+	{
+		constexpr bool has_policy(sanitize_policy policy, sanitize_policy flag) noexcept {
+			return (policy & flag) != sanitize_policy::none;
+		}
+
+		template<sanitize_policy policy>
+		constexpr bool is_stripped(codepoint cp) noexcept
+		{
+			if constexpr(has_policy(policy, sanitize_policy::strip_controls))
+			{
+				if ((cp < 0x20 && cp != '\t' && cp != '\n' && cp != '\r') || (cp >= 0x7F && cp <= 0x9F)) {
+					return true;
+				}
+			}
+			if constexpr(has_policy(policy, sanitize_policy::strip_bidi_controls))
+			{
+				if ((cp >= 0x202A && cp <= 0x202E) || (cp >= 0x2066 && cp <= 0x2069)) {
+					return true;
+				}
+			}
+			return false;
+		}
+
+		// the high bit of each byte set if it is printable ascii, a tab or a line feed, which no policy changes
+		constexpr std::uint64_t clean_bytes(std::uint64_t word) noexcept
+		{
+			constexpr std::uint64_t ascii = ~0x8080808080808080ull;
+			return (bytes_in_range(word, ' ', '~') | bytes_in_range(word, '\t', '\n')) & ~(word & ~ascii);
+		}
+
+		// the most code units sanitize writes for one code unit of input
+		template<typename UTFI, typename UTFO>
+		constexpr std::size_t max_sanitize_expansion() noexcept
+		{
+			if constexpr(std::is_same_v<UTFO, utf8>) {
+				return std::is_same_v<UTFI, utf32> ? 4 : 3;
+			}
+			else if constexpr(std::is_same_v<UTFO, utf16>) {
+				return std::is_same_v<UTFI, utf32> ? 2 : 1;
+			}
+			else {
+				return 1;
+			}
+		}
+	}
+
+	// transcodes [first, last) from UTFI to UTFO in one pass, replacing ill-formed sequences with U+FFFD and applying
+	// policy to the codepoints: the stripped codepoints are removed before newlines are normalized, so a CR and a LF with
+	// only stripped codepoints between them become a single LF
+	template<typename UTFI, typename UTFO, sanitize_policy policy = sanitize_policy::all, typename ForwardIterator, typename OutputIterator>
+	OutputIterator sanitize(ForwardIterator first, ForwardIterator last, OutputIterator output)
+	{
+		bool after_cr = false;
+
+		// eight bytes at a time while they are printable ascii, tabs and line feeds
+		auto block = [&after_cr](auto units, auto& out)
+		{
+			if constexpr(std::is_same_v<UTFI, utf8>)
+			{
+				std::uint64_t word;
+				std::memcpy(&word, units, 8);
+				if (after_cr || detail::clean_bytes(word) != 0x8080808080808080ull) {
+					return false;
+				}
+				if constexpr(std::is_same_v<UTFO, utf8> && std::is_pointer_v<OutputIterator>)
+				{
+					std::memcpy(out, units, 8);
+					out += 8;
+				}
+				else {
+					out = std::copy(units, units + 8, out);
+				}
+				return true;
+			}
+			else {
+				return false;
+			}
+		};
+		auto sink = [&after_cr](codepoint cp, OutputIterator& out)
+		{
+			if (detail::is_stripped<policy>(cp)) {
+				return true;
+			}
+			if constexpr(detail::has_policy(policy, sanitize_policy::normalize_newlines))
+			{
+				if (cp == '\n' && after_cr)
+				{
+					after_cr = false;
+					return true;
+				}
+				after_cr = cp == '\r';
+				if (after_cr) {
+					cp = '\n';
+				}
+			}
+			out = UTFO::encode(cp, out);
+			return true;
+		};
+		replace_errors replace;
+		return detail::transcode_checked<UTFI>(first, last, output, replace, replacement_character(), block, sink).output;
+	}
+
+	namespace detail
+	{
+		template<typename UTFI, typename UTFO, sanitize_policy policy>
+		typename UTFO::string_type sanitize_string(typename UTFI::string_view_type view)
+		{
+			typename UTFO::string_type result(view.size() * max_sanitize_expansion<UTFI, UTFO>(), 0);
+			auto* end = sanitize<UTFI, UTFO, policy>(view.data(), view.data() + view.size(), &result[0]);
+			result.resize(static_cast<std::size_t>(end - result.data()));
+			return result;
+		}
+	}
+
+	template<sanitize_policy policy = sanitize_policy::all>
+	utf8::string_type sanitize_to_utf8(utf8::string_view_type view) {
+		return detail::sanitize_string<utf8, utf8, policy>(view);
+	}
+
+	template<sanitize_policy policy = sanitize_policy::all>
+	utf8::string_type sanitize_to_utf8(utf16::string_view_type view) {
+		return detail::sanitize_string<utf16, utf8, policy>(view);
+	}
+
+	template<sanitize_policy policy = sanitize_policy::all>
+	utf8::string_type sanitize_to_utf8(utf32::string_view_type view) {
+		return detail::sanitize_string<utf32, utf8, policy>(view);
+	}
+
+	template<sanitize_policy policy = sanitize_policy::all>
+	utf16::string_type sanitize_to_utf16(utf8::string_view_type view) {
+		return detail::sanitize_string<utf8, utf16, policy>(view);
+	}
+
+	template<sanitize_policy policy = sanitize_policy::all>
+	utf16::string_type sanitize_to_utf16(utf16::string_view_type view) {
+		return detail::sanitize_string<utf16, utf16, policy>(view);
+	}
+
+	template<sanitize_policy policy = sanitize_policy::all>
+	utf16::string_type sanitize_to_utf16(utf32::string_view_type view) {
+		return detail::sanitize_string<utf32, utf16, policy>(view);
+	}
+
+	template<sanitize_policy policy = sanitize_policy::all>
+	utf32::string_type sanitize_to_utf32(utf8::string_view_type view) {
+		return detail::sanitize_string<utf8, utf32, policy>(view);
+	}
+
+	template<sanitize_policy policy = sanitize_policy::all>
+	utf32::string_type sanitize_to_utf32(utf16::string_view_type view) {
+		return detail::sanitize_string<utf16, utf32, policy>(view);
+	}
+
+	template<sanitize_policy policy = sanitize_policy::all>
+	utf32::string_type sanitize_to_utf32(utf32::string_view_type view) {
+		return detail::sanitize_string<utf32, utf32, policy>(view);
+	}
+}
+
+#endif
@@ -0,0 +1,338 @@
+#ifndef LION_UNICODE_SEARCH_HPP
+#define LION_UNICODE_SEARCH_HPP
+
+#include "codepoint.hpp"
+#include "validation.hpp"
+#include "utf8.hpp"
+#include "utf16.hpp"
+#include "utf32.hpp"
+#include "compare.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace lion::unicode
+{
+	// a position in a sequence, both in code units and in codepoints
+	struct text_position
+	{
+		static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+		std::size_t units = npos;
+		std::size_t codepoints = npos;
+
+		constexpr bool found() const noexcept { return units != npos; }
+	};
+
+	namespace detail
+	{
+		// counts the codepoints from position, which starts a sequence, to target: false if target is inside a sequence,
+		// then position is the end of that sequence
+		template<typename UTF, typename Char>
+		bool advance_to(const Char* data, std::size_t size, text_position& position, std::size_t target) noexcept
+		{
+			const Char* first = data + position.units;
+			const Char* const stop = data + target;
+			std::size_t codepoints = position.codepoints;
+			while (first < stop)
+			{
+				if constexpr(std::is_same_v<UTF, utf8>)
+				{
+					std::uint64_t word;
+					for (; stop - first >= 8; first += 8, codepoints += 8)
+					{
+						std::memcpy(&word, first, 8);
+						if ((word & 0x8080808080808080ull) != 0) {
+							break;
+						}
+					}
+					if (first == stop) {
+						break;
+					}
+				}
+
+				if (is_whole<UTF>(static_cast<typename UTF::char_type>(*first))) {
+					++first;
+				}
+				else
+				{
+					codepoint cp;
+					decode_error error;
+					first = UTF::decode(first, data + size, cp, error);
+				}
+				++codepoints;
+			}
+			position = text_position{ static_cast<std::size_t>(first - data), codepoints };
+			return first == stop;
+		}
+
+		// the code units of a word
+		template<typename Char>
+		constexpr std::size_t word_units = 8 / sizeof(Char);
+
+		// the high bit of each code unit of a word set where both a and b are zero, and maybe above one where they are
+		template<typename Char>
+		constexpr std::uint64_t both_zero(std::uint64_t a, std::uint64_t b) noexcept
+		{
+			constexpr std::uint64_t ones = ~std::uint64_t(0) / ((std::uint64_t(1) << (4 * sizeof(Char)) << (4 * sizeof(Char))) - 1);
+			constexpr std::uint64_t high = ones << (8 * sizeof(Char) - 1);
+			return (a - ones) & ~a & (b - ones) & ~b & high;
+		}
+
+		template<typename Char>
+		constexpr std::uint64_t broadcast(Char unit) noexcept
+		{
+			constexpr std::uint64_t ones = ~std::uint64_t(0) / ((std::uint64_t(1) << (4 * sizeof(Char)) << (4 * sizeof(Char))) - 1);
+			return ones * static_cast<std::make_unsigned_t<Char>>(unit);
+		}
+
+		template<typename Char>
+		bool is_match(const Char* haystack, const Char* needle, std::size_t size) noexcept {
+			return std::char_traits<Char>::compare(haystack, needle, size) == 0;
+		}
+
+		// the first position of [from, last] where the needle is, last = size - needle_size: candidates are filtered a word of
+		// code units at a time by comparing their first and last unit with those of the needle
+		template<typename Char>
+		std::size_t find_units(const Char* haystack, std::size_t last, const Char* needle, std::size_t size, std::size_t from) noexcept
+		{
+			const Char front = needle[0];
+			const Char back = needle[size - 1];
+			const std::uint64_t fronts = broadcast(front);
+			const std::uint64_t backs = broadcast(back);
+			std::size_t i = from;
+			for (; i <= last && last - i >= word_units<Char>; i += word_units<Char>)
+			{
+				std::uint64_t a;
+				std::uint64_t b;
+				std::memcpy(&a, haystack + i, 8);
+				std::memcpy(&b, haystack + i + size - 1, 8);
+				if (both_zero<Char>(a ^ fronts, b ^ backs) == 0) {
+					continue;
+				}
+				for (std::size_t j = i; j < i + word_units<Char>; ++j)
+				{
+					if (haystack[j] == front && haystack[j + size - 1] == back && is_match(haystack + j, needle, size)) {
+						return j;
+					}
+				}
+			}
+			for (; i <= last; ++i)
+			{
+				if (haystack[i] == front && haystack[i + size - 1] == back && is_match(haystack + i, needle, size)) {
+					return i;
+				}
+			}
+			return text_position::npos;
+		}
+
+		// the last position of [0, before) where the needle is
+		template<typename Char>
+		std::size_t rfind_units(const Char* haystack, const Char* needle, std::size_t size, std::size_t before) noexcept
+		{
+			const Char front = needle[0];
+			const Char back = needle[size - 1];
+			const std::uint64_t fronts = broadcast(front);
+			const std::uint64_t backs = broadcast(back);
+			std::size_t i = before;
+			for (; i >= word_units<Char>; i -= word_units<Char>)
+			{
+				std::uint64_t a;
+				std::uint64_t b;
+				std::memcpy(&a, haystack + i - word_units<Char>, 8);
+				std::memcpy(&b, haystack + i - word_units<Char> + size - 1, 8);
+				if (both_zero<Char>(a ^ fronts, b ^ backs) == 0) {
+					continue;
+				}
+				for (std::size_t j = i; j-- > i - word_units<Char>;)
+				{
+					if (haystack[j] == front && haystack[j + size - 1] == back && is_match(haystack + j, needle, size)) {
+						return j;
+					}
+				}
+			}
+			while (i-- > 0)
+			{
+				if (haystack[i] == front && haystack[i + size - 1] == back && is_match(haystack + i, needle, size)) {
+					return i;
+				}
+			}
+			return text_position::npos;
+		}
+
+		// a well-formed needle only matches whole sequences, otherwise every match is checked
+		template<typename UTF, typename Char>
+		bool is_well_formed(const Char* needle, std::size_t size)
+		{
+			// the checked decode stops at the end of the needle and splits it like advance_to
+			const Char* first = needle;
+			const Char* const last = needle + size;
+			while (first != last)
+			{
+				codepoint cp;
+				decode_error error;
+				first = UTF::decode(first, last, cp, error);
+				if (error != decode_error::none) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		template<typename UTF, typename Char>
+		text_position find(const Char* haystack, std::size_t haystack_size, const Char* needle, std::size_t size)
+		{
+			if (size == 0) {
+				return text_position{ 0, 0 };
+			}
+			if (size > haystack_size) {
+				return text_position{};
+			}
+
+			const bool well_formed = is_well_formed<UTF>(needle, size);
+			text_position position{ 0, 0 };
+			for (std::size_t from = 0;;)
+			{
+				const std::size_t found = find_units(haystack, haystack_size - size, needle, size, from);
+				if (found == text_position::npos) {
+					return text_position{};
+				}
+				if (!advance_to<UTF>(haystack, haystack_size, position, found))
+				{
+					from = position.units;
+					continue;
+				}
+				text_position end = position;
+				if (well_formed || advance_to<UTF>(haystack, haystack_size, end, found + size)) {
+					return position;
+				}
+				from = found + 1;
+			}
+		}
+
+		template<typename UTF, typename Char>
+		text_position rfind(const Char* haystack, std::size_t haystack_size, const Char* needle, std::size_t size)
+		{
+			if (size > haystack_size) {
+				return text_position{};
+			}
+			text_position position{ 0, 0 };
+			if (size == 0)
+			{
+				advance_to<UTF>(haystack, haystack_size, position, haystack_size);
+				return position;
+			}
+
+			const bool well_formed = is_well_formed<UTF>(needle, size);
+			for (std::size_t before = haystack_size - size + 1;;)
+			{
+				const std::size_t found = rfind_units(haystack, needle, size, before);
+				if (found == text_position::npos) {
+					return text_position{};
+				}
+				// the codepoints are counted from the start again, as a match inside a sequence moves the position past it
+				position = text_position{ 0, 0 };
+				if (advance_to<UTF>(haystack, haystack_size, position, found))
+				{
+					text_position end = position;
+					if (well_formed || advance_to<UTF>(haystack, haystack_size, end, found + size)) {
+						return position;
+					}
+				}
+				before = found;
+			}
+		}
+
+		template<typename UTF, typename Char>
+		std::size_t count(const Char* haystack, std::size_t haystack_size, const Char* needle, std::size_t size)
+		{
+			text_position position{ 0, 0 };
+			if (size == 0)
+			{
+				advance_to<UTF>(haystack, haystack_size, position, haystack_size);
+				return position.codepoints + 1;
+			}
+			if (size > haystack_size) {
+				return 0;
+			}
+
+			// the matches of a well-formed needle are whole sequences, so they are counted without decoding
+			const bool well_formed = is_well_formed<UTF>(needle, size);
+			std::size_t matches = 0;
+			for (std::size_t from = 0; from <= haystack_size - size;)
+			{
+				const std::size_t found = find_units(haystack, haystack_size - size, needle, size, from);
+				if (found == text_position::npos) {
+					break;
+				}
+				if (well_formed)
+				{
+					++matches;
+					from = found + size;
+					continue;
+				}
+				if (!advance_to<UTF>(haystack, haystack_size, position, found))
+				{
+					from = position.units;
+					continue;
+				}
+				text_position end = position;
+				if (advance_to<UTF>(haystack, haystack_size, end, found + size))
+				{
+					++matches;
+					position = end;
+					from = found + size;
+				}
+				else {
+					from = found + 1;
+				}
+			}
+			return matches;
+		}
+	}
+
+	// the first occurrence of needle in haystack which starts and ends between two codepoints, in code units and in
+	// codepoints from the start of haystack, or a position which isn't found()
+	inline text_position find(utf8::string_view_type haystack, utf8::string_view_type needle) {
+		return detail::find<utf8>(haystack.data(), haystack.size(), needle.data(), needle.size());
+	}
+
+	inline text_position find(utf16::string_view_type haystack, utf16::string_view_type needle) {
+		return detail::find<utf16>(haystack.data(), haystack.size(), needle.data(), needle.size());
+	}
+
+	inline text_position find(utf32::string_view_type haystack, utf32::string_view_type needle) {
+		return detail::find<utf32>(haystack.data(), haystack.size(), needle.data(), needle.size());
+	}
+
+	// the last occurrence
+	inline text_position rfind(utf8::string_view_type haystack, utf8::string_view_type needle) {
+		return detail::rfind<utf8>(haystack.data(), haystack.size(), needle.data(), needle.size());
+	}
+
+	inline text_position rfind(utf16::string_view_type haystack, utf16::string_view_type needle) {
+		return detail::rfind<utf16>(haystack.data(), haystack.size(), needle.data(), needle.size());
+	}
+
+	inline text_position rfind(utf32::string_view_type haystack, utf32::string_view_type needle) {
+		return detail::rfind<utf32>(haystack.data(), haystack.size(), needle.data(), needle.size());
+	}
+
+	// the number of occurrences which don't overlap, an empty needle occurs between every two codepoints
+	inline std::size_t count(utf8::string_view_type haystack, utf8::string_view_type needle) {
+		return detail::count<utf8>(haystack.data(), haystack.size(), needle.data(), needle.size());
+	}
+
+	inline std::size_t count(utf16::string_view_type haystack, utf16::string_view_type needle) {
+		return detail::count<utf16>(haystack.data(), haystack.size(), needle.data(), needle.size());
+	}
+
+	inline std::size_t count(utf32::string_view_type haystack, utf32::string_view_type needle) {
+		return detail::count<utf32>(haystack.data(), haystack.size(), needle.data(), needle.size());
+	}
+}
+
+#endif
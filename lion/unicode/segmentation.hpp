@@ -0,0 +1,522 @@
+#ifndef LION_UNICODE_SEGMENTATION_HPP
+#define LION_UNICODE_SEGMENTATION_HPP
+
+#include "codepoint.hpp"
+#include "utf8.hpp"
+#include "utf16.hpp"
+#include "utf32.hpp"
+#include "tables/breaks.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+namespace lion::unicode
+{
+	namespace detail
+	{
+		constexpr std::uint16_t break_value(codepoint cp) noexcept
+		{
+			if (cp > codepoint_max()) {
+				cp = codepoint_max();
+			}
+			const std::size_t block = break_stage1[cp >> break_shift];
+			return break_stage2[(block << break_shift) + (cp & ((1u << break_shift) - 1))];
+		}
+
+		constexpr grapheme_cluster_break grapheme_of(std::uint16_t value) noexcept {
+			return static_cast<grapheme_cluster_break>(value & 0x0F);
+		}
+
+		constexpr word_break word_of(std::uint16_t value) noexcept {
+			return static_cast<word_break>((value >> 4) & 0x1F);
+		}
+
+		constexpr bool pictographic(std::uint16_t value) noexcept {
+			return (value & 0x200) != 0;
+		}
+
+		template<typename UTF, typename ForwardIterator>
+		std::uint16_t decode_break_value(ForwardIterator& first, ForwardIterator last)
+		{
+			codepoint cp;
+			decode_error error;
+			first = UTF::decode(first, last, cp, error);
+			return break_value(cp);
+		}
+
+		// decodes the codepoint at first and returns its break properties, ill-formed sequences count as U+FFFD
+		template<typename UTF, typename ForwardIterator>
+		std::uint16_t next_break_value(ForwardIterator& first, ForwardIterator last)
+		{
+			const codepoint unit = static_cast<typename UTF::char_type>(*first);
+			if (unit < 0x80)
+			{
+				// the ascii codepoints are the first block of the table
+				++first;
+				return break_stage2[unit];
+			}
+
+			// the common cases are decoded here, anything else by UTF::decode
+			if constexpr(std::is_same_v<UTF, utf8>)
+			{
+				if (unit >= 0xC2 && unit <= 0xDF)
+				{
+					const ForwardIterator second = std::next(first);
+					if (second != last)
+					{
+						const codepoint next = static_cast<typename UTF::char_type>(*second);
+						if ((next & 0xC0) == 0x80)
+						{
+							first = std::next(second);
+							return break_value(((unit & 0x1F) << 6) | (next & 0x3F));
+						}
+					}
+				}
+			}
+			else if (!is_surrogate(unit) && unit <= codepoint_max())
+			{
+				++first;
+				return break_value(unit);
+			}
+			return decode_break_value<UTF>(first, last);
+		}
+	}
+
+	constexpr grapheme_cluster_break get_grapheme_cluster_break(codepoint cp) noexcept {
+		return detail::grapheme_of(detail::break_value(cp));
+	}
+
+	constexpr word_break get_word_break(codepoint cp) noexcept {
+		return detail::word_of(detail::break_value(cp));
+	}
+
+	constexpr bool is_extended_pictographic(codepoint cp) noexcept {
+		return detail::pictographic(detail::break_value(cp));
+	}
+
+	namespace detail
+	{
+		// whether two codepoints are in the same cluster by the rules which don't depend on anything before them
+		constexpr bool grapheme_join(grapheme_cluster_break previous, grapheme_cluster_break current) noexcept
+		{
+			using gcb = grapheme_cluster_break;
+
+			if (previous == gcb::cr) {
+				return current == gcb::lf; // GB3
+			}
+			if (previous == gcb::lf || previous == gcb::control || current == gcb::cr || current == gcb::lf || current == gcb::control) {
+				return false; // GB4, GB5
+			}
+			if (previous == gcb::l && (current == gcb::l || current == gcb::v || current == gcb::lv || current == gcb::lvt)) {
+				return true; // GB6
+			}
+			if ((previous == gcb::lv || previous == gcb::v) && (current == gcb::v || current == gcb::t)) {
+				return true; // GB7
+			}
+			if ((previous == gcb::lvt || previous == gcb::t) && current == gcb::t) {
+				return true; // GB8
+			}
+			return current == gcb::extend || current == gcb::zwj || current == gcb::spacing_mark || previous == gcb::prepend; // GB9, GB9a, GB9b
+		}
+
+		struct grapheme_pair_table
+		{
+			bool joins[14][14] = {};
+
+			constexpr grapheme_pair_table()
+			{
+				for (std::size_t i = 0; i < 14; ++i)
+				{
+					for (std::size_t j = 0; j < 14; ++j) {
+						joins[i][j] = grapheme_join(static_cast<grapheme_cluster_break>(i), static_cast<grapheme_cluster_break>(j));
+					}
+				}
+			}
+
+			constexpr const bool* operator[](std::size_t i) const { return joins[i]; }
+		};
+
+		inline constexpr grapheme_pair_table grapheme_pairs;
+	}
+
+	namespace detail
+	{
+		template<typename UTF, typename ForwardIterator>
+		ForwardIterator next_grapheme_break(ForwardIterator first, ForwardIterator last)
+		{
+			using gcb = grapheme_cluster_break;
+
+			std::uint16_t value = next_break_value<UTF>(first, last);
+			gcb previous = grapheme_of(value);
+			bool emoji = pictographic(value); // the cluster ends with ExtPict Extend*
+			bool emoji_zwj = false;           // the cluster ends with ExtPict Extend* ZWJ
+			std::size_t regional = previous == gcb::regional_indicator ? 1 : 0;
+
+			while (first != last)
+			{
+				ForwardIterator next = first;
+				value = next_break_value<UTF>(next, last);
+				const gcb current = grapheme_of(value);
+
+				bool join = grapheme_pairs[static_cast<std::size_t>(previous)][static_cast<std::size_t>(current)];
+				if (previous == gcb::zwj && !join) {
+					join = emoji_zwj && pictographic(value); // GB11
+				}
+				else if (previous == gcb::regional_indicator && current == gcb::regional_indicator) {
+					join = regional % 2 == 1; // GB12, GB13
+				}
+
+				if (!join) {
+					break;
+				}
+
+				emoji_zwj = current == gcb::zwj && emoji;
+				if (pictographic(value)) {
+					emoji = true;
+				}
+				else if (current != gcb::extend) {
+					emoji = false;
+				}
+				regional = current == gcb::regional_indicator ? regional + 1 : 0;
+				previous = current;
+				first = next;
+			}
+			return first;
+		}
+	}
+
+	// returns the end of the extended grapheme cluster which starts at first, following the rules of UAX #29
+	template<typename UTF, typename ForwardIterator>
+	ForwardIterator next_grapheme_break(ForwardIterator first, ForwardIterator last)
+	{
+		if (first == last) {
+			return last;
+		}
+
+		// two ascii characters are always in different clusters, except CR LF
+		const codepoint unit = static_cast<typename UTF::char_type>(*first);
+		if (unit < 0x80)
+		{
+			const ForwardIterator second = std::next(first);
+			if (second == last) {
+				return second;
+			}
+			const codepoint next = static_cast<typename UTF::char_type>(*second);
+			if (next < 0x80) {
+				return unit == '\r' && next == '\n' ? std::next(second) : second;
+			}
+		}
+		return detail::next_grapheme_break<UTF>(first, last);
+	}
+
+	namespace detail
+	{
+		template<typename UTF, typename ForwardIterator>
+		ForwardIterator next_word_break(ForwardIterator first, ForwardIterator last)
+		{
+			using wb = word_break;
+
+			constexpr auto ignored = [](wb w) { return w == wb::extend || w == wb::format || w == wb::zwj; };
+			constexpr auto letter = [](wb w) { return w == wb::aletter || w == wb::hebrew_letter; };
+			constexpr auto mid_letter = [](wb w) { return w == wb::mid_letter || w == wb::mid_num_let || w == wb::single_quote; };
+			constexpr auto mid_num = [](wb w) { return w == wb::mid_num || w == wb::mid_num_let || w == wb::single_quote; };
+
+			// the property of the next codepoint after it which isn't ignored by WB4
+			const auto lookahead = [&](ForwardIterator it)
+			{
+				while (it != last)
+				{
+					const wb w = word_of(next_break_value<UTF>(it, last));
+					if (!ignored(w)) {
+						return w;
+					}
+				}
+				return wb::other;
+			};
+
+			std::uint16_t value = next_break_value<UTF>(first, last);
+			wb raw = word_of(value); // the property of the last codepoint
+			wb previous = raw;       // the property of the last codepoint which isn't ignored by WB4
+			wb before = wb::other;   // the one before previous
+			std::size_t regional = previous == wb::regional_indicator ? 1 : 0;
+
+			while (first != last)
+			{
+				ForwardIterator next = first;
+				value = next_break_value<UTF>(next, last);
+				const wb current = word_of(value);
+
+				bool join;
+				if (raw == wb::cr && current == wb::lf) {
+					join = true; // WB3
+				}
+				else if (raw == wb::newline || raw == wb::cr || raw == wb::lf
+					|| current == wb::newline || current == wb::cr || current == wb::lf) {
+					join = false; // WB3a, WB3b
+				}
+				else if ((raw == wb::zwj && pictographic(value)) || (raw == wb::wseg_space && current == wb::wseg_space)) {
+					join = true; // WB3c, WB3d
+				}
+				else if (ignored(current))
+				{
+					// WB4, ignored codepoints attach to the previous one and are otherwise invisible
+					raw = current;
+					first = next;
+					continue;
+				}
+				else if (letter(previous) && letter(current)) {
+					join = true; // WB5
+				}
+				else if (letter(previous) && mid_letter(current)) {
+					join = letter(lookahead(next)) // WB6
+						|| (previous == wb::hebrew_letter && current == wb::single_quote); // WB7a
+				}
+				else if (letter(before) && mid_letter(previous) && letter(current)) {
+					join = true; // WB7
+				}
+				else if (previous == wb::hebrew_letter && current == wb::single_quote) {
+					join = true; // WB7a
+				}
+				else if (previous == wb::hebrew_letter && current == wb::double_quote) {
+					join = lookahead(next) == wb::hebrew_letter; // WB7b
+				}
+				else if (before == wb::hebrew_letter && previous == wb::double_quote && current == wb::hebrew_letter) {
+					join = true; // WB7c
+				}
+				else if ((previous == wb::numeric || letter(previous)) && (current == wb::numeric || letter(current))) {
+					join = true; // WB8, WB9, WB10
+				}
+				else if (before == wb::numeric && mid_num(previous) && current == wb::numeric) {
+					join = true; // WB11
+				}
+				else if (previous == wb::numeric && mid_num(current)) {
+					join = lookahead(next) == wb::numeric; // WB12
+				}
+				else if (previous == wb::katakana && current == wb::katakana) {
+					join = true; // WB13
+				}
+				else if (current == wb::extend_num_let) {
+					join = letter(previous) || previous == wb::numeric || previous == wb::katakana
+						|| previous == wb::extend_num_let; // WB13a
+				}
+				else if (previous == wb::extend_num_let) {
+					join = letter(current) || current == wb::numeric || current == wb::katakana; // WB13b
+				}
+				else {
+					join = previous == wb::regional_indicator && current == wb::regional_indicator && regional % 2 == 1; // WB15, WB16
+				}
+
+				if (!join) {
+					break;
+				}
+
+				regional = current == wb::regional_indicator ? regional + 1 : 0;
+				before = previous;
+				previous = current;
+				raw = current;
+				first = next;
+			}
+			return first;
+		}
+	}
+
+	// returns the next word boundary after first, which must be a word boundary, following the rules of UAX #29
+	template<typename UTF, typename ForwardIterator>
+	ForwardIterator next_word_break(ForwardIterator first, ForwardIterator last)
+	{
+		using wb = word_break;
+
+		if (first == last) {
+			return last;
+		}
+
+		const codepoint unit = static_cast<typename UTF::char_type>(*first);
+		if (unit < 0x80)
+		{
+			// an ascii character breaks from a following ascii character, except for the cases below
+			ForwardIterator next = std::next(first);
+			const wb w = detail::word_of(detail::break_stage2[unit]);
+			if (w == wb::aletter || w == wb::numeric || w == wb::extend_num_let)
+			{
+				// WB5, WB8, WB9, WB10, WB13a, WB13b
+				while (next != last)
+				{
+					const codepoint c = static_cast<typename UTF::char_type>(*next);
+					const wb n = c < 0x80 ? detail::word_of(detail::break_stage2[c]) : wb::other;
+					if (c >= 0x80 || n == wb::mid_letter || n == wb::mid_num || n == wb::mid_num_let || n == wb::single_quote) {
+						return detail::next_word_break<UTF>(first, last);
+					}
+					if (n != wb::aletter && n != wb::numeric && n != wb::extend_num_let) {
+						break;
+					}
+					++next;
+				}
+				return next;
+			}
+			if (w == wb::wseg_space)
+			{
+				// WB3d
+				while (next != last && static_cast<typename UTF::char_type>(*next) == ' ') {
+					++next;
+				}
+			}
+			else if (w == wb::cr && next != last && *next == '\n') {
+				return ++next; // WB3
+			}
+			if (next == last || static_cast<typename UTF::char_type>(*next) < 0x80) {
+				return next;
+			}
+		}
+		return detail::next_word_break<UTF>(first, last);
+	}
+
+	// a grapheme cluster or a word, as the range of code units [first, last)
+	template<typename Iterator>
+	struct text_segment
+	{
+		Iterator first;
+		Iterator last;
+
+		Iterator begin() const { return first; }
+		Iterator end() const { return last; }
+		bool empty() const { return first == last; }
+	};
+
+	namespace detail
+	{
+		struct grapheme_boundary
+		{
+			template<typename UTF, typename ForwardIterator>
+			static ForwardIterator next(ForwardIterator first, ForwardIterator last) {
+				return unicode::next_grapheme_break<UTF>(first, last);
+			}
+		};
+
+		struct word_boundary
+		{
+			template<typename UTF, typename ForwardIterator>
+			static ForwardIterator next(ForwardIterator first, ForwardIterator last) {
+				return unicode::next_word_break<UTF>(first, last);
+			}
+		};
+	}
+
+	// iterates over the segments of [first, last), a grapheme_iterator or word_iterator
+	template<typename UTF, typename Iterator, typename Boundary>
+	class segment_iterator
+	{
+	public:
+		using value_type		= text_segment<Iterator>;
+		using difference_type   = std::ptrdiff_t;
+		using pointer			= void;
+		using reference			= value_type;
+		using iterator_category = std::forward_iterator_tag;
+		using iterator_type		= Iterator;
+
+	protected:
+		iterator_type current;
+		iterator_type next;
+		iterator_type last;
+
+	public:
+		segment_iterator() noexcept
+			: current(), next(), last()
+		{}
+
+		segment_iterator(iterator_type first, iterator_type last)
+			: current(first), next(Boundary::template next<UTF>(first, last)), last(last)
+		{}
+
+		reference operator*() const {
+			return value_type{ current, next };
+		}
+
+		segment_iterator& operator++()
+		{
+			current = next;
+			next = Boundary::template next<UTF>(next, last);
+			return *this;
+		}
+
+		segment_iterator operator++(int)
+		{
+			segment_iterator temp = *this;
+			++(*this);
+			return temp;
+		}
+
+		iterator_type base() const {
+			return current;
+		}
+
+		bool operator==(const segment_iterator& rhs) const {
+			return current == rhs.current;
+		}
+
+		bool operator!=(const segment_iterator& rhs) const {
+			return current != rhs.current;
+		}
+	};
+
+	template<typename UTF, typename Iterator>
+	using grapheme_iterator = segment_iterator<UTF, Iterator, detail::grapheme_boundary>;
+
+	template<typename UTF, typename Iterator>
+	using word_iterator = segment_iterator<UTF, Iterator, detail::word_boundary>;
+
+	template<typename SegmentIterator>
+	class segment_range
+	{
+	public:
+		using iterator = SegmentIterator;
+
+		segment_range(typename iterator::iterator_type first, typename iterator::iterator_type last)
+			: first(first, last), last(last, last)
+		{}
+
+		iterator begin() const { return first; }
+		iterator end() const { return last; }
+
+	private:
+		iterator first;
+		iterator last;
+	};
+
+	template<typename UTF, typename Iterator>
+	segment_range<grapheme_iterator<UTF, Iterator>> graphemes(Iterator first, Iterator last) {
+		return segment_range<grapheme_iterator<UTF, Iterator>>(first, last);
+	}
+
+	inline auto graphemes(utf8::string_view_type view) {
+		return graphemes<utf8>(view.begin(), view.end());
+	}
+
+	inline auto graphemes(utf16::string_view_type view) {
+		return graphemes<utf16>(view.begin(), view.end());
+	}
+
+	inline auto graphemes(utf32::string_view_type view) {
+		return graphemes<utf32>(view.begin(), view.end());
+	}
+
+	template<typename UTF, typename Iterator>
+	segment_range<word_iterator<UTF, Iterator>> words(Iterator first, Iterator last) {
+		return segment_range<word_iterator<UTF, Iterator>>(first, last);
+	}
+
+	inline auto words(utf8::string_view_type view) {
+		return words<utf8>(view.begin(), view.end());
+	}
+
+	inline auto words(utf16::string_view_type view) {
+		return words<utf16>(view.begin(), view.end());
+	}
+
+	inline auto words(utf32::string_view_type view) {
+		return words<utf32>(view.begin(), view.end());
+	}
+}
+
+#endif
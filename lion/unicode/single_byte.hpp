@@ -0,0 +1,308 @@
+#ifndef LION_UNICODE_SINGLE_BYTE_HPP
+#define LION_UNICODE_SINGLE_BYTE_HPP
+
+#include "codepoint.hpp"
+#include "encoding.hpp"
+#include "validation.hpp"
+#include "utf8.hpp"
+#include "utf16.hpp"
+#include "utf32.hpp"
+#include "compare.hpp"
+#include "error_policy.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace lion::unicode
+{
+	namespace detail
+	{
+		// what the single byte character sets have in common, decoding like the utf classes do so that the conversions
+		// of files can use them in the same way
+		template<typename Charset>
+		class single_byte_charset
+		{
+		public:
+			using string_type	   = std::string;
+			using string_view_type = std::string_view;
+			using char_type		   = unsigned char;
+
+			template<conversion = conversion::strict, typename ForwardIterator>
+			static constexpr ForwardIterator decode(ForwardIterator first, ForwardIterator, codepoint& cp)
+			{
+				cp = Charset::to_codepoint(static_cast<unsigned char>(*first));
+				return ++first;
+			}
+
+			template<typename ForwardIterator>
+			static constexpr ForwardIterator decode(ForwardIterator first, ForwardIterator, codepoint& cp, decode_error& error)
+			{
+				cp = Charset::to_codepoint(static_cast<unsigned char>(*first));
+				error = cp == replacement_character() ? decode_error::invalid : decode_error::none;
+				return ++first;
+			}
+		};
+	}
+
+	// US-ASCII, the bytes above 0x7F are ill-formed
+	class ascii : public detail::single_byte_charset<ascii>
+	{
+	public:
+		// the codepoints below which are the bytes of the same value
+		static constexpr codepoint identical_below = 0x80;
+
+		static constexpr codepoint to_codepoint(unsigned char byte) noexcept {
+			return byte < 0x80 ? byte : replacement_character();
+		}
+
+		// whether cp has a byte, which is stored in byte
+		static constexpr bool to_byte(codepoint cp, unsigned char& byte) noexcept
+		{
+			byte = static_cast<unsigned char>(cp);
+			return cp < 0x80;
+		}
+	};
+
+	// ISO-8859-1, whose bytes are the codepoints U+0000..U+00FF
+	class latin1 : public detail::single_byte_charset<latin1>
+	{
+	public:
+		static constexpr codepoint identical_below = 0x100;
+
+		static constexpr codepoint to_codepoint(unsigned char byte) noexcept {
+			return byte;
+		}
+
+		static constexpr bool to_byte(codepoint cp, unsigned char& byte) noexcept
+		{
+			byte = static_cast<unsigned char>(cp);
+			return cp < 0x100;
+		}
+	};
+
+	// Windows-1252, which is Latin-1 with printable characters instead of most C1 controls; the five bytes it doesn't
+	// define are the C1 controls of the same value, as in the WHATWG encoding standard, so that any bytes round trip
+	class windows1252 : public detail::single_byte_charset<windows1252>
+	{
+		static constexpr char16_t c1[32] = {
+			0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+			0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178
+		};
+
+	public:
+		static constexpr codepoint identical_below = 0x80;
+
+		static constexpr codepoint to_codepoint(unsigned char byte) noexcept {
+			return byte >= 0x80 && byte < 0xA0 ? c1[byte - 0x80] : byte;
+		}
+
+		static constexpr bool to_byte(codepoint cp, unsigned char& byte) noexcept
+		{
+			byte = static_cast<unsigned char>(cp);
+			if (cp < 0x80 || (cp >= 0xA0 && cp < 0x100)) {
+				return true;
+			}
+			for (unsigned i = 0; i < 32; ++i)
+			{
+				if (c1[i] == cp)
+				{
+					byte = static_cast<unsigned char>(0x80 + i);
+					return true;
+				}
+			}
+			return false;
+		}
+	};
+
+	namespace detail
+	{
+		template<typename UTF>
+		struct is_single_byte : std::is_base_of<single_byte_charset<UTF>, UTF> {};
+
+		// whether the eight bytes at bytes are the codepoints of the same value in Charset
+		template<typename Charset>
+		bool is_identical_word(const char* bytes) noexcept
+		{
+			if constexpr(std::is_same_v<Charset, latin1>) {
+				return true;
+			}
+			else
+			{
+				std::uint64_t word;
+				std::memcpy(&word, bytes, 8);
+				if constexpr(std::is_same_v<Charset, windows1252>) {
+					// the high bit of the bytes 0x80..0x9F, whose next two bits are clear
+					return (word & ~(word << 1) & ~(word << 2) & 0x8080808080808080ull) == 0;
+				}
+				else {
+					return (word & 0x8080808080808080ull) == 0;
+				}
+			}
+		}
+
+		template<typename Charset, typename OutputIterator>
+		OutputIterator widen_to_utf8(unsigned char byte, OutputIterator output)
+		{
+			const codepoint cp = Charset::to_codepoint(byte);
+			if (cp < 0x80) {
+				*output++ = static_cast<char>(cp);
+			}
+			else if (cp < 0x800)
+			{
+				*output++ = static_cast<char>(0xC0 | (cp >> 6));
+				*output++ = static_cast<char>(0x80 | (cp & 0x3F));
+			}
+			else {
+				output = utf8::encode(cp, output);
+			}
+			return output;
+		}
+
+		// whether the eight code units at units are codepoints which are the Charset bytes of the same value
+		template<typename UTFI, typename Charset, typename Unit>
+		bool is_identical_block(const Unit* units) noexcept
+		{
+			constexpr bool c1 = std::is_same_v<Charset, windows1252> && !std::is_same_v<UTFI, utf8>;
+			constexpr codepoint limit = std::is_same_v<UTFI, utf8> ? 0x80 : c1 ? 0x100 : Charset::identical_below;
+			codepoint any = 0;
+			codepoint controls = 0;
+			for (std::size_t i = 0; i < 8; ++i)
+			{
+				const codepoint unit = static_cast<typename UTFI::char_type>(units[i]);
+				any |= unit;
+				if constexpr(c1) {
+					controls |= unit - 0x80 < 0x20;
+				}
+			}
+			return any < limit && controls == 0;
+		}
+	}
+
+	// converts the Charset bytes of [first, last) to UTFO
+	template<typename Charset, typename UTFO, typename ForwardIterator, typename OutputIterator>
+	OutputIterator widen(ForwardIterator first, ForwardIterator last, OutputIterator output)
+	{
+		using unit = typename UTFO::char_type;
+
+		// eight bytes at a time: for utf8 the ascii words are copied and the others widened byte by byte, for utf16 and
+		// utf32 the words whose bytes are the codepoints are widened in a loop which compilers vectorize; the units are
+		// collected first, as the stores could otherwise change the bytes for the compiler
+		if constexpr(std::is_pointer_v<ForwardIterator>)
+		{
+			if constexpr(std::is_same_v<UTFO, utf8>)
+			{
+				for (; last - first >= 8; first += 8)
+				{
+					if (detail::is_whole_block<utf8>(first)) {
+						output = std::copy(first, first + 8, output);
+					}
+					else if (detail::is_identical_word<Charset>(first))
+					{
+						// one or two bytes each, written without branches
+						char bytes[16];
+						std::size_t size = 0;
+						for (std::size_t i = 0; i < 8; ++i)
+						{
+							const unsigned char byte = static_cast<unsigned char>(first[i]);
+							const bool lead = byte >= 0x80;
+							bytes[size] = static_cast<char>(lead ? 0xC0 | (byte >> 6) : byte);
+							bytes[size + 1] = static_cast<char>(0x80 | (byte & 0x3F));
+							size += 1 + lead;
+						}
+						output = std::copy(bytes, bytes + size, output);
+					}
+					else
+					{
+						for (std::size_t i = 0; i < 8; ++i) {
+							output = detail::widen_to_utf8<Charset>(static_cast<unsigned char>(first[i]), output);
+						}
+					}
+				}
+			}
+			else
+			{
+				for (; last - first >= 8; first += 8)
+				{
+					unit units[8];
+					if (detail::is_identical_word<Charset>(first))
+					{
+						for (std::size_t i = 0; i < 8; ++i) {
+							units[i] = static_cast<unsigned char>(first[i]);
+						}
+						output = std::copy(units, units + 8, output);
+					}
+					else
+					{
+						for (std::size_t i = 0; i < 8; ++i) {
+							*output++ = static_cast<unit>(Charset::to_codepoint(static_cast<unsigned char>(first[i])));
+						}
+					}
+				}
+			}
+		}
+
+		for (; first != last; ++first)
+		{
+			if constexpr(std::is_same_v<UTFO, utf8>) {
+				output = detail::widen_to_utf8<Charset>(static_cast<unsigned char>(*first), output);
+			}
+			else {
+				// every codepoint is in the BMP
+				*output++ = static_cast<unit>(Charset::to_codepoint(static_cast<unsigned char>(*first)));
+			}
+		}
+		return output;
+	}
+
+	template<typename Charset, typename UTFO>
+	typename UTFO::string_type widen(std::string_view bytes)
+	{
+		// windows1252 has codepoints which are three bytes in utf8
+		typename UTFO::string_type result(bytes.size() * (std::is_same_v<UTFO, utf8> ? 3 : 1), 0);
+		auto* end = widen<Charset, UTFO>(bytes.data(), bytes.data() + bytes.size(), &result[0]);
+		result.resize(static_cast<std::size_t>(end - result.data()));
+		return result;
+	}
+
+	// converts [first, last) from UTFI to Charset bytes: ErrorPolicy handles the ill-formed sequences and the codepoints
+	// Charset doesn't have, which by default stop the conversion there; replace_errors writes a '?' and a handler is
+	// called with decode_error::none for a codepoint Charset doesn't have
+	template<typename UTFI, typename Charset, typename ErrorPolicy = stop_on_error, typename ForwardIterator, typename OutputIterator>
+	transcode_result<ForwardIterator, OutputIterator> narrow(ForwardIterator first, ForwardIterator last, OutputIterator output,
+		ErrorPolicy policy = ErrorPolicy())
+	{
+		static_assert(!std::is_same_v<ErrorPolicy, escape_errors>, "narrow: escape_errors needs a utf output");
+
+		// eight code units at a time while they are the bytes
+		auto block = [](auto units, auto& out)
+		{
+			if (!detail::is_identical_block<UTFI, Charset>(units)) {
+				return false;
+			}
+			char bytes[8];
+			for (std::size_t i = 0; i < 8; ++i) {
+				bytes[i] = static_cast<char>(units[i]);
+			}
+			out = std::copy(bytes, bytes + 8, out);
+			return true;
+		};
+		auto sink = [](codepoint cp, OutputIterator& out)
+		{
+			unsigned char byte = 0;
+			if (!Charset::to_byte(cp, byte)) {
+				return false;
+			}
+			*out++ = static_cast<char>(byte);
+			return true;
+		};
+		return detail::transcode_checked<UTFI>(first, last, output, policy, '?', block, sink);
+	}
+}
+
+#endif
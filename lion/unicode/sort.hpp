@@ -0,0 +1,290 @@
+#ifndef LION_UNICODE_SORT_HPP
+#define LION_UNICODE_SORT_HPP
+
+#include "codepoint.hpp"
+#include "utf8.hpp"
+#include "utf16.hpp"
+#include "utf32.hpp"
+#include "compare.hpp"
+#include "batch.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace lion::unicode
+{
+	namespace detail
+	{
+		// code units mapped so that their order is the order of the codepoints: in utf16 the surrogates move above
+		// U+E000..U+FFFF, as the supplementary codepoints they encode are above them
+		constexpr std::uint32_t code_unit_order(char unit) noexcept {
+			return static_cast<unsigned char>(unit);
+		}
+
+		constexpr std::uint32_t code_unit_order(char16_t unit) noexcept
+		{
+			if (unit < 0xD800) {
+				return unit;
+			}
+			return unit >= 0xE000 ? unit - 0x800u : unit + 0x2000u;
+		}
+
+		constexpr std::uint32_t code_unit_order(char32_t unit) noexcept {
+			return unit;
+		}
+
+		template<typename Text>
+		auto as_view(const Text& text) noexcept
+		{
+			using char_type = std::remove_cv_t<std::remove_pointer_t<decltype(std::data(text))>>;
+			return std::basic_string_view<char_type>(std::data(text), std::size(text));
+		}
+
+		// whether left < right in codepoint order, given that their first 'start' code units are equal
+		template<typename Char>
+		bool code_unit_less(std::basic_string_view<Char> left, std::basic_string_view<Char> right, std::size_t start = 0) noexcept
+		{
+			const std::size_t size = std::min(left.size(), right.size());
+			for (std::size_t i = start; i < size; ++i)
+			{
+				if (left[i] != right[i]) {
+					return code_unit_order(left[i]) < code_unit_order(right[i]);
+				}
+			}
+			return left.size() < right.size();
+		}
+
+		template<typename Char>
+		struct sort_entry
+		{
+			std::basic_string_view<Char> text;
+			std::size_t index;
+		};
+
+		// the digit of an entry at byte 'depth' of its code units, most significant byte first, 0 past its end
+		template<typename Char>
+		unsigned sort_digit(const sort_entry<Char>& entry, std::size_t depth) noexcept
+		{
+			const std::size_t unit = depth / sizeof(Char);
+			if (unit >= entry.text.size()) {
+				return 0;
+			}
+			const unsigned shift = 8 * static_cast<unsigned>(sizeof(Char) - 1 - depth % sizeof(Char));
+			return 1 + ((code_unit_order(entry.text[unit]) >> shift) & 0xFF);
+		}
+
+		// an msd radix sort of the entries by their code units, a byte at a time, with the buckets of large partitions
+		// sorted as tasks of the pool
+		template<typename Char>
+		class radix_sorter
+		{
+		public:
+			static constexpr std::size_t small_size = 64;
+			static constexpr std::size_t task_size = 1 << 14;
+			static constexpr std::size_t parallel_size = 1 << 17;
+
+			explicit radix_sorter(work_stealing_pool* pool)
+				: pool(pool)
+			{}
+
+			void sort(sort_entry<Char>* entries, std::size_t size)
+			{
+				std::vector<sort_entry<Char>> scratch(size);
+				sort(entries, scratch.data(), size, 0);
+				if (pool != nullptr) {
+					pool->wait_until_zero(pending);
+				}
+			}
+
+		private:
+			using counts_type = std::array<std::size_t, 257>;
+
+			work_stealing_pool* pool;
+			std::atomic<std::size_t> pending{ 0 };
+
+			void sort(sort_entry<Char>* entries, sort_entry<Char>* scratch, std::size_t size, std::size_t depth)
+			{
+				while (size >= small_size)
+				{
+					counts_type counts = {};
+					if (pool != nullptr && size >= parallel_size) {
+						partition_parallel(entries, scratch, size, depth, counts);
+					}
+					else if (!partition(entries, scratch, size, depth, counts))
+					{
+						// every entry has the same digit
+						if (sort_digit(entries[0], depth) == 0) {
+							return;
+						}
+						++depth;
+						continue;
+					}
+
+					std::size_t start = counts[0];
+					for (std::size_t digit = 1; digit < counts.size(); start += counts[digit++])
+					{
+						const std::size_t count = counts[digit];
+						if (count < 2) {
+							continue;
+						}
+						if (pool != nullptr && count >= task_size)
+						{
+							pending.fetch_add(1, std::memory_order_relaxed);
+							pool->submit([this, entries, scratch, start, count, depth]()
+							{
+								sort(entries + start, scratch + start, count, depth + 1);
+								pending.fetch_sub(1, std::memory_order_release);
+							});
+						}
+						else {
+							sort(entries + start, scratch + start, count, depth + 1);
+						}
+					}
+					return;
+				}
+
+				const std::size_t start = depth / sizeof(Char);
+				std::sort(entries, entries + size, [start](const sort_entry<Char>& left, const sort_entry<Char>& right) {
+					return code_unit_less(left.text, right.text, start);
+				});
+			}
+
+			// distributes the entries by their digit, returns false without moving them if they all have the same one
+			static bool partition(sort_entry<Char>* entries, sort_entry<Char>* scratch, std::size_t size, std::size_t depth, counts_type& counts)
+			{
+				for (std::size_t i = 0; i < size; ++i) {
+					++counts[sort_digit(entries[i], depth)];
+				}
+				if (counts[sort_digit(entries[0], depth)] == size) {
+					return false;
+				}
+
+				counts_type offsets;
+				std::size_t offset = 0;
+				for (std::size_t digit = 0; digit < counts.size(); ++digit)
+				{
+					offsets[digit] = offset;
+					offset += counts[digit];
+				}
+				for (std::size_t i = 0; i < size; ++i) {
+					scratch[offsets[sort_digit(entries[i], depth)]++] = entries[i];
+				}
+				std::copy(scratch, scratch + size, entries);
+				return true;
+			}
+
+			// the same, counting and distributing a chunk of the entries per worker
+			void partition_parallel(sort_entry<Char>* entries, sort_entry<Char>* scratch, std::size_t size, std::size_t depth, counts_type& counts)
+			{
+				const std::size_t chunks = pool->size();
+				const std::size_t chunk_size = (size + chunks - 1) / chunks;
+				std::vector<counts_type> offsets(chunks, counts_type{});
+
+				const auto for_each_chunk = [&](auto&& function)
+				{
+					std::atomic<std::size_t> remaining{ chunks };
+					for (std::size_t chunk = 0; chunk < chunks; ++chunk)
+					{
+						pool->submit([&, chunk]()
+						{
+							const std::size_t first = std::min(size, chunk * chunk_size);
+							function(chunk, first, std::min(size, first + chunk_size));
+							remaining.fetch_sub(1, std::memory_order_release);
+						});
+					}
+					pool->wait_until_zero(remaining);
+				};
+
+				for_each_chunk([&](std::size_t chunk, std::size_t first, std::size_t last)
+				{
+					for (std::size_t i = first; i < last; ++i) {
+						++offsets[chunk][sort_digit(entries[i], depth)];
+					}
+				});
+
+				std::size_t offset = 0;
+				for (std::size_t digit = 0; digit < counts.size(); ++digit)
+				{
+					for (std::size_t chunk = 0; chunk < chunks; ++chunk)
+					{
+						const std::size_t count = offsets[chunk][digit];
+						offsets[chunk][digit] = offset;
+						offset += count;
+						counts[digit] += count;
+					}
+				}
+
+				for_each_chunk([&](std::size_t chunk, std::size_t first, std::size_t last)
+				{
+					for (std::size_t i = first; i < last; ++i) {
+						scratch[offsets[chunk][sort_digit(entries[i], depth)]++] = entries[i];
+					}
+				});
+				for_each_chunk([&](std::size_t, std::size_t first, std::size_t last) {
+					std::copy(scratch + first, scratch + last, entries + first);
+				});
+			}
+		};
+
+		template<typename RandomIt>
+		void codepoint_sort(work_stealing_pool* pool, RandomIt first, RandomIt last)
+		{
+			using value_type = typename std::iterator_traits<RandomIt>::value_type;
+			using char_type = typename decltype(as_view(std::declval<const value_type&>()))::value_type;
+
+			const std::size_t size = static_cast<std::size_t>(last - first);
+			std::vector<sort_entry<char_type>> entries(size);
+			for (std::size_t i = 0; i < size; ++i) {
+				entries[i] = sort_entry<char_type>{ as_view(first[i]), i };
+			}
+
+			radix_sorter<char_type>(pool).sort(entries.data(), size);
+
+			std::vector<value_type> sorted;
+			sorted.reserve(size);
+			for (const sort_entry<char_type>& entry : entries) {
+				sorted.push_back(std::move(first[entry.index]));
+			}
+			std::move(sorted.begin(), sorted.end(), first);
+		}
+	}
+
+	// orders strings of any encodings by their codepoints, which for utf16 is not the order of operator<
+	struct codepoint_less
+	{
+		template<typename Left, typename Right>
+		bool operator()(const Left& left, const Right& right) const
+		{
+			const auto one = detail::as_view(left);
+			const auto two = detail::as_view(right);
+			if constexpr(std::is_same_v<decltype(one), decltype(two)>) {
+				return detail::code_unit_less(one, two);
+			}
+			else {
+				return compare(one, two) < 0;
+			}
+		}
+	};
+
+	// sorts a range of strings or string views, of char, char16_t or char32_t, in codepoint order
+	template<typename RandomIt>
+	void codepoint_sort(RandomIt first, RandomIt last) {
+		detail::codepoint_sort(nullptr, first, last);
+	}
+
+	// the same, partitioning large ranges in parallel on the pool
+	template<typename RandomIt>
+	void codepoint_sort(work_stealing_pool& pool, RandomIt first, RandomIt last) {
+		detail::codepoint_sort(&pool, first, last);
+	}
+}
+
+#endif
@@ -0,0 +1,158 @@
+#ifndef LION_UNICODE_SUBSTRING_HPP
+#define LION_UNICODE_SUBSTRING_HPP
+
+#include "codepoint.hpp"
+#include "validation.hpp"
+#include "utf8.hpp"
+#include "utf16.hpp"
+#include "utf32.hpp"
+#include "compare.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+namespace lion::unicode
+{
+	namespace detail
+	{
+		constexpr bool is_continuation(char unit) noexcept {
+			return (static_cast<unsigned char>(unit) & 0xC0) == 0x80;
+		}
+
+		// the offset after 'count' codepoints of [data, data + size), or size if there are fewer
+		template<typename UTF, typename Char>
+		std::size_t skip_codepoints(const Char* data, std::size_t size, std::size_t& count) noexcept
+		{
+			const Char* first = data;
+			const Char* const last = data + size;
+			while (count != 0 && first != last)
+			{
+				if (is_whole<UTF>(static_cast<typename UTF::char_type>(*first)))
+				{
+					// eight codepoints at a time over ascii, or in utf16 outside of the surrogates
+					if constexpr(!std::is_same_v<UTF, utf32>)
+					{
+						if (count >= 8 && last - first >= 8 && is_whole_block<UTF>(first))
+						{
+							first += 8;
+							count -= 8;
+							continue;
+						}
+					}
+					++first;
+					--count;
+					continue;
+				}
+
+				if constexpr(std::is_same_v<UTF, utf8>)
+				{
+					// the two and three byte sequences whose second byte has no narrower range than a continuation byte
+					// are skipped without decoding
+					const unsigned char lead = static_cast<unsigned char>(*first);
+					std::size_t size = 1;
+					if (lead >= 0xC2 && lead <= 0xDF) {
+						size = 2;
+					}
+					else if (lead >= 0xE1 && lead <= 0xEF && lead != 0xED) {
+						size = 3;
+					}
+					if (size > 1 && static_cast<std::size_t>(last - first) >= size && is_continuation(first[1]) && (size == 2 || is_continuation(first[2])))
+					{
+						first += size;
+						--count;
+						continue;
+					}
+				}
+
+				codepoint cp;
+				decode_error error;
+				first = UTF::decode(first, last, cp, error);
+				--count;
+			}
+			return static_cast<std::size_t>(first - data);
+		}
+	}
+
+	// the longest prefix of view of at most 'bytes' bytes which doesn't split a sequence, found by looking back from the
+	// limit for the start of the sequence which crosses it
+	inline utf8::string_view_type truncate_to_bytes(utf8::string_view_type view, std::size_t bytes)
+	{
+		if (view.size() <= bytes) {
+			return view;
+		}
+		std::size_t start = bytes;
+		while (start > 0 && bytes - start < 3 && detail::is_continuation(view[start])) {
+			--start;
+		}
+		if (detail::is_continuation(view[start])) {
+			return view.substr(0, bytes); // continuation bytes which aren't part of a sequence
+		}
+
+		// start begins a sequence, the sequences from there are decoded up to the limit
+		const char* const data = view.data();
+		std::size_t end = start;
+		while (end < bytes)
+		{
+			codepoint cp;
+			decode_error error;
+			const std::size_t next = static_cast<std::size_t>(utf8::decode(data + end, data + view.size(), cp, error) - data);
+			if (next > bytes) {
+				break;
+			}
+			end = next;
+		}
+		return view.substr(0, end);
+	}
+
+	inline utf16::string_view_type truncate_to_bytes(utf16::string_view_type view, std::size_t bytes)
+	{
+		const std::size_t units = bytes / 2;
+		if (view.size() <= units) {
+			return view;
+		}
+		// a high surrogate just before the limit is paired with the low surrogate after it
+		if (units > 0 && is_high_surrogate(view[units - 1]) && is_low_surrogate(view[units])) {
+			return view.substr(0, units - 1);
+		}
+		return view.substr(0, units);
+	}
+
+	inline utf32::string_view_type truncate_to_bytes(utf32::string_view_type view, std::size_t bytes) {
+		return view.substr(0, bytes / 4);
+	}
+
+	// the prefix of view of at most 'count' codepoints, ill-formed sequences count as one codepoint each
+	inline utf8::string_view_type truncate_to_codepoints(utf8::string_view_type view, std::size_t count) {
+		return view.substr(0, detail::skip_codepoints<utf8>(view.data(), view.size(), count));
+	}
+
+	inline utf16::string_view_type truncate_to_codepoints(utf16::string_view_type view, std::size_t count) {
+		return view.substr(0, detail::skip_codepoints<utf16>(view.data(), view.size(), count));
+	}
+
+	inline utf32::string_view_type truncate_to_codepoints(utf32::string_view_type view, std::size_t count) {
+		return view.substr(0, count);
+	}
+
+	// the 'count' codepoints of view starting with the codepoint 'position', or fewer if view ends before
+	inline utf8::string_view_type substr_codepoints(utf8::string_view_type view, std::size_t position, std::size_t count = utf8::string_view_type::npos)
+	{
+		view.remove_prefix(detail::skip_codepoints<utf8>(view.data(), view.size(), position));
+		return truncate_to_codepoints(view, count);
+	}
+
+	inline utf16::string_view_type substr_codepoints(utf16::string_view_type view, std::size_t position, std::size_t count = utf16::string_view_type::npos)
+	{
+		view.remove_prefix(detail::skip_codepoints<utf16>(view.data(), view.size(), position));
+		return truncate_to_codepoints(view, count);
+	}
+
+	inline utf32::string_view_type substr_codepoints(utf32::string_view_type view, std::size_t position, std::size_t count = utf32::string_view_type::npos)
+	{
+		view.remove_prefix(std::min(position, view.size()));
+		return view.substr(0, count);
+	}
+}
+
+#endif
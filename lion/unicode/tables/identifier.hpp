@@ -0,0 +1,280 @@
+// generated by tools/gen_tables.pl from the Unicode Character Database 14.0.0, do not edit
+
+#ifndef LION_UNICODE_TABLES_IDENTIFIER_HPP
+#define LION_UNICODE_TABLES_IDENTIFIER_HPP
+
+#include <cstdint>
+
+namespace lion::unicode
+{
+	namespace detail
+	{
+		// bit cp & 63 of identifier_bits[8 * identifier_stage1[cp >> 8] + 4 * property + (cp >> 6 & 3)], for the
+		// properties XID_Start (0) and XID_Continue (1)
+		inline constexpr std::uint8_t identifier_stage1[] = {
+			0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 1, 17, 18, 19, 1, 20, 21, 22, 23, 24, 25, 26, 27, 1, 28,
+			29, 30, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 32, 33, 31, 31, 34, 35, 31, 31, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 36, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 37, 1, 38, 39, 40, 41, 42, 43, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 44, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 1, 45, 46, 47, 48, 49, 50,
+			51, 52, 53, 54, 55, 56, 1, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 31, 77, 78, 79, 80,
+			1, 1, 1, 81, 82, 83, 31, 31, 31, 31, 31, 31, 31, 31, 31, 84, 1, 1, 1, 1, 85, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 1, 1, 86, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 1, 1, 87, 88, 31, 31, 89, 90, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 91, 1, 1, 1, 1, 92, 93, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 94, 1, 95, 96, 31, 31, 31, 31, 31, 31, 31, 31, 31, 97, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 98, 31, 99, 100, 31, 101, 102, 103, 104, 31, 31, 105, 31, 31, 31, 31, 106,
+			107, 108, 109, 31, 31, 31, 31, 110, 111, 112, 31, 31, 31, 31, 113, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 114, 31, 31, 31, 31,
+			1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 115, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 116, 117, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 118, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 119, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 1, 1, 120, 31, 31, 31, 31, 31,
+			1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 121, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 122, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+			31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+		};
+		inline constexpr std::uint64_t identifier_bits[] = {
+			0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0420040000000000ull, 0xFF7FFFFFFF7FFFFFull, 0x03FF000000000000ull, 0x07FFFFFE87FFFFFEull, 0x04A0040000000000ull, 0xFF7FFFFFFF7FFFFFull,
+			0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull,
+			0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000501F0003FFC3ull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000501F0003FFC3ull,
+			0x0000000000000000ull, 0xB8DF000000000000ull, 0xFFFFFFFBFFFFD740ull, 0xFFBFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xB8DFFFFFFFFFFFFFull, 0xFFFFFFFBFFFFD7C0ull, 0xFFBFFFFFFFFFFFFFull,
+			0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFC03ull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFCFBull, 0xFFFFFFFFFFFFFFFFull,
+			0xFFFEFFFFFFFFFFFFull, 0xFFFFFFFF027FFFFFull, 0x00000000000001FFull, 0x000787FFFFFF0000ull, 0xFFFEFFFFFFFFFFFFull, 0xFFFFFFFF027FFFFFull, 0xBFFFFFFFFFFE01FFull, 0x000787FFFFFF00B6ull,
+			0xFFFFFFFF00000000ull, 0xFFFEC000000007FFull, 0xFFFFFFFFFFFFFFFFull, 0x9C00C060002FFFFFull, 0xFFFFFFFF07FF0000ull, 0xFFFFC3FFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x9FFFFDFF9FEFFFFFull,
+			0x0000FFFFFFFD0000ull, 0xFFFFFFFFFFFFE000ull, 0x0002003FFFFFFFFFull, 0x043007FFFFFFFC00ull, 0xFFFFFFFFFFFF0000ull, 0xFFFFFFFFFFFFE7FFull, 0x0003FFFFFFFFFFFFull, 0x243FFFFFFFFFFFFFull,
+			0x00000110043FFFFFull, 0xFFFF07FF01FFFFFFull, 0xFFFFFFFF00007EFFull, 0x00000000000003FFull, 0x00003FFFFFFFFFFFull, 0xFFFF07FF0FFFFFFFull, 0xFFFFFFFFFF007EFFull, 0xFFFFFFFBFFFFFFFFull,
+			0x23FFFFFFFFFFFFF0ull, 0xFFFE0003FF010000ull, 0x23C5FDFFFFF99FE1ull, 0x10030003B0004000ull, 0xFFFFFFFFFFFFFFFFull, 0xFFFEFFCFFFFFFFFFull, 0xF3C5FDFFFFF99FEFull, 0x5003FFCFB080799Full,
+			0x036DFDFFFFF987E0ull, 0x001C00005E000000ull, 0x23EDFDFFFFFBBFE0ull, 0x0200000300010000ull, 0xD36DFDFFFFF987EEull, 0x003FFFC05E023987ull, 0xF3EDFDFFFFFBBFEEull, 0xFE00FFCF00013BBFull,
+			0x23EDFDFFFFF99FE0ull, 0x00020003B0000000ull, 0x03FFC718D63DC7E8ull, 0x0000000000010000ull, 0xF3EDFDFFFFF99FEEull, 0x0002FFCFB0E0399Full, 0xC3FFC718D63DC7ECull, 0x0000FFC000813DC7ull,
+			0x23FFFDFFFFFDDFE0ull, 0x0000000327000000ull, 0x23EFFDFFFFFDDFE1ull, 0x0006000360000000ull, 0xF3FFFDFFFFFDDFFFull, 0x0000FFCF27603DDFull, 0xF3EFFDFFFFFDDFEFull, 0x0006FFCF60603DDFull,
+			0x27FFFFFFFFFDDFF0ull, 0xFC00000380704000ull, 0x2FFBFFFFFC7FFFE0ull, 0x000000000000007Full, 0xFFFFFFFFFFFDDFFFull, 0xFC00FFCF80F07DDFull, 0x2FFBFFFFFC7FFFEEull, 0x000CFFC0FF5F847Full,
+			0x0005FFFFFFFFFFFEull, 0x000000000000007Full, 0x2005FFAFFFFFF7D6ull, 0x00000000F000005Full, 0x07FFFFFFFFFFFFFEull, 0x0000000003FF7FFFull, 0x3FFFFFAFFFFFF7D6ull, 0x00000000F3FF3F5Full,
+			0x0000000000000001ull, 0x00001FFFFFFFFEFFull, 0x0000000000001F00ull, 0x0000000000000000ull, 0xC2A003FF03000001ull, 0xFFFE1FFFFFFFFEFFull, 0x1FFFFFFFFEFFFFDFull, 0x0000000000000040ull,
+			0x800007FFFFFFFFFFull, 0xFFE1C0623C3F0000ull, 0xFFFFFFFF00004003ull, 0xF7FFFFFFFFFF20BFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFF03FFull, 0xFFFFFFFF3FFFFFFFull, 0xF7FFFFFFFFFF20BFull,
+			0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFF3D7F3DFFull, 0x7F3DFFFFFFFF3DFFull, 0xFFFFFFFFFF7FFF3Dull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFF3D7F3DFFull, 0x7F3DFFFFFFFF3DFFull, 0xFFFFFFFFFF7FFF3Dull,
+			0xFFFFFFFFFF3DFFFFull, 0x0000000007FFFFFFull, 0xFFFFFFFF0000FFFFull, 0x3F3FFFFFFFFFFFFFull, 0xFFFFFFFFFF3DFFFFull, 0x0003FE00E7FFFFFFull, 0xFFFFFFFF0000FFFFull, 0x3F3FFFFFFFFFFFFFull,
+			0xFFFFFFFFFFFFFFFEull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFEull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull,
+			0xFFFFFFFFFFFFFFFFull, 0xFFFF9FFFFFFFFFFFull, 0xFFFFFFFF07FFFFFEull, 0x01FFC7FFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFF9FFFFFFFFFFFull, 0xFFFFFFFF07FFFFFEull, 0x01FFC7FFFFFFFFFFull,
+			0x0003FFFF8003FFFFull, 0x0001DFFF0003FFFFull, 0x000FFFFFFFFFFFFFull, 0x0000000010800000ull, 0x001FFFFF803FFFFFull, 0x000DDFFF000FFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x000003FF308FFFFFull,
+			0xFFFFFFFF00000000ull, 0x01FFFFFFFFFFFFFFull, 0xFFFF05FFFFFFFFFFull, 0x003FFFFFFFFFFFFFull, 0xFFFFFFFF03FFB800ull, 0x01FFFFFFFFFFFFFFull, 0xFFFF07FFFFFFFFFFull, 0x003FFFFFFFFFFFFFull,
+			0x000000007FFFFFFFull, 0x001F3FFFFFFF0000ull, 0xFFFF0FFFFFFFFFFFull, 0x00000000000003FFull, 0x0FFF0FFF7FFFFFFFull, 0x001F3FFFFFFFFFC0ull, 0xFFFF0FFFFFFFFFFFull, 0x0000000007FF03FFull,
+			0xFFFFFFFF007FFFFFull, 0x00000000001FFFFFull, 0x0000008000000000ull, 0x0000000000000000ull, 0xFFFFFFFF0FFFFFFFull, 0x9FFFFFFF7FFFFFFFull, 0xBFFF008003FF03FFull, 0x0000000000007FFFull,
+			0x000FFFFFFFFFFFE0ull, 0x0000000000001FE0ull, 0xFC00C001FFFFFFF8ull, 0x0000003FFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x000FF80003FF1FFFull, 0xFFFFFFFFFFFFFFFFull, 0x000FFFFFFFFFFFFFull,
+			0x0000000FFFFFFFFFull, 0x3FFFFFFFFC00E000ull, 0xE7FFFFFFFFFF01FFull, 0x046FDE0000000000ull, 0x00FFFFFFFFFFFFFFull, 0x3FFFFFFFFFFFE3FFull, 0xE7FFFFFFFFFF01FFull, 0x07FFFFFFFFF70000ull,
+			0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000000000000000ull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull,
+			0xFFFFFFFF3F3FFFFFull, 0x3FFFFFFFAAFF3F3Full, 0x5FDFFFFFFFFFFFFFull, 0x1FDC1FFF0FCF1FDCull, 0xFFFFFFFF3F3FFFFFull, 0x3FFFFFFFAAFF3F3Full, 0x5FDFFFFFFFFFFFFFull, 0x1FDC1FFF0FCF1FDCull,
+			0x0000000000000000ull, 0x8002000000000000ull, 0x000000001FFF0000ull, 0x0000000000000000ull, 0x8000000000000000ull, 0x8002000000100001ull, 0x000000001FFF0000ull, 0x0001FFE21FFF0000ull,
+			0xF3FFFD503F2FFC84ull, 0xFFFFFFFF000043E0ull, 0x00000000000001FFull, 0x0000000000000000ull, 0xF3FFFD503F2FFC84ull, 0xFFFFFFFF000043E0ull, 0x00000000000001FFull, 0x0000000000000000ull,
+			0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+			0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x000C781FFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x000FF81FFFFFFFFFull,
+			0xFFFF20BFFFFFFFFFull, 0x000080FFFFFFFFFFull, 0x7F7F7F7F007FFFFFull, 0x000000007F7F7F7Full, 0xFFFF20BFFFFFFFFFull, 0x800080FFFFFFFFFFull, 0x7F7F7F7F007FFFFFull, 0xFFFFFFFF7F7F7F7Full,
+			0x1F3E03FE000000E0ull, 0xFFFFFFFFFFFFFFFEull, 0xFFFFFFFEE07FFFFFull, 0xF7FFFFFFFFFFFFFFull, 0x1F3EFFFE000000E0ull, 0xFFFFFFFFFFFFFFFEull, 0xFFFFFFFEE67FFFFFull, 0xF7FFFFFFFFFFFFFFull,
+			0xFFFEFFFFFFFFFFE0ull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFF00007FFFull, 0xFFFF000000000000ull, 0xFFFEFFFFFFFFFFE0ull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFF00007FFFull, 0xFFFF000000000000ull,
+			0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000000000000000ull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000000000000000ull,
+			0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000000000001FFFull, 0x3FFFFFFFFFFF0000ull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000000000001FFFull, 0x3FFFFFFFFFFF0000ull,
+			0x00000C00FFFF1FFFull, 0x80007FFFFFFFFFFFull, 0xFFFFFFFF3FFFFFFFull, 0x0000FFFFFFFFFFFFull, 0x00000FFFFFFF1FFFull, 0xBFF0FFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0003FFFFFFFFFFFFull,
+			0xFFFFFFFCFF800000ull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFF9FFull, 0xFFFC000003EB07FFull, 0xFFFFFFFCFF800000ull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFF9FFull, 0xFFFC000003EB07FFull,
+			0x00000007FFFFF7BBull, 0x000FFFFFFFFFFFFFull, 0x000FFFFFFFFFFFFCull, 0x68FC000000000000ull, 0x000010FFFFFFFFFFull, 0x000FFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xE8FFFFFF03FF003Full,
+			0xFFFF003FFFFFFC00ull, 0x1FFFFFFF0000007Full, 0x0007FFFFFFFFFFF0ull, 0x7C00FFDF00008000ull, 0xFFFF3FFFFFFFFFFFull, 0x1FFFFFFF000FFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x7FFFFFFF03FF8001ull,
+			0x000001FFFFFFFFFFull, 0xC47FFFFF00000FF7ull, 0x3E62FFFFFFFFFFFFull, 0x001C07FF38000005ull, 0x007FFFFFFFFFFFFFull, 0xFC7FFFFF03FF3FFFull, 0xFFFFFFFFFFFFFFFFull, 0x007CFFFF38000007ull,
+			0xFFFF7F7F007E7E7Eull, 0xFFFF03FFF7FFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x00000007FFFFFFFFull, 0xFFFF7F7F007E7E7Eull, 0xFFFF03FFF7FFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x03FF37FFFFFFFFFFull,
+			0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFF000FFFFFFFFFull, 0x0FFFFFFFFFFFF87Full, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFF000FFFFFFFFFull, 0x0FFFFFFFFFFFF87Full,
+			0xFFFFFFFFFFFFFFFFull, 0xFFFF3FFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000000003FFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFF3FFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000000003FFFFFFull,
+			0x5F7FFDFFA0F8007Full, 0xFFFFFFFFFFFFFFDBull, 0x0003FFFFFFFFFFFFull, 0xFFFFFFFFFFF80000ull, 0x5F7FFDFFE0F8007Full, 0xFFFFFFFFFFFFFFDBull, 0x0003FFFFFFFFFFFFull, 0xFFFFFFFFFFF80000ull,
+			0xFFFFFFFFFFFFFFFFull, 0xFFFFFFF03FFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFF03FFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull,
+			0x3FFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFF0000ull, 0xFFFFFFFFFFFCFFFFull, 0x03FF0000000000FFull, 0x3FFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFF0000ull, 0xFFFFFFFFFFFCFFFFull, 0x03FF0000000000FFull,
+			0x0000000000000000ull, 0xAA8A000000000000ull, 0xFFFFFFFFFFFFFFFFull, 0x1FFFFFFFFFFFFFFFull, 0x0018FFFF0000FFFFull, 0xAA8A00000000E000ull, 0xFFFFFFFFFFFFFFFFull, 0x1FFFFFFFFFFFFFFFull,
+			0x07FFFFFE00000000ull, 0xFFFFFFC007FFFFFEull, 0x7FFFFFFF3FFFFFFFull, 0x000000001CFCFCFCull, 0x87FFFFFE03FF0000ull, 0xFFFFFFC007FFFFFEull, 0x7FFFFFFFFFFFFFFFull, 0x000000001CFCFCFCull,
+			0xB7FFFF7FFFFFEFFFull, 0x000000003FFF3FFFull, 0xFFFFFFFFFFFFFFFFull, 0x07FFFFFFFFFFFFFFull, 0xB7FFFF7FFFFFEFFFull, 0x000000003FFF3FFFull, 0xFFFFFFFFFFFFFFFFull, 0x07FFFFFFFFFFFFFFull,
+			0x0000000000000000ull, 0x001FFFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x001FFFFFFFFFFFFFull, 0x0000000000000000ull, 0x2000000000000000ull,
+			0x0000000000000000ull, 0x0000000000000000ull, 0xFFFFFFFF1FFFFFFFull, 0x000000000001FFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0xFFFFFFFF1FFFFFFFull, 0x000000010001FFFFull,
+			0xFFFFE000FFFFFFFFull, 0x003FFFFFFFFF07FFull, 0xFFFFFFFF3FFFFFFFull, 0x00000000003EFF0Full, 0xFFFFE000FFFFFFFFull, 0x07FFFFFFFFFF07FFull, 0xFFFFFFFF3FFFFFFFull, 0x00000000003EFF0Full,
+			0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFF00003FFFFFFFull, 0x0FFFFFFFFF0FFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFF03FF3FFFFFFFull, 0x0FFFFFFFFF0FFFFFull,
+			0xFFFF00FFFFFFFFFFull, 0xF7FF000FFFFFFFFFull, 0x1BFBFFFBFFB7F7FFull, 0x0000000000000000ull, 0xFFFF00FFFFFFFFFFull, 0xF7FF000FFFFFFFFFull, 0x1BFBFFFBFFB7F7FFull, 0x0000000000000000ull,
+			0x007FFFFFFFFFFFFFull, 0x000000FF003FFFFFull, 0x07FDFFFFFFFFFFBFull, 0x0000000000000000ull, 0x007FFFFFFFFFFFFFull, 0x000000FF003FFFFFull, 0x07FDFFFFFFFFFFBFull, 0x0000000000000000ull,
+			0x91BFFFFFFFFFFD3Full, 0x007FFFFF003FFFFFull, 0x000000007FFFFFFFull, 0x0037FFFF00000000ull, 0x91BFFFFFFFFFFD3Full, 0x007FFFFF003FFFFFull, 0x000000007FFFFFFFull, 0x0037FFFF00000000ull,
+			0x03FFFFFF003FFFFFull, 0x0000000000000000ull, 0xC0FFFFFFFFFFFFFFull, 0x0000000000000000ull, 0x03FFFFFF003FFFFFull, 0x0000000000000000ull, 0xC0FFFFFFFFFFFFFFull, 0x0000000000000000ull,
+			0x003FFFFFFEEF0001ull, 0x1FFFFFFF00000000ull, 0x000000001FFFFFFFull, 0x0000001FFFFFFEFFull, 0x873FFFFFFEEFF06Full, 0x1FFFFFFF00000000ull, 0x000000001FFFFFFFull, 0x0000007FFFFFFEFFull,
+			0x003FFFFFFFFFFFFFull, 0x0007FFFF003FFFFFull, 0x000000000003FFFFull, 0x0000000000000000ull, 0x003FFFFFFFFFFFFFull, 0x0007FFFF003FFFFFull, 0x000000000003FFFFull, 0x0000000000000000ull,
+			0xFFFFFFFFFFFFFFFFull, 0x00000000000001FFull, 0x0007FFFFFFFFFFFFull, 0x0007FFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x00000000000001FFull, 0x0007FFFFFFFFFFFFull, 0x0007FFFFFFFFFFFFull,
+			0x0000000FFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x03FF00FFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+			0x0000000000000000ull, 0x0000000000000000ull, 0x000303FFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x00031BFFFFFFFFFFull, 0x0000000000000000ull,
+			0xFFFF00801FFFFFFFull, 0xFFFF00000000003Full, 0xFFFF000000000003ull, 0x007FFFFF0000001Full, 0xFFFF00801FFFFFFFull, 0xFFFF00000001FFFFull, 0xFFFF00000000003Full, 0x007FFFFF0000001Full,
+			0x00FFFFFFFFFFFFF8ull, 0x0026000000000000ull, 0x0000FFFFFFFFFFF8ull, 0x000001FFFFFF0000ull, 0xFFFFFFFFFFFFFFFFull, 0x803FFFC00000007Full, 0x07FFFFFFFFFFFFFFull, 0x03FF01FFFFFF0004ull,
+			0x0000007FFFFFFFF8ull, 0x0047FFFFFFFF0090ull, 0x0007FFFFFFFFFFF8ull, 0x000000001400001Eull, 0xFFDFFFFFFFFFFFFFull, 0x004FFFFFFFFF00F0ull, 0xFFFFFFFFFFFFFFFFull, 0x0000000017FFDE1Full,
+			0x00000FFFFFFBFFFFull, 0x0000000000000000ull, 0xFFFF01FFBFFFBD7Full, 0x000000007FFFFFFFull, 0x40FFFFFFFFFBFFFFull, 0x0000000000000000ull, 0xFFFF01FFBFFFBD7Full, 0x03FF07FFFFFFFFFFull,
+			0x23EDFDFFFFF99FE0ull, 0x00000003E0010000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0xFBEDFDFFFFF99FEFull, 0x001F1FCFE081399Full, 0x0000000000000000ull, 0x0000000000000000ull,
+			0x001FFFFFFFFFFFFFull, 0x0000000380000780ull, 0x0000FFFFFFFFFFFFull, 0x00000000000000B0ull, 0xFFFFFFFFFFFFFFFFull, 0x00000003C3FF07FFull, 0xFFFFFFFFFFFFFFFFull, 0x0000000003FF00BFull,
+			0x0000000000000000ull, 0x0000000000000000ull, 0x00007FFFFFFFFFFFull, 0x000000000F000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0xFF3FFFFFFFFFFFFFull, 0x000000003F000001ull,
+			0x0000FFFFFFFFFFFFull, 0x0000000000000010ull, 0x010007FFFFFFFFFFull, 0x0000000000000000ull, 0xFFFFFFFFFFFFFFFFull, 0x0000000003FF0011ull, 0x01FFFFFFFFFFFFFFull, 0x00000000000003FFull,
+			0x0000000007FFFFFFull, 0x000000000000007Full, 0x0000000000000000ull, 0x0000000000000000ull, 0x03FF0FFFE7FFFFFFull, 0x000000000000007Full, 0x0000000000000000ull, 0x0000000000000000ull,
+			0x00000FFFFFFFFFFFull, 0x0000000000000000ull, 0xFFFFFFFF00000000ull, 0x80000000FFFFFFFFull, 0x07FFFFFFFFFFFFFFull, 0x0000000000000000ull, 0xFFFFFFFF00000000ull, 0x800003FFFFFFFFFFull,
+			0x8000FFFFFF6FF27Full, 0x0000000000000002ull, 0xFFFFFCFF00000000ull, 0x0000000A0001FFFFull, 0xF9BFFFFFFF6FF27Full, 0x0000000003FF000Full, 0xFFFFFCFF00000000ull, 0x0000001BFCFFFFFFull,
+			0x0407FFFFFFFFF801ull, 0xFFFFFFFFF0010000ull, 0xFFFF0000200003FFull, 0x01FFFFFFFFFFFFFFull, 0x7FFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFF0080ull, 0xFFFF000023FFFFFFull, 0x01FFFFFFFFFFFFFFull,
+			0x00007FFFFFFFFDFFull, 0xFFFC000000000001ull, 0x000000000000FFFFull, 0x0000000000000000ull, 0xFF7FFFFFFFFFFDFFull, 0xFFFC000003FF0001ull, 0x007FFEFFFFFCFFFFull, 0x0000000000000000ull,
+			0x0001FFFFFFFFFB7Full, 0xFFFFFDBF00000040ull, 0x00000000010003FFull, 0x0000000000000000ull, 0xB47FFFFFFFFFFB7Full, 0xFFFFFDBF03FF00FFull, 0x000003FF01FB7FFFull, 0x0000000000000000ull,
+			0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0007FFFF00000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x007FFFFF00000000ull,
+			0x0000000000000000ull, 0x0000000000000000ull, 0x0001000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0001000000000000ull, 0x0000000000000000ull,
+			0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000000003FFFFFFull, 0x0000000000000000ull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000000003FFFFFFull, 0x0000000000000000ull,
+			0xFFFFFFFFFFFFFFFFull, 0x00007FFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x00007FFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull,
+			0xFFFFFFFFFFFFFFFFull, 0x000000000000000Full, 0x0000000000000000ull, 0x0000000000000000ull, 0xFFFFFFFFFFFFFFFFull, 0x000000000000000Full, 0x0000000000000000ull, 0x0000000000000000ull,
+			0x0000000000000000ull, 0x0000000000000000ull, 0xFFFFFFFFFFFF0000ull, 0x0001FFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0xFFFFFFFFFFFF0000ull, 0x0001FFFFFFFFFFFFull,
+			0x00007FFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x00007FFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+			0xFFFFFFFFFFFFFFFFull, 0x000000000000007Full, 0x0000000000000000ull, 0x0000000000000000ull, 0xFFFFFFFFFFFFFFFFull, 0x000000000000007Full, 0x0000000000000000ull, 0x0000000000000000ull,
+			0x01FFFFFFFFFFFFFFull, 0xFFFF00007FFFFFFFull, 0x7FFFFFFFFFFFFFFFull, 0x00003FFFFFFF0000ull, 0x01FFFFFFFFFFFFFFull, 0xFFFF03FF7FFFFFFFull, 0x7FFFFFFFFFFFFFFFull, 0x001F3FFFFFFF03FFull,
+			0x0000FFFFFFFFFFFFull, 0xE0FFFFF80000000Full, 0x000000000000FFFFull, 0x0000000000000000ull, 0x007FFFFFFFFFFFFFull, 0xE0FFFFF803FF000Full, 0x000000000000FFFFull, 0x0000000000000000ull,
+			0x0000000000000000ull, 0xFFFFFFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0xFFFFFFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull,
+			0xFFFFFFFFFFFFFFFFull, 0x00000000000107FFull, 0x00000000FFF80000ull, 0x0000000B00000000ull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFF87FFull, 0x00000000FFFF80FFull, 0x0003001B00000000ull,
+			0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x00FFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x00FFFFFFFFFFFFFFull,
+			0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x00000000003FFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x00000000003FFFFFull,
+			0x00000000000001FFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x00000000000001FFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+			0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x6FEF000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x6FEF000000000000ull,
+			0x00000007FFFFFFFFull, 0xFFFF00F000070000ull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x00000007FFFFFFFFull, 0xFFFF00F000070000ull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull,
+			0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0FFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0FFFFFFFFFFFFFFFull,
+			0xFFFFFFFFFFFFFFFFull, 0x1FFF07FFFFFFFFFFull, 0x0000000003FF01FFull, 0x0000000000000000ull, 0xFFFFFFFFFFFFFFFFull, 0x1FFF07FFFFFFFFFFull, 0x0000000063FF01FFull, 0x0000000000000000ull,
+			0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0xFFFF3FFFFFFFFFFFull, 0x000000000000007Full, 0x0000000000000000ull, 0x0000000000000000ull,
+			0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0xF807E3E000000000ull, 0x00003C0000000FE7ull, 0x0000000000000000ull,
+			0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x000000000000001Cull, 0x0000000000000000ull, 0x0000000000000000ull,
+			0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFDFFFFFull, 0xEBFFDE64DFFFFFFFull, 0xFFFFFFFFFFFFFFEFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFDFFFFFull, 0xEBFFDE64DFFFFFFFull, 0xFFFFFFFFFFFFFFEFull,
+			0x7BFFFFFFDFDFE7BFull, 0xFFFFFFFFFFFDFC5Full, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x7BFFFFFFDFDFE7BFull, 0xFFFFFFFFFFFDFC5Full, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull,
+			0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFF3FFFFFFFFFull, 0xF7FFFFFFF7FFFFFDull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFF3FFFFFFFFFull, 0xF7FFFFFFF7FFFFFDull,
+			0xFFDFFFFFFFDFFFFFull, 0xFFFF7FFFFFFF7FFFull, 0xFFFFFDFFFFFFFDFFull, 0x0000000000000FF7ull, 0xFFDFFFFFFFDFFFFFull, 0xFFFF7FFFFFFF7FFFull, 0xFFFFFDFFFFFFFDFFull, 0xFFFFFFFFFFFFCFF7ull,
+			0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0xF87FFFFFFFFFFFFFull, 0x00201FFFFFFFFFFFull, 0x0000FFFEF8000010ull, 0x0000000000000000ull,
+			0x000000007FFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x000000007FFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+			0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x000007DBF9FFFF7Full, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+			0x3F801FFFFFFFFFFFull, 0x0000000000004000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x3FFF1FFFFFFFFFFFull, 0x00000000000043FFull, 0x0000000000000000ull, 0x0000000000000000ull,
+			0x0000000000000000ull, 0x0000000000000000ull, 0x00003FFFFFFF0000ull, 0x00000FFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x00007FFFFFFF0000ull, 0x03FFFFFFFFFFFFFFull,
+			0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x7FFF6F7F00000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x7FFF6F7F00000000ull,
+			0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x000000000000001Full, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x00000000007F001Full,
+			0xFFFFFFFFFFFFFFFFull, 0x000000000000080Full, 0x0000000000000000ull, 0x0000000000000000ull, 0xFFFFFFFFFFFFFFFFull, 0x0000000003FF0FFFull, 0x0000000000000000ull, 0x0000000000000000ull,
+			0x0AF7FE96FFFFFFEFull, 0x5EF7F796AA96EA84ull, 0x0FFFFBEE0FFFFBFFull, 0x0000000000000000ull, 0x0AF7FE96FFFFFFEFull, 0x5EF7F796AA96EA84ull, 0x0FFFFBEE0FFFFBFFull, 0x0000000000000000ull,
+			0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x03FF000000000000ull,
+			0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x00000000FFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x00000000FFFFFFFFull,
+			0x01FFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x01FFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull,
+			0xFFFFFFFF3FFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFF3FFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull,
+			0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFF0003FFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFF0003FFFFFFFFull, 0xFFFFFFFFFFFFFFFFull,
+			0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x00000001FFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x00000001FFFFFFFFull,
+			0x000000003FFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x000000003FFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+			0xFFFFFFFFFFFFFFFFull, 0x00000000000007FFull, 0x0000000000000000ull, 0x0000000000000000ull, 0xFFFFFFFFFFFFFFFFull, 0x00000000000007FFull, 0x0000000000000000ull, 0x0000000000000000ull,
+			0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000FFFFFFFFFFFFull,
+		};
+	}
+}
+
+#endif
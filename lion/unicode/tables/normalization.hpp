@@ -0,0 +1,8758 @@
+// generated by tools/gen_tables.pl from the Unicode Character Database 14.0.0, do not edit
+
+#ifndef LION_UNICODE_TABLES_NORMALIZATION_HPP
+#define LION_UNICODE_TABLES_NORMALIZATION_HPP
+
+#include <cstdint>
+
+namespace lion::unicode
+{
+	namespace detail
+	{
+		// Canonical_Combining_Class | NFD_QC << 8 | NFKD_QC << 9 | NFC_QC << 10 | NFKC_QC << 12, 0 Yes 1 No 2 Maybe
+		constexpr unsigned normalization_shift = 7;
+		inline constexpr std::uint8_t normalization_stage1[] = {
+			0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+			31, 32, 33, 34, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 36, 37, 0, 38, 39, 0, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
+			52, 53, 54, 55, 56, 57, 58, 0, 59, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 61, 62, 0, 0, 63, 64, 65, 66, 0, 67, 68, 69,
+			70, 71, 72, 73, 74, 68, 68, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 76, 77, 78, 79, 80, 81, 82, 0, 83, 84, 85, 48, 48, 48, 48, 48, 48, 48, 48,
+			48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+			48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+			48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 86, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 87, 87, 88, 89, 90, 91, 68, 68, 92, 93, 94, 95, 96, 97,
+			0, 0, 0, 98, 0, 99, 100, 0, 0, 0, 0, 0, 0, 0, 0, 101, 0, 0, 0, 0, 102, 103, 0, 0, 0, 0, 104, 0, 0, 105, 106, 107,
+			108, 109, 110, 111, 112, 113, 114, 0, 115, 116, 0, 117, 118, 119, 120, 0, 121, 0, 122, 123, 124, 125, 0, 0, 118, 0, 126, 127, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 129, 0, 0, 0, 0, 0, 0, 0, 0, 130,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 132, 133, 134, 0, 0, 0, 135, 136, 137, 68, 68, 138, 68, 139, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			140, 0, 129, 0, 0, 141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 142, 143, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 145, 0, 0,
+			0, 0, 146, 147, 148, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 149, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 87, 87, 87, 87, 150, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		};
+		inline constexpr std::uint16_t normalization_stage2[] = {
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			4608, 0, 0, 0, 0, 0, 0, 0, 4608, 0, 4608, 0, 0, 0, 0, 4608,
+			0, 0, 4608, 4608, 4608, 4608, 0, 0, 4608, 4608, 4608, 0, 4608, 4608, 4608, 0,
+			768, 768, 768, 768, 768, 768, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+			0, 768, 768, 768, 768, 768, 768, 0, 0, 768, 768, 768, 768, 768, 0, 0,
+			768, 768, 768, 768, 768, 768, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+			0, 768, 768, 768, 768, 768, 768, 0, 0, 768, 768, 768, 768, 768, 0, 768,
+			768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+			0, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+			768, 768, 768, 768, 768, 768, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768,
+			768, 0, 4608, 4608, 768, 768, 768, 768, 0, 768, 768, 768, 768, 768, 768, 4608,
+			4608, 0, 0, 768, 768, 768, 768, 768, 768, 4608, 0, 0, 768, 768, 768, 768,
+			768, 768, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+			768, 768, 768, 768, 768, 768, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768,
+			768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 4608,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			768, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768,
+			768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 768, 768, 768,
+			768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 768, 768,
+			768, 768, 768, 768, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+			768, 4608, 4608, 4608, 768, 768, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768,
+			768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+			768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 0, 768, 768,
+			0, 0, 0, 0, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+			768, 768, 768, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0,
+			4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			10470, 10470, 10470, 10470, 10470, 230, 10470, 10470, 10470, 10470, 10470, 10470, 10470, 230, 230, 10470,
+			230, 10470, 230, 10470, 10470, 232, 220, 220, 220, 220, 232, 10456, 220, 220, 220, 220,
+			220, 202, 202, 10460, 10460, 10460, 10460, 10442, 10442, 220, 220, 220, 220, 10460, 10460, 220,
+			10460, 10460, 220, 220, 1, 1, 1, 1, 10241, 220, 220, 220, 220, 230, 230, 230,
+			6118, 6118, 10470, 6118, 6118, 10480, 230, 220, 220, 220, 230, 230, 230, 220, 220, 0,
+			230, 230, 230, 220, 220, 220, 220, 230, 232, 220, 220, 230, 233, 234, 234, 233,
+			234, 234, 233, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+			0, 0, 0, 0, 5888, 0, 0, 0, 0, 0, 4608, 0, 0, 0, 5888, 0,
+			0, 0, 0, 0, 4608, 4864, 768, 5888, 768, 768, 768, 0, 768, 0, 768, 768,
+			768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 768, 768, 768, 768,
+			768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 768, 768, 768, 0,
+			4608, 4608, 4608, 4864, 4864, 4608, 4608, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			4608, 4608, 4608, 0, 4608, 4608, 0, 0, 0, 4608, 0, 0, 0, 0, 0, 0,
+			768, 768, 0, 768, 0, 0, 0, 768, 0, 0, 0, 0, 768, 768, 768, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			768, 768, 0, 768, 0, 0, 0, 768, 0, 0, 0, 0, 768, 768, 768, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 768, 768, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 768, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			768, 768, 768, 768, 0, 0, 768, 768, 0, 0, 768, 768, 768, 768, 768, 768,
+			0, 0, 768, 768, 768, 768, 768, 768, 0, 0, 768, 768, 768, 768, 768, 768,
+			768, 768, 768, 768, 768, 768, 0, 0, 768, 768, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 4608, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 220, 230, 230, 230, 230, 220, 230, 230, 230, 222, 220, 230, 230, 230, 230,
+			230, 230, 220, 220, 220, 220, 220, 220, 230, 230, 220, 230, 230, 222, 228, 230,
+			10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 19, 20, 21, 22, 0, 23,
+			0, 24, 25, 0, 230, 220, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			230, 230, 230, 230, 230, 230, 230, 230, 30, 31, 32, 0, 0, 0, 0, 0,
+			0, 0, 768, 768, 768, 768, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 28, 29, 30, 31,
+			32, 33, 34, 10470, 10470, 10460, 220, 230, 230, 230, 230, 230, 220, 230, 230, 220,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			35, 0, 0, 0, 0, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			768, 0, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 768, 0, 0, 230, 230, 230, 230, 230, 230, 230, 0, 0, 230,
+			230, 230, 230, 220, 230, 0, 0, 230, 230, 0, 220, 230, 230, 220, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			230, 220, 230, 230, 220, 230, 230, 220, 220, 220, 230, 220, 220, 230, 220, 230,
+			230, 230, 220, 230, 220, 230, 220, 230, 220, 230, 230, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230,
+			230, 230, 220, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 0, 230, 230, 230, 230, 230,
+			230, 230, 230, 230, 0, 230, 230, 230, 0, 230, 230, 230, 230, 230, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 220, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 230, 220, 220, 220, 230, 230, 230, 230,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 220,
+			220, 220, 220, 220, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+			230, 230, 0, 220, 230, 230, 220, 230, 230, 220, 230, 230, 230, 220, 220, 220,
+			27, 28, 29, 230, 230, 230, 220, 230, 230, 220, 220, 230, 230, 230, 230, 230,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 0, 0, 0, 0, 0,
+			0, 768, 0, 0, 768, 0, 0, 0, 0, 0, 0, 0, 10247, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+			0, 230, 220, 230, 230, 0, 0, 0, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 10240, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 9, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 0, 5888, 5888, 0, 5888,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 5888, 0, 0, 5888, 0, 0, 0, 0, 0, 7, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 5888, 5888, 5888, 0, 0, 5888, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 10240, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 0, 768, 768, 9, 0, 0,
+			0, 0, 0, 0, 0, 0, 10240, 10240, 0, 0, 0, 0, 5888, 5888, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 768, 9, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 0, 0, 0, 9, 0, 0,
+			0, 0, 0, 0, 0, 84, 10331, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0,
+			768, 0, 10240, 0, 0, 0, 0, 768, 768, 0, 768, 768, 0, 9, 0, 0,
+			0, 0, 0, 0, 0, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 10240, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 768, 9, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10249, 0, 0, 0, 0, 10240,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 768, 768, 768, 10240,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 4608, 0, 0, 0, 0, 103, 103, 9, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 107, 107, 107, 107, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 4608, 0, 0, 0, 0, 118, 118, 9, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 122, 122, 122, 122, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4608, 4608, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4608, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 220, 0, 220, 0, 216, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 5888, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5888, 0, 0,
+			0, 0, 5888, 0, 0, 0, 0, 5888, 0, 0, 0, 0, 5888, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 5888, 0, 0, 0, 0, 0, 0,
+			0, 129, 130, 5888, 132, 5888, 5888, 4608, 5888, 4608, 130, 130, 130, 130, 0, 0,
+			130, 5888, 230, 230, 9, 0, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 5888, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5888, 0, 0,
+			0, 0, 5888, 0, 0, 0, 0, 5888, 0, 0, 0, 0, 5888, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 5888, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 768, 0, 0, 0, 0, 0, 0, 0, 10240, 0,
+			0, 0, 0, 0, 0, 0, 0, 7, 0, 9, 9, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4608, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+			10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+			10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+			10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 228, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 222, 230, 220, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 230, 220, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0, 220,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			230, 230, 230, 230, 230, 220, 220, 220, 220, 220, 220, 230, 230, 220, 0, 220,
+			220, 230, 230, 220, 220, 230, 230, 230, 230, 230, 220, 230, 230, 230, 230, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 768, 0, 768, 0, 768, 0, 768, 0, 768, 0,
+			0, 0, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 7, 10240, 0, 0, 0, 0, 0, 768, 0, 768, 0, 0,
+			768, 768, 0, 768, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 220, 230, 230, 230,
+			230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			230, 230, 230, 0, 1, 220, 220, 220, 220, 220, 230, 230, 220, 220, 220, 220,
+			230, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 220, 0, 0,
+			0, 0, 0, 0, 230, 0, 0, 0, 230, 230, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4608, 4608, 4608, 0,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 4608, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			230, 230, 220, 230, 230, 230, 230, 230, 230, 230, 220, 230, 230, 234, 214, 220,
+			202, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+			230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+			230, 230, 230, 230, 230, 230, 232, 228, 228, 220, 218, 230, 233, 220, 230, 220,
+			768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+			768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+			768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+			768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+			768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+			768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+			768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+			768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+			768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+			768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 4608, 4864, 0, 0, 0, 0,
+			768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+			768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+			768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+			768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+			768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+			768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 0, 0, 0, 0, 0,
+			768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+			768, 768, 768, 768, 768, 768, 0, 0, 768, 768, 768, 768, 768, 768, 0, 0,
+			768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+			768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+			768, 768, 768, 768, 768, 768, 0, 0, 768, 768, 768, 768, 768, 768, 0, 0,
+			768, 768, 768, 768, 768, 768, 768, 768, 0, 768, 0, 768, 0, 768, 0, 768,
+			768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+			768, 5888, 768, 5888, 768, 5888, 768, 5888, 768, 5888, 768, 5888, 768, 5888, 0, 0,
+			768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+			768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+			768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+			768, 768, 768, 768, 768, 0, 768, 768, 768, 768, 768, 5888, 768, 4608, 5888, 4608,
+			4608, 4864, 768, 768, 768, 0, 768, 768, 768, 5888, 768, 5888, 768, 4864, 4864, 4864,
+			768, 768, 768, 5888, 0, 0, 768, 768, 768, 768, 768, 5888, 0, 4864, 4864, 4864,
+			768, 768, 768, 5888, 768, 768, 768, 768, 768, 768, 768, 5888, 768, 4864, 5888, 5888,
+			0, 0, 768, 768, 768, 0, 768, 768, 768, 5888, 768, 5888, 768, 5888, 4608, 0,
+			5888, 5888, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0,
+			0, 4608, 0, 0, 0, 0, 0, 4608, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0, 0, 0, 4608,
+			0, 0, 0, 4608, 4608, 0, 4608, 4608, 0, 0, 0, 0, 4608, 0, 4608, 0,
+			0, 0, 0, 0, 0, 0, 0, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 4608, 0, 0, 0, 0, 0, 0, 0, 4608,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			4608, 4608, 0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 4608, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			230, 230, 1, 1, 230, 230, 230, 230, 1, 1, 1, 230, 230, 0, 0, 0,
+			0, 230, 0, 0, 0, 1, 1, 230, 220, 230, 1, 1, 220, 220, 220, 220,
+			230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 0, 4608, 4608, 0, 0, 4608, 4608, 4608, 4608, 4608, 0, 0,
+			4608, 4608, 4608, 0, 4608, 0, 5888, 0, 4608, 0, 5888, 5888, 4608, 4608, 0, 4608,
+			4608, 4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608,
+			4608, 0, 0, 0, 0, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 4608, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 768,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 768, 0, 0, 0, 0, 768, 0, 0, 768, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 768, 0, 768, 0, 0, 0, 0, 0, 4608, 4608, 0, 4608,
+			4608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 768, 0, 0, 768, 0, 0, 768, 0, 768, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			768, 0, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 768,
+			768, 768, 0, 0, 768, 768, 0, 0, 768, 768, 0, 0, 0, 0, 0, 0,
+			768, 768, 0, 0, 768, 768, 0, 0, 768, 768, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 768, 768,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			768, 768, 768, 768, 0, 0, 0, 0, 0, 0, 768, 768, 768, 768, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 5888, 5888, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4608, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5888, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4608, 4608, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230,
+			230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4608,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+			230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4608,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 4608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			4608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 218, 228, 232, 222, 224, 224,
+			0, 0, 0, 0, 0, 0, 4608, 0, 4608, 4608, 4608, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 768, 0,
+			768, 0, 768, 0, 768, 0, 768, 0, 768, 0, 768, 0, 768, 0, 768, 0,
+			768, 0, 768, 0, 0, 768, 0, 768, 0, 768, 0, 0, 0, 0, 0, 0,
+			768, 768, 0, 768, 768, 0, 768, 768, 0, 768, 768, 0, 768, 768, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 768, 0, 0, 0, 0, 10248, 10248, 4608, 4608, 0, 768, 4608,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 768, 0,
+			768, 0, 768, 0, 768, 0, 768, 0, 768, 0, 768, 0, 768, 0, 768, 0,
+			768, 0, 768, 0, 0, 768, 0, 768, 0, 768, 0, 0, 0, 0, 0, 0,
+			768, 768, 0, 768, 768, 0, 768, 768, 0, 768, 768, 0, 768, 768, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 768, 0, 0, 768, 768, 768, 768, 0, 0, 0, 768, 4608,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0,
+			0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0, 0, 0,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230,
+			0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4608, 4608, 230, 230,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			4608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 4608, 4608, 4608, 0, 0, 0, 4608, 4608, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+			230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 220, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			230, 0, 230, 230, 220, 0, 0, 230, 230, 0, 0, 0, 0, 0, 230, 230,
+			0, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4608, 4608, 4608, 4608,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 4608, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+			768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+			768, 768, 768, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+			5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+			5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+			5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+			5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+			5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+			5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+			5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+			5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 0, 0,
+			5888, 0, 5888, 0, 0, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 0,
+			5888, 0, 5888, 0, 0, 5888, 5888, 0, 0, 0, 5888, 5888, 5888, 5888, 5888, 5888,
+			5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+			5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+			5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+			5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 0, 0,
+			5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+			5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+			5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+			5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+			5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+			5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+			5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 5888, 26, 5888,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 5888, 5888, 5888, 5888, 5888, 5888,
+			5888, 5888, 5888, 5888, 5888, 5888, 5888, 0, 5888, 5888, 5888, 5888, 5888, 0, 5888, 0,
+			5888, 5888, 0, 5888, 5888, 0, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0,
+			230, 230, 230, 230, 230, 230, 230, 220, 220, 220, 220, 220, 220, 220, 230, 230,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 0, 0, 0, 0,
+			4608, 4608, 4608, 0, 4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0,
+			0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0,
+			0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 4608, 4608, 4608, 4608, 4608, 4608,
+			0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 4608, 4608, 4608, 0, 0, 0,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0,
+			0, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 230,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 230, 1, 220, 0, 0, 0, 0, 9,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 230, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 220, 220, 230, 230, 230, 220, 230, 220, 220, 220,
+			220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 230, 220, 230, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 768, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 10247, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 0, 0, 0, 768, 768,
+			0, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 9, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 10240, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 9, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 0, 0, 0,
+			230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 9, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 768, 768, 10240, 768, 0,
+			0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 0, 0, 0, 9,
+			7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			10240, 0, 0, 0, 0, 0, 0, 0, 768, 0, 0, 0, 0, 9, 9, 0,
+			0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 7, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			230, 230, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5888, 5888,
+			5888, 5888, 5888, 5888, 5888, 216, 216, 1, 1, 1, 0, 0, 0, 226, 216, 216,
+			216, 216, 216, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 220, 220, 220,
+			220, 220, 220, 0, 0, 230, 230, 230, 230, 230, 220, 220, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5888, 5888, 5888, 5888, 5888,
+			5888, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608,
+			0, 0, 4608, 0, 0, 4608, 4608, 0, 0, 4608, 4608, 4608, 4608, 0, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 0, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 0, 0, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 0,
+			4608, 4608, 4608, 4608, 4608, 0, 4608, 0, 0, 0, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			230, 230, 230, 230, 230, 230, 230, 0, 230, 230, 230, 230, 230, 230, 230, 230,
+			230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0, 230, 230, 230, 230, 230,
+			230, 230, 0, 230, 230, 0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			220, 220, 220, 220, 220, 220, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 7, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			0, 4608, 4608, 0, 4608, 0, 0, 4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 0, 4608, 0, 4608, 0, 0, 0, 0,
+			0, 0, 4608, 0, 0, 0, 0, 4608, 0, 4608, 0, 4608, 0, 4608, 4608, 4608,
+			0, 4608, 4608, 0, 4608, 0, 0, 4608, 0, 4608, 0, 4608, 0, 4608, 0, 4608,
+			0, 4608, 4608, 0, 4608, 0, 0, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 0, 4608, 0,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0,
+			0, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4608, 4608, 4608, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			4608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			4608, 4608, 4608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0, 0,
+			4608, 4608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0,
+			5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+			5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		};
+
+		// the first codepoint which is not a starter with quick check Yes, for NFC, NFD, NFKC and NFKD
+		inline constexpr char32_t quick_check_minimum[] = {
+			0x0300, 0x00C0, 0x00A0, 0x00A0,
+		};
+
+		// offset and length of the canonical, then of the compatibility decomposition in decomposition_data
+		inline constexpr std::uint16_t decomposition_records[][4] = {
+			{ 0, 0, 0, 0 },
+			{ 0, 0, 0, 1 },
+			{ 0, 0, 1, 2 },
+			{ 0, 0, 3, 1 },
+			{ 0, 0, 4, 2 },
+			{ 0, 0, 6, 1 },
+			{ 0, 0, 7, 1 },
+			{ 0, 0, 8, 2 },
+			{ 0, 0, 10, 1 },
+			{ 0, 0, 11, 2 },
+			{ 0, 0, 13, 1 },
+			{ 0, 0, 14, 1 },
+			{ 0, 0, 15, 3 },
+			{ 0, 0, 18, 3 },
+			{ 0, 0, 21, 3 },
+			{ 24, 2, 24, 2 },
+			{ 26, 2, 26, 2 },
+			{ 28, 2, 28, 2 },
+			{ 30, 2, 30, 2 },
+			{ 32, 2, 32, 2 },
+			{ 34, 2, 34, 2 },
+			{ 36, 2, 36, 2 },
+			{ 38, 2, 38, 2 },
+			{ 40, 2, 40, 2 },
+			{ 42, 2, 42, 2 },
+			{ 44, 2, 44, 2 },
+			{ 46, 2, 46, 2 },
+			{ 48, 2, 48, 2 },
+			{ 50, 2, 50, 2 },
+			{ 52, 2, 52, 2 },
+			{ 54, 2, 54, 2 },
+			{ 56, 2, 56, 2 },
+			{ 58, 2, 58, 2 },
+			{ 60, 2, 60, 2 },
+			{ 62, 2, 62, 2 },
+			{ 64, 2, 64, 2 },
+			{ 66, 2, 66, 2 },
+			{ 68, 2, 68, 2 },
+			{ 70, 2, 70, 2 },
+			{ 72, 2, 72, 2 },
+			{ 74, 2, 74, 2 },
+			{ 76, 2, 76, 2 },
+			{ 78, 2, 78, 2 },
+			{ 80, 2, 80, 2 },
+			{ 82, 2, 82, 2 },
+			{ 84, 2, 84, 2 },
+			{ 86, 2, 86, 2 },
+			{ 88, 2, 88, 2 },
+			{ 90, 2, 90, 2 },
+			{ 92, 2, 92, 2 },
+			{ 94, 2, 94, 2 },
+			{ 96, 2, 96, 2 },
+			{ 98, 2, 98, 2 },
+			{ 100, 2, 100, 2 },
+			{ 102, 2, 102, 2 },
+			{ 104, 2, 104, 2 },
+			{ 106, 2, 106, 2 },
+			{ 108, 2, 108, 2 },
+			{ 110, 2, 110, 2 },
+			{ 112, 2, 112, 2 },
+			{ 114, 2, 114, 2 },
+			{ 116, 2, 116, 2 },
+			{ 118, 2, 118, 2 },
+			{ 120, 2, 120, 2 },
+			{ 122, 2, 122, 2 },
+			{ 124, 2, 124, 2 },
+			{ 126, 2, 126, 2 },
+			{ 128, 2, 128, 2 },
+			{ 130, 2, 130, 2 },
+			{ 132, 2, 132, 2 },
+			{ 134, 2, 134, 2 },
+			{ 136, 2, 136, 2 },
+			{ 138, 2, 138, 2 },
+			{ 140, 2, 140, 2 },
+			{ 142, 2, 142, 2 },
+			{ 144, 2, 144, 2 },
+			{ 146, 2, 146, 2 },
+			{ 148, 2, 148, 2 },
+			{ 150, 2, 150, 2 },
+			{ 152, 2, 152, 2 },
+			{ 154, 2, 154, 2 },
+			{ 156, 2, 156, 2 },
+			{ 158, 2, 158, 2 },
+			{ 160, 2, 160, 2 },
+			{ 162, 2, 162, 2 },
+			{ 164, 2, 164, 2 },
+			{ 166, 2, 166, 2 },
+			{ 168, 2, 168, 2 },
+			{ 170, 2, 170, 2 },
+			{ 172, 2, 172, 2 },
+			{ 174, 2, 174, 2 },
+			{ 176, 2, 176, 2 },
+			{ 178, 2, 178, 2 },
+			{ 180, 2, 180, 2 },
+			{ 182, 2, 182, 2 },
+			{ 184, 2, 184, 2 },
+			{ 186, 2, 186, 2 },
+			{ 188, 2, 188, 2 },
+			{ 190, 2, 190, 2 },
+			{ 192, 2, 192, 2 },
+			{ 194, 2, 194, 2 },
+			{ 196, 2, 196, 2 },
+			{ 198, 2, 198, 2 },
+			{ 200, 2, 200, 2 },
+			{ 202, 2, 202, 2 },
+			{ 204, 2, 204, 2 },
+			{ 206, 2, 206, 2 },
+			{ 208, 2, 208, 2 },
+			{ 210, 2, 210, 2 },
+			{ 212, 2, 212, 2 },
+			{ 214, 2, 214, 2 },
+			{ 216, 2, 216, 2 },
+			{ 218, 2, 218, 2 },
+			{ 0, 0, 220, 2 },
+			{ 0, 0, 222, 2 },
+			{ 224, 2, 224, 2 },
+			{ 226, 2, 226, 2 },
+			{ 228, 2, 228, 2 },
+			{ 230, 2, 230, 2 },
+			{ 232, 2, 232, 2 },
+			{ 234, 2, 234, 2 },
+			{ 236, 2, 236, 2 },
+			{ 238, 2, 238, 2 },
+			{ 240, 2, 240, 2 },
+			{ 242, 2, 242, 2 },
+			{ 0, 0, 244, 2 },
+			{ 0, 0, 246, 2 },
+			{ 248, 2, 248, 2 },
+			{ 250, 2, 250, 2 },
+			{ 252, 2, 252, 2 },
+			{ 254, 2, 254, 2 },
+			{ 256, 2, 256, 2 },
+			{ 258, 2, 258, 2 },
+			{ 0, 0, 260, 2 },
+			{ 262, 2, 262, 2 },
+			{ 264, 2, 264, 2 },
+			{ 266, 2, 266, 2 },
+			{ 268, 2, 268, 2 },
+			{ 270, 2, 270, 2 },
+			{ 272, 2, 272, 2 },
+			{ 274, 2, 274, 2 },
+			{ 276, 2, 276, 2 },
+			{ 278, 2, 278, 2 },
+			{ 280, 2, 280, 2 },
+			{ 282, 2, 282, 2 },
+			{ 284, 2, 284, 2 },
+			{ 286, 2, 286, 2 },
+			{ 288, 2, 288, 2 },
+			{ 290, 2, 290, 2 },
+			{ 292, 2, 292, 2 },
+			{ 294, 2, 294, 2 },
+			{ 296, 2, 296, 2 },
+			{ 298, 2, 298, 2 },
+			{ 300, 2, 300, 2 },
+			{ 302, 2, 302, 2 },
+			{ 304, 2, 304, 2 },
+			{ 306, 2, 306, 2 },
+			{ 308, 2, 308, 2 },
+			{ 310, 2, 310, 2 },
+			{ 312, 2, 312, 2 },
+			{ 314, 2, 314, 2 },
+			{ 316, 2, 316, 2 },
+			{ 318, 2, 318, 2 },
+			{ 320, 2, 320, 2 },
+			{ 322, 2, 322, 2 },
+			{ 324, 2, 324, 2 },
+			{ 326, 2, 326, 2 },
+			{ 328, 2, 328, 2 },
+			{ 330, 2, 330, 2 },
+			{ 332, 2, 332, 2 },
+			{ 334, 2, 334, 2 },
+			{ 336, 2, 336, 2 },
+			{ 338, 2, 338, 2 },
+			{ 340, 2, 340, 2 },
+			{ 342, 2, 342, 2 },
+			{ 344, 2, 344, 2 },
+			{ 346, 2, 346, 2 },
+			{ 348, 2, 348, 2 },
+			{ 350, 2, 350, 2 },
+			{ 352, 2, 352, 2 },
+			{ 354, 2, 354, 2 },
+			{ 0, 0, 356, 1 },
+			{ 357, 2, 357, 2 },
+			{ 359, 2, 359, 2 },
+			{ 361, 2, 361, 2 },
+			{ 363, 2, 363, 2 },
+			{ 0, 0, 365, 3 },
+			{ 0, 0, 368, 3 },
+			{ 0, 0, 371, 3 },
+			{ 0, 0, 374, 2 },
+			{ 0, 0, 376, 2 },
+			{ 0, 0, 378, 2 },
+			{ 0, 0, 380, 2 },
+			{ 0, 0, 382, 2 },
+			{ 0, 0, 384, 2 },
+			{ 386, 2, 386, 2 },
+			{ 388, 2, 388, 2 },
+			{ 390, 2, 390, 2 },
+			{ 392, 2, 392, 2 },
+			{ 394, 2, 394, 2 },
+			{ 396, 2, 396, 2 },
+			{ 398, 2, 398, 2 },
+			{ 400, 2, 400, 2 },
+			{ 402, 3, 402, 3 },
+			{ 405, 3, 405, 3 },
+			{ 408, 3, 408, 3 },
+			{ 411, 3, 411, 3 },
+			{ 414, 3, 414, 3 },
+			{ 417, 3, 417, 3 },
+			{ 420, 3, 420, 3 },
+			{ 423, 3, 423, 3 },
+			{ 426, 3, 426, 3 },
+			{ 429, 3, 429, 3 },
+			{ 432, 3, 432, 3 },
+			{ 435, 3, 435, 3 },
+			{ 438, 2, 438, 2 },
+			{ 440, 2, 440, 2 },
+			{ 442, 2, 442, 2 },
+			{ 444, 2, 444, 2 },
+			{ 446, 2, 446, 2 },
+			{ 448, 2, 448, 2 },
+			{ 450, 2, 450, 2 },
+			{ 452, 2, 452, 2 },
+			{ 454, 3, 454, 3 },
+			{ 457, 3, 457, 3 },
+			{ 460, 2, 460, 2 },
+			{ 462, 2, 462, 2 },
+			{ 464, 2, 464, 2 },
+			{ 0, 0, 466, 2 },
+			{ 0, 0, 468, 2 },
+			{ 0, 0, 470, 2 },
+			{ 472, 2, 472, 2 },
+			{ 474, 2, 474, 2 },
+			{ 476, 2, 476, 2 },
+			{ 478, 2, 478, 2 },
+			{ 480, 3, 480, 3 },
+			{ 483, 3, 483, 3 },
+			{ 486, 2, 486, 2 },
+			{ 488, 2, 488, 2 },
+			{ 490, 2, 490, 2 },
+			{ 492, 2, 492, 2 },
+			{ 494, 2, 494, 2 },
+			{ 496, 2, 496, 2 },
+			{ 498, 2, 498, 2 },
+			{ 500, 2, 500, 2 },
+			{ 502, 2, 502, 2 },
+			{ 504, 2, 504, 2 },
+			{ 506, 2, 506, 2 },
+			{ 508, 2, 508, 2 },
+			{ 510, 2, 510, 2 },
+			{ 512, 2, 512, 2 },
+			{ 514, 2, 514, 2 },
+			{ 516, 2, 516, 2 },
+			{ 518, 2, 518, 2 },
+			{ 520, 2, 520, 2 },
+			{ 522, 2, 522, 2 },
+			{ 524, 2, 524, 2 },
+			{ 526, 2, 526, 2 },
+			{ 528, 2, 528, 2 },
+			{ 530, 2, 530, 2 },
+			{ 532, 2, 532, 2 },
+			{ 534, 2, 534, 2 },
+			{ 536, 2, 536, 2 },
+			{ 538, 2, 538, 2 },
+			{ 540, 2, 540, 2 },
+			{ 542, 2, 542, 2 },
+			{ 544, 2, 544, 2 },
+			{ 546, 2, 546, 2 },
+			{ 548, 2, 548, 2 },
+			{ 550, 2, 550, 2 },
+			{ 552, 2, 552, 2 },
+			{ 554, 2, 554, 2 },
+			{ 556, 2, 556, 2 },
+			{ 558, 2, 558, 2 },
+			{ 560, 2, 560, 2 },
+			{ 562, 3, 562, 3 },
+			{ 565, 3, 565, 3 },
+			{ 568, 3, 568, 3 },
+			{ 571, 3, 571, 3 },
+			{ 574, 2, 574, 2 },
+			{ 576, 2, 576, 2 },
+			{ 578, 3, 578, 3 },
+			{ 581, 3, 581, 3 },
+			{ 584, 2, 584, 2 },
+			{ 586, 2, 586, 2 },
+			{ 0, 0, 588, 1 },
+			{ 0, 0, 589, 1 },
+			{ 0, 0, 590, 1 },
+			{ 0, 0, 591, 1 },
+			{ 0, 0, 592, 1 },
+			{ 0, 0, 593, 1 },
+			{ 0, 0, 594, 1 },
+			{ 0, 0, 595, 1 },
+			{ 0, 0, 596, 1 },
+			{ 0, 0, 597, 2 },
+			{ 0, 0, 599, 2 },
+			{ 0, 0, 601, 2 },
+			{ 0, 0, 603, 2 },
+			{ 0, 0, 605, 2 },
+			{ 0, 0, 607, 2 },
+			{ 0, 0, 609, 1 },
+			{ 0, 0, 610, 1 },
+			{ 0, 0, 611, 1 },
+			{ 0, 0, 612, 1 },
+			{ 0, 0, 613, 1 },
+			{ 614, 1, 614, 1 },
+			{ 615, 1, 615, 1 },
+			{ 616, 1, 616, 1 },
+			{ 617, 2, 617, 2 },
+			{ 619, 1, 619, 1 },
+			{ 0, 0, 620, 2 },
+			{ 622, 1, 622, 1 },
+			{ 0, 0, 623, 2 },
+			{ 625, 2, 627, 3 },
+			{ 630, 2, 630, 2 },
+			{ 632, 1, 632, 1 },
+			{ 633, 2, 633, 2 },
+			{ 635, 2, 635, 2 },
+			{ 637, 2, 637, 2 },
+			{ 639, 2, 639, 2 },
+			{ 641, 2, 641, 2 },
+			{ 643, 2, 643, 2 },
+			{ 645, 3, 645, 3 },
+			{ 648, 2, 648, 2 },
+			{ 650, 2, 650, 2 },
+			{ 652, 2, 652, 2 },
+			{ 654, 2, 654, 2 },
+			{ 656, 2, 656, 2 },
+			{ 658, 2, 658, 2 },
+			{ 660, 3, 660, 3 },
+			{ 663, 2, 663, 2 },
+			{ 665, 2, 665, 2 },
+			{ 667, 2, 667, 2 },
+			{ 669, 2, 669, 2 },
+			{ 671, 2, 671, 2 },
+			{ 0, 0, 673, 1 },
+			{ 0, 0, 674, 1 },
+			{ 0, 0, 675, 1 },
+			{ 676, 2, 678, 2 },
+			{ 680, 2, 682, 2 },
+			{ 0, 0, 684, 1 },
+			{ 0, 0, 685, 1 },
+			{ 0, 0, 686, 1 },
+			{ 0, 0, 687, 1 },
+			{ 0, 0, 688, 1 },
+			{ 0, 0, 689, 1 },
+			{ 0, 0, 690, 1 },
+			{ 0, 0, 691, 1 },
+			{ 692, 2, 692, 2 },
+			{ 694, 2, 694, 2 },
+			{ 696, 2, 696, 2 },
+			{ 698, 2, 698, 2 },
+			{ 700, 2, 700, 2 },
+			{ 702, 2, 702, 2 },
+			{ 704, 2, 704, 2 },
+			{ 706, 2, 706, 2 },
+			{ 708, 2, 708, 2 },
+			{ 710, 2, 710, 2 },
+			{ 712, 2, 712, 2 },
+			{ 714, 2, 714, 2 },
+			{ 716, 2, 716, 2 },
+			{ 718, 2, 718, 2 },
+			{ 720, 2, 720, 2 },
+			{ 722, 2, 722, 2 },
+			{ 724, 2, 724, 2 },
+			{ 726, 2, 726, 2 },
+			{ 728, 2, 728, 2 },
+			{ 730, 2, 730, 2 },
+			{ 732, 2, 732, 2 },
+			{ 734, 2, 734, 2 },
+			{ 736, 2, 736, 2 },
+			{ 738, 2, 738, 2 },
+			{ 740, 2, 740, 2 },
+			{ 742, 2, 742, 2 },
+			{ 744, 2, 744, 2 },
+			{ 746, 2, 746, 2 },
+			{ 748, 2, 748, 2 },
+			{ 750, 2, 750, 2 },
+			{ 752, 2, 752, 2 },
+			{ 754, 2, 754, 2 },
+			{ 756, 2, 756, 2 },
+			{ 758, 2, 758, 2 },
+			{ 760, 2, 760, 2 },
+			{ 762, 2, 762, 2 },
+			{ 764, 2, 764, 2 },
+			{ 766, 2, 766, 2 },
+			{ 768, 2, 768, 2 },
+			{ 770, 2, 770, 2 },
+			{ 772, 2, 772, 2 },
+			{ 774, 2, 774, 2 },
+			{ 776, 2, 776, 2 },
+			{ 778, 2, 778, 2 },
+			{ 780, 2, 780, 2 },
+			{ 782, 2, 782, 2 },
+			{ 784, 2, 784, 2 },
+			{ 786, 2, 786, 2 },
+			{ 788, 2, 788, 2 },
+			{ 790, 2, 790, 2 },
+			{ 792, 2, 792, 2 },
+			{ 794, 2, 794, 2 },
+			{ 0, 0, 796, 2 },
+			{ 798, 2, 798, 2 },
+			{ 800, 2, 800, 2 },
+			{ 802, 2, 802, 2 },
+			{ 804, 2, 804, 2 },
+			{ 806, 2, 806, 2 },
+			{ 0, 0, 808, 2 },
+			{ 0, 0, 810, 2 },
+			{ 0, 0, 812, 2 },
+			{ 0, 0, 814, 2 },
+			{ 816, 2, 816, 2 },
+			{ 818, 2, 818, 2 },
+			{ 820, 2, 820, 2 },
+			{ 822, 2, 822, 2 },
+			{ 824, 2, 824, 2 },
+			{ 826, 2, 826, 2 },
+			{ 828, 2, 828, 2 },
+			{ 830, 2, 830, 2 },
+			{ 832, 2, 832, 2 },
+			{ 834, 2, 834, 2 },
+			{ 836, 2, 836, 2 },
+			{ 838, 2, 838, 2 },
+			{ 840, 2, 840, 2 },
+			{ 842, 2, 842, 2 },
+			{ 844, 2, 844, 2 },
+			{ 846, 2, 846, 2 },
+			{ 848, 2, 848, 2 },
+			{ 850, 2, 850, 2 },
+			{ 852, 2, 852, 2 },
+			{ 854, 2, 854, 2 },
+			{ 856, 2, 856, 2 },
+			{ 858, 2, 858, 2 },
+			{ 860, 2, 860, 2 },
+			{ 862, 2, 862, 2 },
+			{ 864, 2, 864, 2 },
+			{ 866, 2, 866, 2 },
+			{ 868, 2, 868, 2 },
+			{ 870, 2, 870, 2 },
+			{ 872, 2, 872, 2 },
+			{ 874, 2, 874, 2 },
+			{ 876, 2, 876, 2 },
+			{ 878, 2, 878, 2 },
+			{ 880, 2, 880, 2 },
+			{ 882, 2, 882, 2 },
+			{ 884, 2, 884, 2 },
+			{ 886, 2, 886, 2 },
+			{ 888, 2, 888, 2 },
+			{ 890, 2, 890, 2 },
+			{ 892, 2, 892, 2 },
+			{ 894, 3, 894, 3 },
+			{ 897, 2, 897, 2 },
+			{ 899, 2, 899, 2 },
+			{ 901, 2, 901, 2 },
+			{ 903, 2, 903, 2 },
+			{ 905, 2, 905, 2 },
+			{ 907, 3, 907, 3 },
+			{ 910, 2, 910, 2 },
+			{ 0, 0, 912, 2 },
+			{ 0, 0, 914, 2 },
+			{ 0, 0, 916, 2 },
+			{ 0, 0, 918, 2 },
+			{ 0, 0, 920, 1 },
+			{ 921, 2, 921, 2 },
+			{ 923, 2, 923, 2 },
+			{ 925, 2, 925, 2 },
+			{ 927, 2, 927, 2 },
+			{ 929, 2, 929, 2 },
+			{ 931, 2, 931, 2 },
+			{ 933, 2, 933, 2 },
+			{ 935, 2, 935, 2 },
+			{ 937, 2, 937, 2 },
+			{ 0, 0, 939, 3 },
+			{ 942, 2, 942, 2 },
+			{ 0, 0, 944, 3 },
+			{ 947, 2, 947, 2 },
+			{ 949, 2, 949, 2 },
+			{ 951, 2, 951, 2 },
+			{ 953, 2, 953, 2 },
+			{ 955, 2, 955, 2 },
+			{ 957, 2, 957, 2 },
+			{ 959, 2, 959, 2 },
+			{ 961, 2, 961, 2 },
+			{ 0, 0, 963, 1 },
+			{ 964, 2, 964, 2 },
+			{ 966, 2, 966, 2 },
+			{ 968, 2, 968, 2 },
+			{ 970, 2, 970, 2 },
+			{ 972, 2, 972, 2 },
+			{ 974, 2, 974, 2 },
+			{ 976, 2, 976, 2 },
+			{ 978, 2, 978, 2 },
+			{ 980, 2, 980, 2 },
+			{ 982, 2, 982, 2 },
+			{ 984, 2, 984, 2 },
+			{ 0, 0, 986, 1 },
+			{ 0, 0, 987, 1 },
+			{ 0, 0, 988, 1 },
+			{ 0, 0, 989, 1 },
+			{ 0, 0, 990, 1 },
+			{ 0, 0, 991, 1 },
+			{ 0, 0, 992, 1 },
+			{ 0, 0, 993, 1 },
+			{ 0, 0, 994, 1 },
+			{ 0, 0, 995, 1 },
+			{ 0, 0, 996, 1 },
+			{ 0, 0, 997, 1 },
+			{ 0, 0, 998, 1 },
+			{ 0, 0, 999, 1 },
+			{ 0, 0, 1000, 1 },
+			{ 0, 0, 1001, 1 },
+			{ 0, 0, 1002, 1 },
+			{ 0, 0, 1003, 1 },
+			{ 0, 0, 1004, 1 },
+			{ 0, 0, 1005, 1 },
+			{ 0, 0, 1006, 1 },
+			{ 0, 0, 1007, 1 },
+			{ 0, 0, 1008, 1 },
+			{ 0, 0, 1009, 1 },
+			{ 0, 0, 1010, 1 },
+			{ 0, 0, 1011, 1 },
+			{ 0, 0, 1012, 1 },
+			{ 0, 0, 1013, 1 },
+			{ 0, 0, 1014, 1 },
+			{ 0, 0, 1015, 1 },
+			{ 0, 0, 1016, 1 },
+			{ 0, 0, 1017, 1 },
+			{ 0, 0, 1018, 1 },
+			{ 0, 0, 1019, 1 },
+			{ 0, 0, 1020, 1 },
+			{ 0, 0, 1021, 1 },
+			{ 0, 0, 1022, 1 },
+			{ 0, 0, 1023, 1 },
+			{ 0, 0, 1024, 1 },
+			{ 0, 0, 1025, 1 },
+			{ 0, 0, 1026, 1 },
+			{ 0, 0, 1027, 1 },
+			{ 0, 0, 1028, 1 },
+			{ 0, 0, 1029, 1 },
+			{ 0, 0, 1030, 1 },
+			{ 0, 0, 1031, 1 },
+			{ 0, 0, 1032, 1 },
+			{ 0, 0, 1033, 1 },
+			{ 0, 0, 1034, 1 },
+			{ 0, 0, 1035, 1 },
+			{ 0, 0, 1036, 1 },
+			{ 0, 0, 1037, 1 },
+			{ 0, 0, 1038, 1 },
+			{ 0, 0, 1039, 1 },
+			{ 0, 0, 1040, 1 },
+			{ 0, 0, 1041, 1 },
+			{ 0, 0, 1042, 1 },
+			{ 0, 0, 1043, 1 },
+			{ 0, 0, 1044, 1 },
+			{ 0, 0, 1045, 1 },
+			{ 0, 0, 1046, 1 },
+			{ 0, 0, 1047, 1 },
+			{ 0, 0, 1048, 1 },
+			{ 0, 0, 1049, 1 },
+			{ 0, 0, 1050, 1 },
+			{ 0, 0, 1051, 1 },
+			{ 0, 0, 1052, 1 },
+			{ 0, 0, 1053, 1 },
+			{ 0, 0, 1054, 1 },
+			{ 0, 0, 1055, 1 },
+			{ 0, 0, 1056, 1 },
+			{ 0, 0, 1057, 1 },
+			{ 0, 0, 1058, 1 },
+			{ 0, 0, 1059, 1 },
+			{ 0, 0, 1060, 1 },
+			{ 0, 0, 1061, 1 },
+			{ 0, 0, 1062, 1 },
+			{ 0, 0, 1063, 1 },
+			{ 0, 0, 1064, 1 },
+			{ 0, 0, 1065, 1 },
+			{ 0, 0, 1066, 1 },
+			{ 0, 0, 1067, 1 },
+			{ 0, 0, 1068, 1 },
+			{ 0, 0, 1069, 1 },
+			{ 0, 0, 1070, 1 },
+			{ 0, 0, 1071, 1 },
+			{ 0, 0, 1072, 1 },
+			{ 0, 0, 1073, 1 },
+			{ 0, 0, 1074, 1 },
+			{ 0, 0, 1075, 1 },
+			{ 0, 0, 1076, 1 },
+			{ 0, 0, 1077, 1 },
+			{ 0, 0, 1078, 1 },
+			{ 0, 0, 1079, 1 },
+			{ 0, 0, 1080, 1 },
+			{ 0, 0, 1081, 1 },
+			{ 0, 0, 1082, 1 },
+			{ 0, 0, 1083, 1 },
+			{ 1084, 2, 1084, 2 },
+			{ 1086, 2, 1086, 2 },
+			{ 1088, 2, 1088, 2 },
+			{ 1090, 2, 1090, 2 },
+			{ 1092, 2, 1092, 2 },
+			{ 1094, 2, 1094, 2 },
+			{ 1096, 2, 1096, 2 },
+			{ 1098, 2, 1098, 2 },
+			{ 1100, 3, 1100, 3 },
+			{ 1103, 3, 1103, 3 },
+			{ 1106, 2, 1106, 2 },
+			{ 1108, 2, 1108, 2 },
+			{ 1110, 2, 1110, 2 },
+			{ 1112, 2, 1112, 2 },
+			{ 1114, 2, 1114, 2 },
+			{ 1116, 2, 1116, 2 },
+			{ 1118, 2, 1118, 2 },
+			{ 1120, 2, 1120, 2 },
+			{ 1122, 2, 1122, 2 },
+			{ 1124, 2, 1124, 2 },
+			{ 1126, 3, 1126, 3 },
+			{ 1129, 3, 1129, 3 },
+			{ 1132, 3, 1132, 3 },
+			{ 1135, 3, 1135, 3 },
+			{ 1138, 2, 1138, 2 },
+			{ 1140, 2, 1140, 2 },
+			{ 1142, 2, 1142, 2 },
+			{ 1144, 2, 1144, 2 },
+			{ 1146, 3, 1146, 3 },
+			{ 1149, 3, 1149, 3 },
+			{ 1152, 2, 1152, 2 },
+			{ 1154, 2, 1154, 2 },
+			{ 1156, 2, 1156, 2 },
+			{ 1158, 2, 1158, 2 },
+			{ 1160, 2, 1160, 2 },
+			{ 1162, 2, 1162, 2 },
+			{ 1164, 2, 1164, 2 },
+			{ 1166, 2, 1166, 2 },
+			{ 1168, 2, 1168, 2 },
+			{ 1170, 2, 1170, 2 },
+			{ 1172, 2, 1172, 2 },
+			{ 1174, 2, 1174, 2 },
+			{ 1176, 2, 1176, 2 },
+			{ 1178, 2, 1178, 2 },
+			{ 1180, 2, 1180, 2 },
+			{ 1182, 2, 1182, 2 },
+			{ 1184, 3, 1184, 3 },
+			{ 1187, 3, 1187, 3 },
+			{ 1190, 2, 1190, 2 },
+			{ 1192, 2, 1192, 2 },
+			{ 1194, 2, 1194, 2 },
+			{ 1196, 2, 1196, 2 },
+			{ 1198, 2, 1198, 2 },
+			{ 1200, 2, 1200, 2 },
+			{ 1202, 2, 1202, 2 },
+			{ 1204, 2, 1204, 2 },
+			{ 1206, 3, 1206, 3 },
+			{ 1209, 3, 1209, 3 },
+			{ 1212, 2, 1212, 2 },
+			{ 1214, 2, 1214, 2 },
+			{ 1216, 2, 1216, 2 },
+			{ 1218, 2, 1218, 2 },
+			{ 1220, 2, 1220, 2 },
+			{ 1222, 2, 1222, 2 },
+			{ 1224, 2, 1224, 2 },
+			{ 1226, 2, 1226, 2 },
+			{ 1228, 2, 1228, 2 },
+			{ 1230, 2, 1230, 2 },
+			{ 1232, 2, 1232, 2 },
+			{ 1234, 2, 1234, 2 },
+			{ 1236, 2, 1236, 2 },
+			{ 1238, 2, 1238, 2 },
+			{ 1240, 2, 1240, 2 },
+			{ 1242, 2, 1242, 2 },
+			{ 1244, 2, 1244, 2 },
+			{ 1246, 2, 1246, 2 },
+			{ 1248, 3, 1248, 3 },
+			{ 1251, 3, 1251, 3 },
+			{ 1254, 3, 1254, 3 },
+			{ 1257, 3, 1257, 3 },
+			{ 1260, 3, 1260, 3 },
+			{ 1263, 3, 1263, 3 },
+			{ 1266, 3, 1266, 3 },
+			{ 1269, 3, 1269, 3 },
+			{ 1272, 2, 1272, 2 },
+			{ 1274, 2, 1274, 2 },
+			{ 1276, 2, 1276, 2 },
+			{ 1278, 2, 1278, 2 },
+			{ 1280, 2, 1280, 2 },
+			{ 1282, 2, 1282, 2 },
+			{ 1284, 2, 1284, 2 },
+			{ 1286, 2, 1286, 2 },
+			{ 1288, 3, 1288, 3 },
+			{ 1291, 3, 1291, 3 },
+			{ 1294, 2, 1294, 2 },
+			{ 1296, 2, 1296, 2 },
+			{ 1298, 2, 1298, 2 },
+			{ 1300, 2, 1300, 2 },
+			{ 1302, 2, 1302, 2 },
+			{ 1304, 2, 1304, 2 },
+			{ 1306, 3, 1306, 3 },
+			{ 1309, 3, 1309, 3 },
+			{ 1312, 3, 1312, 3 },
+			{ 1315, 3, 1315, 3 },
+			{ 1318, 3, 1318, 3 },
+			{ 1321, 3, 1321, 3 },
+			{ 1324, 2, 1324, 2 },
+			{ 1326, 2, 1326, 2 },
+			{ 1328, 2, 1328, 2 },
+			{ 1330, 2, 1330, 2 },
+			{ 1332, 2, 1332, 2 },
+			{ 1334, 2, 1334, 2 },
+			{ 1336, 2, 1336, 2 },
+			{ 1338, 2, 1338, 2 },
+			{ 1340, 2, 1340, 2 },
+			{ 1342, 2, 1342, 2 },
+			{ 1344, 2, 1344, 2 },
+			{ 1346, 2, 1346, 2 },
+			{ 1348, 2, 1348, 2 },
+			{ 1350, 2, 1350, 2 },
+			{ 1352, 3, 1352, 3 },
+			{ 1355, 3, 1355, 3 },
+			{ 1358, 3, 1358, 3 },
+			{ 1361, 3, 1361, 3 },
+			{ 1364, 2, 1364, 2 },
+			{ 1366, 2, 1366, 2 },
+			{ 1368, 2, 1368, 2 },
+			{ 1370, 2, 1370, 2 },
+			{ 1372, 2, 1372, 2 },
+			{ 1374, 2, 1374, 2 },
+			{ 1376, 2, 1376, 2 },
+			{ 1378, 2, 1378, 2 },
+			{ 1380, 2, 1380, 2 },
+			{ 1382, 2, 1382, 2 },
+			{ 1384, 2, 1384, 2 },
+			{ 1386, 2, 1386, 2 },
+			{ 1388, 2, 1388, 2 },
+			{ 1390, 2, 1390, 2 },
+			{ 1392, 2, 1392, 2 },
+			{ 1394, 2, 1394, 2 },
+			{ 1396, 2, 1396, 2 },
+			{ 1398, 2, 1398, 2 },
+			{ 1400, 2, 1400, 2 },
+			{ 1402, 2, 1402, 2 },
+			{ 1404, 2, 1404, 2 },
+			{ 1406, 2, 1406, 2 },
+			{ 1408, 2, 1408, 2 },
+			{ 1410, 2, 1410, 2 },
+			{ 1412, 2, 1412, 2 },
+			{ 1414, 2, 1414, 2 },
+			{ 1416, 2, 1416, 2 },
+			{ 1418, 2, 1418, 2 },
+			{ 1420, 2, 1420, 2 },
+			{ 1422, 2, 1422, 2 },
+			{ 0, 0, 1424, 2 },
+			{ 1426, 2, 1428, 2 },
+			{ 1430, 2, 1430, 2 },
+			{ 1432, 2, 1432, 2 },
+			{ 1434, 2, 1434, 2 },
+			{ 1436, 2, 1436, 2 },
+			{ 1438, 3, 1438, 3 },
+			{ 1441, 3, 1441, 3 },
+			{ 1444, 3, 1444, 3 },
+			{ 1447, 3, 1447, 3 },
+			{ 1450, 3, 1450, 3 },
+			{ 1453, 3, 1453, 3 },
+			{ 1456, 3, 1456, 3 },
+			{ 1459, 3, 1459, 3 },
+			{ 1462, 3, 1462, 3 },
+			{ 1465, 3, 1465, 3 },
+			{ 1468, 3, 1468, 3 },
+			{ 1471, 3, 1471, 3 },
+			{ 1474, 3, 1474, 3 },
+			{ 1477, 3, 1477, 3 },
+			{ 1480, 3, 1480, 3 },
+			{ 1483, 3, 1483, 3 },
+			{ 1486, 3, 1486, 3 },
+			{ 1489, 3, 1489, 3 },
+			{ 1492, 3, 1492, 3 },
+			{ 1495, 3, 1495, 3 },
+			{ 1498, 2, 1498, 2 },
+			{ 1500, 2, 1500, 2 },
+			{ 1502, 2, 1502, 2 },
+			{ 1504, 2, 1504, 2 },
+			{ 1506, 2, 1506, 2 },
+			{ 1508, 2, 1508, 2 },
+			{ 1510, 3, 1510, 3 },
+			{ 1513, 3, 1513, 3 },
+			{ 1516, 3, 1516, 3 },
+			{ 1519, 3, 1519, 3 },
+			{ 1522, 3, 1522, 3 },
+			{ 1525, 3, 1525, 3 },
+			{ 1528, 3, 1528, 3 },
+			{ 1531, 3, 1531, 3 },
+			{ 1534, 3, 1534, 3 },
+			{ 1537, 3, 1537, 3 },
+			{ 1540, 2, 1540, 2 },
+			{ 1542, 2, 1542, 2 },
+			{ 1544, 2, 1544, 2 },
+			{ 1546, 2, 1546, 2 },
+			{ 1548, 2, 1548, 2 },
+			{ 1550, 2, 1550, 2 },
+			{ 1552, 2, 1552, 2 },
+			{ 1554, 2, 1554, 2 },
+			{ 1556, 3, 1556, 3 },
+			{ 1559, 3, 1559, 3 },
+			{ 1562, 3, 1562, 3 },
+			{ 1565, 3, 1565, 3 },
+			{ 1568, 3, 1568, 3 },
+			{ 1571, 3, 1571, 3 },
+			{ 1574, 3, 1574, 3 },
+			{ 1577, 3, 1577, 3 },
+			{ 1580, 3, 1580, 3 },
+			{ 1583, 3, 1583, 3 },
+			{ 1586, 3, 1586, 3 },
+			{ 1589, 3, 1589, 3 },
+			{ 1592, 3, 1592, 3 },
+			{ 1595, 3, 1595, 3 },
+			{ 1598, 3, 1598, 3 },
+			{ 1601, 3, 1601, 3 },
+			{ 1604, 3, 1604, 3 },
+			{ 1607, 3, 1607, 3 },
+			{ 1610, 3, 1610, 3 },
+			{ 1613, 3, 1613, 3 },
+			{ 1616, 2, 1616, 2 },
+			{ 1618, 2, 1618, 2 },
+			{ 1620, 2, 1620, 2 },
+			{ 1622, 2, 1622, 2 },
+			{ 1624, 3, 1624, 3 },
+			{ 1627, 3, 1627, 3 },
+			{ 1630, 3, 1630, 3 },
+			{ 1633, 3, 1633, 3 },
+			{ 1636, 3, 1636, 3 },
+			{ 1639, 3, 1639, 3 },
+			{ 1642, 3, 1642, 3 },
+			{ 1645, 3, 1645, 3 },
+			{ 1648, 3, 1648, 3 },
+			{ 1651, 3, 1651, 3 },
+			{ 1654, 2, 1654, 2 },
+			{ 1656, 2, 1656, 2 },
+			{ 1658, 2, 1658, 2 },
+			{ 1660, 2, 1660, 2 },
+			{ 1662, 2, 1662, 2 },
+			{ 1664, 2, 1664, 2 },
+			{ 1666, 2, 1666, 2 },
+			{ 1668, 2, 1668, 2 },
+			{ 1670, 2, 1670, 2 },
+			{ 1672, 2, 1672, 2 },
+			{ 1674, 3, 1674, 3 },
+			{ 1677, 3, 1677, 3 },
+			{ 1680, 3, 1680, 3 },
+			{ 1683, 3, 1683, 3 },
+			{ 1686, 3, 1686, 3 },
+			{ 1689, 3, 1689, 3 },
+			{ 1692, 2, 1692, 2 },
+			{ 1694, 2, 1694, 2 },
+			{ 1696, 3, 1696, 3 },
+			{ 1699, 3, 1699, 3 },
+			{ 1702, 3, 1702, 3 },
+			{ 1705, 3, 1705, 3 },
+			{ 1708, 3, 1708, 3 },
+			{ 1711, 3, 1711, 3 },
+			{ 1714, 2, 1714, 2 },
+			{ 1716, 2, 1716, 2 },
+			{ 1718, 3, 1718, 3 },
+			{ 1721, 3, 1721, 3 },
+			{ 1724, 3, 1724, 3 },
+			{ 1727, 3, 1727, 3 },
+			{ 1730, 2, 1730, 2 },
+			{ 1732, 2, 1732, 2 },
+			{ 1734, 3, 1734, 3 },
+			{ 1737, 3, 1737, 3 },
+			{ 1740, 3, 1740, 3 },
+			{ 1743, 3, 1743, 3 },
+			{ 1746, 2, 1746, 2 },
+			{ 1748, 2, 1748, 2 },
+			{ 1750, 3, 1750, 3 },
+			{ 1753, 3, 1753, 3 },
+			{ 1756, 3, 1756, 3 },
+			{ 1759, 3, 1759, 3 },
+			{ 1762, 3, 1762, 3 },
+			{ 1765, 3, 1765, 3 },
+			{ 1768, 2, 1768, 2 },
+			{ 1770, 2, 1770, 2 },
+			{ 1772, 3, 1772, 3 },
+			{ 1775, 3, 1775, 3 },
+			{ 1778, 3, 1778, 3 },
+			{ 1781, 3, 1781, 3 },
+			{ 1784, 3, 1784, 3 },
+			{ 1787, 3, 1787, 3 },
+			{ 1790, 2, 1790, 2 },
+			{ 1792, 2, 1792, 2 },
+			{ 1794, 3, 1794, 3 },
+			{ 1797, 3, 1797, 3 },
+			{ 1800, 3, 1800, 3 },
+			{ 1803, 3, 1803, 3 },
+			{ 1806, 3, 1806, 3 },
+			{ 1809, 3, 1809, 3 },
+			{ 1812, 2, 1812, 2 },
+			{ 1814, 2, 1814, 2 },
+			{ 1816, 3, 1816, 3 },
+			{ 1819, 3, 1819, 3 },
+			{ 1822, 3, 1822, 3 },
+			{ 1825, 3, 1825, 3 },
+			{ 1828, 3, 1828, 3 },
+			{ 1831, 3, 1831, 3 },
+			{ 1834, 2, 1834, 2 },
+			{ 1836, 2, 1836, 2 },
+			{ 1838, 3, 1838, 3 },
+			{ 1841, 3, 1841, 3 },
+			{ 1844, 3, 1844, 3 },
+			{ 1847, 3, 1847, 3 },
+			{ 1850, 2, 1850, 2 },
+			{ 1852, 2, 1852, 2 },
+			{ 1854, 3, 1854, 3 },
+			{ 1857, 3, 1857, 3 },
+			{ 1860, 3, 1860, 3 },
+			{ 1863, 3, 1863, 3 },
+			{ 1866, 2, 1866, 2 },
+			{ 1868, 2, 1868, 2 },
+			{ 1870, 3, 1870, 3 },
+			{ 1873, 3, 1873, 3 },
+			{ 1876, 3, 1876, 3 },
+			{ 1879, 3, 1879, 3 },
+			{ 1882, 3, 1882, 3 },
+			{ 1885, 3, 1885, 3 },
+			{ 1888, 2, 1888, 2 },
+			{ 1890, 3, 1890, 3 },
+			{ 1893, 3, 1893, 3 },
+			{ 1896, 3, 1896, 3 },
+			{ 1899, 2, 1899, 2 },
+			{ 1901, 2, 1901, 2 },
+			{ 1903, 3, 1903, 3 },
+			{ 1906, 3, 1906, 3 },
+			{ 1909, 3, 1909, 3 },
+			{ 1912, 3, 1912, 3 },
+			{ 1915, 3, 1915, 3 },
+			{ 1918, 3, 1918, 3 },
+			{ 1921, 2, 1921, 2 },
+			{ 1923, 2, 1923, 2 },
+			{ 1925, 3, 1925, 3 },
+			{ 1928, 3, 1928, 3 },
+			{ 1931, 3, 1931, 3 },
+			{ 1934, 3, 1934, 3 },
+			{ 1937, 3, 1937, 3 },
+			{ 1940, 3, 1940, 3 },
+			{ 1943, 2, 1943, 2 },
+			{ 1945, 2, 1945, 2 },
+			{ 1947, 2, 1947, 2 },
+			{ 1949, 2, 1949, 2 },
+			{ 1951, 2, 1951, 2 },
+			{ 1953, 2, 1953, 2 },
+			{ 1955, 2, 1955, 2 },
+			{ 1957, 2, 1957, 2 },
+			{ 1959, 2, 1959, 2 },
+			{ 1961, 2, 1961, 2 },
+			{ 1963, 2, 1963, 2 },
+			{ 1965, 2, 1965, 2 },
+			{ 1967, 2, 1967, 2 },
+			{ 1969, 2, 1969, 2 },
+			{ 1971, 3, 1971, 3 },
+			{ 1974, 3, 1974, 3 },
+			{ 1977, 4, 1977, 4 },
+			{ 1981, 4, 1981, 4 },
+			{ 1985, 4, 1985, 4 },
+			{ 1989, 4, 1989, 4 },
+			{ 1993, 4, 1993, 4 },
+			{ 1997, 4, 1997, 4 },
+			{ 2001, 3, 2001, 3 },
+			{ 2004, 3, 2004, 3 },
+			{ 2007, 4, 2007, 4 },
+			{ 2011, 4, 2011, 4 },
+			{ 2015, 4, 2015, 4 },
+			{ 2019, 4, 2019, 4 },
+			{ 2023, 4, 2023, 4 },
+			{ 2027, 4, 2027, 4 },
+			{ 2031, 3, 2031, 3 },
+			{ 2034, 3, 2034, 3 },
+			{ 2037, 4, 2037, 4 },
+			{ 2041, 4, 2041, 4 },
+			{ 2045, 4, 2045, 4 },
+			{ 2049, 4, 2049, 4 },
+			{ 2053, 4, 2053, 4 },
+			{ 2057, 4, 2057, 4 },
+			{ 2061, 3, 2061, 3 },
+			{ 2064, 3, 2064, 3 },
+			{ 2067, 4, 2067, 4 },
+			{ 2071, 4, 2071, 4 },
+			{ 2075, 4, 2075, 4 },
+			{ 2079, 4, 2079, 4 },
+			{ 2083, 4, 2083, 4 },
+			{ 2087, 4, 2087, 4 },
+			{ 2091, 3, 2091, 3 },
+			{ 2094, 3, 2094, 3 },
+			{ 2097, 4, 2097, 4 },
+			{ 2101, 4, 2101, 4 },
+			{ 2105, 4, 2105, 4 },
+			{ 2109, 4, 2109, 4 },
+			{ 2113, 4, 2113, 4 },
+			{ 2117, 4, 2117, 4 },
+			{ 2121, 3, 2121, 3 },
+			{ 2124, 3, 2124, 3 },
+			{ 2127, 4, 2127, 4 },
+			{ 2131, 4, 2131, 4 },
+			{ 2135, 4, 2135, 4 },
+			{ 2139, 4, 2139, 4 },
+			{ 2143, 4, 2143, 4 },
+			{ 2147, 4, 2147, 4 },
+			{ 2151, 2, 2151, 2 },
+			{ 2153, 2, 2153, 2 },
+			{ 2155, 3, 2155, 3 },
+			{ 2158, 2, 2158, 2 },
+			{ 2160, 3, 2160, 3 },
+			{ 2163, 2, 2163, 2 },
+			{ 2165, 3, 2165, 3 },
+			{ 2168, 2, 2168, 2 },
+			{ 2170, 2, 2170, 2 },
+			{ 2172, 2, 2172, 2 },
+			{ 2174, 2, 2174, 2 },
+			{ 2176, 2, 2176, 2 },
+			{ 0, 0, 2178, 2 },
+			{ 2180, 1, 2180, 1 },
+			{ 0, 0, 2181, 2 },
+			{ 0, 0, 2183, 2 },
+			{ 2185, 2, 2187, 3 },
+			{ 2190, 3, 2190, 3 },
+			{ 2193, 2, 2193, 2 },
+			{ 2195, 3, 2195, 3 },
+			{ 2198, 2, 2198, 2 },
+			{ 2200, 3, 2200, 3 },
+			{ 2203, 2, 2203, 2 },
+			{ 2205, 2, 2205, 2 },
+			{ 2207, 2, 2207, 2 },
+			{ 2209, 2, 2209, 2 },
+			{ 2211, 2, 2211, 2 },
+			{ 2213, 2, 2215, 3 },
+			{ 2218, 2, 2220, 3 },
+			{ 2223, 2, 2225, 3 },
+			{ 2228, 2, 2228, 2 },
+			{ 2230, 2, 2230, 2 },
+			{ 2232, 3, 2232, 3 },
+			{ 2235, 3, 2235, 3 },
+			{ 2238, 2, 2238, 2 },
+			{ 2240, 3, 2240, 3 },
+			{ 2243, 2, 2243, 2 },
+			{ 2245, 2, 2245, 2 },
+			{ 2247, 2, 2247, 2 },
+			{ 2249, 2, 2249, 2 },
+			{ 2251, 2, 2253, 3 },
+			{ 2256, 2, 2258, 3 },
+			{ 2261, 2, 2263, 3 },
+			{ 2266, 2, 2266, 2 },
+			{ 2268, 2, 2268, 2 },
+			{ 2270, 3, 2270, 3 },
+			{ 2273, 3, 2273, 3 },
+			{ 2276, 2, 2276, 2 },
+			{ 2278, 2, 2278, 2 },
+			{ 2280, 2, 2280, 2 },
+			{ 2282, 3, 2282, 3 },
+			{ 2285, 2, 2285, 2 },
+			{ 2287, 2, 2287, 2 },
+			{ 2289, 2, 2289, 2 },
+			{ 2291, 2, 2291, 2 },
+			{ 2293, 2, 2293, 2 },
+			{ 2295, 2, 2297, 3 },
+			{ 2300, 2, 2302, 3 },
+			{ 2305, 1, 2305, 1 },
+			{ 2306, 3, 2306, 3 },
+			{ 2309, 2, 2309, 2 },
+			{ 2311, 3, 2311, 3 },
+			{ 2314, 2, 2314, 2 },
+			{ 2316, 3, 2316, 3 },
+			{ 2319, 2, 2319, 2 },
+			{ 2321, 2, 2321, 2 },
+			{ 2323, 2, 2323, 2 },
+			{ 2325, 2, 2325, 2 },
+			{ 2327, 2, 2327, 2 },
+			{ 2329, 1, 2330, 2 },
+			{ 0, 0, 2332, 2 },
+			{ 2334, 1, 2335, 1 },
+			{ 2336, 1, 2337, 1 },
+			{ 0, 0, 2338, 1 },
+			{ 0, 0, 2339, 1 },
+			{ 0, 0, 2340, 1 },
+			{ 0, 0, 2341, 1 },
+			{ 0, 0, 2342, 1 },
+			{ 0, 0, 2343, 1 },
+			{ 0, 0, 2344, 1 },
+			{ 0, 0, 2345, 1 },
+			{ 0, 0, 2346, 1 },
+			{ 0, 0, 2347, 1 },
+			{ 0, 0, 2348, 2 },
+			{ 0, 0, 2350, 1 },
+			{ 0, 0, 2351, 2 },
+			{ 0, 0, 2353, 3 },
+			{ 0, 0, 2356, 1 },
+			{ 0, 0, 2357, 2 },
+			{ 0, 0, 2359, 3 },
+			{ 0, 0, 2362, 2 },
+			{ 0, 0, 2364, 3 },
+			{ 0, 0, 2367, 2 },
+			{ 0, 0, 2369, 2 },
+			{ 0, 0, 2371, 2 },
+			{ 0, 0, 2373, 2 },
+			{ 0, 0, 2375, 2 },
+			{ 0, 0, 2377, 4 },
+			{ 0, 0, 2381, 1 },
+			{ 0, 0, 2382, 1 },
+			{ 0, 0, 2383, 1 },
+			{ 0, 0, 2384, 1 },
+			{ 0, 0, 2385, 1 },
+			{ 0, 0, 2386, 1 },
+			{ 0, 0, 2387, 1 },
+			{ 0, 0, 2388, 1 },
+			{ 0, 0, 2389, 1 },
+			{ 0, 0, 2390, 1 },
+			{ 0, 0, 2391, 1 },
+			{ 0, 0, 2392, 1 },
+			{ 0, 0, 2393, 1 },
+			{ 0, 0, 2394, 1 },
+			{ 0, 0, 2395, 1 },
+			{ 0, 0, 2396, 1 },
+			{ 0, 0, 2397, 1 },
+			{ 0, 0, 2398, 1 },
+			{ 0, 0, 2399, 1 },
+			{ 0, 0, 2400, 1 },
+			{ 0, 0, 2401, 1 },
+			{ 0, 0, 2402, 1 },
+			{ 0, 0, 2403, 1 },
+			{ 0, 0, 2404, 1 },
+			{ 0, 0, 2405, 1 },
+			{ 0, 0, 2406, 1 },
+			{ 0, 0, 2407, 1 },
+			{ 0, 0, 2408, 1 },
+			{ 0, 0, 2409, 1 },
+			{ 0, 0, 2410, 1 },
+			{ 0, 0, 2411, 1 },
+			{ 0, 0, 2412, 1 },
+			{ 0, 0, 2413, 1 },
+			{ 0, 0, 2414, 1 },
+			{ 0, 0, 2415, 1 },
+			{ 0, 0, 2416, 1 },
+			{ 0, 0, 2417, 1 },
+			{ 0, 0, 2418, 1 },
+			{ 0, 0, 2419, 1 },
+			{ 0, 0, 2420, 1 },
+			{ 0, 0, 2421, 1 },
+			{ 0, 0, 2422, 1 },
+			{ 0, 0, 2423, 1 },
+			{ 0, 0, 2424, 2 },
+			{ 0, 0, 2426, 3 },
+			{ 0, 0, 2429, 3 },
+			{ 0, 0, 2432, 1 },
+			{ 0, 0, 2433, 2 },
+			{ 0, 0, 2435, 3 },
+			{ 0, 0, 2438, 3 },
+			{ 0, 0, 2441, 1 },
+			{ 0, 0, 2442, 2 },
+			{ 0, 0, 2444, 1 },
+			{ 0, 0, 2445, 1 },
+			{ 0, 0, 2446, 1 },
+			{ 0, 0, 2447, 1 },
+			{ 0, 0, 2448, 1 },
+			{ 0, 0, 2449, 1 },
+			{ 0, 0, 2450, 1 },
+			{ 0, 0, 2451, 1 },
+			{ 0, 0, 2452, 1 },
+			{ 0, 0, 2453, 1 },
+			{ 0, 0, 2454, 1 },
+			{ 0, 0, 2455, 2 },
+			{ 0, 0, 2457, 1 },
+			{ 0, 0, 2458, 1 },
+			{ 0, 0, 2459, 1 },
+			{ 0, 0, 2460, 1 },
+			{ 0, 0, 2461, 1 },
+			{ 0, 0, 2462, 2 },
+			{ 0, 0, 2464, 3 },
+			{ 0, 0, 2467, 2 },
+			{ 0, 0, 2469, 1 },
+			{ 2470, 1, 2470, 1 },
+			{ 0, 0, 2471, 1 },
+			{ 2472, 1, 2472, 1 },
+			{ 2473, 2, 2473, 2 },
+			{ 0, 0, 2475, 1 },
+			{ 0, 0, 2476, 1 },
+			{ 0, 0, 2477, 1 },
+			{ 0, 0, 2478, 1 },
+			{ 0, 0, 2479, 1 },
+			{ 0, 0, 2480, 1 },
+			{ 0, 0, 2481, 1 },
+			{ 0, 0, 2482, 1 },
+			{ 0, 0, 2483, 1 },
+			{ 0, 0, 2484, 1 },
+			{ 0, 0, 2485, 1 },
+			{ 0, 0, 2486, 1 },
+			{ 0, 0, 2487, 3 },
+			{ 0, 0, 2490, 1 },
+			{ 0, 0, 2491, 1 },
+			{ 0, 0, 2492, 1 },
+			{ 0, 0, 2493, 1 },
+			{ 0, 0, 2494, 1 },
+			{ 0, 0, 2495, 1 },
+			{ 0, 0, 2496, 1 },
+			{ 0, 0, 2497, 1 },
+			{ 0, 0, 2498, 1 },
+			{ 0, 0, 2499, 1 },
+			{ 0, 0, 2500, 3 },
+			{ 0, 0, 2503, 3 },
+			{ 0, 0, 2506, 4 },
+			{ 0, 0, 2510, 3 },
+			{ 0, 0, 2513, 3 },
+			{ 0, 0, 2516, 3 },
+			{ 0, 0, 2519, 3 },
+			{ 0, 0, 2522, 3 },
+			{ 0, 0, 2525, 3 },
+			{ 0, 0, 2528, 3 },
+			{ 0, 0, 2531, 3 },
+			{ 0, 0, 2534, 3 },
+			{ 0, 0, 2537, 3 },
+			{ 0, 0, 2540, 3 },
+			{ 0, 0, 2543, 3 },
+			{ 0, 0, 2546, 2 },
+			{ 0, 0, 2548, 1 },
+			{ 0, 0, 2549, 2 },
+			{ 0, 0, 2551, 3 },
+			{ 0, 0, 2554, 2 },
+			{ 0, 0, 2556, 1 },
+			{ 0, 0, 2557, 2 },
+			{ 0, 0, 2559, 3 },
+			{ 0, 0, 2562, 4 },
+			{ 0, 0, 2566, 2 },
+			{ 0, 0, 2568, 1 },
+			{ 0, 0, 2569, 2 },
+			{ 0, 0, 2571, 3 },
+			{ 0, 0, 2574, 1 },
+			{ 0, 0, 2575, 1 },
+			{ 0, 0, 2576, 1 },
+			{ 0, 0, 2577, 1 },
+			{ 0, 0, 2578, 1 },
+			{ 0, 0, 2579, 2 },
+			{ 0, 0, 2581, 3 },
+			{ 0, 0, 2584, 2 },
+			{ 0, 0, 2586, 1 },
+			{ 0, 0, 2587, 2 },
+			{ 0, 0, 2589, 3 },
+			{ 0, 0, 2592, 4 },
+			{ 0, 0, 2596, 2 },
+			{ 0, 0, 2598, 1 },
+			{ 0, 0, 2599, 2 },
+			{ 0, 0, 2601, 3 },
+			{ 0, 0, 2604, 1 },
+			{ 0, 0, 2605, 1 },
+			{ 0, 0, 2606, 1 },
+			{ 0, 0, 2607, 1 },
+			{ 0, 0, 2608, 3 },
+			{ 2611, 2, 2611, 2 },
+			{ 2613, 2, 2613, 2 },
+			{ 2615, 2, 2615, 2 },
+			{ 2617, 2, 2617, 2 },
+			{ 2619, 2, 2619, 2 },
+			{ 2621, 2, 2621, 2 },
+			{ 2623, 2, 2623, 2 },
+			{ 2625, 2, 2625, 2 },
+			{ 2627, 2, 2627, 2 },
+			{ 2629, 2, 2629, 2 },
+			{ 2631, 2, 2631, 2 },
+			{ 0, 0, 2633, 2 },
+			{ 0, 0, 2635, 3 },
+			{ 0, 0, 2638, 2 },
+			{ 0, 0, 2640, 3 },
+			{ 2643, 2, 2643, 2 },
+			{ 2645, 2, 2645, 2 },
+			{ 2647, 2, 2647, 2 },
+			{ 2649, 2, 2649, 2 },
+			{ 2651, 2, 2651, 2 },
+			{ 2653, 2, 2653, 2 },
+			{ 2655, 2, 2655, 2 },
+			{ 2657, 2, 2657, 2 },
+			{ 2659, 2, 2659, 2 },
+			{ 2661, 2, 2661, 2 },
+			{ 2663, 2, 2663, 2 },
+			{ 2665, 2, 2665, 2 },
+			{ 2667, 2, 2667, 2 },
+			{ 2669, 2, 2669, 2 },
+			{ 2671, 2, 2671, 2 },
+			{ 2673, 2, 2673, 2 },
+			{ 2675, 2, 2675, 2 },
+			{ 2677, 2, 2677, 2 },
+			{ 2679, 2, 2679, 2 },
+			{ 2681, 2, 2681, 2 },
+			{ 2683, 2, 2683, 2 },
+			{ 2685, 2, 2685, 2 },
+			{ 2687, 2, 2687, 2 },
+			{ 2689, 2, 2689, 2 },
+			{ 2691, 2, 2691, 2 },
+			{ 2693, 2, 2693, 2 },
+			{ 2695, 2, 2695, 2 },
+			{ 2697, 2, 2697, 2 },
+			{ 2699, 2, 2699, 2 },
+			{ 2701, 2, 2701, 2 },
+			{ 2703, 2, 2703, 2 },
+			{ 2705, 2, 2705, 2 },
+			{ 2707, 2, 2707, 2 },
+			{ 2709, 1, 2709, 1 },
+			{ 2710, 1, 2710, 1 },
+			{ 0, 0, 2711, 1 },
+			{ 0, 0, 2712, 1 },
+			{ 0, 0, 2713, 1 },
+			{ 0, 0, 2714, 1 },
+			{ 0, 0, 2715, 1 },
+			{ 0, 0, 2716, 1 },
+			{ 0, 0, 2717, 1 },
+			{ 0, 0, 2718, 1 },
+			{ 0, 0, 2719, 1 },
+			{ 0, 0, 2720, 2 },
+			{ 0, 0, 2722, 2 },
+			{ 0, 0, 2724, 2 },
+			{ 0, 0, 2726, 2 },
+			{ 0, 0, 2728, 2 },
+			{ 0, 0, 2730, 2 },
+			{ 0, 0, 2732, 2 },
+			{ 0, 0, 2734, 2 },
+			{ 0, 0, 2736, 2 },
+			{ 0, 0, 2738, 2 },
+			{ 0, 0, 2740, 2 },
+			{ 0, 0, 2742, 3 },
+			{ 0, 0, 2745, 3 },
+			{ 0, 0, 2748, 3 },
+			{ 0, 0, 2751, 3 },
+			{ 0, 0, 2754, 3 },
+			{ 0, 0, 2757, 3 },
+			{ 0, 0, 2760, 3 },
+			{ 0, 0, 2763, 3 },
+			{ 0, 0, 2766, 3 },
+			{ 0, 0, 2769, 4 },
+			{ 0, 0, 2773, 4 },
+			{ 0, 0, 2777, 4 },
+			{ 0, 0, 2781, 4 },
+			{ 0, 0, 2785, 4 },
+			{ 0, 0, 2789, 4 },
+			{ 0, 0, 2793, 4 },
+			{ 0, 0, 2797, 4 },
+			{ 0, 0, 2801, 4 },
+			{ 0, 0, 2805, 4 },
+			{ 0, 0, 2809, 4 },
+			{ 0, 0, 2813, 2 },
+			{ 0, 0, 2815, 2 },
+			{ 0, 0, 2817, 2 },
+			{ 0, 0, 2819, 2 },
+			{ 0, 0, 2821, 2 },
+			{ 0, 0, 2823, 2 },
+			{ 0, 0, 2825, 2 },
+			{ 0, 0, 2827, 2 },
+			{ 0, 0, 2829, 2 },
+			{ 0, 0, 2831, 3 },
+			{ 0, 0, 2834, 3 },
+			{ 0, 0, 2837, 3 },
+			{ 0, 0, 2840, 3 },
+			{ 0, 0, 2843, 3 },
+			{ 0, 0, 2846, 3 },
+			{ 0, 0, 2849, 3 },
+			{ 0, 0, 2852, 3 },
+			{ 0, 0, 2855, 3 },
+			{ 0, 0, 2858, 3 },
+			{ 0, 0, 2861, 3 },
+			{ 0, 0, 2864, 3 },
+			{ 0, 0, 2867, 3 },
+			{ 0, 0, 2870, 3 },
+			{ 0, 0, 2873, 3 },
+			{ 0, 0, 2876, 3 },
+			{ 0, 0, 2879, 3 },
+			{ 0, 0, 2882, 3 },
+			{ 0, 0, 2885, 3 },
+			{ 0, 0, 2888, 3 },
+			{ 0, 0, 2891, 3 },
+			{ 0, 0, 2894, 3 },
+			{ 0, 0, 2897, 3 },
+			{ 0, 0, 2900, 3 },
+			{ 0, 0, 2903, 3 },
+			{ 0, 0, 2906, 3 },
+			{ 0, 0, 2909, 3 },
+			{ 0, 0, 2912, 3 },
+			{ 0, 0, 2915, 3 },
+			{ 0, 0, 2918, 3 },
+			{ 0, 0, 2921, 3 },
+			{ 0, 0, 2924, 3 },
+			{ 0, 0, 2927, 3 },
+			{ 0, 0, 2930, 3 },
+			{ 0, 0, 2933, 3 },
+			{ 0, 0, 2936, 3 },
+			{ 0, 0, 2939, 3 },
+			{ 0, 0, 2942, 1 },
+			{ 0, 0, 2943, 1 },
+			{ 0, 0, 2944, 1 },
+			{ 0, 0, 2945, 1 },
+			{ 0, 0, 2946, 1 },
+			{ 0, 0, 2947, 1 },
+			{ 0, 0, 2948, 1 },
+			{ 0, 0, 2949, 1 },
+			{ 0, 0, 2950, 1 },
+			{ 0, 0, 2951, 1 },
+			{ 0, 0, 2952, 1 },
+			{ 0, 0, 2953, 1 },
+			{ 0, 0, 2954, 1 },
+			{ 0, 0, 2955, 1 },
+			{ 0, 0, 2956, 1 },
+			{ 0, 0, 2957, 1 },
+			{ 0, 0, 2958, 1 },
+			{ 0, 0, 2959, 1 },
+			{ 0, 0, 2960, 1 },
+			{ 0, 0, 2961, 1 },
+			{ 0, 0, 2962, 1 },
+			{ 0, 0, 2963, 1 },
+			{ 0, 0, 2964, 1 },
+			{ 0, 0, 2965, 1 },
+			{ 0, 0, 2966, 1 },
+			{ 0, 0, 2967, 1 },
+			{ 0, 0, 2968, 1 },
+			{ 0, 0, 2969, 1 },
+			{ 0, 0, 2970, 1 },
+			{ 0, 0, 2971, 1 },
+			{ 0, 0, 2972, 1 },
+			{ 0, 0, 2973, 1 },
+			{ 0, 0, 2974, 1 },
+			{ 0, 0, 2975, 1 },
+			{ 0, 0, 2976, 1 },
+			{ 0, 0, 2977, 1 },
+			{ 0, 0, 2978, 1 },
+			{ 0, 0, 2979, 1 },
+			{ 0, 0, 2980, 1 },
+			{ 0, 0, 2981, 1 },
+			{ 0, 0, 2982, 1 },
+			{ 0, 0, 2983, 1 },
+			{ 0, 0, 2984, 1 },
+			{ 0, 0, 2985, 1 },
+			{ 0, 0, 2986, 1 },
+			{ 0, 0, 2987, 1 },
+			{ 0, 0, 2988, 1 },
+			{ 0, 0, 2989, 1 },
+			{ 0, 0, 2990, 1 },
+			{ 0, 0, 2991, 1 },
+			{ 0, 0, 2992, 1 },
+			{ 0, 0, 2993, 1 },
+			{ 0, 0, 2994, 1 },
+			{ 0, 0, 2995, 4 },
+			{ 0, 0, 2999, 3 },
+			{ 0, 0, 3002, 2 },
+			{ 0, 0, 3004, 3 },
+			{ 3007, 2, 3007, 2 },
+			{ 0, 0, 3009, 1 },
+			{ 0, 0, 3010, 1 },
+			{ 0, 0, 3011, 1 },
+			{ 0, 0, 3012, 1 },
+			{ 0, 0, 3013, 1 },
+			{ 0, 0, 3014, 1 },
+			{ 0, 0, 3015, 1 },
+			{ 0, 0, 3016, 1 },
+			{ 0, 0, 3017, 1 },
+			{ 0, 0, 3018, 1 },
+			{ 0, 0, 3019, 1 },
+			{ 0, 0, 3020, 1 },
+			{ 0, 0, 3021, 1 },
+			{ 0, 0, 3022, 1 },
+			{ 0, 0, 3023, 1 },
+			{ 0, 0, 3024, 1 },
+			{ 0, 0, 3025, 1 },
+			{ 0, 0, 3026, 1 },
+			{ 0, 0, 3027, 1 },
+			{ 0, 0, 3028, 1 },
+			{ 0, 0, 3029, 1 },
+			{ 0, 0, 3030, 1 },
+			{ 0, 0, 3031, 1 },
+			{ 0, 0, 3032, 1 },
+			{ 0, 0, 3033, 1 },
+			{ 0, 0, 3034, 1 },
+			{ 0, 0, 3035, 1 },
+			{ 0, 0, 3036, 1 },
+			{ 0, 0, 3037, 1 },
+			{ 0, 0, 3038, 1 },
+			{ 0, 0, 3039, 1 },
+			{ 0, 0, 3040, 1 },
+			{ 0, 0, 3041, 1 },
+			{ 0, 0, 3042, 1 },
+			{ 0, 0, 3043, 1 },
+			{ 0, 0, 3044, 1 },
+			{ 0, 0, 3045, 1 },
+			{ 0, 0, 3046, 1 },
+			{ 0, 0, 3047, 1 },
+			{ 0, 0, 3048, 1 },
+			{ 0, 0, 3049, 1 },
+			{ 0, 0, 3050, 1 },
+			{ 0, 0, 3051, 1 },
+			{ 0, 0, 3052, 1 },
+			{ 0, 0, 3053, 1 },
+			{ 0, 0, 3054, 1 },
+			{ 0, 0, 3055, 1 },
+			{ 0, 0, 3056, 1 },
+			{ 0, 0, 3057, 1 },
+			{ 0, 0, 3058, 1 },
+			{ 0, 0, 3059, 1 },
+			{ 0, 0, 3060, 1 },
+			{ 0, 0, 3061, 1 },
+			{ 0, 0, 3062, 1 },
+			{ 0, 0, 3063, 1 },
+			{ 0, 0, 3064, 1 },
+			{ 0, 0, 3065, 1 },
+			{ 0, 0, 3066, 1 },
+			{ 0, 0, 3067, 1 },
+			{ 0, 0, 3068, 1 },
+			{ 0, 0, 3069, 1 },
+			{ 0, 0, 3070, 1 },
+			{ 0, 0, 3071, 1 },
+			{ 0, 0, 3072, 1 },
+			{ 0, 0, 3073, 1 },
+			{ 0, 0, 3074, 1 },
+			{ 0, 0, 3075, 1 },
+			{ 0, 0, 3076, 1 },
+			{ 0, 0, 3077, 1 },
+			{ 0, 0, 3078, 1 },
+			{ 0, 0, 3079, 1 },
+			{ 0, 0, 3080, 1 },
+			{ 0, 0, 3081, 1 },
+			{ 0, 0, 3082, 1 },
+			{ 0, 0, 3083, 1 },
+			{ 0, 0, 3084, 1 },
+			{ 0, 0, 3085, 1 },
+			{ 0, 0, 3086, 1 },
+			{ 0, 0, 3087, 1 },
+			{ 0, 0, 3088, 1 },
+			{ 0, 0, 3089, 1 },
+			{ 0, 0, 3090, 1 },
+			{ 0, 0, 3091, 1 },
+			{ 0, 0, 3092, 1 },
+			{ 0, 0, 3093, 1 },
+			{ 0, 0, 3094, 1 },
+			{ 0, 0, 3095, 1 },
+			{ 0, 0, 3096, 1 },
+			{ 0, 0, 3097, 1 },
+			{ 0, 0, 3098, 1 },
+			{ 0, 0, 3099, 1 },
+			{ 0, 0, 3100, 1 },
+			{ 0, 0, 3101, 1 },
+			{ 0, 0, 3102, 1 },
+			{ 0, 0, 3103, 1 },
+			{ 0, 0, 3104, 1 },
+			{ 0, 0, 3105, 1 },
+			{ 0, 0, 3106, 1 },
+			{ 0, 0, 3107, 1 },
+			{ 0, 0, 3108, 1 },
+			{ 0, 0, 3109, 1 },
+			{ 0, 0, 3110, 1 },
+			{ 0, 0, 3111, 1 },
+			{ 0, 0, 3112, 1 },
+			{ 0, 0, 3113, 1 },
+			{ 0, 0, 3114, 1 },
+			{ 0, 0, 3115, 1 },
+			{ 0, 0, 3116, 1 },
+			{ 0, 0, 3117, 1 },
+			{ 0, 0, 3118, 1 },
+			{ 0, 0, 3119, 1 },
+			{ 0, 0, 3120, 1 },
+			{ 0, 0, 3121, 1 },
+			{ 0, 0, 3122, 1 },
+			{ 0, 0, 3123, 1 },
+			{ 0, 0, 3124, 1 },
+			{ 0, 0, 3125, 1 },
+			{ 0, 0, 3126, 1 },
+			{ 0, 0, 3127, 1 },
+			{ 0, 0, 3128, 1 },
+			{ 0, 0, 3129, 1 },
+			{ 0, 0, 3130, 1 },
+			{ 0, 0, 3131, 1 },
+			{ 0, 0, 3132, 1 },
+			{ 0, 0, 3133, 1 },
+			{ 0, 0, 3134, 1 },
+			{ 0, 0, 3135, 1 },
+			{ 0, 0, 3136, 1 },
+			{ 0, 0, 3137, 1 },
+			{ 0, 0, 3138, 1 },
+			{ 0, 0, 3139, 1 },
+			{ 0, 0, 3140, 1 },
+			{ 0, 0, 3141, 1 },
+			{ 0, 0, 3142, 1 },
+			{ 0, 0, 3143, 1 },
+			{ 0, 0, 3144, 1 },
+			{ 0, 0, 3145, 1 },
+			{ 0, 0, 3146, 1 },
+			{ 0, 0, 3147, 1 },
+			{ 0, 0, 3148, 1 },
+			{ 0, 0, 3149, 1 },
+			{ 0, 0, 3150, 1 },
+			{ 0, 0, 3151, 1 },
+			{ 0, 0, 3152, 1 },
+			{ 0, 0, 3153, 1 },
+			{ 0, 0, 3154, 1 },
+			{ 0, 0, 3155, 1 },
+			{ 0, 0, 3156, 1 },
+			{ 0, 0, 3157, 1 },
+			{ 0, 0, 3158, 1 },
+			{ 0, 0, 3159, 1 },
+			{ 0, 0, 3160, 1 },
+			{ 0, 0, 3161, 1 },
+			{ 0, 0, 3162, 1 },
+			{ 0, 0, 3163, 1 },
+			{ 0, 0, 3164, 1 },
+			{ 0, 0, 3165, 1 },
+			{ 0, 0, 3166, 1 },
+			{ 0, 0, 3167, 1 },
+			{ 0, 0, 3168, 1 },
+			{ 0, 0, 3169, 1 },
+			{ 0, 0, 3170, 1 },
+			{ 0, 0, 3171, 1 },
+			{ 0, 0, 3172, 1 },
+			{ 0, 0, 3173, 1 },
+			{ 0, 0, 3174, 1 },
+			{ 0, 0, 3175, 1 },
+			{ 0, 0, 3176, 1 },
+			{ 0, 0, 3177, 1 },
+			{ 0, 0, 3178, 1 },
+			{ 0, 0, 3179, 1 },
+			{ 0, 0, 3180, 1 },
+			{ 0, 0, 3181, 1 },
+			{ 0, 0, 3182, 1 },
+			{ 0, 0, 3183, 1 },
+			{ 0, 0, 3184, 1 },
+			{ 0, 0, 3185, 1 },
+			{ 0, 0, 3186, 1 },
+			{ 0, 0, 3187, 1 },
+			{ 0, 0, 3188, 1 },
+			{ 0, 0, 3189, 1 },
+			{ 0, 0, 3190, 1 },
+			{ 0, 0, 3191, 1 },
+			{ 0, 0, 3192, 1 },
+			{ 0, 0, 3193, 1 },
+			{ 0, 0, 3194, 1 },
+			{ 0, 0, 3195, 1 },
+			{ 0, 0, 3196, 1 },
+			{ 0, 0, 3197, 1 },
+			{ 0, 0, 3198, 1 },
+			{ 0, 0, 3199, 1 },
+			{ 0, 0, 3200, 1 },
+			{ 0, 0, 3201, 1 },
+			{ 0, 0, 3202, 1 },
+			{ 0, 0, 3203, 1 },
+			{ 0, 0, 3204, 1 },
+			{ 0, 0, 3205, 1 },
+			{ 0, 0, 3206, 1 },
+			{ 0, 0, 3207, 1 },
+			{ 0, 0, 3208, 1 },
+			{ 0, 0, 3209, 1 },
+			{ 0, 0, 3210, 1 },
+			{ 0, 0, 3211, 1 },
+			{ 0, 0, 3212, 1 },
+			{ 0, 0, 3213, 1 },
+			{ 0, 0, 3214, 1 },
+			{ 0, 0, 3215, 1 },
+			{ 0, 0, 3216, 1 },
+			{ 0, 0, 3217, 1 },
+			{ 0, 0, 3218, 1 },
+			{ 0, 0, 3219, 1 },
+			{ 0, 0, 3220, 1 },
+			{ 0, 0, 3221, 1 },
+			{ 0, 0, 3222, 1 },
+			{ 0, 0, 3223, 1 },
+			{ 0, 0, 3224, 1 },
+			{ 0, 0, 3225, 1 },
+			{ 0, 0, 3226, 1 },
+			{ 0, 0, 3227, 1 },
+			{ 0, 0, 3228, 1 },
+			{ 0, 0, 3229, 1 },
+			{ 0, 0, 3230, 1 },
+			{ 0, 0, 3231, 1 },
+			{ 0, 0, 3232, 1 },
+			{ 3233, 2, 3233, 2 },
+			{ 3235, 2, 3235, 2 },
+			{ 3237, 2, 3237, 2 },
+			{ 3239, 2, 3239, 2 },
+			{ 3241, 2, 3241, 2 },
+			{ 3243, 2, 3243, 2 },
+			{ 3245, 2, 3245, 2 },
+			{ 3247, 2, 3247, 2 },
+			{ 3249, 2, 3249, 2 },
+			{ 3251, 2, 3251, 2 },
+			{ 3253, 2, 3253, 2 },
+			{ 3255, 2, 3255, 2 },
+			{ 3257, 2, 3257, 2 },
+			{ 3259, 2, 3259, 2 },
+			{ 3261, 2, 3261, 2 },
+			{ 3263, 2, 3263, 2 },
+			{ 3265, 2, 3265, 2 },
+			{ 3267, 2, 3267, 2 },
+			{ 3269, 2, 3269, 2 },
+			{ 3271, 2, 3271, 2 },
+			{ 3273, 2, 3273, 2 },
+			{ 3275, 2, 3275, 2 },
+			{ 3277, 2, 3277, 2 },
+			{ 3279, 2, 3279, 2 },
+			{ 3281, 2, 3281, 2 },
+			{ 3283, 2, 3283, 2 },
+			{ 0, 0, 3285, 2 },
+			{ 0, 0, 3287, 2 },
+			{ 3289, 2, 3289, 2 },
+			{ 0, 0, 3291, 2 },
+			{ 3293, 2, 3293, 2 },
+			{ 3295, 2, 3295, 2 },
+			{ 3297, 2, 3297, 2 },
+			{ 3299, 2, 3299, 2 },
+			{ 3301, 2, 3301, 2 },
+			{ 3303, 2, 3303, 2 },
+			{ 3305, 2, 3305, 2 },
+			{ 3307, 2, 3307, 2 },
+			{ 3309, 2, 3309, 2 },
+			{ 3311, 2, 3311, 2 },
+			{ 3313, 2, 3313, 2 },
+			{ 3315, 2, 3315, 2 },
+			{ 3317, 2, 3317, 2 },
+			{ 3319, 2, 3319, 2 },
+			{ 3321, 2, 3321, 2 },
+			{ 3323, 2, 3323, 2 },
+			{ 3325, 2, 3325, 2 },
+			{ 3327, 2, 3327, 2 },
+			{ 3329, 2, 3329, 2 },
+			{ 3331, 2, 3331, 2 },
+			{ 3333, 2, 3333, 2 },
+			{ 3335, 2, 3335, 2 },
+			{ 3337, 2, 3337, 2 },
+			{ 3339, 2, 3339, 2 },
+			{ 3341, 2, 3341, 2 },
+			{ 3343, 2, 3343, 2 },
+			{ 3345, 2, 3345, 2 },
+			{ 3347, 2, 3347, 2 },
+			{ 3349, 2, 3349, 2 },
+			{ 3351, 2, 3351, 2 },
+			{ 3353, 2, 3353, 2 },
+			{ 0, 0, 3355, 2 },
+			{ 0, 0, 3357, 1 },
+			{ 0, 0, 3358, 1 },
+			{ 0, 0, 3359, 1 },
+			{ 0, 0, 3360, 1 },
+			{ 0, 0, 3361, 1 },
+			{ 0, 0, 3362, 1 },
+			{ 0, 0, 3363, 1 },
+			{ 0, 0, 3364, 1 },
+			{ 0, 0, 3365, 1 },
+			{ 0, 0, 3366, 1 },
+			{ 0, 0, 3367, 1 },
+			{ 0, 0, 3368, 1 },
+			{ 0, 0, 3369, 1 },
+			{ 0, 0, 3370, 1 },
+			{ 0, 0, 3371, 1 },
+			{ 0, 0, 3372, 1 },
+			{ 0, 0, 3373, 1 },
+			{ 0, 0, 3374, 1 },
+			{ 0, 0, 3375, 1 },
+			{ 0, 0, 3376, 1 },
+			{ 0, 0, 3377, 1 },
+			{ 0, 0, 3378, 1 },
+			{ 0, 0, 3379, 1 },
+			{ 0, 0, 3380, 1 },
+			{ 0, 0, 3381, 1 },
+			{ 0, 0, 3382, 1 },
+			{ 0, 0, 3383, 1 },
+			{ 0, 0, 3384, 1 },
+			{ 0, 0, 3385, 1 },
+			{ 0, 0, 3386, 1 },
+			{ 0, 0, 3387, 1 },
+			{ 0, 0, 3388, 1 },
+			{ 0, 0, 3389, 1 },
+			{ 0, 0, 3390, 1 },
+			{ 0, 0, 3391, 1 },
+			{ 0, 0, 3392, 1 },
+			{ 0, 0, 3393, 1 },
+			{ 0, 0, 3394, 1 },
+			{ 0, 0, 3395, 1 },
+			{ 0, 0, 3396, 1 },
+			{ 0, 0, 3397, 1 },
+			{ 0, 0, 3398, 1 },
+			{ 0, 0, 3399, 1 },
+			{ 0, 0, 3400, 1 },
+			{ 0, 0, 3401, 1 },
+			{ 0, 0, 3402, 1 },
+			{ 0, 0, 3403, 1 },
+			{ 0, 0, 3404, 1 },
+			{ 0, 0, 3405, 1 },
+			{ 0, 0, 3406, 1 },
+			{ 0, 0, 3407, 1 },
+			{ 0, 0, 3408, 1 },
+			{ 0, 0, 3409, 1 },
+			{ 0, 0, 3410, 1 },
+			{ 0, 0, 3411, 1 },
+			{ 0, 0, 3412, 1 },
+			{ 0, 0, 3413, 1 },
+			{ 0, 0, 3414, 1 },
+			{ 0, 0, 3415, 1 },
+			{ 0, 0, 3416, 1 },
+			{ 0, 0, 3417, 1 },
+			{ 0, 0, 3418, 1 },
+			{ 0, 0, 3419, 1 },
+			{ 0, 0, 3420, 1 },
+			{ 0, 0, 3421, 1 },
+			{ 0, 0, 3422, 1 },
+			{ 0, 0, 3423, 1 },
+			{ 0, 0, 3424, 1 },
+			{ 0, 0, 3425, 1 },
+			{ 0, 0, 3426, 1 },
+			{ 0, 0, 3427, 1 },
+			{ 0, 0, 3428, 1 },
+			{ 0, 0, 3429, 1 },
+			{ 0, 0, 3430, 1 },
+			{ 0, 0, 3431, 1 },
+			{ 0, 0, 3432, 1 },
+			{ 0, 0, 3433, 1 },
+			{ 0, 0, 3434, 1 },
+			{ 0, 0, 3435, 1 },
+			{ 0, 0, 3436, 1 },
+			{ 0, 0, 3437, 1 },
+			{ 0, 0, 3438, 1 },
+			{ 0, 0, 3439, 1 },
+			{ 0, 0, 3440, 1 },
+			{ 0, 0, 3441, 1 },
+			{ 0, 0, 3442, 1 },
+			{ 0, 0, 3443, 1 },
+			{ 0, 0, 3444, 1 },
+			{ 0, 0, 3445, 1 },
+			{ 0, 0, 3446, 1 },
+			{ 0, 0, 3447, 1 },
+			{ 0, 0, 3448, 1 },
+			{ 0, 0, 3449, 1 },
+			{ 0, 0, 3450, 1 },
+			{ 0, 0, 3451, 1 },
+			{ 0, 0, 3452, 1 },
+			{ 0, 0, 3453, 1 },
+			{ 0, 0, 3454, 1 },
+			{ 0, 0, 3455, 1 },
+			{ 0, 0, 3456, 1 },
+			{ 0, 0, 3457, 1 },
+			{ 0, 0, 3458, 1 },
+			{ 0, 0, 3459, 1 },
+			{ 0, 0, 3460, 1 },
+			{ 0, 0, 3461, 1 },
+			{ 0, 0, 3462, 1 },
+			{ 0, 0, 3463, 1 },
+			{ 0, 0, 3464, 1 },
+			{ 0, 0, 3465, 3 },
+			{ 0, 0, 3468, 3 },
+			{ 0, 0, 3471, 3 },
+			{ 0, 0, 3474, 3 },
+			{ 0, 0, 3477, 3 },
+			{ 0, 0, 3480, 3 },
+			{ 0, 0, 3483, 3 },
+			{ 0, 0, 3486, 3 },
+			{ 0, 0, 3489, 3 },
+			{ 0, 0, 3492, 3 },
+			{ 0, 0, 3495, 3 },
+			{ 0, 0, 3498, 3 },
+			{ 0, 0, 3501, 3 },
+			{ 0, 0, 3504, 3 },
+			{ 0, 0, 3507, 4 },
+			{ 0, 0, 3511, 4 },
+			{ 0, 0, 3515, 4 },
+			{ 0, 0, 3519, 4 },
+			{ 0, 0, 3523, 4 },
+			{ 0, 0, 3527, 4 },
+			{ 0, 0, 3531, 4 },
+			{ 0, 0, 3535, 4 },
+			{ 0, 0, 3539, 4 },
+			{ 0, 0, 3543, 4 },
+			{ 0, 0, 3547, 4 },
+			{ 0, 0, 3551, 4 },
+			{ 0, 0, 3555, 4 },
+			{ 0, 0, 3559, 4 },
+			{ 0, 0, 3563, 4 },
+			{ 0, 0, 3567, 7 },
+			{ 0, 0, 3574, 6 },
+			{ 0, 0, 3580, 3 },
+			{ 0, 0, 3583, 3 },
+			{ 0, 0, 3586, 3 },
+			{ 0, 0, 3589, 3 },
+			{ 0, 0, 3592, 3 },
+			{ 0, 0, 3595, 3 },
+			{ 0, 0, 3598, 3 },
+			{ 0, 0, 3601, 3 },
+			{ 0, 0, 3604, 3 },
+			{ 0, 0, 3607, 3 },
+			{ 0, 0, 3610, 3 },
+			{ 0, 0, 3613, 3 },
+			{ 0, 0, 3616, 3 },
+			{ 0, 0, 3619, 3 },
+			{ 0, 0, 3622, 3 },
+			{ 0, 0, 3625, 3 },
+			{ 0, 0, 3628, 3 },
+			{ 0, 0, 3631, 3 },
+			{ 0, 0, 3634, 3 },
+			{ 0, 0, 3637, 3 },
+			{ 0, 0, 3640, 3 },
+			{ 0, 0, 3643, 3 },
+			{ 0, 0, 3646, 3 },
+			{ 0, 0, 3649, 3 },
+			{ 0, 0, 3652, 3 },
+			{ 0, 0, 3655, 3 },
+			{ 0, 0, 3658, 3 },
+			{ 0, 0, 3661, 3 },
+			{ 0, 0, 3664, 3 },
+			{ 0, 0, 3667, 3 },
+			{ 0, 0, 3670, 3 },
+			{ 0, 0, 3673, 3 },
+			{ 0, 0, 3676, 3 },
+			{ 0, 0, 3679, 3 },
+			{ 0, 0, 3682, 3 },
+			{ 0, 0, 3685, 3 },
+			{ 0, 0, 3688, 1 },
+			{ 0, 0, 3689, 1 },
+			{ 0, 0, 3690, 1 },
+			{ 0, 0, 3691, 1 },
+			{ 0, 0, 3692, 3 },
+			{ 0, 0, 3695, 2 },
+			{ 0, 0, 3697, 2 },
+			{ 0, 0, 3699, 2 },
+			{ 0, 0, 3701, 2 },
+			{ 0, 0, 3703, 2 },
+			{ 0, 0, 3705, 2 },
+			{ 0, 0, 3707, 2 },
+			{ 0, 0, 3709, 2 },
+			{ 0, 0, 3711, 2 },
+			{ 0, 0, 3713, 2 },
+			{ 0, 0, 3715, 2 },
+			{ 0, 0, 3717, 2 },
+			{ 0, 0, 3719, 2 },
+			{ 0, 0, 3721, 2 },
+			{ 0, 0, 3723, 2 },
+			{ 0, 0, 3725, 1 },
+			{ 0, 0, 3726, 1 },
+			{ 0, 0, 3727, 1 },
+			{ 0, 0, 3728, 1 },
+			{ 0, 0, 3729, 1 },
+			{ 0, 0, 3730, 1 },
+			{ 0, 0, 3731, 1 },
+			{ 0, 0, 3732, 1 },
+			{ 0, 0, 3733, 1 },
+			{ 0, 0, 3734, 1 },
+			{ 0, 0, 3735, 1 },
+			{ 0, 0, 3736, 1 },
+			{ 0, 0, 3737, 1 },
+			{ 0, 0, 3738, 1 },
+			{ 0, 0, 3739, 2 },
+			{ 0, 0, 3741, 2 },
+			{ 0, 0, 3743, 2 },
+			{ 0, 0, 3745, 2 },
+			{ 0, 0, 3747, 2 },
+			{ 0, 0, 3749, 2 },
+			{ 0, 0, 3751, 2 },
+			{ 0, 0, 3753, 2 },
+			{ 0, 0, 3755, 2 },
+			{ 0, 0, 3757, 2 },
+			{ 0, 0, 3759, 2 },
+			{ 0, 0, 3761, 2 },
+			{ 0, 0, 3763, 2 },
+			{ 0, 0, 3765, 2 },
+			{ 0, 0, 3767, 5 },
+			{ 0, 0, 3772, 4 },
+			{ 0, 0, 3776, 2 },
+			{ 0, 0, 3778, 1 },
+			{ 0, 0, 3779, 1 },
+			{ 0, 0, 3780, 1 },
+			{ 0, 0, 3781, 1 },
+			{ 0, 0, 3782, 1 },
+			{ 0, 0, 3783, 1 },
+			{ 0, 0, 3784, 1 },
+			{ 0, 0, 3785, 1 },
+			{ 0, 0, 3786, 1 },
+			{ 0, 0, 3787, 1 },
+			{ 0, 0, 3788, 1 },
+			{ 0, 0, 3789, 1 },
+			{ 0, 0, 3790, 1 },
+			{ 0, 0, 3791, 1 },
+			{ 0, 0, 3792, 1 },
+			{ 0, 0, 3793, 1 },
+			{ 0, 0, 3794, 1 },
+			{ 0, 0, 3795, 1 },
+			{ 0, 0, 3796, 1 },
+			{ 0, 0, 3797, 1 },
+			{ 0, 0, 3798, 1 },
+			{ 0, 0, 3799, 1 },
+			{ 0, 0, 3800, 1 },
+			{ 0, 0, 3801, 1 },
+			{ 0, 0, 3802, 1 },
+			{ 0, 0, 3803, 1 },
+			{ 0, 0, 3804, 1 },
+			{ 0, 0, 3805, 1 },
+			{ 0, 0, 3806, 1 },
+			{ 0, 0, 3807, 1 },
+			{ 0, 0, 3808, 1 },
+			{ 0, 0, 3809, 1 },
+			{ 0, 0, 3810, 1 },
+			{ 0, 0, 3811, 1 },
+			{ 0, 0, 3812, 1 },
+			{ 0, 0, 3813, 1 },
+			{ 0, 0, 3814, 1 },
+			{ 0, 0, 3815, 1 },
+			{ 0, 0, 3816, 1 },
+			{ 0, 0, 3817, 1 },
+			{ 0, 0, 3818, 1 },
+			{ 0, 0, 3819, 1 },
+			{ 0, 0, 3820, 1 },
+			{ 0, 0, 3821, 1 },
+			{ 0, 0, 3822, 1 },
+			{ 0, 0, 3823, 1 },
+			{ 0, 0, 3824, 1 },
+			{ 0, 0, 3825, 1 },
+			{ 0, 0, 3826, 1 },
+			{ 0, 0, 3827, 2 },
+			{ 0, 0, 3829, 2 },
+			{ 0, 0, 3831, 2 },
+			{ 0, 0, 3833, 2 },
+			{ 0, 0, 3835, 2 },
+			{ 0, 0, 3837, 2 },
+			{ 0, 0, 3839, 2 },
+			{ 0, 0, 3841, 2 },
+			{ 0, 0, 3843, 2 },
+			{ 0, 0, 3845, 2 },
+			{ 0, 0, 3847, 2 },
+			{ 0, 0, 3849, 2 },
+			{ 0, 0, 3851, 2 },
+			{ 0, 0, 3853, 2 },
+			{ 0, 0, 3855, 2 },
+			{ 0, 0, 3857, 2 },
+			{ 0, 0, 3859, 2 },
+			{ 0, 0, 3861, 2 },
+			{ 0, 0, 3863, 2 },
+			{ 0, 0, 3865, 2 },
+			{ 0, 0, 3867, 2 },
+			{ 0, 0, 3869, 2 },
+			{ 0, 0, 3871, 2 },
+			{ 0, 0, 3873, 2 },
+			{ 0, 0, 3875, 3 },
+			{ 0, 0, 3878, 3 },
+			{ 0, 0, 3881, 3 },
+			{ 0, 0, 3884, 2 },
+			{ 0, 0, 3886, 3 },
+			{ 0, 0, 3889, 2 },
+			{ 0, 0, 3891, 3 },
+			{ 0, 0, 3894, 1 },
+			{ 0, 0, 3895, 1 },
+			{ 0, 0, 3896, 1 },
+			{ 0, 0, 3897, 1 },
+			{ 0, 0, 3898, 1 },
+			{ 0, 0, 3899, 1 },
+			{ 0, 0, 3900, 1 },
+			{ 0, 0, 3901, 1 },
+			{ 0, 0, 3902, 1 },
+			{ 0, 0, 3903, 1 },
+			{ 0, 0, 3904, 1 },
+			{ 0, 0, 3905, 1 },
+			{ 0, 0, 3906, 1 },
+			{ 0, 0, 3907, 1 },
+			{ 0, 0, 3908, 1 },
+			{ 0, 0, 3909, 1 },
+			{ 0, 0, 3910, 1 },
+			{ 0, 0, 3911, 1 },
+			{ 0, 0, 3912, 1 },
+			{ 0, 0, 3913, 1 },
+			{ 0, 0, 3914, 1 },
+			{ 0, 0, 3915, 1 },
+			{ 0, 0, 3916, 1 },
+			{ 0, 0, 3917, 1 },
+			{ 0, 0, 3918, 1 },
+			{ 0, 0, 3919, 1 },
+			{ 0, 0, 3920, 1 },
+			{ 0, 0, 3921, 1 },
+			{ 0, 0, 3922, 1 },
+			{ 0, 0, 3923, 1 },
+			{ 0, 0, 3924, 1 },
+			{ 0, 0, 3925, 1 },
+			{ 0, 0, 3926, 1 },
+			{ 0, 0, 3927, 1 },
+			{ 0, 0, 3928, 1 },
+			{ 0, 0, 3929, 1 },
+			{ 0, 0, 3930, 1 },
+			{ 0, 0, 3931, 1 },
+			{ 0, 0, 3932, 1 },
+			{ 0, 0, 3933, 1 },
+			{ 0, 0, 3934, 1 },
+			{ 0, 0, 3935, 1 },
+			{ 0, 0, 3936, 1 },
+			{ 0, 0, 3937, 1 },
+			{ 0, 0, 3938, 1 },
+			{ 0, 0, 3939, 1 },
+			{ 0, 0, 3940, 1 },
+			{ 0, 0, 3941, 2 },
+			{ 0, 0, 3943, 5 },
+			{ 0, 0, 3948, 4 },
+			{ 0, 0, 3952, 5 },
+			{ 0, 0, 3957, 3 },
+			{ 0, 0, 3960, 5 },
+			{ 0, 0, 3965, 3 },
+			{ 0, 0, 3968, 3 },
+			{ 0, 0, 3971, 6 },
+			{ 0, 0, 3977, 4 },
+			{ 0, 0, 3981, 3 },
+			{ 0, 0, 3984, 3 },
+			{ 0, 0, 3987, 3 },
+			{ 0, 0, 3990, 4 },
+			{ 0, 0, 3994, 4 },
+			{ 0, 0, 3998, 4 },
+			{ 0, 0, 4002, 4 },
+			{ 0, 0, 4006, 4 },
+			{ 0, 0, 4010, 4 },
+			{ 0, 0, 4014, 4 },
+			{ 0, 0, 4018, 6 },
+			{ 0, 0, 4024, 2 },
+			{ 0, 0, 4026, 6 },
+			{ 0, 0, 4032, 6 },
+			{ 0, 0, 4038, 5 },
+			{ 0, 0, 4043, 4 },
+			{ 0, 0, 4047, 6 },
+			{ 0, 0, 4053, 6 },
+			{ 0, 0, 4059, 4 },
+			{ 0, 0, 4063, 3 },
+			{ 0, 0, 4066, 3 },
+			{ 0, 0, 4069, 4 },
+			{ 0, 0, 4073, 4 },
+			{ 0, 0, 4077, 5 },
+			{ 0, 0, 4082, 5 },
+			{ 0, 0, 4087, 3 },
+			{ 0, 0, 4090, 3 },
+			{ 0, 0, 4093, 4 },
+			{ 0, 0, 4097, 3 },
+			{ 0, 0, 4100, 3 },
+			{ 0, 0, 4103, 2 },
+			{ 0, 0, 4105, 2 },
+			{ 0, 0, 4107, 3 },
+			{ 0, 0, 4110, 3 },
+			{ 0, 0, 4113, 6 },
+			{ 0, 0, 4119, 4 },
+			{ 0, 0, 4123, 5 },
+			{ 0, 0, 4128, 6 },
+			{ 0, 0, 4134, 4 },
+			{ 0, 0, 4138, 3 },
+			{ 0, 0, 4141, 3 },
+			{ 0, 0, 4144, 6 },
+			{ 0, 0, 4150, 4 },
+			{ 0, 0, 4154, 6 },
+			{ 0, 0, 4160, 3 },
+			{ 0, 0, 4163, 5 },
+			{ 0, 0, 4168, 3 },
+			{ 0, 0, 4171, 4 },
+			{ 0, 0, 4175, 3 },
+			{ 0, 0, 4178, 4 },
+			{ 0, 0, 4182, 5 },
+			{ 0, 0, 4187, 4 },
+			{ 0, 0, 4191, 5 },
+			{ 0, 0, 4196, 4 },
+			{ 0, 0, 4200, 2 },
+			{ 0, 0, 4202, 5 },
+			{ 0, 0, 4207, 3 },
+			{ 0, 0, 4210, 3 },
+			{ 0, 0, 4213, 4 },
+			{ 0, 0, 4217, 3 },
+			{ 0, 0, 4220, 3 },
+			{ 0, 0, 4223, 3 },
+			{ 0, 0, 4226, 5 },
+			{ 0, 0, 4231, 4 },
+			{ 0, 0, 4235, 2 },
+			{ 0, 0, 4237, 6 },
+			{ 0, 0, 4243, 3 },
+			{ 0, 0, 4246, 5 },
+			{ 0, 0, 4251, 4 },
+			{ 0, 0, 4255, 4 },
+			{ 0, 0, 4259, 3 },
+			{ 0, 0, 4262, 3 },
+			{ 0, 0, 4265, 4 },
+			{ 0, 0, 4269, 2 },
+			{ 0, 0, 4271, 4 },
+			{ 0, 0, 4275, 5 },
+			{ 0, 0, 4280, 2 },
+			{ 0, 0, 4282, 6 },
+			{ 0, 0, 4288, 3 },
+			{ 0, 0, 4291, 2 },
+			{ 0, 0, 4293, 2 },
+			{ 0, 0, 4295, 2 },
+			{ 0, 0, 4297, 2 },
+			{ 0, 0, 4299, 2 },
+			{ 0, 0, 4301, 2 },
+			{ 0, 0, 4303, 2 },
+			{ 0, 0, 4305, 2 },
+			{ 0, 0, 4307, 2 },
+			{ 0, 0, 4309, 2 },
+			{ 0, 0, 4311, 3 },
+			{ 0, 0, 4314, 3 },
+			{ 0, 0, 4317, 3 },
+			{ 0, 0, 4320, 3 },
+			{ 0, 0, 4323, 3 },
+			{ 0, 0, 4326, 3 },
+			{ 0, 0, 4329, 3 },
+			{ 0, 0, 4332, 3 },
+			{ 0, 0, 4335, 3 },
+			{ 0, 0, 4338, 3 },
+			{ 0, 0, 4341, 3 },
+			{ 0, 0, 4344, 3 },
+			{ 0, 0, 4347, 3 },
+			{ 0, 0, 4350, 3 },
+			{ 0, 0, 4353, 3 },
+			{ 0, 0, 4356, 3 },
+			{ 0, 0, 4359, 2 },
+			{ 0, 0, 4361, 2 },
+			{ 0, 0, 4363, 3 },
+			{ 0, 0, 4366, 2 },
+			{ 0, 0, 4368, 2 },
+			{ 0, 0, 4370, 2 },
+			{ 0, 0, 4372, 3 },
+			{ 0, 0, 4375, 3 },
+			{ 0, 0, 4378, 2 },
+			{ 0, 0, 4380, 2 },
+			{ 0, 0, 4382, 2 },
+			{ 0, 0, 4384, 2 },
+			{ 0, 0, 4386, 2 },
+			{ 0, 0, 4388, 4 },
+			{ 0, 0, 4392, 2 },
+			{ 0, 0, 4394, 2 },
+			{ 0, 0, 4396, 2 },
+			{ 0, 0, 4398, 2 },
+			{ 0, 0, 4400, 2 },
+			{ 0, 0, 4402, 2 },
+			{ 0, 0, 4404, 2 },
+			{ 0, 0, 4406, 2 },
+			{ 0, 0, 4408, 3 },
+			{ 0, 0, 4411, 4 },
+			{ 0, 0, 4415, 2 },
+			{ 0, 0, 4417, 2 },
+			{ 0, 0, 4419, 2 },
+			{ 0, 0, 4421, 2 },
+			{ 0, 0, 4423, 2 },
+			{ 0, 0, 4425, 2 },
+			{ 0, 0, 4427, 2 },
+			{ 0, 0, 4429, 3 },
+			{ 0, 0, 4432, 3 },
+			{ 0, 0, 4435, 3 },
+			{ 0, 0, 4438, 3 },
+			{ 0, 0, 4441, 2 },
+			{ 0, 0, 4443, 2 },
+			{ 0, 0, 4445, 2 },
+			{ 0, 0, 4447, 2 },
+			{ 0, 0, 4449, 2 },
+			{ 0, 0, 4451, 2 },
+			{ 0, 0, 4453, 2 },
+			{ 0, 0, 4455, 2 },
+			{ 0, 0, 4457, 2 },
+			{ 0, 0, 4459, 2 },
+			{ 0, 0, 4461, 3 },
+			{ 0, 0, 4464, 3 },
+			{ 0, 0, 4467, 2 },
+			{ 0, 0, 4469, 3 },
+			{ 0, 0, 4472, 3 },
+			{ 0, 0, 4475, 3 },
+			{ 0, 0, 4478, 2 },
+			{ 0, 0, 4480, 3 },
+			{ 0, 0, 4483, 3 },
+			{ 0, 0, 4486, 4 },
+			{ 0, 0, 4490, 2 },
+			{ 0, 0, 4492, 3 },
+			{ 0, 0, 4495, 3 },
+			{ 0, 0, 4498, 3 },
+			{ 0, 0, 4501, 3 },
+			{ 0, 0, 4504, 5 },
+			{ 0, 0, 4509, 6 },
+			{ 0, 0, 4515, 2 },
+			{ 0, 0, 4517, 2 },
+			{ 0, 0, 4519, 2 },
+			{ 0, 0, 4521, 2 },
+			{ 0, 0, 4523, 2 },
+			{ 0, 0, 4525, 2 },
+			{ 0, 0, 4527, 2 },
+			{ 0, 0, 4529, 2 },
+			{ 0, 0, 4531, 2 },
+			{ 0, 0, 4533, 2 },
+			{ 0, 0, 4535, 2 },
+			{ 0, 0, 4537, 2 },
+			{ 0, 0, 4539, 2 },
+			{ 0, 0, 4541, 2 },
+			{ 0, 0, 4543, 2 },
+			{ 0, 0, 4545, 2 },
+			{ 0, 0, 4547, 2 },
+			{ 0, 0, 4549, 2 },
+			{ 0, 0, 4551, 4 },
+			{ 0, 0, 4555, 2 },
+			{ 0, 0, 4557, 2 },
+			{ 0, 0, 4559, 2 },
+			{ 0, 0, 4561, 4 },
+			{ 0, 0, 4565, 3 },
+			{ 0, 0, 4568, 2 },
+			{ 0, 0, 4570, 2 },
+			{ 0, 0, 4572, 2 },
+			{ 0, 0, 4574, 2 },
+			{ 0, 0, 4576, 2 },
+			{ 0, 0, 4578, 2 },
+			{ 0, 0, 4580, 2 },
+			{ 0, 0, 4582, 2 },
+			{ 0, 0, 4584, 2 },
+			{ 0, 0, 4586, 2 },
+			{ 0, 0, 4588, 3 },
+			{ 0, 0, 4591, 2 },
+			{ 0, 0, 4593, 2 },
+			{ 0, 0, 4595, 3 },
+			{ 0, 0, 4598, 3 },
+			{ 0, 0, 4601, 2 },
+			{ 0, 0, 4603, 4 },
+			{ 0, 0, 4607, 3 },
+			{ 0, 0, 4610, 2 },
+			{ 0, 0, 4612, 2 },
+			{ 0, 0, 4614, 2 },
+			{ 0, 0, 4616, 2 },
+			{ 0, 0, 4618, 3 },
+			{ 0, 0, 4621, 3 },
+			{ 0, 0, 4624, 2 },
+			{ 0, 0, 4626, 2 },
+			{ 0, 0, 4628, 2 },
+			{ 0, 0, 4630, 2 },
+			{ 0, 0, 4632, 2 },
+			{ 0, 0, 4634, 2 },
+			{ 0, 0, 4636, 2 },
+			{ 0, 0, 4638, 2 },
+			{ 0, 0, 4640, 2 },
+			{ 0, 0, 4642, 3 },
+			{ 0, 0, 4645, 3 },
+			{ 0, 0, 4648, 3 },
+			{ 0, 0, 4651, 3 },
+			{ 0, 0, 4654, 3 },
+			{ 0, 0, 4657, 3 },
+			{ 0, 0, 4660, 3 },
+			{ 0, 0, 4663, 3 },
+			{ 0, 0, 4666, 3 },
+			{ 0, 0, 4669, 3 },
+			{ 0, 0, 4672, 3 },
+			{ 0, 0, 4675, 3 },
+			{ 0, 0, 4678, 3 },
+			{ 0, 0, 4681, 3 },
+			{ 0, 0, 4684, 3 },
+			{ 0, 0, 4687, 3 },
+			{ 0, 0, 4690, 3 },
+			{ 0, 0, 4693, 3 },
+			{ 0, 0, 4696, 3 },
+			{ 0, 0, 4699, 3 },
+			{ 0, 0, 4702, 3 },
+			{ 0, 0, 4705, 3 },
+			{ 0, 0, 4708, 3 },
+			{ 0, 0, 4711, 1 },
+			{ 0, 0, 4712, 1 },
+			{ 0, 0, 4713, 1 },
+			{ 0, 0, 4714, 1 },
+			{ 0, 0, 4715, 1 },
+			{ 0, 0, 4716, 1 },
+			{ 0, 0, 4717, 1 },
+			{ 0, 0, 4718, 1 },
+			{ 0, 0, 4719, 1 },
+			{ 0, 0, 4720, 1 },
+			{ 0, 0, 4721, 1 },
+			{ 0, 0, 4722, 1 },
+			{ 0, 0, 4723, 1 },
+			{ 4724, 1, 4724, 1 },
+			{ 4725, 1, 4725, 1 },
+			{ 4726, 1, 4726, 1 },
+			{ 4727, 1, 4727, 1 },
+			{ 4728, 1, 4728, 1 },
+			{ 4729, 1, 4729, 1 },
+			{ 4730, 1, 4730, 1 },
+			{ 4731, 1, 4731, 1 },
+			{ 4732, 1, 4732, 1 },
+			{ 4733, 1, 4733, 1 },
+			{ 4734, 1, 4734, 1 },
+			{ 4735, 1, 4735, 1 },
+			{ 4736, 1, 4736, 1 },
+			{ 4737, 1, 4737, 1 },
+			{ 4738, 1, 4738, 1 },
+			{ 4739, 1, 4739, 1 },
+			{ 4740, 1, 4740, 1 },
+			{ 4741, 1, 4741, 1 },
+			{ 4742, 1, 4742, 1 },
+			{ 4743, 1, 4743, 1 },
+			{ 4744, 1, 4744, 1 },
+			{ 4745, 1, 4745, 1 },
+			{ 4746, 1, 4746, 1 },
+			{ 4747, 1, 4747, 1 },
+			{ 4748, 1, 4748, 1 },
+			{ 4749, 1, 4749, 1 },
+			{ 4750, 1, 4750, 1 },
+			{ 4751, 1, 4751, 1 },
+			{ 4752, 1, 4752, 1 },
+			{ 4753, 1, 4753, 1 },
+			{ 4754, 1, 4754, 1 },
+			{ 4755, 1, 4755, 1 },
+			{ 4756, 1, 4756, 1 },
+			{ 4757, 1, 4757, 1 },
+			{ 4758, 1, 4758, 1 },
+			{ 4759, 1, 4759, 1 },
+			{ 4760, 1, 4760, 1 },
+			{ 4761, 1, 4761, 1 },
+			{ 4762, 1, 4762, 1 },
+			{ 4763, 1, 4763, 1 },
+			{ 4764, 1, 4764, 1 },
+			{ 4765, 1, 4765, 1 },
+			{ 4766, 1, 4766, 1 },
+			{ 4767, 1, 4767, 1 },
+			{ 4768, 1, 4768, 1 },
+			{ 4769, 1, 4769, 1 },
+			{ 4770, 1, 4770, 1 },
+			{ 4771, 1, 4771, 1 },
+			{ 4772, 1, 4772, 1 },
+			{ 4773, 1, 4773, 1 },
+			{ 4774, 1, 4774, 1 },
+			{ 4775, 1, 4775, 1 },
+			{ 4776, 1, 4776, 1 },
+			{ 4777, 1, 4777, 1 },
+			{ 4778, 1, 4778, 1 },
+			{ 4779, 1, 4779, 1 },
+			{ 4780, 1, 4780, 1 },
+			{ 4781, 1, 4781, 1 },
+			{ 4782, 1, 4782, 1 },
+			{ 4783, 1, 4783, 1 },
+			{ 4784, 1, 4784, 1 },
+			{ 4785, 1, 4785, 1 },
+			{ 4786, 1, 4786, 1 },
+			{ 4787, 1, 4787, 1 },
+			{ 4788, 1, 4788, 1 },
+			{ 4789, 1, 4789, 1 },
+			{ 4790, 1, 4790, 1 },
+			{ 4791, 1, 4791, 1 },
+			{ 4792, 1, 4792, 1 },
+			{ 4793, 1, 4793, 1 },
+			{ 4794, 1, 4794, 1 },
+			{ 4795, 1, 4795, 1 },
+			{ 4796, 1, 4796, 1 },
+			{ 4797, 1, 4797, 1 },
+			{ 4798, 1, 4798, 1 },
+			{ 4799, 1, 4799, 1 },
+			{ 4800, 1, 4800, 1 },
+			{ 4801, 1, 4801, 1 },
+			{ 4802, 1, 4802, 1 },
+			{ 4803, 1, 4803, 1 },
+			{ 4804, 1, 4804, 1 },
+			{ 4805, 1, 4805, 1 },
+			{ 4806, 1, 4806, 1 },
+			{ 4807, 1, 4807, 1 },
+			{ 4808, 1, 4808, 1 },
+			{ 4809, 1, 4809, 1 },
+			{ 4810, 1, 4810, 1 },
+			{ 4811, 1, 4811, 1 },
+			{ 4812, 1, 4812, 1 },
+			{ 4813, 1, 4813, 1 },
+			{ 4814, 1, 4814, 1 },
+			{ 4815, 1, 4815, 1 },
+			{ 4816, 1, 4816, 1 },
+			{ 4817, 1, 4817, 1 },
+			{ 4818, 1, 4818, 1 },
+			{ 4819, 1, 4819, 1 },
+			{ 4820, 1, 4820, 1 },
+			{ 4821, 1, 4821, 1 },
+			{ 4822, 1, 4822, 1 },
+			{ 4823, 1, 4823, 1 },
+			{ 4824, 1, 4824, 1 },
+			{ 4825, 1, 4825, 1 },
+			{ 4826, 1, 4826, 1 },
+			{ 4827, 1, 4827, 1 },
+			{ 4828, 1, 4828, 1 },
+			{ 4829, 1, 4829, 1 },
+			{ 4830, 1, 4830, 1 },
+			{ 4831, 1, 4831, 1 },
+			{ 4832, 1, 4832, 1 },
+			{ 4833, 1, 4833, 1 },
+			{ 4834, 1, 4834, 1 },
+			{ 4835, 1, 4835, 1 },
+			{ 4836, 1, 4836, 1 },
+			{ 4837, 1, 4837, 1 },
+			{ 4838, 1, 4838, 1 },
+			{ 4839, 1, 4839, 1 },
+			{ 4840, 1, 4840, 1 },
+			{ 4841, 1, 4841, 1 },
+			{ 4842, 1, 4842, 1 },
+			{ 4843, 1, 4843, 1 },
+			{ 4844, 1, 4844, 1 },
+			{ 4845, 1, 4845, 1 },
+			{ 4846, 1, 4846, 1 },
+			{ 4847, 1, 4847, 1 },
+			{ 4848, 1, 4848, 1 },
+			{ 4849, 1, 4849, 1 },
+			{ 4850, 1, 4850, 1 },
+			{ 4851, 1, 4851, 1 },
+			{ 4852, 1, 4852, 1 },
+			{ 4853, 1, 4853, 1 },
+			{ 4854, 1, 4854, 1 },
+			{ 4855, 1, 4855, 1 },
+			{ 4856, 1, 4856, 1 },
+			{ 4857, 1, 4857, 1 },
+			{ 4858, 1, 4858, 1 },
+			{ 4859, 1, 4859, 1 },
+			{ 4860, 1, 4860, 1 },
+			{ 4861, 1, 4861, 1 },
+			{ 4862, 1, 4862, 1 },
+			{ 4863, 1, 4863, 1 },
+			{ 4864, 1, 4864, 1 },
+			{ 4865, 1, 4865, 1 },
+			{ 4866, 1, 4866, 1 },
+			{ 4867, 1, 4867, 1 },
+			{ 4868, 1, 4868, 1 },
+			{ 4869, 1, 4869, 1 },
+			{ 4870, 1, 4870, 1 },
+			{ 4871, 1, 4871, 1 },
+			{ 4872, 1, 4872, 1 },
+			{ 4873, 1, 4873, 1 },
+			{ 4874, 1, 4874, 1 },
+			{ 4875, 1, 4875, 1 },
+			{ 4876, 1, 4876, 1 },
+			{ 4877, 1, 4877, 1 },
+			{ 4878, 1, 4878, 1 },
+			{ 4879, 1, 4879, 1 },
+			{ 4880, 1, 4880, 1 },
+			{ 4881, 1, 4881, 1 },
+			{ 4882, 1, 4882, 1 },
+			{ 4883, 1, 4883, 1 },
+			{ 4884, 1, 4884, 1 },
+			{ 4885, 1, 4885, 1 },
+			{ 4886, 1, 4886, 1 },
+			{ 4887, 1, 4887, 1 },
+			{ 4888, 1, 4888, 1 },
+			{ 4889, 1, 4889, 1 },
+			{ 4890, 1, 4890, 1 },
+			{ 4891, 1, 4891, 1 },
+			{ 4892, 1, 4892, 1 },
+			{ 4893, 1, 4893, 1 },
+			{ 4894, 1, 4894, 1 },
+			{ 4895, 1, 4895, 1 },
+			{ 4896, 1, 4896, 1 },
+			{ 4897, 1, 4897, 1 },
+			{ 4898, 1, 4898, 1 },
+			{ 4899, 1, 4899, 1 },
+			{ 4900, 1, 4900, 1 },
+			{ 4901, 1, 4901, 1 },
+			{ 4902, 1, 4902, 1 },
+			{ 4903, 1, 4903, 1 },
+			{ 4904, 1, 4904, 1 },
+			{ 4905, 1, 4905, 1 },
+			{ 4906, 1, 4906, 1 },
+			{ 4907, 1, 4907, 1 },
+			{ 4908, 1, 4908, 1 },
+			{ 4909, 1, 4909, 1 },
+			{ 4910, 1, 4910, 1 },
+			{ 4911, 1, 4911, 1 },
+			{ 4912, 1, 4912, 1 },
+			{ 4913, 1, 4913, 1 },
+			{ 4914, 1, 4914, 1 },
+			{ 4915, 1, 4915, 1 },
+			{ 4916, 1, 4916, 1 },
+			{ 4917, 1, 4917, 1 },
+			{ 4918, 1, 4918, 1 },
+			{ 4919, 1, 4919, 1 },
+			{ 4920, 1, 4920, 1 },
+			{ 4921, 1, 4921, 1 },
+			{ 4922, 1, 4922, 1 },
+			{ 4923, 1, 4923, 1 },
+			{ 4924, 1, 4924, 1 },
+			{ 4925, 1, 4925, 1 },
+			{ 4926, 1, 4926, 1 },
+			{ 4927, 1, 4927, 1 },
+			{ 4928, 1, 4928, 1 },
+			{ 4929, 1, 4929, 1 },
+			{ 4930, 1, 4930, 1 },
+			{ 4931, 1, 4931, 1 },
+			{ 4932, 1, 4932, 1 },
+			{ 4933, 1, 4933, 1 },
+			{ 4934, 1, 4934, 1 },
+			{ 4935, 1, 4935, 1 },
+			{ 4936, 1, 4936, 1 },
+			{ 4937, 1, 4937, 1 },
+			{ 4938, 1, 4938, 1 },
+			{ 4939, 1, 4939, 1 },
+			{ 4940, 1, 4940, 1 },
+			{ 4941, 1, 4941, 1 },
+			{ 4942, 1, 4942, 1 },
+			{ 4943, 1, 4943, 1 },
+			{ 4944, 1, 4944, 1 },
+			{ 4945, 1, 4945, 1 },
+			{ 4946, 1, 4946, 1 },
+			{ 4947, 1, 4947, 1 },
+			{ 4948, 1, 4948, 1 },
+			{ 4949, 1, 4949, 1 },
+			{ 4950, 1, 4950, 1 },
+			{ 4951, 1, 4951, 1 },
+			{ 4952, 1, 4952, 1 },
+			{ 4953, 1, 4953, 1 },
+			{ 4954, 1, 4954, 1 },
+			{ 4955, 1, 4955, 1 },
+			{ 4956, 1, 4956, 1 },
+			{ 4957, 1, 4957, 1 },
+			{ 4958, 1, 4958, 1 },
+			{ 4959, 1, 4959, 1 },
+			{ 4960, 1, 4960, 1 },
+			{ 4961, 1, 4961, 1 },
+			{ 4962, 1, 4962, 1 },
+			{ 4963, 1, 4963, 1 },
+			{ 4964, 1, 4964, 1 },
+			{ 4965, 1, 4965, 1 },
+			{ 4966, 1, 4966, 1 },
+			{ 4967, 1, 4967, 1 },
+			{ 4968, 1, 4968, 1 },
+			{ 4969, 1, 4969, 1 },
+			{ 4970, 1, 4970, 1 },
+			{ 4971, 1, 4971, 1 },
+			{ 4972, 1, 4972, 1 },
+			{ 4973, 1, 4973, 1 },
+			{ 4974, 1, 4974, 1 },
+			{ 4975, 1, 4975, 1 },
+			{ 4976, 1, 4976, 1 },
+			{ 4977, 1, 4977, 1 },
+			{ 4978, 1, 4978, 1 },
+			{ 4979, 1, 4979, 1 },
+			{ 4980, 1, 4980, 1 },
+			{ 4981, 1, 4981, 1 },
+			{ 4982, 1, 4982, 1 },
+			{ 4983, 1, 4983, 1 },
+			{ 4984, 1, 4984, 1 },
+			{ 4985, 1, 4985, 1 },
+			{ 4986, 1, 4986, 1 },
+			{ 4987, 1, 4987, 1 },
+			{ 4988, 1, 4988, 1 },
+			{ 4989, 1, 4989, 1 },
+			{ 4990, 1, 4990, 1 },
+			{ 4991, 1, 4991, 1 },
+			{ 4992, 1, 4992, 1 },
+			{ 4993, 1, 4993, 1 },
+			{ 4994, 1, 4994, 1 },
+			{ 4995, 1, 4995, 1 },
+			{ 4996, 1, 4996, 1 },
+			{ 4997, 1, 4997, 1 },
+			{ 4998, 1, 4998, 1 },
+			{ 4999, 1, 4999, 1 },
+			{ 5000, 1, 5000, 1 },
+			{ 5001, 1, 5001, 1 },
+			{ 5002, 1, 5002, 1 },
+			{ 5003, 1, 5003, 1 },
+			{ 5004, 1, 5004, 1 },
+			{ 5005, 1, 5005, 1 },
+			{ 5006, 1, 5006, 1 },
+			{ 5007, 1, 5007, 1 },
+			{ 5008, 1, 5008, 1 },
+			{ 5009, 1, 5009, 1 },
+			{ 5010, 1, 5010, 1 },
+			{ 5011, 1, 5011, 1 },
+			{ 5012, 1, 5012, 1 },
+			{ 5013, 1, 5013, 1 },
+			{ 5014, 1, 5014, 1 },
+			{ 5015, 1, 5015, 1 },
+			{ 5016, 1, 5016, 1 },
+			{ 5017, 1, 5017, 1 },
+			{ 5018, 1, 5018, 1 },
+			{ 5019, 1, 5019, 1 },
+			{ 5020, 1, 5020, 1 },
+			{ 5021, 1, 5021, 1 },
+			{ 5022, 1, 5022, 1 },
+			{ 5023, 1, 5023, 1 },
+			{ 5024, 1, 5024, 1 },
+			{ 5025, 1, 5025, 1 },
+			{ 5026, 1, 5026, 1 },
+			{ 5027, 1, 5027, 1 },
+			{ 5028, 1, 5028, 1 },
+			{ 5029, 1, 5029, 1 },
+			{ 5030, 1, 5030, 1 },
+			{ 5031, 1, 5031, 1 },
+			{ 5032, 1, 5032, 1 },
+			{ 5033, 1, 5033, 1 },
+			{ 5034, 1, 5034, 1 },
+			{ 5035, 1, 5035, 1 },
+			{ 5036, 1, 5036, 1 },
+			{ 5037, 1, 5037, 1 },
+			{ 5038, 1, 5038, 1 },
+			{ 5039, 1, 5039, 1 },
+			{ 5040, 1, 5040, 1 },
+			{ 5041, 1, 5041, 1 },
+			{ 5042, 1, 5042, 1 },
+			{ 5043, 1, 5043, 1 },
+			{ 5044, 1, 5044, 1 },
+			{ 5045, 1, 5045, 1 },
+			{ 5046, 1, 5046, 1 },
+			{ 5047, 1, 5047, 1 },
+			{ 5048, 1, 5048, 1 },
+			{ 5049, 1, 5049, 1 },
+			{ 5050, 1, 5050, 1 },
+			{ 5051, 1, 5051, 1 },
+			{ 5052, 1, 5052, 1 },
+			{ 5053, 1, 5053, 1 },
+			{ 5054, 1, 5054, 1 },
+			{ 5055, 1, 5055, 1 },
+			{ 5056, 1, 5056, 1 },
+			{ 5057, 1, 5057, 1 },
+			{ 5058, 1, 5058, 1 },
+			{ 5059, 1, 5059, 1 },
+			{ 5060, 1, 5060, 1 },
+			{ 5061, 1, 5061, 1 },
+			{ 5062, 1, 5062, 1 },
+			{ 5063, 1, 5063, 1 },
+			{ 5064, 1, 5064, 1 },
+			{ 5065, 1, 5065, 1 },
+			{ 5066, 1, 5066, 1 },
+			{ 5067, 1, 5067, 1 },
+			{ 5068, 1, 5068, 1 },
+			{ 5069, 1, 5069, 1 },
+			{ 5070, 1, 5070, 1 },
+			{ 5071, 1, 5071, 1 },
+			{ 5072, 1, 5072, 1 },
+			{ 5073, 1, 5073, 1 },
+			{ 5074, 1, 5074, 1 },
+			{ 5075, 1, 5075, 1 },
+			{ 5076, 1, 5076, 1 },
+			{ 5077, 1, 5077, 1 },
+			{ 5078, 1, 5078, 1 },
+			{ 5079, 1, 5079, 1 },
+			{ 5080, 1, 5080, 1 },
+			{ 5081, 1, 5081, 1 },
+			{ 5082, 1, 5082, 1 },
+			{ 5083, 1, 5083, 1 },
+			{ 5084, 1, 5084, 1 },
+			{ 5085, 1, 5085, 1 },
+			{ 5086, 1, 5086, 1 },
+			{ 5087, 1, 5087, 1 },
+			{ 5088, 1, 5088, 1 },
+			{ 5089, 1, 5089, 1 },
+			{ 5090, 1, 5090, 1 },
+			{ 5091, 1, 5091, 1 },
+			{ 5092, 1, 5092, 1 },
+			{ 5093, 1, 5093, 1 },
+			{ 5094, 1, 5094, 1 },
+			{ 5095, 1, 5095, 1 },
+			{ 5096, 1, 5096, 1 },
+			{ 5097, 1, 5097, 1 },
+			{ 5098, 1, 5098, 1 },
+			{ 5099, 1, 5099, 1 },
+			{ 5100, 1, 5100, 1 },
+			{ 5101, 1, 5101, 1 },
+			{ 5102, 1, 5102, 1 },
+			{ 5103, 1, 5103, 1 },
+			{ 5104, 1, 5104, 1 },
+			{ 5105, 1, 5105, 1 },
+			{ 5106, 1, 5106, 1 },
+			{ 5107, 1, 5107, 1 },
+			{ 5108, 1, 5108, 1 },
+			{ 5109, 1, 5109, 1 },
+			{ 5110, 1, 5110, 1 },
+			{ 5111, 1, 5111, 1 },
+			{ 5112, 1, 5112, 1 },
+			{ 5113, 1, 5113, 1 },
+			{ 5114, 1, 5114, 1 },
+			{ 5115, 1, 5115, 1 },
+			{ 5116, 1, 5116, 1 },
+			{ 5117, 1, 5117, 1 },
+			{ 5118, 1, 5118, 1 },
+			{ 5119, 1, 5119, 1 },
+			{ 5120, 1, 5120, 1 },
+			{ 5121, 1, 5121, 1 },
+			{ 5122, 1, 5122, 1 },
+			{ 5123, 1, 5123, 1 },
+			{ 5124, 1, 5124, 1 },
+			{ 5125, 1, 5125, 1 },
+			{ 5126, 1, 5126, 1 },
+			{ 5127, 1, 5127, 1 },
+			{ 5128, 1, 5128, 1 },
+			{ 5129, 1, 5129, 1 },
+			{ 5130, 1, 5130, 1 },
+			{ 5131, 1, 5131, 1 },
+			{ 5132, 1, 5132, 1 },
+			{ 5133, 1, 5133, 1 },
+			{ 5134, 1, 5134, 1 },
+			{ 5135, 1, 5135, 1 },
+			{ 5136, 1, 5136, 1 },
+			{ 5137, 1, 5137, 1 },
+			{ 5138, 1, 5138, 1 },
+			{ 5139, 1, 5139, 1 },
+			{ 5140, 1, 5140, 1 },
+			{ 5141, 1, 5141, 1 },
+			{ 5142, 1, 5142, 1 },
+			{ 5143, 1, 5143, 1 },
+			{ 5144, 1, 5144, 1 },
+			{ 5145, 1, 5145, 1 },
+			{ 5146, 1, 5146, 1 },
+			{ 5147, 1, 5147, 1 },
+			{ 5148, 1, 5148, 1 },
+			{ 5149, 1, 5149, 1 },
+			{ 5150, 1, 5150, 1 },
+			{ 5151, 1, 5151, 1 },
+			{ 5152, 1, 5152, 1 },
+			{ 5153, 1, 5153, 1 },
+			{ 5154, 1, 5154, 1 },
+			{ 5155, 1, 5155, 1 },
+			{ 5156, 1, 5156, 1 },
+			{ 5157, 1, 5157, 1 },
+			{ 5158, 1, 5158, 1 },
+			{ 5159, 1, 5159, 1 },
+			{ 5160, 1, 5160, 1 },
+			{ 5161, 1, 5161, 1 },
+			{ 5162, 1, 5162, 1 },
+			{ 5163, 1, 5163, 1 },
+			{ 5164, 1, 5164, 1 },
+			{ 5165, 1, 5165, 1 },
+			{ 5166, 1, 5166, 1 },
+			{ 5167, 1, 5167, 1 },
+			{ 5168, 1, 5168, 1 },
+			{ 5169, 1, 5169, 1 },
+			{ 5170, 1, 5170, 1 },
+			{ 5171, 1, 5171, 1 },
+			{ 5172, 1, 5172, 1 },
+			{ 5173, 1, 5173, 1 },
+			{ 5174, 1, 5174, 1 },
+			{ 5175, 1, 5175, 1 },
+			{ 5176, 1, 5176, 1 },
+			{ 5177, 1, 5177, 1 },
+			{ 5178, 1, 5178, 1 },
+			{ 5179, 1, 5179, 1 },
+			{ 5180, 1, 5180, 1 },
+			{ 5181, 1, 5181, 1 },
+			{ 5182, 1, 5182, 1 },
+			{ 5183, 1, 5183, 1 },
+			{ 0, 0, 5184, 2 },
+			{ 0, 0, 5186, 2 },
+			{ 0, 0, 5188, 2 },
+			{ 0, 0, 5190, 3 },
+			{ 0, 0, 5193, 3 },
+			{ 0, 0, 5196, 2 },
+			{ 0, 0, 5198, 2 },
+			{ 0, 0, 5200, 2 },
+			{ 0, 0, 5202, 2 },
+			{ 0, 0, 5204, 2 },
+			{ 0, 0, 5206, 2 },
+			{ 0, 0, 5208, 2 },
+			{ 5210, 2, 5210, 2 },
+			{ 5212, 2, 5212, 2 },
+			{ 0, 0, 5214, 1 },
+			{ 0, 0, 5215, 1 },
+			{ 0, 0, 5216, 1 },
+			{ 0, 0, 5217, 1 },
+			{ 0, 0, 5218, 1 },
+			{ 0, 0, 5219, 1 },
+			{ 0, 0, 5220, 1 },
+			{ 0, 0, 5221, 1 },
+			{ 0, 0, 5222, 1 },
+			{ 0, 0, 5223, 1 },
+			{ 5224, 2, 5224, 2 },
+			{ 5226, 2, 5226, 2 },
+			{ 5228, 3, 5228, 3 },
+			{ 5231, 3, 5231, 3 },
+			{ 5234, 2, 5234, 2 },
+			{ 5236, 2, 5236, 2 },
+			{ 5238, 2, 5238, 2 },
+			{ 5240, 2, 5240, 2 },
+			{ 5242, 2, 5242, 2 },
+			{ 5244, 2, 5244, 2 },
+			{ 5246, 2, 5246, 2 },
+			{ 5248, 2, 5248, 2 },
+			{ 5250, 2, 5250, 2 },
+			{ 5252, 2, 5252, 2 },
+			{ 5254, 2, 5254, 2 },
+			{ 5256, 2, 5256, 2 },
+			{ 5258, 2, 5258, 2 },
+			{ 5260, 2, 5260, 2 },
+			{ 5262, 2, 5262, 2 },
+			{ 5264, 2, 5264, 2 },
+			{ 5266, 2, 5266, 2 },
+			{ 5268, 2, 5268, 2 },
+			{ 5270, 2, 5270, 2 },
+			{ 5272, 2, 5272, 2 },
+			{ 5274, 2, 5274, 2 },
+			{ 5276, 2, 5276, 2 },
+			{ 5278, 2, 5278, 2 },
+			{ 5280, 2, 5280, 2 },
+			{ 5282, 2, 5282, 2 },
+			{ 5284, 2, 5284, 2 },
+			{ 5286, 2, 5286, 2 },
+			{ 5288, 2, 5288, 2 },
+			{ 0, 0, 5290, 2 },
+			{ 0, 0, 5292, 1 },
+			{ 0, 0, 5293, 1 },
+			{ 0, 0, 5294, 1 },
+			{ 0, 0, 5295, 1 },
+			{ 0, 0, 5296, 1 },
+			{ 0, 0, 5297, 1 },
+			{ 0, 0, 5298, 1 },
+			{ 0, 0, 5299, 1 },
+			{ 0, 0, 5300, 1 },
+			{ 0, 0, 5301, 1 },
+			{ 0, 0, 5302, 1 },
+			{ 0, 0, 5303, 1 },
+			{ 0, 0, 5304, 1 },
+			{ 0, 0, 5305, 1 },
+			{ 0, 0, 5306, 1 },
+			{ 0, 0, 5307, 1 },
+			{ 0, 0, 5308, 1 },
+			{ 0, 0, 5309, 1 },
+			{ 0, 0, 5310, 1 },
+			{ 0, 0, 5311, 1 },
+			{ 0, 0, 5312, 1 },
+			{ 0, 0, 5313, 1 },
+			{ 0, 0, 5314, 1 },
+			{ 0, 0, 5315, 1 },
+			{ 0, 0, 5316, 1 },
+			{ 0, 0, 5317, 1 },
+			{ 0, 0, 5318, 1 },
+			{ 0, 0, 5319, 1 },
+			{ 0, 0, 5320, 1 },
+			{ 0, 0, 5321, 1 },
+			{ 0, 0, 5322, 1 },
+			{ 0, 0, 5323, 1 },
+			{ 0, 0, 5324, 1 },
+			{ 0, 0, 5325, 1 },
+			{ 0, 0, 5326, 1 },
+			{ 0, 0, 5327, 1 },
+			{ 0, 0, 5328, 1 },
+			{ 0, 0, 5329, 1 },
+			{ 0, 0, 5330, 1 },
+			{ 0, 0, 5331, 1 },
+			{ 0, 0, 5332, 1 },
+			{ 0, 0, 5333, 1 },
+			{ 0, 0, 5334, 1 },
+			{ 0, 0, 5335, 1 },
+			{ 0, 0, 5336, 1 },
+			{ 0, 0, 5337, 1 },
+			{ 0, 0, 5338, 1 },
+			{ 0, 0, 5339, 1 },
+			{ 0, 0, 5340, 1 },
+			{ 0, 0, 5341, 1 },
+			{ 0, 0, 5342, 1 },
+			{ 0, 0, 5343, 1 },
+			{ 0, 0, 5344, 1 },
+			{ 0, 0, 5345, 1 },
+			{ 0, 0, 5346, 1 },
+			{ 0, 0, 5347, 1 },
+			{ 0, 0, 5348, 1 },
+			{ 0, 0, 5349, 1 },
+			{ 0, 0, 5350, 1 },
+			{ 0, 0, 5351, 1 },
+			{ 0, 0, 5352, 1 },
+			{ 0, 0, 5353, 1 },
+			{ 0, 0, 5354, 1 },
+			{ 0, 0, 5355, 1 },
+			{ 0, 0, 5356, 1 },
+			{ 0, 0, 5357, 1 },
+			{ 0, 0, 5358, 1 },
+			{ 0, 0, 5359, 1 },
+			{ 0, 0, 5360, 1 },
+			{ 0, 0, 5361, 1 },
+			{ 0, 0, 5362, 1 },
+			{ 0, 0, 5363, 1 },
+			{ 0, 0, 5364, 1 },
+			{ 0, 0, 5365, 1 },
+			{ 0, 0, 5366, 1 },
+			{ 0, 0, 5367, 1 },
+			{ 0, 0, 5368, 1 },
+			{ 0, 0, 5369, 1 },
+			{ 0, 0, 5370, 1 },
+			{ 0, 0, 5371, 1 },
+			{ 0, 0, 5372, 1 },
+			{ 0, 0, 5373, 1 },
+			{ 0, 0, 5374, 1 },
+			{ 0, 0, 5375, 1 },
+			{ 0, 0, 5376, 2 },
+			{ 0, 0, 5378, 2 },
+			{ 0, 0, 5380, 1 },
+			{ 0, 0, 5381, 1 },
+			{ 0, 0, 5382, 1 },
+			{ 0, 0, 5383, 1 },
+			{ 0, 0, 5384, 1 },
+			{ 0, 0, 5385, 1 },
+			{ 0, 0, 5386, 1 },
+			{ 0, 0, 5387, 1 },
+			{ 0, 0, 5388, 1 },
+			{ 0, 0, 5389, 1 },
+			{ 0, 0, 5390, 2 },
+			{ 0, 0, 5392, 2 },
+			{ 0, 0, 5394, 1 },
+			{ 0, 0, 5395, 1 },
+			{ 0, 0, 5396, 1 },
+			{ 0, 0, 5397, 1 },
+			{ 0, 0, 5398, 1 },
+			{ 0, 0, 5399, 1 },
+			{ 0, 0, 5400, 1 },
+			{ 0, 0, 5401, 1 },
+			{ 0, 0, 5402, 1 },
+			{ 0, 0, 5403, 1 },
+			{ 0, 0, 5404, 2 },
+			{ 0, 0, 5406, 1 },
+			{ 0, 0, 5407, 1 },
+			{ 0, 0, 5408, 1 },
+			{ 0, 0, 5409, 1 },
+			{ 0, 0, 5410, 1 },
+			{ 0, 0, 5411, 1 },
+			{ 0, 0, 5412, 1 },
+			{ 0, 0, 5413, 1 },
+			{ 0, 0, 5414, 1 },
+			{ 0, 0, 5415, 1 },
+			{ 0, 0, 5416, 1 },
+			{ 0, 0, 5417, 1 },
+			{ 0, 0, 5418, 3 },
+			{ 0, 0, 5421, 3 },
+			{ 0, 0, 5424, 3 },
+			{ 0, 0, 5427, 3 },
+			{ 0, 0, 5430, 3 },
+			{ 0, 0, 5433, 3 },
+			{ 0, 0, 5436, 3 },
+			{ 0, 0, 5439, 3 },
+			{ 0, 0, 5442, 3 },
+			{ 0, 0, 5445, 3 },
+			{ 0, 0, 5448, 3 },
+			{ 0, 0, 5451, 3 },
+			{ 0, 0, 5454, 3 },
+			{ 0, 0, 5457, 3 },
+			{ 0, 0, 5460, 3 },
+			{ 0, 0, 5463, 3 },
+			{ 0, 0, 5466, 3 },
+			{ 0, 0, 5469, 3 },
+			{ 0, 0, 5472, 1 },
+			{ 0, 0, 5473, 1 },
+			{ 0, 0, 5474, 1 },
+			{ 0, 0, 5475, 1 },
+			{ 0, 0, 5476, 3 },
+			{ 0, 0, 5479, 3 },
+			{ 0, 0, 5482, 3 },
+			{ 0, 0, 5485, 3 },
+			{ 0, 0, 5488, 3 },
+			{ 0, 0, 5491, 2 },
+			{ 0, 0, 5493, 2 },
+			{ 0, 0, 5495, 2 },
+			{ 0, 0, 5497, 2 },
+			{ 0, 0, 5499, 2 },
+			{ 0, 0, 5501, 2 },
+			{ 0, 0, 5503, 2 },
+			{ 0, 0, 5505, 2 },
+			{ 0, 0, 5507, 2 },
+			{ 0, 0, 5509, 2 },
+			{ 0, 0, 5511, 2 },
+			{ 0, 0, 5513, 2 },
+			{ 0, 0, 5515, 2 },
+			{ 0, 0, 5517, 2 },
+			{ 0, 0, 5519, 2 },
+			{ 0, 0, 5521, 2 },
+			{ 0, 0, 5523, 2 },
+			{ 0, 0, 5525, 2 },
+			{ 0, 0, 5527, 2 },
+			{ 0, 0, 5529, 2 },
+			{ 0, 0, 5531, 2 },
+			{ 0, 0, 5533, 2 },
+			{ 0, 0, 5535, 2 },
+			{ 0, 0, 5537, 2 },
+			{ 0, 0, 5539, 2 },
+			{ 0, 0, 5541, 2 },
+			{ 0, 0, 5543, 2 },
+			{ 0, 0, 5545, 2 },
+			{ 0, 0, 5547, 2 },
+			{ 0, 0, 5549, 2 },
+			{ 0, 0, 5551, 2 },
+			{ 0, 0, 5553, 2 },
+			{ 0, 0, 5555, 2 },
+			{ 0, 0, 5557, 2 },
+			{ 0, 0, 5559, 2 },
+			{ 0, 0, 5561, 2 },
+			{ 0, 0, 5563, 2 },
+			{ 0, 0, 5565, 2 },
+			{ 0, 0, 5567, 2 },
+			{ 0, 0, 5569, 2 },
+			{ 0, 0, 5571, 2 },
+			{ 0, 0, 5573, 2 },
+			{ 0, 0, 5575, 2 },
+			{ 0, 0, 5577, 2 },
+			{ 0, 0, 5579, 2 },
+			{ 0, 0, 5581, 2 },
+			{ 0, 0, 5583, 2 },
+			{ 0, 0, 5585, 2 },
+			{ 0, 0, 5587, 2 },
+			{ 0, 0, 5589, 2 },
+			{ 0, 0, 5591, 2 },
+			{ 0, 0, 5593, 2 },
+			{ 0, 0, 5595, 2 },
+			{ 0, 0, 5597, 2 },
+			{ 0, 0, 5599, 2 },
+			{ 0, 0, 5601, 2 },
+			{ 0, 0, 5603, 2 },
+			{ 0, 0, 5605, 2 },
+			{ 0, 0, 5607, 2 },
+			{ 0, 0, 5609, 2 },
+			{ 0, 0, 5611, 2 },
+			{ 0, 0, 5613, 2 },
+			{ 0, 0, 5615, 2 },
+			{ 0, 0, 5617, 2 },
+			{ 0, 0, 5619, 2 },
+			{ 0, 0, 5621, 2 },
+			{ 0, 0, 5623, 2 },
+			{ 0, 0, 5625, 2 },
+			{ 0, 0, 5627, 2 },
+			{ 0, 0, 5629, 2 },
+			{ 0, 0, 5631, 2 },
+			{ 0, 0, 5633, 2 },
+			{ 0, 0, 5635, 2 },
+			{ 0, 0, 5637, 2 },
+			{ 0, 0, 5639, 2 },
+			{ 0, 0, 5641, 2 },
+			{ 0, 0, 5643, 2 },
+			{ 0, 0, 5645, 2 },
+			{ 0, 0, 5647, 2 },
+			{ 0, 0, 5649, 2 },
+			{ 0, 0, 5651, 2 },
+			{ 0, 0, 5653, 2 },
+			{ 0, 0, 5655, 2 },
+			{ 0, 0, 5657, 2 },
+			{ 0, 0, 5659, 2 },
+			{ 0, 0, 5661, 2 },
+			{ 0, 0, 5663, 2 },
+			{ 0, 0, 5665, 2 },
+			{ 0, 0, 5667, 2 },
+			{ 0, 0, 5669, 3 },
+			{ 0, 0, 5672, 3 },
+			{ 0, 0, 5675, 3 },
+			{ 0, 0, 5678, 3 },
+			{ 0, 0, 5681, 3 },
+			{ 0, 0, 5684, 3 },
+			{ 0, 0, 5687, 3 },
+			{ 0, 0, 5690, 3 },
+			{ 0, 0, 5693, 3 },
+			{ 0, 0, 5696, 3 },
+			{ 0, 0, 5699, 3 },
+			{ 0, 0, 5702, 3 },
+			{ 0, 0, 5705, 2 },
+			{ 0, 0, 5707, 2 },
+			{ 0, 0, 5709, 2 },
+			{ 0, 0, 5711, 2 },
+			{ 0, 0, 5713, 2 },
+			{ 0, 0, 5715, 2 },
+			{ 0, 0, 5717, 2 },
+			{ 0, 0, 5719, 2 },
+			{ 0, 0, 5721, 2 },
+			{ 0, 0, 5723, 2 },
+			{ 0, 0, 5725, 2 },
+			{ 0, 0, 5727, 2 },
+			{ 0, 0, 5729, 2 },
+			{ 0, 0, 5731, 2 },
+			{ 0, 0, 5733, 2 },
+			{ 0, 0, 5735, 2 },
+			{ 0, 0, 5737, 2 },
+			{ 0, 0, 5739, 2 },
+			{ 0, 0, 5741, 2 },
+			{ 0, 0, 5743, 2 },
+			{ 0, 0, 5745, 2 },
+			{ 0, 0, 5747, 2 },
+			{ 0, 0, 5749, 2 },
+			{ 0, 0, 5751, 2 },
+			{ 0, 0, 5753, 2 },
+			{ 0, 0, 5755, 2 },
+			{ 0, 0, 5757, 2 },
+			{ 0, 0, 5759, 2 },
+			{ 0, 0, 5761, 2 },
+			{ 0, 0, 5763, 2 },
+			{ 0, 0, 5765, 2 },
+			{ 0, 0, 5767, 2 },
+			{ 0, 0, 5769, 2 },
+			{ 0, 0, 5771, 2 },
+			{ 0, 0, 5773, 2 },
+			{ 0, 0, 5775, 2 },
+			{ 0, 0, 5777, 2 },
+			{ 0, 0, 5779, 2 },
+			{ 0, 0, 5781, 2 },
+			{ 0, 0, 5783, 2 },
+			{ 0, 0, 5785, 2 },
+			{ 0, 0, 5787, 2 },
+			{ 0, 0, 5789, 2 },
+			{ 0, 0, 5791, 2 },
+			{ 0, 0, 5793, 2 },
+			{ 0, 0, 5795, 3 },
+			{ 0, 0, 5798, 3 },
+			{ 0, 0, 5801, 3 },
+			{ 0, 0, 5804, 3 },
+			{ 0, 0, 5807, 3 },
+			{ 0, 0, 5810, 2 },
+			{ 0, 0, 5812, 2 },
+			{ 0, 0, 5814, 2 },
+			{ 0, 0, 5816, 2 },
+			{ 0, 0, 5818, 2 },
+			{ 0, 0, 5820, 2 },
+			{ 0, 0, 5822, 2 },
+			{ 0, 0, 5824, 2 },
+			{ 0, 0, 5826, 2 },
+			{ 0, 0, 5828, 2 },
+			{ 0, 0, 5830, 2 },
+			{ 0, 0, 5832, 2 },
+			{ 0, 0, 5834, 2 },
+			{ 0, 0, 5836, 2 },
+			{ 0, 0, 5838, 2 },
+			{ 0, 0, 5840, 2 },
+			{ 0, 0, 5842, 2 },
+			{ 0, 0, 5844, 2 },
+			{ 0, 0, 5846, 2 },
+			{ 0, 0, 5848, 2 },
+			{ 0, 0, 5850, 2 },
+			{ 0, 0, 5852, 2 },
+			{ 0, 0, 5854, 2 },
+			{ 0, 0, 5856, 2 },
+			{ 0, 0, 5858, 2 },
+			{ 0, 0, 5860, 2 },
+			{ 0, 0, 5862, 2 },
+			{ 0, 0, 5864, 2 },
+			{ 0, 0, 5866, 2 },
+			{ 0, 0, 5868, 2 },
+			{ 0, 0, 5870, 2 },
+			{ 0, 0, 5872, 2 },
+			{ 0, 0, 5874, 2 },
+			{ 0, 0, 5876, 2 },
+			{ 0, 0, 5878, 2 },
+			{ 0, 0, 5880, 2 },
+			{ 0, 0, 5882, 2 },
+			{ 0, 0, 5884, 2 },
+			{ 0, 0, 5886, 2 },
+			{ 0, 0, 5888, 2 },
+			{ 0, 0, 5890, 2 },
+			{ 0, 0, 5892, 2 },
+			{ 0, 0, 5894, 2 },
+			{ 0, 0, 5896, 2 },
+			{ 0, 0, 5898, 2 },
+			{ 0, 0, 5900, 2 },
+			{ 0, 0, 5902, 2 },
+			{ 0, 0, 5904, 2 },
+			{ 0, 0, 5906, 2 },
+			{ 0, 0, 5908, 2 },
+			{ 0, 0, 5910, 2 },
+			{ 0, 0, 5912, 2 },
+			{ 0, 0, 5914, 2 },
+			{ 0, 0, 5916, 2 },
+			{ 0, 0, 5918, 2 },
+			{ 0, 0, 5920, 2 },
+			{ 0, 0, 5922, 2 },
+			{ 0, 0, 5924, 2 },
+			{ 0, 0, 5926, 2 },
+			{ 0, 0, 5928, 2 },
+			{ 0, 0, 5930, 2 },
+			{ 0, 0, 5932, 2 },
+			{ 0, 0, 5934, 2 },
+			{ 0, 0, 5936, 2 },
+			{ 0, 0, 5938, 2 },
+			{ 0, 0, 5940, 2 },
+			{ 0, 0, 5942, 2 },
+			{ 0, 0, 5944, 3 },
+			{ 0, 0, 5947, 3 },
+			{ 0, 0, 5950, 2 },
+			{ 0, 0, 5952, 2 },
+			{ 0, 0, 5954, 2 },
+			{ 0, 0, 5956, 2 },
+			{ 0, 0, 5958, 2 },
+			{ 0, 0, 5960, 2 },
+			{ 0, 0, 5962, 2 },
+			{ 0, 0, 5964, 2 },
+			{ 0, 0, 5966, 2 },
+			{ 0, 0, 5968, 2 },
+			{ 0, 0, 5970, 2 },
+			{ 0, 0, 5972, 2 },
+			{ 0, 0, 5974, 2 },
+			{ 0, 0, 5976, 2 },
+			{ 0, 0, 5978, 2 },
+			{ 0, 0, 5980, 2 },
+			{ 0, 0, 5982, 2 },
+			{ 0, 0, 5984, 3 },
+			{ 0, 0, 5987, 3 },
+			{ 0, 0, 5990, 3 },
+			{ 0, 0, 5993, 2 },
+			{ 0, 0, 5995, 2 },
+			{ 0, 0, 5997, 2 },
+			{ 0, 0, 5999, 2 },
+			{ 0, 0, 6001, 2 },
+			{ 0, 0, 6003, 2 },
+			{ 0, 0, 6005, 2 },
+			{ 0, 0, 6007, 2 },
+			{ 0, 0, 6009, 2 },
+			{ 0, 0, 6011, 2 },
+			{ 0, 0, 6013, 2 },
+			{ 0, 0, 6015, 2 },
+			{ 0, 0, 6017, 2 },
+			{ 0, 0, 6019, 2 },
+			{ 0, 0, 6021, 2 },
+			{ 0, 0, 6023, 2 },
+			{ 0, 0, 6025, 2 },
+			{ 0, 0, 6027, 2 },
+			{ 0, 0, 6029, 2 },
+			{ 0, 0, 6031, 2 },
+			{ 0, 0, 6033, 2 },
+			{ 0, 0, 6035, 2 },
+			{ 0, 0, 6037, 2 },
+			{ 0, 0, 6039, 2 },
+			{ 0, 0, 6041, 2 },
+			{ 0, 0, 6043, 2 },
+			{ 0, 0, 6045, 2 },
+			{ 0, 0, 6047, 2 },
+			{ 0, 0, 6049, 2 },
+			{ 0, 0, 6051, 2 },
+			{ 0, 0, 6053, 2 },
+			{ 0, 0, 6055, 2 },
+			{ 0, 0, 6057, 2 },
+			{ 0, 0, 6059, 2 },
+			{ 0, 0, 6061, 2 },
+			{ 0, 0, 6063, 2 },
+			{ 0, 0, 6065, 2 },
+			{ 0, 0, 6067, 2 },
+			{ 0, 0, 6069, 2 },
+			{ 0, 0, 6071, 2 },
+			{ 0, 0, 6073, 2 },
+			{ 0, 0, 6075, 2 },
+			{ 0, 0, 6077, 2 },
+			{ 0, 0, 6079, 2 },
+			{ 0, 0, 6081, 2 },
+			{ 0, 0, 6083, 2 },
+			{ 0, 0, 6085, 2 },
+			{ 0, 0, 6087, 2 },
+			{ 0, 0, 6089, 2 },
+			{ 0, 0, 6091, 2 },
+			{ 0, 0, 6093, 2 },
+			{ 0, 0, 6095, 2 },
+			{ 0, 0, 6097, 2 },
+			{ 0, 0, 6099, 2 },
+			{ 0, 0, 6101, 2 },
+			{ 0, 0, 6103, 2 },
+			{ 0, 0, 6105, 2 },
+			{ 0, 0, 6107, 2 },
+			{ 0, 0, 6109, 2 },
+			{ 0, 0, 6111, 2 },
+			{ 0, 0, 6113, 2 },
+			{ 0, 0, 6115, 2 },
+			{ 0, 0, 6117, 2 },
+			{ 0, 0, 6119, 2 },
+			{ 0, 0, 6121, 2 },
+			{ 0, 0, 6123, 2 },
+			{ 0, 0, 6125, 2 },
+			{ 0, 0, 6127, 2 },
+			{ 0, 0, 6129, 2 },
+			{ 0, 0, 6131, 2 },
+			{ 0, 0, 6133, 2 },
+			{ 0, 0, 6135, 2 },
+			{ 0, 0, 6137, 2 },
+			{ 0, 0, 6139, 3 },
+			{ 0, 0, 6142, 3 },
+			{ 0, 0, 6145, 3 },
+			{ 0, 0, 6148, 3 },
+			{ 0, 0, 6151, 3 },
+			{ 0, 0, 6154, 3 },
+			{ 0, 0, 6157, 3 },
+			{ 0, 0, 6160, 3 },
+			{ 0, 0, 6163, 3 },
+			{ 0, 0, 6166, 3 },
+			{ 0, 0, 6169, 3 },
+			{ 0, 0, 6172, 3 },
+			{ 0, 0, 6175, 3 },
+			{ 0, 0, 6178, 3 },
+			{ 0, 0, 6181, 3 },
+			{ 0, 0, 6184, 3 },
+			{ 0, 0, 6187, 3 },
+			{ 0, 0, 6190, 3 },
+			{ 0, 0, 6193, 3 },
+			{ 0, 0, 6196, 3 },
+			{ 0, 0, 6199, 3 },
+			{ 0, 0, 6202, 3 },
+			{ 0, 0, 6205, 3 },
+			{ 0, 0, 6208, 3 },
+			{ 0, 0, 6211, 3 },
+			{ 0, 0, 6214, 3 },
+			{ 0, 0, 6217, 3 },
+			{ 0, 0, 6220, 3 },
+			{ 0, 0, 6223, 3 },
+			{ 0, 0, 6226, 3 },
+			{ 0, 0, 6229, 3 },
+			{ 0, 0, 6232, 3 },
+			{ 0, 0, 6235, 3 },
+			{ 0, 0, 6238, 3 },
+			{ 0, 0, 6241, 3 },
+			{ 0, 0, 6244, 3 },
+			{ 0, 0, 6247, 3 },
+			{ 0, 0, 6250, 3 },
+			{ 0, 0, 6253, 3 },
+			{ 0, 0, 6256, 3 },
+			{ 0, 0, 6259, 3 },
+			{ 0, 0, 6262, 3 },
+			{ 0, 0, 6265, 3 },
+			{ 0, 0, 6268, 3 },
+			{ 0, 0, 6271, 3 },
+			{ 0, 0, 6274, 3 },
+			{ 0, 0, 6277, 3 },
+			{ 0, 0, 6280, 3 },
+			{ 0, 0, 6283, 3 },
+			{ 0, 0, 6286, 3 },
+			{ 0, 0, 6289, 3 },
+			{ 0, 0, 6292, 3 },
+			{ 0, 0, 6295, 3 },
+			{ 0, 0, 6298, 3 },
+			{ 0, 0, 6301, 3 },
+			{ 0, 0, 6304, 3 },
+			{ 0, 0, 6307, 3 },
+			{ 0, 0, 6310, 3 },
+			{ 0, 0, 6313, 3 },
+			{ 0, 0, 6316, 3 },
+			{ 0, 0, 6319, 3 },
+			{ 0, 0, 6322, 3 },
+			{ 0, 0, 6325, 3 },
+			{ 0, 0, 6328, 3 },
+			{ 0, 0, 6331, 3 },
+			{ 0, 0, 6334, 3 },
+			{ 0, 0, 6337, 3 },
+			{ 0, 0, 6340, 3 },
+			{ 0, 0, 6343, 3 },
+			{ 0, 0, 6346, 3 },
+			{ 0, 0, 6349, 3 },
+			{ 0, 0, 6352, 3 },
+			{ 0, 0, 6355, 3 },
+			{ 0, 0, 6358, 3 },
+			{ 0, 0, 6361, 3 },
+			{ 0, 0, 6364, 3 },
+			{ 0, 0, 6367, 3 },
+			{ 0, 0, 6370, 3 },
+			{ 0, 0, 6373, 3 },
+			{ 0, 0, 6376, 3 },
+			{ 0, 0, 6379, 3 },
+			{ 0, 0, 6382, 3 },
+			{ 0, 0, 6385, 3 },
+			{ 0, 0, 6388, 3 },
+			{ 0, 0, 6391, 3 },
+			{ 0, 0, 6394, 3 },
+			{ 0, 0, 6397, 3 },
+			{ 0, 0, 6400, 3 },
+			{ 0, 0, 6403, 3 },
+			{ 0, 0, 6406, 3 },
+			{ 0, 0, 6409, 3 },
+			{ 0, 0, 6412, 3 },
+			{ 0, 0, 6415, 3 },
+			{ 0, 0, 6418, 3 },
+			{ 0, 0, 6421, 3 },
+			{ 0, 0, 6424, 3 },
+			{ 0, 0, 6427, 3 },
+			{ 0, 0, 6430, 3 },
+			{ 0, 0, 6433, 3 },
+			{ 0, 0, 6436, 3 },
+			{ 0, 0, 6439, 3 },
+			{ 0, 0, 6442, 3 },
+			{ 0, 0, 6445, 3 },
+			{ 0, 0, 6448, 3 },
+			{ 0, 0, 6451, 3 },
+			{ 0, 0, 6454, 3 },
+			{ 0, 0, 6457, 3 },
+			{ 0, 0, 6460, 3 },
+			{ 0, 0, 6463, 3 },
+			{ 0, 0, 6466, 3 },
+			{ 0, 0, 6469, 3 },
+			{ 0, 0, 6472, 3 },
+			{ 0, 0, 6475, 3 },
+			{ 0, 0, 6478, 3 },
+			{ 0, 0, 6481, 3 },
+			{ 0, 0, 6484, 3 },
+			{ 0, 0, 6487, 3 },
+			{ 0, 0, 6490, 3 },
+			{ 0, 0, 6493, 3 },
+			{ 0, 0, 6496, 3 },
+			{ 0, 0, 6499, 4 },
+			{ 0, 0, 6503, 4 },
+			{ 0, 0, 6507, 4 },
+			{ 0, 0, 6511, 4 },
+			{ 0, 0, 6515, 4 },
+			{ 0, 0, 6519, 4 },
+			{ 0, 0, 6523, 4 },
+			{ 0, 0, 6527, 3 },
+			{ 0, 0, 6530, 18 },
+			{ 0, 0, 6548, 8 },
+			{ 0, 0, 6556, 4 },
+			{ 0, 0, 6560, 1 },
+			{ 0, 0, 6561, 1 },
+			{ 0, 0, 6562, 1 },
+			{ 0, 0, 6563, 1 },
+			{ 0, 0, 6564, 1 },
+			{ 0, 0, 6565, 1 },
+			{ 0, 0, 6566, 1 },
+			{ 0, 0, 6567, 1 },
+			{ 0, 0, 6568, 1 },
+			{ 0, 0, 6569, 3 },
+			{ 0, 0, 6572, 2 },
+			{ 0, 0, 6574, 1 },
+			{ 0, 0, 6575, 1 },
+			{ 0, 0, 6576, 1 },
+			{ 0, 0, 6577, 1 },
+			{ 0, 0, 6578, 1 },
+			{ 0, 0, 6579, 1 },
+			{ 0, 0, 6580, 1 },
+			{ 0, 0, 6581, 1 },
+			{ 0, 0, 6582, 1 },
+			{ 0, 0, 6583, 1 },
+			{ 0, 0, 6584, 1 },
+			{ 0, 0, 6585, 1 },
+			{ 0, 0, 6586, 1 },
+			{ 0, 0, 6587, 1 },
+			{ 0, 0, 6588, 1 },
+			{ 0, 0, 6589, 1 },
+			{ 0, 0, 6590, 1 },
+			{ 0, 0, 6591, 1 },
+			{ 0, 0, 6592, 1 },
+			{ 0, 0, 6593, 1 },
+			{ 0, 0, 6594, 1 },
+			{ 0, 0, 6595, 1 },
+			{ 0, 0, 6596, 2 },
+			{ 0, 0, 6598, 2 },
+			{ 0, 0, 6600, 2 },
+			{ 0, 0, 6602, 2 },
+			{ 0, 0, 6604, 1 },
+			{ 0, 0, 6605, 1 },
+			{ 0, 0, 6606, 1 },
+			{ 0, 0, 6607, 1 },
+			{ 0, 0, 6608, 1 },
+			{ 0, 0, 6609, 1 },
+			{ 0, 0, 6610, 1 },
+			{ 0, 0, 6611, 1 },
+			{ 0, 0, 6612, 1 },
+			{ 0, 0, 6613, 1 },
+			{ 0, 0, 6614, 1 },
+			{ 0, 0, 6615, 1 },
+			{ 0, 0, 6616, 1 },
+			{ 0, 0, 6617, 1 },
+			{ 0, 0, 6618, 1 },
+			{ 0, 0, 6619, 1 },
+			{ 0, 0, 6620, 1 },
+			{ 0, 0, 6621, 1 },
+			{ 0, 0, 6622, 1 },
+			{ 0, 0, 6623, 1 },
+			{ 0, 0, 6624, 1 },
+			{ 0, 0, 6625, 1 },
+			{ 0, 0, 6626, 1 },
+			{ 0, 0, 6627, 1 },
+			{ 0, 0, 6628, 1 },
+			{ 0, 0, 6629, 1 },
+			{ 0, 0, 6630, 1 },
+			{ 0, 0, 6631, 1 },
+			{ 0, 0, 6632, 1 },
+			{ 0, 0, 6633, 2 },
+			{ 0, 0, 6635, 2 },
+			{ 0, 0, 6637, 2 },
+			{ 0, 0, 6639, 2 },
+			{ 0, 0, 6641, 2 },
+			{ 0, 0, 6643, 2 },
+			{ 0, 0, 6645, 2 },
+			{ 0, 0, 6647, 2 },
+			{ 0, 0, 6649, 2 },
+			{ 0, 0, 6651, 2 },
+			{ 0, 0, 6653, 2 },
+			{ 0, 0, 6655, 2 },
+			{ 0, 0, 6657, 2 },
+			{ 0, 0, 6659, 2 },
+			{ 0, 0, 6661, 1 },
+			{ 0, 0, 6662, 2 },
+			{ 0, 0, 6664, 2 },
+			{ 0, 0, 6666, 2 },
+			{ 0, 0, 6668, 2 },
+			{ 0, 0, 6670, 2 },
+			{ 0, 0, 6672, 2 },
+			{ 0, 0, 6674, 2 },
+			{ 0, 0, 6676, 2 },
+			{ 0, 0, 6678, 2 },
+			{ 0, 0, 6680, 2 },
+			{ 0, 0, 6682, 2 },
+			{ 0, 0, 6684, 2 },
+			{ 0, 0, 6686, 1 },
+			{ 0, 0, 6687, 1 },
+			{ 0, 0, 6688, 1 },
+			{ 0, 0, 6689, 1 },
+			{ 0, 0, 6690, 1 },
+			{ 0, 0, 6691, 1 },
+			{ 0, 0, 6692, 1 },
+			{ 0, 0, 6693, 1 },
+			{ 0, 0, 6694, 1 },
+			{ 0, 0, 6695, 1 },
+			{ 0, 0, 6696, 1 },
+			{ 0, 0, 6697, 1 },
+			{ 0, 0, 6698, 1 },
+			{ 0, 0, 6699, 1 },
+			{ 0, 0, 6700, 1 },
+			{ 0, 0, 6701, 1 },
+			{ 0, 0, 6702, 1 },
+			{ 0, 0, 6703, 1 },
+			{ 0, 0, 6704, 1 },
+			{ 0, 0, 6705, 1 },
+			{ 0, 0, 6706, 1 },
+			{ 0, 0, 6707, 1 },
+			{ 0, 0, 6708, 1 },
+			{ 0, 0, 6709, 1 },
+			{ 0, 0, 6710, 1 },
+			{ 0, 0, 6711, 1 },
+			{ 0, 0, 6712, 1 },
+			{ 0, 0, 6713, 1 },
+			{ 0, 0, 6714, 1 },
+			{ 0, 0, 6715, 1 },
+			{ 0, 0, 6716, 1 },
+			{ 0, 0, 6717, 1 },
+			{ 0, 0, 6718, 1 },
+			{ 0, 0, 6719, 1 },
+			{ 0, 0, 6720, 1 },
+			{ 0, 0, 6721, 1 },
+			{ 0, 0, 6722, 1 },
+			{ 0, 0, 6723, 1 },
+			{ 0, 0, 6724, 1 },
+			{ 0, 0, 6725, 1 },
+			{ 0, 0, 6726, 1 },
+			{ 0, 0, 6727, 1 },
+			{ 0, 0, 6728, 1 },
+			{ 0, 0, 6729, 1 },
+			{ 0, 0, 6730, 1 },
+			{ 0, 0, 6731, 1 },
+			{ 0, 0, 6732, 1 },
+			{ 0, 0, 6733, 1 },
+			{ 0, 0, 6734, 1 },
+			{ 0, 0, 6735, 1 },
+			{ 0, 0, 6736, 1 },
+			{ 0, 0, 6737, 1 },
+			{ 0, 0, 6738, 1 },
+			{ 0, 0, 6739, 1 },
+			{ 0, 0, 6740, 1 },
+			{ 0, 0, 6741, 1 },
+			{ 0, 0, 6742, 1 },
+			{ 0, 0, 6743, 1 },
+			{ 0, 0, 6744, 1 },
+			{ 0, 0, 6745, 1 },
+			{ 0, 0, 6746, 1 },
+			{ 0, 0, 6747, 1 },
+			{ 0, 0, 6748, 1 },
+			{ 0, 0, 6749, 1 },
+			{ 0, 0, 6750, 1 },
+			{ 0, 0, 6751, 1 },
+			{ 0, 0, 6752, 1 },
+			{ 0, 0, 6753, 1 },
+			{ 0, 0, 6754, 1 },
+			{ 0, 0, 6755, 1 },
+			{ 0, 0, 6756, 1 },
+			{ 0, 0, 6757, 1 },
+			{ 0, 0, 6758, 1 },
+			{ 0, 0, 6759, 1 },
+			{ 0, 0, 6760, 1 },
+			{ 0, 0, 6761, 1 },
+			{ 0, 0, 6762, 1 },
+			{ 0, 0, 6763, 1 },
+			{ 0, 0, 6764, 1 },
+			{ 0, 0, 6765, 1 },
+			{ 0, 0, 6766, 1 },
+			{ 0, 0, 6767, 1 },
+			{ 0, 0, 6768, 1 },
+			{ 0, 0, 6769, 1 },
+			{ 0, 0, 6770, 1 },
+			{ 0, 0, 6771, 1 },
+			{ 0, 0, 6772, 1 },
+			{ 0, 0, 6773, 1 },
+			{ 0, 0, 6774, 1 },
+			{ 0, 0, 6775, 1 },
+			{ 0, 0, 6776, 1 },
+			{ 0, 0, 6777, 1 },
+			{ 0, 0, 6778, 1 },
+			{ 0, 0, 6779, 1 },
+			{ 0, 0, 6780, 1 },
+			{ 0, 0, 6781, 1 },
+			{ 0, 0, 6782, 1 },
+			{ 0, 0, 6783, 1 },
+			{ 0, 0, 6784, 1 },
+			{ 0, 0, 6785, 1 },
+			{ 0, 0, 6786, 1 },
+			{ 0, 0, 6787, 1 },
+			{ 0, 0, 6788, 1 },
+			{ 0, 0, 6789, 1 },
+			{ 0, 0, 6790, 3 },
+			{ 0, 0, 6793, 3 },
+			{ 0, 0, 6796, 3 },
+			{ 0, 0, 6799, 3 },
+			{ 0, 0, 6802, 3 },
+			{ 0, 0, 6805, 3 },
+			{ 0, 0, 6808, 2 },
+			{ 0, 0, 6810, 2 },
+			{ 0, 0, 6812, 1 },
+			{ 0, 0, 6813, 1 },
+			{ 0, 0, 6814, 1 },
+			{ 0, 0, 6815, 1 },
+			{ 0, 0, 6816, 1 },
+			{ 0, 0, 6817, 1 },
+			{ 0, 0, 6818, 1 },
+			{ 0, 0, 6819, 1 },
+			{ 0, 0, 6820, 1 },
+			{ 0, 0, 6821, 1 },
+			{ 0, 0, 6822, 1 },
+			{ 0, 0, 6823, 1 },
+			{ 0, 0, 6824, 1 },
+			{ 0, 0, 6825, 1 },
+			{ 0, 0, 6826, 1 },
+			{ 0, 0, 6827, 1 },
+			{ 0, 0, 6828, 1 },
+			{ 0, 0, 6829, 1 },
+			{ 0, 0, 6830, 1 },
+			{ 0, 0, 6831, 1 },
+			{ 0, 0, 6832, 1 },
+			{ 0, 0, 6833, 1 },
+			{ 0, 0, 6834, 1 },
+			{ 0, 0, 6835, 1 },
+			{ 0, 0, 6836, 1 },
+			{ 0, 0, 6837, 1 },
+			{ 0, 0, 6838, 1 },
+			{ 0, 0, 6839, 1 },
+			{ 0, 0, 6840, 1 },
+			{ 0, 0, 6841, 1 },
+			{ 0, 0, 6842, 1 },
+			{ 0, 0, 6843, 1 },
+			{ 0, 0, 6844, 1 },
+			{ 0, 0, 6845, 1 },
+			{ 0, 0, 6846, 1 },
+			{ 0, 0, 6847, 1 },
+			{ 0, 0, 6848, 1 },
+			{ 0, 0, 6849, 1 },
+			{ 0, 0, 6850, 1 },
+			{ 0, 0, 6851, 1 },
+			{ 0, 0, 6852, 1 },
+			{ 0, 0, 6853, 1 },
+			{ 0, 0, 6854, 1 },
+			{ 0, 0, 6855, 1 },
+			{ 0, 0, 6856, 1 },
+			{ 0, 0, 6857, 1 },
+			{ 0, 0, 6858, 1 },
+			{ 0, 0, 6859, 1 },
+			{ 0, 0, 6860, 1 },
+			{ 0, 0, 6861, 1 },
+			{ 0, 0, 6862, 1 },
+			{ 0, 0, 6863, 1 },
+			{ 0, 0, 6864, 1 },
+			{ 0, 0, 6865, 1 },
+			{ 0, 0, 6866, 1 },
+			{ 0, 0, 6867, 1 },
+			{ 0, 0, 6868, 1 },
+			{ 0, 0, 6869, 1 },
+			{ 0, 0, 6870, 1 },
+			{ 0, 0, 6871, 1 },
+			{ 0, 0, 6872, 1 },
+			{ 0, 0, 6873, 1 },
+			{ 0, 0, 6874, 1 },
+			{ 0, 0, 6875, 1 },
+			{ 0, 0, 6876, 1 },
+			{ 0, 0, 6877, 1 },
+			{ 0, 0, 6878, 1 },
+			{ 0, 0, 6879, 1 },
+			{ 0, 0, 6880, 1 },
+			{ 0, 0, 6881, 1 },
+			{ 0, 0, 6882, 1 },
+			{ 0, 0, 6883, 1 },
+			{ 0, 0, 6884, 1 },
+			{ 0, 0, 6885, 1 },
+			{ 0, 0, 6886, 1 },
+			{ 0, 0, 6887, 1 },
+			{ 0, 0, 6888, 1 },
+			{ 0, 0, 6889, 1 },
+			{ 0, 0, 6890, 1 },
+			{ 0, 0, 6891, 1 },
+			{ 0, 0, 6892, 1 },
+			{ 0, 0, 6893, 1 },
+			{ 0, 0, 6894, 1 },
+			{ 0, 0, 6895, 1 },
+			{ 0, 0, 6896, 1 },
+			{ 0, 0, 6897, 1 },
+			{ 0, 0, 6898, 1 },
+			{ 0, 0, 6899, 1 },
+			{ 0, 0, 6900, 1 },
+			{ 0, 0, 6901, 1 },
+			{ 0, 0, 6902, 1 },
+			{ 0, 0, 6903, 1 },
+			{ 0, 0, 6904, 1 },
+			{ 0, 0, 6905, 1 },
+			{ 0, 0, 6906, 1 },
+			{ 0, 0, 6907, 1 },
+			{ 0, 0, 6908, 1 },
+			{ 0, 0, 6909, 1 },
+			{ 0, 0, 6910, 1 },
+			{ 0, 0, 6911, 1 },
+			{ 0, 0, 6912, 1 },
+			{ 0, 0, 6913, 1 },
+			{ 0, 0, 6914, 1 },
+			{ 0, 0, 6915, 1 },
+			{ 0, 0, 6916, 1 },
+			{ 0, 0, 6917, 1 },
+			{ 0, 0, 6918, 1 },
+			{ 0, 0, 6919, 1 },
+			{ 0, 0, 6920, 1 },
+			{ 0, 0, 6921, 1 },
+			{ 0, 0, 6922, 1 },
+			{ 0, 0, 6923, 1 },
+			{ 0, 0, 6924, 1 },
+			{ 0, 0, 6925, 1 },
+			{ 0, 0, 6926, 1 },
+			{ 0, 0, 6927, 1 },
+			{ 0, 0, 6928, 1 },
+			{ 0, 0, 6929, 1 },
+			{ 0, 0, 6930, 1 },
+			{ 0, 0, 6931, 1 },
+			{ 0, 0, 6932, 1 },
+			{ 0, 0, 6933, 1 },
+			{ 0, 0, 6934, 1 },
+			{ 0, 0, 6935, 1 },
+			{ 0, 0, 6936, 1 },
+			{ 0, 0, 6937, 1 },
+			{ 0, 0, 6938, 1 },
+			{ 0, 0, 6939, 1 },
+			{ 0, 0, 6940, 1 },
+			{ 0, 0, 6941, 1 },
+			{ 0, 0, 6942, 1 },
+			{ 0, 0, 6943, 1 },
+			{ 0, 0, 6944, 1 },
+			{ 0, 0, 6945, 1 },
+			{ 0, 0, 6946, 1 },
+			{ 0, 0, 6947, 1 },
+			{ 0, 0, 6948, 1 },
+			{ 0, 0, 6949, 1 },
+			{ 0, 0, 6950, 1 },
+			{ 0, 0, 6951, 1 },
+			{ 0, 0, 6952, 1 },
+			{ 0, 0, 6953, 1 },
+			{ 0, 0, 6954, 1 },
+			{ 0, 0, 6955, 1 },
+			{ 0, 0, 6956, 1 },
+			{ 0, 0, 6957, 1 },
+			{ 0, 0, 6958, 1 },
+			{ 0, 0, 6959, 1 },
+			{ 0, 0, 6960, 1 },
+			{ 0, 0, 6961, 1 },
+			{ 0, 0, 6962, 1 },
+			{ 0, 0, 6963, 1 },
+			{ 0, 0, 6964, 1 },
+			{ 0, 0, 6965, 1 },
+			{ 0, 0, 6966, 1 },
+			{ 0, 0, 6967, 1 },
+			{ 0, 0, 6968, 1 },
+			{ 0, 0, 6969, 1 },
+			{ 0, 0, 6970, 1 },
+			{ 0, 0, 6971, 1 },
+			{ 0, 0, 6972, 1 },
+			{ 0, 0, 6973, 1 },
+			{ 0, 0, 6974, 1 },
+			{ 0, 0, 6975, 1 },
+			{ 0, 0, 6976, 1 },
+			{ 0, 0, 6977, 1 },
+			{ 0, 0, 6978, 1 },
+			{ 0, 0, 6979, 1 },
+			{ 0, 0, 6980, 1 },
+			{ 0, 0, 6981, 1 },
+			{ 0, 0, 6982, 1 },
+			{ 0, 0, 6983, 1 },
+			{ 0, 0, 6984, 1 },
+			{ 0, 0, 6985, 1 },
+			{ 0, 0, 6986, 1 },
+			{ 0, 0, 6987, 1 },
+			{ 0, 0, 6988, 1 },
+			{ 0, 0, 6989, 1 },
+			{ 0, 0, 6990, 1 },
+			{ 0, 0, 6991, 1 },
+			{ 0, 0, 6992, 1 },
+			{ 0, 0, 6993, 1 },
+			{ 0, 0, 6994, 1 },
+			{ 0, 0, 6995, 1 },
+			{ 0, 0, 6996, 1 },
+			{ 0, 0, 6997, 1 },
+			{ 0, 0, 6998, 1 },
+			{ 0, 0, 6999, 1 },
+			{ 0, 0, 7000, 1 },
+			{ 0, 0, 7001, 1 },
+			{ 0, 0, 7002, 1 },
+			{ 0, 0, 7003, 1 },
+			{ 0, 0, 7004, 1 },
+			{ 0, 0, 7005, 1 },
+			{ 0, 0, 7006, 1 },
+			{ 0, 0, 7007, 1 },
+			{ 0, 0, 7008, 1 },
+			{ 0, 0, 7009, 1 },
+			{ 0, 0, 7010, 1 },
+			{ 0, 0, 7011, 1 },
+			{ 0, 0, 7012, 1 },
+			{ 0, 0, 7013, 1 },
+			{ 0, 0, 7014, 1 },
+			{ 0, 0, 7015, 1 },
+			{ 0, 0, 7016, 1 },
+			{ 0, 0, 7017, 1 },
+			{ 0, 0, 7018, 1 },
+			{ 0, 0, 7019, 1 },
+			{ 0, 0, 7020, 1 },
+			{ 0, 0, 7021, 1 },
+			{ 0, 0, 7022, 1 },
+			{ 0, 0, 7023, 1 },
+			{ 0, 0, 7024, 1 },
+			{ 0, 0, 7025, 1 },
+			{ 0, 0, 7026, 2 },
+			{ 0, 0, 7028, 1 },
+			{ 0, 0, 7029, 1 },
+			{ 0, 0, 7030, 1 },
+			{ 0, 0, 7031, 1 },
+			{ 0, 0, 7032, 1 },
+			{ 0, 0, 7033, 1 },
+			{ 0, 0, 7034, 1 },
+			{ 0, 0, 7035, 1 },
+			{ 0, 0, 7036, 1 },
+			{ 0, 0, 7037, 1 },
+			{ 0, 0, 7038, 1 },
+			{ 0, 0, 7039, 1 },
+			{ 0, 0, 7040, 1 },
+			{ 0, 0, 7041, 1 },
+			{ 0, 0, 7042, 1 },
+			{ 0, 0, 7043, 1 },
+			{ 0, 0, 7044, 1 },
+			{ 0, 0, 7045, 1 },
+			{ 0, 0, 7046, 1 },
+			{ 0, 0, 7047, 1 },
+			{ 0, 0, 7048, 1 },
+			{ 0, 0, 7049, 1 },
+			{ 0, 0, 7050, 1 },
+			{ 0, 0, 7051, 1 },
+			{ 0, 0, 7052, 1 },
+			{ 0, 0, 7053, 1 },
+			{ 0, 0, 7054, 1 },
+			{ 0, 0, 7055, 1 },
+			{ 0, 0, 7056, 1 },
+			{ 0, 0, 7057, 1 },
+			{ 0, 0, 7058, 1 },
+			{ 0, 0, 7059, 1 },
+			{ 0, 0, 7060, 1 },
+			{ 0, 0, 7061, 1 },
+			{ 0, 0, 7062, 1 },
+			{ 0, 0, 7063, 1 },
+			{ 0, 0, 7064, 1 },
+			{ 0, 0, 7065, 1 },
+			{ 0, 0, 7066, 1 },
+			{ 0, 0, 7067, 1 },
+			{ 0, 0, 7068, 1 },
+			{ 0, 0, 7069, 1 },
+			{ 0, 0, 7070, 1 },
+			{ 0, 0, 7071, 1 },
+			{ 0, 0, 7072, 1 },
+			{ 0, 0, 7073, 1 },
+			{ 0, 0, 7074, 1 },
+			{ 0, 0, 7075, 1 },
+			{ 0, 0, 7076, 1 },
+			{ 0, 0, 7077, 1 },
+			{ 0, 0, 7078, 1 },
+			{ 0, 0, 7079, 1 },
+			{ 0, 0, 7080, 1 },
+			{ 0, 0, 7081, 1 },
+			{ 0, 0, 7082, 1 },
+			{ 0, 0, 7083, 1 },
+			{ 0, 0, 7084, 1 },
+			{ 0, 0, 7085, 1 },
+			{ 0, 0, 7086, 1 },
+			{ 0, 0, 7087, 1 },
+			{ 0, 0, 7088, 1 },
+			{ 0, 0, 7089, 1 },
+			{ 0, 0, 7090, 1 },
+			{ 0, 0, 7091, 1 },
+			{ 0, 0, 7092, 1 },
+			{ 0, 0, 7093, 1 },
+			{ 7094, 2, 7094, 2 },
+			{ 7096, 2, 7096, 2 },
+			{ 7098, 2, 7098, 2 },
+			{ 7100, 2, 7100, 2 },
+			{ 7102, 2, 7102, 2 },
+			{ 7104, 2, 7104, 2 },
+			{ 7106, 2, 7106, 2 },
+			{ 7108, 2, 7108, 2 },
+			{ 7110, 2, 7110, 2 },
+			{ 7112, 2, 7112, 2 },
+			{ 7114, 2, 7114, 2 },
+			{ 7116, 2, 7116, 2 },
+			{ 7118, 2, 7118, 2 },
+			{ 7120, 2, 7120, 2 },
+			{ 7122, 2, 7122, 2 },
+			{ 7124, 3, 7124, 3 },
+			{ 7127, 3, 7127, 3 },
+			{ 7130, 3, 7130, 3 },
+			{ 7133, 3, 7133, 3 },
+			{ 7136, 3, 7136, 3 },
+			{ 7139, 2, 7139, 2 },
+			{ 7141, 2, 7141, 2 },
+			{ 7143, 3, 7143, 3 },
+			{ 7146, 3, 7146, 3 },
+			{ 7149, 3, 7149, 3 },
+			{ 7152, 3, 7152, 3 },
+			{ 0, 0, 7155, 1 },
+			{ 0, 0, 7156, 1 },
+			{ 0, 0, 7157, 1 },
+			{ 0, 0, 7158, 1 },
+			{ 0, 0, 7159, 1 },
+			{ 0, 0, 7160, 1 },
+			{ 0, 0, 7161, 1 },
+			{ 0, 0, 7162, 1 },
+			{ 0, 0, 7163, 1 },
+			{ 0, 0, 7164, 1 },
+			{ 0, 0, 7165, 1 },
+			{ 0, 0, 7166, 1 },
+			{ 0, 0, 7167, 1 },
+			{ 0, 0, 7168, 1 },
+			{ 0, 0, 7169, 1 },
+			{ 0, 0, 7170, 1 },
+			{ 0, 0, 7171, 1 },
+			{ 0, 0, 7172, 1 },
+			{ 0, 0, 7173, 1 },
+			{ 0, 0, 7174, 1 },
+			{ 0, 0, 7175, 1 },
+			{ 0, 0, 7176, 1 },
+			{ 0, 0, 7177, 1 },
+			{ 0, 0, 7178, 1 },
+			{ 0, 0, 7179, 1 },
+			{ 0, 0, 7180, 1 },
+			{ 0, 0, 7181, 1 },
+			{ 0, 0, 7182, 1 },
+			{ 0, 0, 7183, 1 },
+			{ 0, 0, 7184, 1 },
+			{ 0, 0, 7185, 1 },
+			{ 0, 0, 7186, 1 },
+			{ 0, 0, 7187, 1 },
+			{ 0, 0, 7188, 1 },
+			{ 0, 0, 7189, 1 },
+			{ 0, 0, 7190, 1 },
+			{ 0, 0, 7191, 1 },
+			{ 0, 0, 7192, 1 },
+			{ 0, 0, 7193, 1 },
+			{ 0, 0, 7194, 1 },
+			{ 0, 0, 7195, 1 },
+			{ 0, 0, 7196, 1 },
+			{ 0, 0, 7197, 1 },
+			{ 0, 0, 7198, 1 },
+			{ 0, 0, 7199, 1 },
+			{ 0, 0, 7200, 1 },
+			{ 0, 0, 7201, 1 },
+			{ 0, 0, 7202, 1 },
+			{ 0, 0, 7203, 1 },
+			{ 0, 0, 7204, 1 },
+			{ 0, 0, 7205, 1 },
+			{ 0, 0, 7206, 1 },
+			{ 0, 0, 7207, 1 },
+			{ 0, 0, 7208, 1 },
+			{ 0, 0, 7209, 1 },
+			{ 0, 0, 7210, 1 },
+			{ 0, 0, 7211, 1 },
+			{ 0, 0, 7212, 1 },
+			{ 0, 0, 7213, 1 },
+			{ 0, 0, 7214, 1 },
+			{ 0, 0, 7215, 1 },
+			{ 0, 0, 7216, 1 },
+			{ 0, 0, 7217, 1 },
+			{ 0, 0, 7218, 1 },
+			{ 0, 0, 7219, 1 },
+			{ 0, 0, 7220, 1 },
+			{ 0, 0, 7221, 1 },
+			{ 0, 0, 7222, 1 },
+			{ 0, 0, 7223, 1 },
+			{ 0, 0, 7224, 1 },
+			{ 0, 0, 7225, 1 },
+			{ 0, 0, 7226, 1 },
+			{ 0, 0, 7227, 1 },
+			{ 0, 0, 7228, 1 },
+			{ 0, 0, 7229, 1 },
+			{ 0, 0, 7230, 1 },
+			{ 0, 0, 7231, 1 },
+			{ 0, 0, 7232, 1 },
+			{ 0, 0, 7233, 1 },
+			{ 0, 0, 7234, 1 },
+			{ 0, 0, 7235, 1 },
+			{ 0, 0, 7236, 1 },
+			{ 0, 0, 7237, 1 },
+			{ 0, 0, 7238, 1 },
+			{ 0, 0, 7239, 1 },
+			{ 0, 0, 7240, 1 },
+			{ 0, 0, 7241, 1 },
+			{ 0, 0, 7242, 1 },
+			{ 0, 0, 7243, 1 },
+			{ 0, 0, 7244, 1 },
+			{ 0, 0, 7245, 1 },
+			{ 0, 0, 7246, 1 },
+			{ 0, 0, 7247, 1 },
+			{ 0, 0, 7248, 1 },
+			{ 0, 0, 7249, 1 },
+			{ 0, 0, 7250, 1 },
+			{ 0, 0, 7251, 1 },
+			{ 0, 0, 7252, 1 },
+			{ 0, 0, 7253, 1 },
+			{ 0, 0, 7254, 1 },
+			{ 0, 0, 7255, 1 },
+			{ 0, 0, 7256, 1 },
+			{ 0, 0, 7257, 1 },
+			{ 0, 0, 7258, 1 },
+			{ 0, 0, 7259, 1 },
+			{ 0, 0, 7260, 1 },
+			{ 0, 0, 7261, 1 },
+			{ 0, 0, 7262, 1 },
+			{ 0, 0, 7263, 1 },
+			{ 0, 0, 7264, 1 },
+			{ 0, 0, 7265, 1 },
+			{ 0, 0, 7266, 1 },
+			{ 0, 0, 7267, 1 },
+			{ 0, 0, 7268, 1 },
+			{ 0, 0, 7269, 1 },
+			{ 0, 0, 7270, 1 },
+			{ 0, 0, 7271, 1 },
+			{ 0, 0, 7272, 1 },
+			{ 0, 0, 7273, 1 },
+			{ 0, 0, 7274, 1 },
+			{ 0, 0, 7275, 1 },
+			{ 0, 0, 7276, 1 },
+			{ 0, 0, 7277, 1 },
+			{ 0, 0, 7278, 1 },
+			{ 0, 0, 7279, 1 },
+			{ 0, 0, 7280, 1 },
+			{ 0, 0, 7281, 1 },
+			{ 0, 0, 7282, 1 },
+			{ 0, 0, 7283, 1 },
+			{ 0, 0, 7284, 1 },
+			{ 0, 0, 7285, 1 },
+			{ 0, 0, 7286, 1 },
+			{ 0, 0, 7287, 1 },
+			{ 0, 0, 7288, 1 },
+			{ 0, 0, 7289, 1 },
+			{ 0, 0, 7290, 1 },
+			{ 0, 0, 7291, 1 },
+			{ 0, 0, 7292, 1 },
+			{ 0, 0, 7293, 1 },
+			{ 0, 0, 7294, 1 },
+			{ 0, 0, 7295, 1 },
+			{ 0, 0, 7296, 1 },
+			{ 0, 0, 7297, 1 },
+			{ 0, 0, 7298, 1 },
+			{ 0, 0, 7299, 1 },
+			{ 0, 0, 7300, 1 },
+			{ 0, 0, 7301, 1 },
+			{ 0, 0, 7302, 1 },
+			{ 0, 0, 7303, 1 },
+			{ 0, 0, 7304, 1 },
+			{ 0, 0, 7305, 1 },
+			{ 0, 0, 7306, 1 },
+			{ 0, 0, 7307, 1 },
+			{ 0, 0, 7308, 1 },
+			{ 0, 0, 7309, 1 },
+			{ 0, 0, 7310, 1 },
+			{ 0, 0, 7311, 1 },
+			{ 0, 0, 7312, 1 },
+			{ 0, 0, 7313, 1 },
+			{ 0, 0, 7314, 1 },
+			{ 0, 0, 7315, 1 },
+			{ 0, 0, 7316, 1 },
+			{ 0, 0, 7317, 1 },
+			{ 0, 0, 7318, 1 },
+			{ 0, 0, 7319, 1 },
+			{ 0, 0, 7320, 1 },
+			{ 0, 0, 7321, 1 },
+			{ 0, 0, 7322, 1 },
+			{ 0, 0, 7323, 1 },
+			{ 0, 0, 7324, 1 },
+			{ 0, 0, 7325, 1 },
+			{ 0, 0, 7326, 1 },
+			{ 0, 0, 7327, 1 },
+			{ 0, 0, 7328, 1 },
+			{ 0, 0, 7329, 1 },
+			{ 0, 0, 7330, 1 },
+			{ 0, 0, 7331, 1 },
+			{ 0, 0, 7332, 1 },
+			{ 0, 0, 7333, 1 },
+			{ 0, 0, 7334, 1 },
+			{ 0, 0, 7335, 1 },
+			{ 0, 0, 7336, 1 },
+			{ 0, 0, 7337, 1 },
+			{ 0, 0, 7338, 1 },
+			{ 0, 0, 7339, 1 },
+			{ 0, 0, 7340, 1 },
+			{ 0, 0, 7341, 1 },
+			{ 0, 0, 7342, 1 },
+			{ 0, 0, 7343, 1 },
+			{ 0, 0, 7344, 1 },
+			{ 0, 0, 7345, 1 },
+			{ 0, 0, 7346, 1 },
+			{ 0, 0, 7347, 1 },
+			{ 0, 0, 7348, 1 },
+			{ 0, 0, 7349, 1 },
+			{ 0, 0, 7350, 1 },
+			{ 0, 0, 7351, 1 },
+			{ 0, 0, 7352, 1 },
+			{ 0, 0, 7353, 1 },
+			{ 0, 0, 7354, 1 },
+			{ 0, 0, 7355, 1 },
+			{ 0, 0, 7356, 1 },
+			{ 0, 0, 7357, 1 },
+			{ 0, 0, 7358, 1 },
+			{ 0, 0, 7359, 1 },
+			{ 0, 0, 7360, 1 },
+			{ 0, 0, 7361, 1 },
+			{ 0, 0, 7362, 1 },
+			{ 0, 0, 7363, 1 },
+			{ 0, 0, 7364, 1 },
+			{ 0, 0, 7365, 1 },
+			{ 0, 0, 7366, 1 },
+			{ 0, 0, 7367, 1 },
+			{ 0, 0, 7368, 1 },
+			{ 0, 0, 7369, 1 },
+			{ 0, 0, 7370, 1 },
+			{ 0, 0, 7371, 1 },
+			{ 0, 0, 7372, 1 },
+			{ 0, 0, 7373, 1 },
+			{ 0, 0, 7374, 1 },
+			{ 0, 0, 7375, 1 },
+			{ 0, 0, 7376, 1 },
+			{ 0, 0, 7377, 1 },
+			{ 0, 0, 7378, 1 },
+			{ 0, 0, 7379, 1 },
+			{ 0, 0, 7380, 1 },
+			{ 0, 0, 7381, 1 },
+			{ 0, 0, 7382, 1 },
+			{ 0, 0, 7383, 1 },
+			{ 0, 0, 7384, 1 },
+			{ 0, 0, 7385, 1 },
+			{ 0, 0, 7386, 1 },
+			{ 0, 0, 7387, 1 },
+			{ 0, 0, 7388, 1 },
+			{ 0, 0, 7389, 1 },
+			{ 0, 0, 7390, 1 },
+			{ 0, 0, 7391, 1 },
+			{ 0, 0, 7392, 1 },
+			{ 0, 0, 7393, 1 },
+			{ 0, 0, 7394, 1 },
+			{ 0, 0, 7395, 1 },
+			{ 0, 0, 7396, 1 },
+			{ 0, 0, 7397, 1 },
+			{ 0, 0, 7398, 1 },
+			{ 0, 0, 7399, 1 },
+			{ 0, 0, 7400, 1 },
+			{ 0, 0, 7401, 1 },
+			{ 0, 0, 7402, 1 },
+			{ 0, 0, 7403, 1 },
+			{ 0, 0, 7404, 1 },
+			{ 0, 0, 7405, 1 },
+			{ 0, 0, 7406, 1 },
+			{ 0, 0, 7407, 1 },
+			{ 0, 0, 7408, 1 },
+			{ 0, 0, 7409, 1 },
+			{ 0, 0, 7410, 1 },
+			{ 0, 0, 7411, 1 },
+			{ 0, 0, 7412, 1 },
+			{ 0, 0, 7413, 1 },
+			{ 0, 0, 7414, 1 },
+			{ 0, 0, 7415, 1 },
+			{ 0, 0, 7416, 1 },
+			{ 0, 0, 7417, 1 },
+			{ 0, 0, 7418, 1 },
+			{ 0, 0, 7419, 1 },
+			{ 0, 0, 7420, 1 },
+			{ 0, 0, 7421, 1 },
+			{ 0, 0, 7422, 1 },
+			{ 0, 0, 7423, 1 },
+			{ 0, 0, 7424, 1 },
+			{ 0, 0, 7425, 1 },
+			{ 0, 0, 7426, 1 },
+			{ 0, 0, 7427, 1 },
+			{ 0, 0, 7428, 1 },
+			{ 0, 0, 7429, 1 },
+			{ 0, 0, 7430, 1 },
+			{ 0, 0, 7431, 1 },
+			{ 0, 0, 7432, 1 },
+			{ 0, 0, 7433, 1 },
+			{ 0, 0, 7434, 1 },
+			{ 0, 0, 7435, 1 },
+			{ 0, 0, 7436, 1 },
+			{ 0, 0, 7437, 1 },
+			{ 0, 0, 7438, 1 },
+			{ 0, 0, 7439, 1 },
+			{ 0, 0, 7440, 1 },
+			{ 0, 0, 7441, 1 },
+			{ 0, 0, 7442, 1 },
+			{ 0, 0, 7443, 1 },
+			{ 0, 0, 7444, 1 },
+			{ 0, 0, 7445, 1 },
+			{ 0, 0, 7446, 1 },
+			{ 0, 0, 7447, 1 },
+			{ 0, 0, 7448, 1 },
+			{ 0, 0, 7449, 1 },
+			{ 0, 0, 7450, 1 },
+			{ 0, 0, 7451, 1 },
+			{ 0, 0, 7452, 1 },
+			{ 0, 0, 7453, 1 },
+			{ 0, 0, 7454, 1 },
+			{ 0, 0, 7455, 1 },
+			{ 0, 0, 7456, 1 },
+			{ 0, 0, 7457, 1 },
+			{ 0, 0, 7458, 1 },
+			{ 0, 0, 7459, 1 },
+			{ 0, 0, 7460, 1 },
+			{ 0, 0, 7461, 1 },
+			{ 0, 0, 7462, 1 },
+			{ 0, 0, 7463, 1 },
+			{ 0, 0, 7464, 1 },
+			{ 0, 0, 7465, 1 },
+			{ 0, 0, 7466, 1 },
+			{ 0, 0, 7467, 1 },
+			{ 0, 0, 7468, 1 },
+			{ 0, 0, 7469, 1 },
+			{ 0, 0, 7470, 1 },
+			{ 0, 0, 7471, 1 },
+			{ 0, 0, 7472, 1 },
+			{ 0, 0, 7473, 1 },
+			{ 0, 0, 7474, 1 },
+			{ 0, 0, 7475, 1 },
+			{ 0, 0, 7476, 1 },
+			{ 0, 0, 7477, 1 },
+			{ 0, 0, 7478, 1 },
+			{ 0, 0, 7479, 1 },
+			{ 0, 0, 7480, 1 },
+			{ 0, 0, 7481, 1 },
+			{ 0, 0, 7482, 1 },
+			{ 0, 0, 7483, 1 },
+			{ 0, 0, 7484, 1 },
+			{ 0, 0, 7485, 1 },
+			{ 0, 0, 7486, 1 },
+			{ 0, 0, 7487, 1 },
+			{ 0, 0, 7488, 1 },
+			{ 0, 0, 7489, 1 },
+			{ 0, 0, 7490, 1 },
+			{ 0, 0, 7491, 1 },
+			{ 0, 0, 7492, 1 },
+			{ 0, 0, 7493, 1 },
+			{ 0, 0, 7494, 1 },
+			{ 0, 0, 7495, 1 },
+			{ 0, 0, 7496, 1 },
+			{ 0, 0, 7497, 1 },
+			{ 0, 0, 7498, 1 },
+			{ 0, 0, 7499, 1 },
+			{ 0, 0, 7500, 1 },
+			{ 0, 0, 7501, 1 },
+			{ 0, 0, 7502, 1 },
+			{ 0, 0, 7503, 1 },
+			{ 0, 0, 7504, 1 },
+			{ 0, 0, 7505, 1 },
+			{ 0, 0, 7506, 1 },
+			{ 0, 0, 7507, 1 },
+			{ 0, 0, 7508, 1 },
+			{ 0, 0, 7509, 1 },
+			{ 0, 0, 7510, 1 },
+			{ 0, 0, 7511, 1 },
+			{ 0, 0, 7512, 1 },
+			{ 0, 0, 7513, 1 },
+			{ 0, 0, 7514, 1 },
+			{ 0, 0, 7515, 1 },
+			{ 0, 0, 7516, 1 },
+			{ 0, 0, 7517, 1 },
+			{ 0, 0, 7518, 1 },
+			{ 0, 0, 7519, 1 },
+			{ 0, 0, 7520, 1 },
+			{ 0, 0, 7521, 1 },
+			{ 0, 0, 7522, 1 },
+			{ 0, 0, 7523, 1 },
+			{ 0, 0, 7524, 1 },
+			{ 0, 0, 7525, 1 },
+			{ 0, 0, 7526, 1 },
+			{ 0, 0, 7527, 1 },
+			{ 0, 0, 7528, 1 },
+			{ 0, 0, 7529, 1 },
+			{ 0, 0, 7530, 1 },
+			{ 0, 0, 7531, 1 },
+			{ 0, 0, 7532, 1 },
+			{ 0, 0, 7533, 1 },
+			{ 0, 0, 7534, 1 },
+			{ 0, 0, 7535, 1 },
+			{ 0, 0, 7536, 1 },
+			{ 0, 0, 7537, 1 },
+			{ 0, 0, 7538, 1 },
+			{ 0, 0, 7539, 1 },
+			{ 0, 0, 7540, 1 },
+			{ 0, 0, 7541, 1 },
+			{ 0, 0, 7542, 1 },
+			{ 0, 0, 7543, 1 },
+			{ 0, 0, 7544, 1 },
+			{ 0, 0, 7545, 1 },
+			{ 0, 0, 7546, 1 },
+			{ 0, 0, 7547, 1 },
+			{ 0, 0, 7548, 1 },
+			{ 0, 0, 7549, 1 },
+			{ 0, 0, 7550, 1 },
+			{ 0, 0, 7551, 1 },
+			{ 0, 0, 7552, 1 },
+			{ 0, 0, 7553, 1 },
+			{ 0, 0, 7554, 1 },
+			{ 0, 0, 7555, 1 },
+			{ 0, 0, 7556, 1 },
+			{ 0, 0, 7557, 1 },
+			{ 0, 0, 7558, 1 },
+			{ 0, 0, 7559, 1 },
+			{ 0, 0, 7560, 1 },
+			{ 0, 0, 7561, 1 },
+			{ 0, 0, 7562, 1 },
+			{ 0, 0, 7563, 1 },
+			{ 0, 0, 7564, 1 },
+			{ 0, 0, 7565, 1 },
+			{ 0, 0, 7566, 1 },
+			{ 0, 0, 7567, 1 },
+			{ 0, 0, 7568, 1 },
+			{ 0, 0, 7569, 1 },
+			{ 0, 0, 7570, 1 },
+			{ 0, 0, 7571, 1 },
+			{ 0, 0, 7572, 1 },
+			{ 0, 0, 7573, 1 },
+			{ 0, 0, 7574, 1 },
+			{ 0, 0, 7575, 1 },
+			{ 0, 0, 7576, 1 },
+			{ 0, 0, 7577, 1 },
+			{ 0, 0, 7578, 1 },
+			{ 0, 0, 7579, 1 },
+			{ 0, 0, 7580, 1 },
+			{ 0, 0, 7581, 1 },
+			{ 0, 0, 7582, 1 },
+			{ 0, 0, 7583, 1 },
+			{ 0, 0, 7584, 1 },
+			{ 0, 0, 7585, 1 },
+			{ 0, 0, 7586, 1 },
+			{ 0, 0, 7587, 1 },
+			{ 0, 0, 7588, 1 },
+			{ 0, 0, 7589, 1 },
+			{ 0, 0, 7590, 1 },
+			{ 0, 0, 7591, 1 },
+			{ 0, 0, 7592, 1 },
+			{ 0, 0, 7593, 1 },
+			{ 0, 0, 7594, 1 },
+			{ 0, 0, 7595, 1 },
+			{ 0, 0, 7596, 1 },
+			{ 0, 0, 7597, 1 },
+			{ 0, 0, 7598, 1 },
+			{ 0, 0, 7599, 1 },
+			{ 0, 0, 7600, 1 },
+			{ 0, 0, 7601, 1 },
+			{ 0, 0, 7602, 1 },
+			{ 0, 0, 7603, 1 },
+			{ 0, 0, 7604, 1 },
+			{ 0, 0, 7605, 1 },
+			{ 0, 0, 7606, 1 },
+			{ 0, 0, 7607, 1 },
+			{ 0, 0, 7608, 1 },
+			{ 0, 0, 7609, 1 },
+			{ 0, 0, 7610, 1 },
+			{ 0, 0, 7611, 1 },
+			{ 0, 0, 7612, 1 },
+			{ 0, 0, 7613, 1 },
+			{ 0, 0, 7614, 1 },
+			{ 0, 0, 7615, 1 },
+			{ 0, 0, 7616, 1 },
+			{ 0, 0, 7617, 1 },
+			{ 0, 0, 7618, 1 },
+			{ 0, 0, 7619, 1 },
+			{ 0, 0, 7620, 1 },
+			{ 0, 0, 7621, 1 },
+			{ 0, 0, 7622, 1 },
+			{ 0, 0, 7623, 1 },
+			{ 0, 0, 7624, 1 },
+			{ 0, 0, 7625, 1 },
+			{ 0, 0, 7626, 1 },
+			{ 0, 0, 7627, 1 },
+			{ 0, 0, 7628, 1 },
+			{ 0, 0, 7629, 1 },
+			{ 0, 0, 7630, 1 },
+			{ 0, 0, 7631, 1 },
+			{ 0, 0, 7632, 1 },
+			{ 0, 0, 7633, 1 },
+			{ 0, 0, 7634, 1 },
+			{ 0, 0, 7635, 1 },
+			{ 0, 0, 7636, 1 },
+			{ 0, 0, 7637, 1 },
+			{ 0, 0, 7638, 1 },
+			{ 0, 0, 7639, 1 },
+			{ 0, 0, 7640, 1 },
+			{ 0, 0, 7641, 1 },
+			{ 0, 0, 7642, 1 },
+			{ 0, 0, 7643, 1 },
+			{ 0, 0, 7644, 1 },
+			{ 0, 0, 7645, 1 },
+			{ 0, 0, 7646, 1 },
+			{ 0, 0, 7647, 1 },
+			{ 0, 0, 7648, 1 },
+			{ 0, 0, 7649, 1 },
+			{ 0, 0, 7650, 1 },
+			{ 0, 0, 7651, 1 },
+			{ 0, 0, 7652, 1 },
+			{ 0, 0, 7653, 1 },
+			{ 0, 0, 7654, 1 },
+			{ 0, 0, 7655, 1 },
+			{ 0, 0, 7656, 1 },
+			{ 0, 0, 7657, 1 },
+			{ 0, 0, 7658, 1 },
+			{ 0, 0, 7659, 1 },
+			{ 0, 0, 7660, 1 },
+			{ 0, 0, 7661, 1 },
+			{ 0, 0, 7662, 1 },
+			{ 0, 0, 7663, 1 },
+			{ 0, 0, 7664, 1 },
+			{ 0, 0, 7665, 1 },
+			{ 0, 0, 7666, 1 },
+			{ 0, 0, 7667, 1 },
+			{ 0, 0, 7668, 1 },
+			{ 0, 0, 7669, 1 },
+			{ 0, 0, 7670, 1 },
+			{ 0, 0, 7671, 1 },
+			{ 0, 0, 7672, 1 },
+			{ 0, 0, 7673, 1 },
+			{ 0, 0, 7674, 1 },
+			{ 0, 0, 7675, 1 },
+			{ 0, 0, 7676, 1 },
+			{ 0, 0, 7677, 1 },
+			{ 0, 0, 7678, 1 },
+			{ 0, 0, 7679, 1 },
+			{ 0, 0, 7680, 1 },
+			{ 0, 0, 7681, 1 },
+			{ 0, 0, 7682, 1 },
+			{ 0, 0, 7683, 1 },
+			{ 0, 0, 7684, 1 },
+			{ 0, 0, 7685, 1 },
+			{ 0, 0, 7686, 1 },
+			{ 0, 0, 7687, 1 },
+			{ 0, 0, 7688, 1 },
+			{ 0, 0, 7689, 1 },
+			{ 0, 0, 7690, 1 },
+			{ 0, 0, 7691, 1 },
+			{ 0, 0, 7692, 1 },
+			{ 0, 0, 7693, 1 },
+			{ 0, 0, 7694, 1 },
+			{ 0, 0, 7695, 1 },
+			{ 0, 0, 7696, 1 },
+			{ 0, 0, 7697, 1 },
+			{ 0, 0, 7698, 1 },
+			{ 0, 0, 7699, 1 },
+			{ 0, 0, 7700, 1 },
+			{ 0, 0, 7701, 1 },
+			{ 0, 0, 7702, 1 },
+			{ 0, 0, 7703, 1 },
+			{ 0, 0, 7704, 1 },
+			{ 0, 0, 7705, 1 },
+			{ 0, 0, 7706, 1 },
+			{ 0, 0, 7707, 1 },
+			{ 0, 0, 7708, 1 },
+			{ 0, 0, 7709, 1 },
+			{ 0, 0, 7710, 1 },
+			{ 0, 0, 7711, 1 },
+			{ 0, 0, 7712, 1 },
+			{ 0, 0, 7713, 1 },
+			{ 0, 0, 7714, 1 },
+			{ 0, 0, 7715, 1 },
+			{ 0, 0, 7716, 1 },
+			{ 0, 0, 7717, 1 },
+			{ 0, 0, 7718, 1 },
+			{ 0, 0, 7719, 1 },
+			{ 0, 0, 7720, 1 },
+			{ 0, 0, 7721, 1 },
+			{ 0, 0, 7722, 1 },
+			{ 0, 0, 7723, 1 },
+			{ 0, 0, 7724, 1 },
+			{ 0, 0, 7725, 1 },
+			{ 0, 0, 7726, 1 },
+			{ 0, 0, 7727, 1 },
+			{ 0, 0, 7728, 1 },
+			{ 0, 0, 7729, 1 },
+			{ 0, 0, 7730, 1 },
+			{ 0, 0, 7731, 1 },
+			{ 0, 0, 7732, 1 },
+			{ 0, 0, 7733, 1 },
+			{ 0, 0, 7734, 1 },
+			{ 0, 0, 7735, 1 },
+			{ 0, 0, 7736, 1 },
+			{ 0, 0, 7737, 1 },
+			{ 0, 0, 7738, 1 },
+			{ 0, 0, 7739, 1 },
+			{ 0, 0, 7740, 1 },
+			{ 0, 0, 7741, 1 },
+			{ 0, 0, 7742, 1 },
+			{ 0, 0, 7743, 1 },
+			{ 0, 0, 7744, 1 },
+			{ 0, 0, 7745, 1 },
+			{ 0, 0, 7746, 1 },
+			{ 0, 0, 7747, 1 },
+			{ 0, 0, 7748, 1 },
+			{ 0, 0, 7749, 1 },
+			{ 0, 0, 7750, 1 },
+			{ 0, 0, 7751, 1 },
+			{ 0, 0, 7752, 1 },
+			{ 0, 0, 7753, 1 },
+			{ 0, 0, 7754, 1 },
+			{ 0, 0, 7755, 1 },
+			{ 0, 0, 7756, 1 },
+			{ 0, 0, 7757, 1 },
+			{ 0, 0, 7758, 1 },
+			{ 0, 0, 7759, 1 },
+			{ 0, 0, 7760, 1 },
+			{ 0, 0, 7761, 1 },
+			{ 0, 0, 7762, 1 },
+			{ 0, 0, 7763, 1 },
+			{ 0, 0, 7764, 1 },
+			{ 0, 0, 7765, 1 },
+			{ 0, 0, 7766, 1 },
+			{ 0, 0, 7767, 1 },
+			{ 0, 0, 7768, 1 },
+			{ 0, 0, 7769, 1 },
+			{ 0, 0, 7770, 1 },
+			{ 0, 0, 7771, 1 },
+			{ 0, 0, 7772, 1 },
+			{ 0, 0, 7773, 1 },
+			{ 0, 0, 7774, 1 },
+			{ 0, 0, 7775, 1 },
+			{ 0, 0, 7776, 1 },
+			{ 0, 0, 7777, 1 },
+			{ 0, 0, 7778, 1 },
+			{ 0, 0, 7779, 1 },
+			{ 0, 0, 7780, 1 },
+			{ 0, 0, 7781, 1 },
+			{ 0, 0, 7782, 1 },
+			{ 0, 0, 7783, 1 },
+			{ 0, 0, 7784, 1 },
+			{ 0, 0, 7785, 1 },
+			{ 0, 0, 7786, 1 },
+			{ 0, 0, 7787, 1 },
+			{ 0, 0, 7788, 1 },
+			{ 0, 0, 7789, 1 },
+			{ 0, 0, 7790, 1 },
+			{ 0, 0, 7791, 1 },
+			{ 0, 0, 7792, 1 },
+			{ 0, 0, 7793, 1 },
+			{ 0, 0, 7794, 1 },
+			{ 0, 0, 7795, 1 },
+			{ 0, 0, 7796, 1 },
+			{ 0, 0, 7797, 1 },
+			{ 0, 0, 7798, 1 },
+			{ 0, 0, 7799, 1 },
+			{ 0, 0, 7800, 1 },
+			{ 0, 0, 7801, 1 },
+			{ 0, 0, 7802, 1 },
+			{ 0, 0, 7803, 1 },
+			{ 0, 0, 7804, 1 },
+			{ 0, 0, 7805, 1 },
+			{ 0, 0, 7806, 1 },
+			{ 0, 0, 7807, 1 },
+			{ 0, 0, 7808, 1 },
+			{ 0, 0, 7809, 1 },
+			{ 0, 0, 7810, 1 },
+			{ 0, 0, 7811, 1 },
+			{ 0, 0, 7812, 1 },
+			{ 0, 0, 7813, 1 },
+			{ 0, 0, 7814, 1 },
+			{ 0, 0, 7815, 1 },
+			{ 0, 0, 7816, 1 },
+			{ 0, 0, 7817, 1 },
+			{ 0, 0, 7818, 1 },
+			{ 0, 0, 7819, 1 },
+			{ 0, 0, 7820, 1 },
+			{ 0, 0, 7821, 1 },
+			{ 0, 0, 7822, 1 },
+			{ 0, 0, 7823, 1 },
+			{ 0, 0, 7824, 1 },
+			{ 0, 0, 7825, 1 },
+			{ 0, 0, 7826, 1 },
+			{ 0, 0, 7827, 1 },
+			{ 0, 0, 7828, 1 },
+			{ 0, 0, 7829, 1 },
+			{ 0, 0, 7830, 1 },
+			{ 0, 0, 7831, 1 },
+			{ 0, 0, 7832, 1 },
+			{ 0, 0, 7833, 1 },
+			{ 0, 0, 7834, 1 },
+			{ 0, 0, 7835, 1 },
+			{ 0, 0, 7836, 1 },
+			{ 0, 0, 7837, 1 },
+			{ 0, 0, 7838, 1 },
+			{ 0, 0, 7839, 1 },
+			{ 0, 0, 7840, 1 },
+			{ 0, 0, 7841, 1 },
+			{ 0, 0, 7842, 1 },
+			{ 0, 0, 7843, 1 },
+			{ 0, 0, 7844, 1 },
+			{ 0, 0, 7845, 1 },
+			{ 0, 0, 7846, 1 },
+			{ 0, 0, 7847, 1 },
+			{ 0, 0, 7848, 1 },
+			{ 0, 0, 7849, 1 },
+			{ 0, 0, 7850, 1 },
+			{ 0, 0, 7851, 1 },
+			{ 0, 0, 7852, 1 },
+			{ 0, 0, 7853, 1 },
+			{ 0, 0, 7854, 1 },
+			{ 0, 0, 7855, 1 },
+			{ 0, 0, 7856, 1 },
+			{ 0, 0, 7857, 1 },
+			{ 0, 0, 7858, 1 },
+			{ 0, 0, 7859, 1 },
+			{ 0, 0, 7860, 1 },
+			{ 0, 0, 7861, 1 },
+			{ 0, 0, 7862, 1 },
+			{ 0, 0, 7863, 1 },
+			{ 0, 0, 7864, 1 },
+			{ 0, 0, 7865, 1 },
+			{ 0, 0, 7866, 1 },
+			{ 0, 0, 7867, 1 },
+			{ 0, 0, 7868, 1 },
+			{ 0, 0, 7869, 1 },
+			{ 0, 0, 7870, 1 },
+			{ 0, 0, 7871, 1 },
+			{ 0, 0, 7872, 1 },
+			{ 0, 0, 7873, 1 },
+			{ 0, 0, 7874, 1 },
+			{ 0, 0, 7875, 1 },
+			{ 0, 0, 7876, 1 },
+			{ 0, 0, 7877, 1 },
+			{ 0, 0, 7878, 1 },
+			{ 0, 0, 7879, 1 },
+			{ 0, 0, 7880, 1 },
+			{ 0, 0, 7881, 1 },
+			{ 0, 0, 7882, 1 },
+			{ 0, 0, 7883, 1 },
+			{ 0, 0, 7884, 1 },
+			{ 0, 0, 7885, 1 },
+			{ 0, 0, 7886, 1 },
+			{ 0, 0, 7887, 1 },
+			{ 0, 0, 7888, 1 },
+			{ 0, 0, 7889, 1 },
+			{ 0, 0, 7890, 1 },
+			{ 0, 0, 7891, 1 },
+			{ 0, 0, 7892, 1 },
+			{ 0, 0, 7893, 1 },
+			{ 0, 0, 7894, 1 },
+			{ 0, 0, 7895, 1 },
+			{ 0, 0, 7896, 1 },
+			{ 0, 0, 7897, 1 },
+			{ 0, 0, 7898, 1 },
+			{ 0, 0, 7899, 1 },
+			{ 0, 0, 7900, 1 },
+			{ 0, 0, 7901, 1 },
+			{ 0, 0, 7902, 1 },
+			{ 0, 0, 7903, 1 },
+			{ 0, 0, 7904, 1 },
+			{ 0, 0, 7905, 1 },
+			{ 0, 0, 7906, 1 },
+			{ 0, 0, 7907, 1 },
+			{ 0, 0, 7908, 1 },
+			{ 0, 0, 7909, 1 },
+			{ 0, 0, 7910, 1 },
+			{ 0, 0, 7911, 1 },
+			{ 0, 0, 7912, 1 },
+			{ 0, 0, 7913, 1 },
+			{ 0, 0, 7914, 1 },
+			{ 0, 0, 7915, 1 },
+			{ 0, 0, 7916, 1 },
+			{ 0, 0, 7917, 1 },
+			{ 0, 0, 7918, 1 },
+			{ 0, 0, 7919, 1 },
+			{ 0, 0, 7920, 1 },
+			{ 0, 0, 7921, 1 },
+			{ 0, 0, 7922, 1 },
+			{ 0, 0, 7923, 1 },
+			{ 0, 0, 7924, 1 },
+			{ 0, 0, 7925, 1 },
+			{ 0, 0, 7926, 1 },
+			{ 0, 0, 7927, 1 },
+			{ 0, 0, 7928, 1 },
+			{ 0, 0, 7929, 1 },
+			{ 0, 0, 7930, 1 },
+			{ 0, 0, 7931, 1 },
+			{ 0, 0, 7932, 1 },
+			{ 0, 0, 7933, 1 },
+			{ 0, 0, 7934, 1 },
+			{ 0, 0, 7935, 1 },
+			{ 0, 0, 7936, 1 },
+			{ 0, 0, 7937, 1 },
+			{ 0, 0, 7938, 1 },
+			{ 0, 0, 7939, 1 },
+			{ 0, 0, 7940, 1 },
+			{ 0, 0, 7941, 1 },
+			{ 0, 0, 7942, 1 },
+			{ 0, 0, 7943, 1 },
+			{ 0, 0, 7944, 1 },
+			{ 0, 0, 7945, 1 },
+			{ 0, 0, 7946, 1 },
+			{ 0, 0, 7947, 1 },
+			{ 0, 0, 7948, 1 },
+			{ 0, 0, 7949, 1 },
+			{ 0, 0, 7950, 1 },
+			{ 0, 0, 7951, 1 },
+			{ 0, 0, 7952, 1 },
+			{ 0, 0, 7953, 1 },
+			{ 0, 0, 7954, 1 },
+			{ 0, 0, 7955, 1 },
+			{ 0, 0, 7956, 1 },
+			{ 0, 0, 7957, 1 },
+			{ 0, 0, 7958, 1 },
+			{ 0, 0, 7959, 1 },
+			{ 0, 0, 7960, 1 },
+			{ 0, 0, 7961, 1 },
+			{ 0, 0, 7962, 1 },
+			{ 0, 0, 7963, 1 },
+			{ 0, 0, 7964, 1 },
+			{ 0, 0, 7965, 1 },
+			{ 0, 0, 7966, 1 },
+			{ 0, 0, 7967, 1 },
+			{ 0, 0, 7968, 1 },
+			{ 0, 0, 7969, 1 },
+			{ 0, 0, 7970, 1 },
+			{ 0, 0, 7971, 1 },
+			{ 0, 0, 7972, 1 },
+			{ 0, 0, 7973, 1 },
+			{ 0, 0, 7974, 1 },
+			{ 0, 0, 7975, 1 },
+			{ 0, 0, 7976, 1 },
+			{ 0, 0, 7977, 1 },
+			{ 0, 0, 7978, 1 },
+			{ 0, 0, 7979, 1 },
+			{ 0, 0, 7980, 1 },
+			{ 0, 0, 7981, 1 },
+			{ 0, 0, 7982, 1 },
+			{ 0, 0, 7983, 1 },
+			{ 0, 0, 7984, 1 },
+			{ 0, 0, 7985, 1 },
+			{ 0, 0, 7986, 1 },
+			{ 0, 0, 7987, 1 },
+			{ 0, 0, 7988, 1 },
+			{ 0, 0, 7989, 1 },
+			{ 0, 0, 7990, 1 },
+			{ 0, 0, 7991, 1 },
+			{ 0, 0, 7992, 1 },
+			{ 0, 0, 7993, 1 },
+			{ 0, 0, 7994, 1 },
+			{ 0, 0, 7995, 1 },
+			{ 0, 0, 7996, 1 },
+			{ 0, 0, 7997, 1 },
+			{ 0, 0, 7998, 1 },
+			{ 0, 0, 7999, 1 },
+			{ 0, 0, 8000, 1 },
+			{ 0, 0, 8001, 1 },
+			{ 0, 0, 8002, 1 },
+			{ 0, 0, 8003, 1 },
+			{ 0, 0, 8004, 1 },
+			{ 0, 0, 8005, 1 },
+			{ 0, 0, 8006, 1 },
+			{ 0, 0, 8007, 1 },
+			{ 0, 0, 8008, 1 },
+			{ 0, 0, 8009, 1 },
+			{ 0, 0, 8010, 1 },
+			{ 0, 0, 8011, 1 },
+			{ 0, 0, 8012, 1 },
+			{ 0, 0, 8013, 1 },
+			{ 0, 0, 8014, 1 },
+			{ 0, 0, 8015, 1 },
+			{ 0, 0, 8016, 1 },
+			{ 0, 0, 8017, 1 },
+			{ 0, 0, 8018, 1 },
+			{ 0, 0, 8019, 1 },
+			{ 0, 0, 8020, 1 },
+			{ 0, 0, 8021, 1 },
+			{ 0, 0, 8022, 1 },
+			{ 0, 0, 8023, 1 },
+			{ 0, 0, 8024, 1 },
+			{ 0, 0, 8025, 1 },
+			{ 0, 0, 8026, 1 },
+			{ 0, 0, 8027, 1 },
+			{ 0, 0, 8028, 1 },
+			{ 0, 0, 8029, 1 },
+			{ 0, 0, 8030, 1 },
+			{ 0, 0, 8031, 1 },
+			{ 0, 0, 8032, 1 },
+			{ 0, 0, 8033, 1 },
+			{ 0, 0, 8034, 1 },
+			{ 0, 0, 8035, 1 },
+			{ 0, 0, 8036, 1 },
+			{ 0, 0, 8037, 1 },
+			{ 0, 0, 8038, 1 },
+			{ 0, 0, 8039, 1 },
+			{ 0, 0, 8040, 1 },
+			{ 0, 0, 8041, 1 },
+			{ 0, 0, 8042, 1 },
+			{ 0, 0, 8043, 1 },
+			{ 0, 0, 8044, 1 },
+			{ 0, 0, 8045, 1 },
+			{ 0, 0, 8046, 1 },
+			{ 0, 0, 8047, 1 },
+			{ 0, 0, 8048, 1 },
+			{ 0, 0, 8049, 1 },
+			{ 0, 0, 8050, 1 },
+			{ 0, 0, 8051, 1 },
+			{ 0, 0, 8052, 1 },
+			{ 0, 0, 8053, 1 },
+			{ 0, 0, 8054, 1 },
+			{ 0, 0, 8055, 1 },
+			{ 0, 0, 8056, 1 },
+			{ 0, 0, 8057, 1 },
+			{ 0, 0, 8058, 1 },
+			{ 0, 0, 8059, 1 },
+			{ 0, 0, 8060, 1 },
+			{ 0, 0, 8061, 1 },
+			{ 0, 0, 8062, 1 },
+			{ 0, 0, 8063, 1 },
+			{ 0, 0, 8064, 1 },
+			{ 0, 0, 8065, 1 },
+			{ 0, 0, 8066, 1 },
+			{ 0, 0, 8067, 1 },
+			{ 0, 0, 8068, 1 },
+			{ 0, 0, 8069, 1 },
+			{ 0, 0, 8070, 1 },
+			{ 0, 0, 8071, 1 },
+			{ 0, 0, 8072, 1 },
+			{ 0, 0, 8073, 1 },
+			{ 0, 0, 8074, 1 },
+			{ 0, 0, 8075, 1 },
+			{ 0, 0, 8076, 1 },
+			{ 0, 0, 8077, 1 },
+			{ 0, 0, 8078, 1 },
+			{ 0, 0, 8079, 1 },
+			{ 0, 0, 8080, 1 },
+			{ 0, 0, 8081, 1 },
+			{ 0, 0, 8082, 1 },
+			{ 0, 0, 8083, 1 },
+			{ 0, 0, 8084, 1 },
+			{ 0, 0, 8085, 1 },
+			{ 0, 0, 8086, 1 },
+			{ 0, 0, 8087, 1 },
+			{ 0, 0, 8088, 1 },
+			{ 0, 0, 8089, 1 },
+			{ 0, 0, 8090, 1 },
+			{ 0, 0, 8091, 1 },
+			{ 0, 0, 8092, 1 },
+			{ 0, 0, 8093, 1 },
+			{ 0, 0, 8094, 1 },
+			{ 0, 0, 8095, 1 },
+			{ 0, 0, 8096, 1 },
+			{ 0, 0, 8097, 1 },
+			{ 0, 0, 8098, 1 },
+			{ 0, 0, 8099, 1 },
+			{ 0, 0, 8100, 1 },
+			{ 0, 0, 8101, 1 },
+			{ 0, 0, 8102, 1 },
+			{ 0, 0, 8103, 1 },
+			{ 0, 0, 8104, 1 },
+			{ 0, 0, 8105, 1 },
+			{ 0, 0, 8106, 1 },
+			{ 0, 0, 8107, 1 },
+			{ 0, 0, 8108, 1 },
+			{ 0, 0, 8109, 1 },
+			{ 0, 0, 8110, 1 },
+			{ 0, 0, 8111, 1 },
+			{ 0, 0, 8112, 1 },
+			{ 0, 0, 8113, 1 },
+			{ 0, 0, 8114, 1 },
+			{ 0, 0, 8115, 1 },
+			{ 0, 0, 8116, 1 },
+			{ 0, 0, 8117, 1 },
+			{ 0, 0, 8118, 1 },
+			{ 0, 0, 8119, 1 },
+			{ 0, 0, 8120, 1 },
+			{ 0, 0, 8121, 1 },
+			{ 0, 0, 8122, 1 },
+			{ 0, 0, 8123, 1 },
+			{ 0, 0, 8124, 1 },
+			{ 0, 0, 8125, 1 },
+			{ 0, 0, 8126, 1 },
+			{ 0, 0, 8127, 1 },
+			{ 0, 0, 8128, 1 },
+			{ 0, 0, 8129, 1 },
+			{ 0, 0, 8130, 1 },
+			{ 0, 0, 8131, 1 },
+			{ 0, 0, 8132, 1 },
+			{ 0, 0, 8133, 1 },
+			{ 0, 0, 8134, 1 },
+			{ 0, 0, 8135, 1 },
+			{ 0, 0, 8136, 1 },
+			{ 0, 0, 8137, 1 },
+			{ 0, 0, 8138, 1 },
+			{ 0, 0, 8139, 1 },
+			{ 0, 0, 8140, 1 },
+			{ 0, 0, 8141, 1 },
+			{ 0, 0, 8142, 1 },
+			{ 0, 0, 8143, 1 },
+			{ 0, 0, 8144, 1 },
+			{ 0, 0, 8145, 1 },
+			{ 0, 0, 8146, 1 },
+			{ 0, 0, 8147, 1 },
+			{ 0, 0, 8148, 1 },
+			{ 0, 0, 8149, 1 },
+			{ 0, 0, 8150, 1 },
+			{ 0, 0, 8151, 1 },
+			{ 0, 0, 8152, 1 },
+			{ 0, 0, 8153, 1 },
+			{ 0, 0, 8154, 1 },
+			{ 0, 0, 8155, 1 },
+			{ 0, 0, 8156, 1 },
+			{ 0, 0, 8157, 1 },
+			{ 0, 0, 8158, 1 },
+			{ 0, 0, 8159, 1 },
+			{ 0, 0, 8160, 1 },
+			{ 0, 0, 8161, 1 },
+			{ 0, 0, 8162, 1 },
+			{ 0, 0, 8163, 1 },
+			{ 0, 0, 8164, 1 },
+			{ 0, 0, 8165, 1 },
+			{ 0, 0, 8166, 1 },
+			{ 0, 0, 8167, 1 },
+			{ 0, 0, 8168, 1 },
+			{ 0, 0, 8169, 1 },
+			{ 0, 0, 8170, 1 },
+			{ 0, 0, 8171, 1 },
+			{ 0, 0, 8172, 1 },
+			{ 0, 0, 8173, 1 },
+			{ 0, 0, 8174, 1 },
+			{ 0, 0, 8175, 1 },
+			{ 0, 0, 8176, 1 },
+			{ 0, 0, 8177, 1 },
+			{ 0, 0, 8178, 1 },
+			{ 0, 0, 8179, 1 },
+			{ 0, 0, 8180, 1 },
+			{ 0, 0, 8181, 1 },
+			{ 0, 0, 8182, 1 },
+			{ 0, 0, 8183, 1 },
+			{ 0, 0, 8184, 1 },
+			{ 0, 0, 8185, 1 },
+			{ 0, 0, 8186, 1 },
+			{ 0, 0, 8187, 1 },
+			{ 0, 0, 8188, 1 },
+			{ 0, 0, 8189, 1 },
+			{ 0, 0, 8190, 1 },
+			{ 0, 0, 8191, 1 },
+			{ 0, 0, 8192, 1 },
+			{ 0, 0, 8193, 1 },
+			{ 0, 0, 8194, 1 },
+			{ 0, 0, 8195, 1 },
+			{ 0, 0, 8196, 1 },
+			{ 0, 0, 8197, 1 },
+			{ 0, 0, 8198, 1 },
+			{ 0, 0, 8199, 1 },
+			{ 0, 0, 8200, 1 },
+			{ 0, 0, 8201, 1 },
+			{ 0, 0, 8202, 1 },
+			{ 0, 0, 8203, 1 },
+			{ 0, 0, 8204, 1 },
+			{ 0, 0, 8205, 1 },
+			{ 0, 0, 8206, 1 },
+			{ 0, 0, 8207, 1 },
+			{ 0, 0, 8208, 1 },
+			{ 0, 0, 8209, 1 },
+			{ 0, 0, 8210, 1 },
+			{ 0, 0, 8211, 1 },
+			{ 0, 0, 8212, 1 },
+			{ 0, 0, 8213, 1 },
+			{ 0, 0, 8214, 1 },
+			{ 0, 0, 8215, 1 },
+			{ 0, 0, 8216, 1 },
+			{ 0, 0, 8217, 1 },
+			{ 0, 0, 8218, 1 },
+			{ 0, 0, 8219, 1 },
+			{ 0, 0, 8220, 1 },
+			{ 0, 0, 8221, 1 },
+			{ 0, 0, 8222, 1 },
+			{ 0, 0, 8223, 1 },
+			{ 0, 0, 8224, 1 },
+			{ 0, 0, 8225, 1 },
+			{ 0, 0, 8226, 1 },
+			{ 0, 0, 8227, 1 },
+			{ 0, 0, 8228, 1 },
+			{ 0, 0, 8229, 1 },
+			{ 0, 0, 8230, 1 },
+			{ 0, 0, 8231, 1 },
+			{ 0, 0, 8232, 1 },
+			{ 0, 0, 8233, 1 },
+			{ 0, 0, 8234, 1 },
+			{ 0, 0, 8235, 1 },
+			{ 0, 0, 8236, 1 },
+			{ 0, 0, 8237, 1 },
+			{ 0, 0, 8238, 1 },
+			{ 0, 0, 8239, 1 },
+			{ 0, 0, 8240, 1 },
+			{ 0, 0, 8241, 1 },
+			{ 0, 0, 8242, 1 },
+			{ 0, 0, 8243, 1 },
+			{ 0, 0, 8244, 1 },
+			{ 0, 0, 8245, 1 },
+			{ 0, 0, 8246, 1 },
+			{ 0, 0, 8247, 1 },
+			{ 0, 0, 8248, 1 },
+			{ 0, 0, 8249, 1 },
+			{ 0, 0, 8250, 1 },
+			{ 0, 0, 8251, 1 },
+			{ 0, 0, 8252, 1 },
+			{ 0, 0, 8253, 1 },
+			{ 0, 0, 8254, 1 },
+			{ 0, 0, 8255, 1 },
+			{ 0, 0, 8256, 1 },
+			{ 0, 0, 8257, 1 },
+			{ 0, 0, 8258, 1 },
+			{ 0, 0, 8259, 1 },
+			{ 0, 0, 8260, 1 },
+			{ 0, 0, 8261, 1 },
+			{ 0, 0, 8262, 1 },
+			{ 0, 0, 8263, 1 },
+			{ 0, 0, 8264, 1 },
+			{ 0, 0, 8265, 1 },
+			{ 0, 0, 8266, 1 },
+			{ 0, 0, 8267, 1 },
+			{ 0, 0, 8268, 1 },
+			{ 0, 0, 8269, 1 },
+			{ 0, 0, 8270, 1 },
+			{ 0, 0, 8271, 1 },
+			{ 0, 0, 8272, 1 },
+			{ 0, 0, 8273, 1 },
+			{ 0, 0, 8274, 1 },
+			{ 0, 0, 8275, 1 },
+			{ 0, 0, 8276, 1 },
+			{ 0, 0, 8277, 1 },
+			{ 0, 0, 8278, 1 },
+			{ 0, 0, 8279, 1 },
+			{ 0, 0, 8280, 1 },
+			{ 0, 0, 8281, 1 },
+			{ 0, 0, 8282, 1 },
+			{ 0, 0, 8283, 1 },
+			{ 0, 0, 8284, 1 },
+			{ 0, 0, 8285, 1 },
+			{ 0, 0, 8286, 1 },
+			{ 0, 0, 8287, 1 },
+			{ 0, 0, 8288, 1 },
+			{ 0, 0, 8289, 1 },
+			{ 0, 0, 8290, 1 },
+			{ 0, 0, 8291, 1 },
+			{ 0, 0, 8292, 2 },
+			{ 0, 0, 8294, 2 },
+			{ 0, 0, 8296, 2 },
+			{ 0, 0, 8298, 2 },
+			{ 0, 0, 8300, 2 },
+			{ 0, 0, 8302, 2 },
+			{ 0, 0, 8304, 2 },
+			{ 0, 0, 8306, 2 },
+			{ 0, 0, 8308, 2 },
+			{ 0, 0, 8310, 2 },
+			{ 0, 0, 8312, 2 },
+			{ 0, 0, 8314, 3 },
+			{ 0, 0, 8317, 3 },
+			{ 0, 0, 8320, 3 },
+			{ 0, 0, 8323, 3 },
+			{ 0, 0, 8326, 3 },
+			{ 0, 0, 8329, 3 },
+			{ 0, 0, 8332, 3 },
+			{ 0, 0, 8335, 3 },
+			{ 0, 0, 8338, 3 },
+			{ 0, 0, 8341, 3 },
+			{ 0, 0, 8344, 3 },
+			{ 0, 0, 8347, 3 },
+			{ 0, 0, 8350, 3 },
+			{ 0, 0, 8353, 3 },
+			{ 0, 0, 8356, 3 },
+			{ 0, 0, 8359, 3 },
+			{ 0, 0, 8362, 3 },
+			{ 0, 0, 8365, 3 },
+			{ 0, 0, 8368, 3 },
+			{ 0, 0, 8371, 3 },
+			{ 0, 0, 8374, 3 },
+			{ 0, 0, 8377, 3 },
+			{ 0, 0, 8380, 3 },
+			{ 0, 0, 8383, 3 },
+			{ 0, 0, 8386, 3 },
+			{ 0, 0, 8389, 3 },
+			{ 0, 0, 8392, 3 },
+			{ 0, 0, 8395, 1 },
+			{ 0, 0, 8396, 1 },
+			{ 0, 0, 8397, 2 },
+			{ 0, 0, 8399, 2 },
+			{ 0, 0, 8401, 1 },
+			{ 0, 0, 8402, 1 },
+			{ 0, 0, 8403, 1 },
+			{ 0, 0, 8404, 1 },
+			{ 0, 0, 8405, 1 },
+			{ 0, 0, 8406, 1 },
+			{ 0, 0, 8407, 1 },
+			{ 0, 0, 8408, 1 },
+			{ 0, 0, 8409, 1 },
+			{ 0, 0, 8410, 1 },
+			{ 0, 0, 8411, 1 },
+			{ 0, 0, 8412, 1 },
+			{ 0, 0, 8413, 1 },
+			{ 0, 0, 8414, 1 },
+			{ 0, 0, 8415, 1 },
+			{ 0, 0, 8416, 1 },
+			{ 0, 0, 8417, 1 },
+			{ 0, 0, 8418, 1 },
+			{ 0, 0, 8419, 1 },
+			{ 0, 0, 8420, 1 },
+			{ 0, 0, 8421, 1 },
+			{ 0, 0, 8422, 1 },
+			{ 0, 0, 8423, 1 },
+			{ 0, 0, 8424, 1 },
+			{ 0, 0, 8425, 1 },
+			{ 0, 0, 8426, 1 },
+			{ 0, 0, 8427, 2 },
+			{ 0, 0, 8429, 2 },
+			{ 0, 0, 8431, 2 },
+			{ 0, 0, 8433, 2 },
+			{ 0, 0, 8435, 3 },
+			{ 0, 0, 8438, 2 },
+			{ 0, 0, 8440, 2 },
+			{ 0, 0, 8442, 2 },
+			{ 0, 0, 8444, 2 },
+			{ 0, 0, 8446, 2 },
+			{ 0, 0, 8448, 2 },
+			{ 0, 0, 8450, 2 },
+			{ 0, 0, 8452, 1 },
+			{ 0, 0, 8453, 1 },
+			{ 0, 0, 8454, 1 },
+			{ 0, 0, 8455, 1 },
+			{ 0, 0, 8456, 2 },
+			{ 0, 0, 8458, 1 },
+			{ 0, 0, 8459, 1 },
+			{ 0, 0, 8460, 1 },
+			{ 0, 0, 8461, 1 },
+			{ 0, 0, 8462, 1 },
+			{ 0, 0, 8463, 1 },
+			{ 0, 0, 8464, 1 },
+			{ 0, 0, 8465, 1 },
+			{ 0, 0, 8466, 1 },
+			{ 0, 0, 8467, 1 },
+			{ 0, 0, 8468, 1 },
+			{ 0, 0, 8469, 1 },
+			{ 0, 0, 8470, 1 },
+			{ 0, 0, 8471, 1 },
+			{ 0, 0, 8472, 1 },
+			{ 0, 0, 8473, 1 },
+			{ 0, 0, 8474, 1 },
+			{ 0, 0, 8475, 1 },
+			{ 0, 0, 8476, 1 },
+			{ 0, 0, 8477, 1 },
+			{ 0, 0, 8478, 1 },
+			{ 0, 0, 8479, 1 },
+			{ 0, 0, 8480, 1 },
+			{ 0, 0, 8481, 1 },
+			{ 0, 0, 8482, 1 },
+			{ 0, 0, 8483, 1 },
+			{ 0, 0, 8484, 1 },
+			{ 0, 0, 8485, 1 },
+			{ 0, 0, 8486, 1 },
+			{ 0, 0, 8487, 1 },
+			{ 0, 0, 8488, 1 },
+			{ 0, 0, 8489, 1 },
+			{ 0, 0, 8490, 1 },
+			{ 0, 0, 8491, 1 },
+			{ 0, 0, 8492, 1 },
+			{ 0, 0, 8493, 1 },
+			{ 0, 0, 8494, 1 },
+			{ 0, 0, 8495, 1 },
+			{ 0, 0, 8496, 1 },
+			{ 0, 0, 8497, 1 },
+			{ 0, 0, 8498, 3 },
+			{ 0, 0, 8501, 3 },
+			{ 0, 0, 8504, 3 },
+			{ 0, 0, 8507, 3 },
+			{ 0, 0, 8510, 3 },
+			{ 0, 0, 8513, 3 },
+			{ 0, 0, 8516, 3 },
+			{ 0, 0, 8519, 3 },
+			{ 0, 0, 8522, 3 },
+			{ 0, 0, 8525, 1 },
+			{ 0, 0, 8526, 1 },
+			{ 0, 0, 8527, 1 },
+			{ 0, 0, 8528, 1 },
+			{ 0, 0, 8529, 1 },
+			{ 0, 0, 8530, 1 },
+			{ 0, 0, 8531, 1 },
+			{ 0, 0, 8532, 1 },
+			{ 0, 0, 8533, 1 },
+			{ 0, 0, 8534, 1 },
+			{ 0, 0, 8535, 1 },
+			{ 0, 0, 8536, 1 },
+			{ 8537, 1, 8537, 1 },
+			{ 8538, 1, 8538, 1 },
+			{ 8539, 1, 8539, 1 },
+			{ 8540, 1, 8540, 1 },
+			{ 8541, 1, 8541, 1 },
+			{ 8542, 1, 8542, 1 },
+			{ 8543, 1, 8543, 1 },
+			{ 8544, 1, 8544, 1 },
+			{ 8545, 1, 8545, 1 },
+			{ 8546, 1, 8546, 1 },
+			{ 8547, 1, 8547, 1 },
+			{ 8548, 1, 8548, 1 },
+			{ 8549, 1, 8549, 1 },
+			{ 8550, 1, 8550, 1 },
+			{ 8551, 1, 8551, 1 },
+			{ 8552, 1, 8552, 1 },
+			{ 8553, 1, 8553, 1 },
+			{ 8554, 1, 8554, 1 },
+			{ 8555, 1, 8555, 1 },
+			{ 8556, 1, 8556, 1 },
+			{ 8557, 1, 8557, 1 },
+			{ 8558, 1, 8558, 1 },
+			{ 8559, 1, 8559, 1 },
+			{ 8560, 1, 8560, 1 },
+			{ 8561, 1, 8561, 1 },
+			{ 8562, 1, 8562, 1 },
+			{ 8563, 1, 8563, 1 },
+			{ 8564, 1, 8564, 1 },
+			{ 8565, 1, 8565, 1 },
+			{ 8566, 1, 8566, 1 },
+			{ 8567, 1, 8567, 1 },
+			{ 8568, 1, 8568, 1 },
+			{ 8569, 1, 8569, 1 },
+			{ 8570, 1, 8570, 1 },
+			{ 8571, 1, 8571, 1 },
+			{ 8572, 1, 8572, 1 },
+			{ 8573, 1, 8573, 1 },
+			{ 8574, 1, 8574, 1 },
+			{ 8575, 1, 8575, 1 },
+			{ 8576, 1, 8576, 1 },
+			{ 8577, 1, 8577, 1 },
+			{ 8578, 1, 8578, 1 },
+			{ 8579, 1, 8579, 1 },
+			{ 8580, 1, 8580, 1 },
+			{ 8581, 1, 8581, 1 },
+			{ 8582, 1, 8582, 1 },
+			{ 8583, 1, 8583, 1 },
+			{ 8584, 1, 8584, 1 },
+			{ 8585, 1, 8585, 1 },
+			{ 8586, 1, 8586, 1 },
+			{ 8587, 1, 8587, 1 },
+			{ 8588, 1, 8588, 1 },
+			{ 8589, 1, 8589, 1 },
+			{ 8590, 1, 8590, 1 },
+			{ 8591, 1, 8591, 1 },
+			{ 8592, 1, 8592, 1 },
+			{ 8593, 1, 8593, 1 },
+			{ 8594, 1, 8594, 1 },
+			{ 8595, 1, 8595, 1 },
+			{ 8596, 1, 8596, 1 },
+			{ 8597, 1, 8597, 1 },
+			{ 8598, 1, 8598, 1 },
+			{ 8599, 1, 8599, 1 },
+			{ 8600, 1, 8600, 1 },
+			{ 8601, 1, 8601, 1 },
+			{ 8602, 1, 8602, 1 },
+			{ 8603, 1, 8603, 1 },
+			{ 8604, 1, 8604, 1 },
+			{ 8605, 1, 8605, 1 },
+			{ 8606, 1, 8606, 1 },
+			{ 8607, 1, 8607, 1 },
+			{ 8608, 1, 8608, 1 },
+			{ 8609, 1, 8609, 1 },
+			{ 8610, 1, 8610, 1 },
+			{ 8611, 1, 8611, 1 },
+			{ 8612, 1, 8612, 1 },
+			{ 8613, 1, 8613, 1 },
+			{ 8614, 1, 8614, 1 },
+			{ 8615, 1, 8615, 1 },
+			{ 8616, 1, 8616, 1 },
+			{ 8617, 1, 8617, 1 },
+			{ 8618, 1, 8618, 1 },
+			{ 8619, 1, 8619, 1 },
+			{ 8620, 1, 8620, 1 },
+			{ 8621, 1, 8621, 1 },
+			{ 8622, 1, 8622, 1 },
+			{ 8623, 1, 8623, 1 },
+			{ 8624, 1, 8624, 1 },
+			{ 8625, 1, 8625, 1 },
+			{ 8626, 1, 8626, 1 },
+			{ 8627, 1, 8627, 1 },
+			{ 8628, 1, 8628, 1 },
+			{ 8629, 1, 8629, 1 },
+			{ 8630, 1, 8630, 1 },
+			{ 8631, 1, 8631, 1 },
+			{ 8632, 1, 8632, 1 },
+			{ 8633, 1, 8633, 1 },
+			{ 8634, 1, 8634, 1 },
+			{ 8635, 1, 8635, 1 },
+			{ 8636, 1, 8636, 1 },
+			{ 8637, 1, 8637, 1 },
+			{ 8638, 1, 8638, 1 },
+			{ 8639, 1, 8639, 1 },
+			{ 8640, 1, 8640, 1 },
+			{ 8641, 1, 8641, 1 },
+			{ 8642, 1, 8642, 1 },
+			{ 8643, 1, 8643, 1 },
+			{ 8644, 1, 8644, 1 },
+			{ 8645, 1, 8645, 1 },
+			{ 8646, 1, 8646, 1 },
+			{ 8647, 1, 8647, 1 },
+			{ 8648, 1, 8648, 1 },
+			{ 8649, 1, 8649, 1 },
+			{ 8650, 1, 8650, 1 },
+			{ 8651, 1, 8651, 1 },
+			{ 8652, 1, 8652, 1 },
+			{ 8653, 1, 8653, 1 },
+			{ 8654, 1, 8654, 1 },
+			{ 8655, 1, 8655, 1 },
+			{ 8656, 1, 8656, 1 },
+			{ 8657, 1, 8657, 1 },
+			{ 8658, 1, 8658, 1 },
+			{ 8659, 1, 8659, 1 },
+			{ 8660, 1, 8660, 1 },
+			{ 8661, 1, 8661, 1 },
+			{ 8662, 1, 8662, 1 },
+			{ 8663, 1, 8663, 1 },
+			{ 8664, 1, 8664, 1 },
+			{ 8665, 1, 8665, 1 },
+			{ 8666, 1, 8666, 1 },
+			{ 8667, 1, 8667, 1 },
+			{ 8668, 1, 8668, 1 },
+			{ 8669, 1, 8669, 1 },
+			{ 8670, 1, 8670, 1 },
+			{ 8671, 1, 8671, 1 },
+			{ 8672, 1, 8672, 1 },
+			{ 8673, 1, 8673, 1 },
+			{ 8674, 1, 8674, 1 },
+			{ 8675, 1, 8675, 1 },
+			{ 8676, 1, 8676, 1 },
+			{ 8677, 1, 8677, 1 },
+			{ 8678, 1, 8678, 1 },
+			{ 8679, 1, 8679, 1 },
+			{ 8680, 1, 8680, 1 },
+			{ 8681, 1, 8681, 1 },
+			{ 8682, 1, 8682, 1 },
+			{ 8683, 1, 8683, 1 },
+			{ 8684, 1, 8684, 1 },
+			{ 8685, 1, 8685, 1 },
+			{ 8686, 1, 8686, 1 },
+			{ 8687, 1, 8687, 1 },
+			{ 8688, 1, 8688, 1 },
+			{ 8689, 1, 8689, 1 },
+			{ 8690, 1, 8690, 1 },
+			{ 8691, 1, 8691, 1 },
+			{ 8692, 1, 8692, 1 },
+			{ 8693, 1, 8693, 1 },
+			{ 8694, 1, 8694, 1 },
+			{ 8695, 1, 8695, 1 },
+			{ 8696, 1, 8696, 1 },
+			{ 8697, 1, 8697, 1 },
+			{ 8698, 1, 8698, 1 },
+			{ 8699, 1, 8699, 1 },
+			{ 8700, 1, 8700, 1 },
+			{ 8701, 1, 8701, 1 },
+			{ 8702, 1, 8702, 1 },
+			{ 8703, 1, 8703, 1 },
+			{ 8704, 1, 8704, 1 },
+			{ 8705, 1, 8705, 1 },
+			{ 8706, 1, 8706, 1 },
+			{ 8707, 1, 8707, 1 },
+			{ 8708, 1, 8708, 1 },
+			{ 8709, 1, 8709, 1 },
+			{ 8710, 1, 8710, 1 },
+			{ 8711, 1, 8711, 1 },
+			{ 8712, 1, 8712, 1 },
+			{ 8713, 1, 8713, 1 },
+			{ 8714, 1, 8714, 1 },
+			{ 8715, 1, 8715, 1 },
+			{ 8716, 1, 8716, 1 },
+			{ 8717, 1, 8717, 1 },
+			{ 8718, 1, 8718, 1 },
+			{ 8719, 1, 8719, 1 },
+			{ 8720, 1, 8720, 1 },
+			{ 8721, 1, 8721, 1 },
+			{ 8722, 1, 8722, 1 },
+			{ 8723, 1, 8723, 1 },
+			{ 8724, 1, 8724, 1 },
+			{ 8725, 1, 8725, 1 },
+			{ 8726, 1, 8726, 1 },
+			{ 8727, 1, 8727, 1 },
+			{ 8728, 1, 8728, 1 },
+			{ 8729, 1, 8729, 1 },
+			{ 8730, 1, 8730, 1 },
+			{ 8731, 1, 8731, 1 },
+			{ 8732, 1, 8732, 1 },
+			{ 8733, 1, 8733, 1 },
+			{ 8734, 1, 8734, 1 },
+			{ 8735, 1, 8735, 1 },
+			{ 8736, 1, 8736, 1 },
+			{ 8737, 1, 8737, 1 },
+			{ 8738, 1, 8738, 1 },
+			{ 8739, 1, 8739, 1 },
+			{ 8740, 1, 8740, 1 },
+			{ 8741, 1, 8741, 1 },
+			{ 8742, 1, 8742, 1 },
+			{ 8743, 1, 8743, 1 },
+			{ 8744, 1, 8744, 1 },
+			{ 8745, 1, 8745, 1 },
+			{ 8746, 1, 8746, 1 },
+			{ 8747, 1, 8747, 1 },
+			{ 8748, 1, 8748, 1 },
+			{ 8749, 1, 8749, 1 },
+			{ 8750, 1, 8750, 1 },
+			{ 8751, 1, 8751, 1 },
+			{ 8752, 1, 8752, 1 },
+			{ 8753, 1, 8753, 1 },
+			{ 8754, 1, 8754, 1 },
+			{ 8755, 1, 8755, 1 },
+			{ 8756, 1, 8756, 1 },
+			{ 8757, 1, 8757, 1 },
+			{ 8758, 1, 8758, 1 },
+			{ 8759, 1, 8759, 1 },
+			{ 8760, 1, 8760, 1 },
+			{ 8761, 1, 8761, 1 },
+			{ 8762, 1, 8762, 1 },
+			{ 8763, 1, 8763, 1 },
+			{ 8764, 1, 8764, 1 },
+			{ 8765, 1, 8765, 1 },
+			{ 8766, 1, 8766, 1 },
+			{ 8767, 1, 8767, 1 },
+			{ 8768, 1, 8768, 1 },
+			{ 8769, 1, 8769, 1 },
+			{ 8770, 1, 8770, 1 },
+			{ 8771, 1, 8771, 1 },
+			{ 8772, 1, 8772, 1 },
+			{ 8773, 1, 8773, 1 },
+			{ 8774, 1, 8774, 1 },
+			{ 8775, 1, 8775, 1 },
+			{ 8776, 1, 8776, 1 },
+			{ 8777, 1, 8777, 1 },
+			{ 8778, 1, 8778, 1 },
+			{ 8779, 1, 8779, 1 },
+			{ 8780, 1, 8780, 1 },
+			{ 8781, 1, 8781, 1 },
+			{ 8782, 1, 8782, 1 },
+			{ 8783, 1, 8783, 1 },
+			{ 8784, 1, 8784, 1 },
+			{ 8785, 1, 8785, 1 },
+			{ 8786, 1, 8786, 1 },
+			{ 8787, 1, 8787, 1 },
+			{ 8788, 1, 8788, 1 },
+			{ 8789, 1, 8789, 1 },
+			{ 8790, 1, 8790, 1 },
+			{ 8791, 1, 8791, 1 },
+			{ 8792, 1, 8792, 1 },
+			{ 8793, 1, 8793, 1 },
+			{ 8794, 1, 8794, 1 },
+			{ 8795, 1, 8795, 1 },
+			{ 8796, 1, 8796, 1 },
+			{ 8797, 1, 8797, 1 },
+			{ 8798, 1, 8798, 1 },
+			{ 8799, 1, 8799, 1 },
+			{ 8800, 1, 8800, 1 },
+			{ 8801, 1, 8801, 1 },
+			{ 8802, 1, 8802, 1 },
+			{ 8803, 1, 8803, 1 },
+			{ 8804, 1, 8804, 1 },
+			{ 8805, 1, 8805, 1 },
+			{ 8806, 1, 8806, 1 },
+			{ 8807, 1, 8807, 1 },
+			{ 8808, 1, 8808, 1 },
+			{ 8809, 1, 8809, 1 },
+			{ 8810, 1, 8810, 1 },
+			{ 8811, 1, 8811, 1 },
+			{ 8812, 1, 8812, 1 },
+			{ 8813, 1, 8813, 1 },
+			{ 8814, 1, 8814, 1 },
+			{ 8815, 1, 8815, 1 },
+			{ 8816, 1, 8816, 1 },
+			{ 8817, 1, 8817, 1 },
+			{ 8818, 1, 8818, 1 },
+			{ 8819, 1, 8819, 1 },
+			{ 8820, 1, 8820, 1 },
+			{ 8821, 1, 8821, 1 },
+			{ 8822, 1, 8822, 1 },
+			{ 8823, 1, 8823, 1 },
+			{ 8824, 1, 8824, 1 },
+			{ 8825, 1, 8825, 1 },
+			{ 8826, 1, 8826, 1 },
+			{ 8827, 1, 8827, 1 },
+			{ 8828, 1, 8828, 1 },
+			{ 8829, 1, 8829, 1 },
+			{ 8830, 1, 8830, 1 },
+			{ 8831, 1, 8831, 1 },
+			{ 8832, 1, 8832, 1 },
+			{ 8833, 1, 8833, 1 },
+			{ 8834, 1, 8834, 1 },
+			{ 8835, 1, 8835, 1 },
+			{ 8836, 1, 8836, 1 },
+			{ 8837, 1, 8837, 1 },
+			{ 8838, 1, 8838, 1 },
+			{ 8839, 1, 8839, 1 },
+			{ 8840, 1, 8840, 1 },
+			{ 8841, 1, 8841, 1 },
+			{ 8842, 1, 8842, 1 },
+			{ 8843, 1, 8843, 1 },
+			{ 8844, 1, 8844, 1 },
+			{ 8845, 1, 8845, 1 },
+			{ 8846, 1, 8846, 1 },
+			{ 8847, 1, 8847, 1 },
+			{ 8848, 1, 8848, 1 },
+			{ 8849, 1, 8849, 1 },
+			{ 8850, 1, 8850, 1 },
+			{ 8851, 1, 8851, 1 },
+			{ 8852, 1, 8852, 1 },
+			{ 8853, 1, 8853, 1 },
+			{ 8854, 1, 8854, 1 },
+			{ 8855, 1, 8855, 1 },
+			{ 8856, 1, 8856, 1 },
+			{ 8857, 1, 8857, 1 },
+			{ 8858, 1, 8858, 1 },
+			{ 8859, 1, 8859, 1 },
+			{ 8860, 1, 8860, 1 },
+			{ 8861, 1, 8861, 1 },
+			{ 8862, 1, 8862, 1 },
+			{ 8863, 1, 8863, 1 },
+			{ 8864, 1, 8864, 1 },
+			{ 8865, 1, 8865, 1 },
+			{ 8866, 1, 8866, 1 },
+			{ 8867, 1, 8867, 1 },
+			{ 8868, 1, 8868, 1 },
+			{ 8869, 1, 8869, 1 },
+			{ 8870, 1, 8870, 1 },
+			{ 8871, 1, 8871, 1 },
+			{ 8872, 1, 8872, 1 },
+			{ 8873, 1, 8873, 1 },
+			{ 8874, 1, 8874, 1 },
+			{ 8875, 1, 8875, 1 },
+			{ 8876, 1, 8876, 1 },
+			{ 8877, 1, 8877, 1 },
+			{ 8878, 1, 8878, 1 },
+			{ 8879, 1, 8879, 1 },
+			{ 8880, 1, 8880, 1 },
+			{ 8881, 1, 8881, 1 },
+			{ 8882, 1, 8882, 1 },
+			{ 8883, 1, 8883, 1 },
+			{ 8884, 1, 8884, 1 },
+			{ 8885, 1, 8885, 1 },
+			{ 8886, 1, 8886, 1 },
+			{ 8887, 1, 8887, 1 },
+			{ 8888, 1, 8888, 1 },
+			{ 8889, 1, 8889, 1 },
+			{ 8890, 1, 8890, 1 },
+			{ 8891, 1, 8891, 1 },
+			{ 8892, 1, 8892, 1 },
+			{ 8893, 1, 8893, 1 },
+			{ 8894, 1, 8894, 1 },
+			{ 8895, 1, 8895, 1 },
+			{ 8896, 1, 8896, 1 },
+			{ 8897, 1, 8897, 1 },
+			{ 8898, 1, 8898, 1 },
+			{ 8899, 1, 8899, 1 },
+			{ 8900, 1, 8900, 1 },
+			{ 8901, 1, 8901, 1 },
+			{ 8902, 1, 8902, 1 },
+			{ 8903, 1, 8903, 1 },
+			{ 8904, 1, 8904, 1 },
+			{ 8905, 1, 8905, 1 },
+			{ 8906, 1, 8906, 1 },
+			{ 8907, 1, 8907, 1 },
+			{ 8908, 1, 8908, 1 },
+			{ 8909, 1, 8909, 1 },
+			{ 8910, 1, 8910, 1 },
+			{ 8911, 1, 8911, 1 },
+			{ 8912, 1, 8912, 1 },
+			{ 8913, 1, 8913, 1 },
+			{ 8914, 1, 8914, 1 },
+			{ 8915, 1, 8915, 1 },
+			{ 8916, 1, 8916, 1 },
+			{ 8917, 1, 8917, 1 },
+			{ 8918, 1, 8918, 1 },
+			{ 8919, 1, 8919, 1 },
+			{ 8920, 1, 8920, 1 },
+			{ 8921, 1, 8921, 1 },
+			{ 8922, 1, 8922, 1 },
+			{ 8923, 1, 8923, 1 },
+			{ 8924, 1, 8924, 1 },
+			{ 8925, 1, 8925, 1 },
+			{ 8926, 1, 8926, 1 },
+			{ 8927, 1, 8927, 1 },
+			{ 8928, 1, 8928, 1 },
+			{ 8929, 1, 8929, 1 },
+			{ 8930, 1, 8930, 1 },
+			{ 8931, 1, 8931, 1 },
+			{ 8932, 1, 8932, 1 },
+			{ 8933, 1, 8933, 1 },
+			{ 8934, 1, 8934, 1 },
+			{ 8935, 1, 8935, 1 },
+			{ 8936, 1, 8936, 1 },
+			{ 8937, 1, 8937, 1 },
+			{ 8938, 1, 8938, 1 },
+			{ 8939, 1, 8939, 1 },
+			{ 8940, 1, 8940, 1 },
+			{ 8941, 1, 8941, 1 },
+			{ 8942, 1, 8942, 1 },
+			{ 8943, 1, 8943, 1 },
+			{ 8944, 1, 8944, 1 },
+			{ 8945, 1, 8945, 1 },
+			{ 8946, 1, 8946, 1 },
+			{ 8947, 1, 8947, 1 },
+			{ 8948, 1, 8948, 1 },
+			{ 8949, 1, 8949, 1 },
+			{ 8950, 1, 8950, 1 },
+			{ 8951, 1, 8951, 1 },
+			{ 8952, 1, 8952, 1 },
+			{ 8953, 1, 8953, 1 },
+			{ 8954, 1, 8954, 1 },
+			{ 8955, 1, 8955, 1 },
+			{ 8956, 1, 8956, 1 },
+			{ 8957, 1, 8957, 1 },
+			{ 8958, 1, 8958, 1 },
+			{ 8959, 1, 8959, 1 },
+			{ 8960, 1, 8960, 1 },
+			{ 8961, 1, 8961, 1 },
+			{ 8962, 1, 8962, 1 },
+			{ 8963, 1, 8963, 1 },
+			{ 8964, 1, 8964, 1 },
+			{ 8965, 1, 8965, 1 },
+			{ 8966, 1, 8966, 1 },
+			{ 8967, 1, 8967, 1 },
+			{ 8968, 1, 8968, 1 },
+			{ 8969, 1, 8969, 1 },
+			{ 8970, 1, 8970, 1 },
+			{ 8971, 1, 8971, 1 },
+			{ 8972, 1, 8972, 1 },
+			{ 8973, 1, 8973, 1 },
+			{ 8974, 1, 8974, 1 },
+			{ 8975, 1, 8975, 1 },
+			{ 8976, 1, 8976, 1 },
+			{ 8977, 1, 8977, 1 },
+			{ 8978, 1, 8978, 1 },
+			{ 8979, 1, 8979, 1 },
+			{ 8980, 1, 8980, 1 },
+			{ 8981, 1, 8981, 1 },
+			{ 8982, 1, 8982, 1 },
+			{ 8983, 1, 8983, 1 },
+			{ 8984, 1, 8984, 1 },
+			{ 8985, 1, 8985, 1 },
+			{ 8986, 1, 8986, 1 },
+			{ 8987, 1, 8987, 1 },
+			{ 8988, 1, 8988, 1 },
+			{ 8989, 1, 8989, 1 },
+			{ 8990, 1, 8990, 1 },
+			{ 8991, 1, 8991, 1 },
+			{ 8992, 1, 8992, 1 },
+			{ 8993, 1, 8993, 1 },
+			{ 8994, 1, 8994, 1 },
+			{ 8995, 1, 8995, 1 },
+			{ 8996, 1, 8996, 1 },
+			{ 8997, 1, 8997, 1 },
+			{ 8998, 1, 8998, 1 },
+			{ 8999, 1, 8999, 1 },
+			{ 9000, 1, 9000, 1 },
+			{ 9001, 1, 9001, 1 },
+			{ 9002, 1, 9002, 1 },
+			{ 9003, 1, 9003, 1 },
+			{ 9004, 1, 9004, 1 },
+			{ 9005, 1, 9005, 1 },
+			{ 9006, 1, 9006, 1 },
+			{ 9007, 1, 9007, 1 },
+			{ 9008, 1, 9008, 1 },
+			{ 9009, 1, 9009, 1 },
+			{ 9010, 1, 9010, 1 },
+			{ 9011, 1, 9011, 1 },
+			{ 9012, 1, 9012, 1 },
+			{ 9013, 1, 9013, 1 },
+			{ 9014, 1, 9014, 1 },
+			{ 9015, 1, 9015, 1 },
+			{ 9016, 1, 9016, 1 },
+			{ 9017, 1, 9017, 1 },
+			{ 9018, 1, 9018, 1 },
+			{ 9019, 1, 9019, 1 },
+			{ 9020, 1, 9020, 1 },
+			{ 9021, 1, 9021, 1 },
+			{ 9022, 1, 9022, 1 },
+			{ 9023, 1, 9023, 1 },
+			{ 9024, 1, 9024, 1 },
+			{ 9025, 1, 9025, 1 },
+			{ 9026, 1, 9026, 1 },
+			{ 9027, 1, 9027, 1 },
+			{ 9028, 1, 9028, 1 },
+			{ 9029, 1, 9029, 1 },
+			{ 9030, 1, 9030, 1 },
+			{ 9031, 1, 9031, 1 },
+			{ 9032, 1, 9032, 1 },
+			{ 9033, 1, 9033, 1 },
+			{ 9034, 1, 9034, 1 },
+			{ 9035, 1, 9035, 1 },
+			{ 9036, 1, 9036, 1 },
+			{ 9037, 1, 9037, 1 },
+			{ 9038, 1, 9038, 1 },
+			{ 9039, 1, 9039, 1 },
+			{ 9040, 1, 9040, 1 },
+			{ 9041, 1, 9041, 1 },
+			{ 9042, 1, 9042, 1 },
+			{ 9043, 1, 9043, 1 },
+			{ 9044, 1, 9044, 1 },
+			{ 9045, 1, 9045, 1 },
+			{ 9046, 1, 9046, 1 },
+			{ 9047, 1, 9047, 1 },
+			{ 9048, 1, 9048, 1 },
+			{ 9049, 1, 9049, 1 },
+			{ 9050, 1, 9050, 1 },
+			{ 9051, 1, 9051, 1 },
+			{ 9052, 1, 9052, 1 },
+			{ 9053, 1, 9053, 1 },
+			{ 9054, 1, 9054, 1 },
+			{ 9055, 1, 9055, 1 },
+			{ 9056, 1, 9056, 1 },
+			{ 9057, 1, 9057, 1 },
+			{ 9058, 1, 9058, 1 },
+			{ 9059, 1, 9059, 1 },
+			{ 9060, 1, 9060, 1 },
+			{ 9061, 1, 9061, 1 },
+			{ 9062, 1, 9062, 1 },
+			{ 9063, 1, 9063, 1 },
+			{ 9064, 1, 9064, 1 },
+			{ 9065, 1, 9065, 1 },
+			{ 9066, 1, 9066, 1 },
+			{ 9067, 1, 9067, 1 },
+			{ 9068, 1, 9068, 1 },
+			{ 9069, 1, 9069, 1 },
+			{ 9070, 1, 9070, 1 },
+			{ 9071, 1, 9071, 1 },
+			{ 9072, 1, 9072, 1 },
+			{ 9073, 1, 9073, 1 },
+			{ 9074, 1, 9074, 1 },
+			{ 9075, 1, 9075, 1 },
+			{ 9076, 1, 9076, 1 },
+			{ 9077, 1, 9077, 1 },
+			{ 9078, 1, 9078, 1 },
+		};
+
+		inline constexpr char32_t decomposition_data[] = {
+			0x0020, 0x0020, 0x0308, 0x0061, 0x0020, 0x0304, 0x0032, 0x0033, 0x0020, 0x0301, 0x03BC, 0x0020, 0x0327, 0x0031, 0x006F, 0x0031,
+			0x2044, 0x0034, 0x0031, 0x2044, 0x0032, 0x0033, 0x2044, 0x0034, 0x0041, 0x0300, 0x0041, 0x0301, 0x0041, 0x0302, 0x0041, 0x0303,
+			0x0041, 0x0308, 0x0041, 0x030A, 0x0043, 0x0327, 0x0045, 0x0300, 0x0045, 0x0301, 0x0045, 0x0302, 0x0045, 0x0308, 0x0049, 0x0300,
+			0x0049, 0x0301, 0x0049, 0x0302, 0x0049, 0x0308, 0x004E, 0x0303, 0x004F, 0x0300, 0x004F, 0x0301, 0x004F, 0x0302, 0x004F, 0x0303,
+			0x004F, 0x0308, 0x0055, 0x0300, 0x0055, 0x0301, 0x0055, 0x0302, 0x0055, 0x0308, 0x0059, 0x0301, 0x0061, 0x0300, 0x0061, 0x0301,
+			0x0061, 0x0302, 0x0061, 0x0303, 0x0061, 0x0308, 0x0061, 0x030A, 0x0063, 0x0327, 0x0065, 0x0300, 0x0065, 0x0301, 0x0065, 0x0302,
+			0x0065, 0x0308, 0x0069, 0x0300, 0x0069, 0x0301, 0x0069, 0x0302, 0x0069, 0x0308, 0x006E, 0x0303, 0x006F, 0x0300, 0x006F, 0x0301,
+			0x006F, 0x0302, 0x006F, 0x0303, 0x006F, 0x0308, 0x0075, 0x0300, 0x0075, 0x0301, 0x0075, 0x0302, 0x0075, 0x0308, 0x0079, 0x0301,
+			0x0079, 0x0308, 0x0041, 0x0304, 0x0061, 0x0304, 0x0041, 0x0306, 0x0061, 0x0306, 0x0041, 0x0328, 0x0061, 0x0328, 0x0043, 0x0301,
+			0x0063, 0x0301, 0x0043, 0x0302, 0x0063, 0x0302, 0x0043, 0x0307, 0x0063, 0x0307, 0x0043, 0x030C, 0x0063, 0x030C, 0x0044, 0x030C,
+			0x0064, 0x030C, 0x0045, 0x0304, 0x0065, 0x0304, 0x0045, 0x0306, 0x0065, 0x0306, 0x0045, 0x0307, 0x0065, 0x0307, 0x0045, 0x0328,
+			0x0065, 0x0328, 0x0045, 0x030C, 0x0065, 0x030C, 0x0047, 0x0302, 0x0067, 0x0302, 0x0047, 0x0306, 0x0067, 0x0306, 0x0047, 0x0307,
+			0x0067, 0x0307, 0x0047, 0x0327, 0x0067, 0x0327, 0x0048, 0x0302, 0x0068, 0x0302, 0x0049, 0x0303, 0x0069, 0x0303, 0x0049, 0x0304,
+			0x0069, 0x0304, 0x0049, 0x0306, 0x0069, 0x0306, 0x0049, 0x0328, 0x0069, 0x0328, 0x0049, 0x0307, 0x0049, 0x004A, 0x0069, 0x006A,
+			0x004A, 0x0302, 0x006A, 0x0302, 0x004B, 0x0327, 0x006B, 0x0327, 0x004C, 0x0301, 0x006C, 0x0301, 0x004C, 0x0327, 0x006C, 0x0327,
+			0x004C, 0x030C, 0x006C, 0x030C, 0x004C, 0x00B7, 0x006C, 0x00B7, 0x004E, 0x0301, 0x006E, 0x0301, 0x004E, 0x0327, 0x006E, 0x0327,
+			0x004E, 0x030C, 0x006E, 0x030C, 0x02BC, 0x006E, 0x004F, 0x0304, 0x006F, 0x0304, 0x004F, 0x0306, 0x006F, 0x0306, 0x004F, 0x030B,
+			0x006F, 0x030B, 0x0052, 0x0301, 0x0072, 0x0301, 0x0052, 0x0327, 0x0072, 0x0327, 0x0052, 0x030C, 0x0072, 0x030C, 0x0053, 0x0301,
+			0x0073, 0x0301, 0x0053, 0x0302, 0x0073, 0x0302, 0x0053, 0x0327, 0x0073, 0x0327, 0x0053, 0x030C, 0x0073, 0x030C, 0x0054, 0x0327,
+			0x0074, 0x0327, 0x0054, 0x030C, 0x0074, 0x030C, 0x0055, 0x0303, 0x0075, 0x0303, 0x0055, 0x0304, 0x0075, 0x0304, 0x0055, 0x0306,
+			0x0075, 0x0306, 0x0055, 0x030A, 0x0075, 0x030A, 0x0055, 0x030B, 0x0075, 0x030B, 0x0055, 0x0328, 0x0075, 0x0328, 0x0057, 0x0302,
+			0x0077, 0x0302, 0x0059, 0x0302, 0x0079, 0x0302, 0x0059, 0x0308, 0x005A, 0x0301, 0x007A, 0x0301, 0x005A, 0x0307, 0x007A, 0x0307,
+			0x005A, 0x030C, 0x007A, 0x030C, 0x0073, 0x004F, 0x031B, 0x006F, 0x031B, 0x0055, 0x031B, 0x0075, 0x031B, 0x0044, 0x005A, 0x030C,
+			0x0044, 0x007A, 0x030C, 0x0064, 0x007A, 0x030C, 0x004C, 0x004A, 0x004C, 0x006A, 0x006C, 0x006A, 0x004E, 0x004A, 0x004E, 0x006A,
+			0x006E, 0x006A, 0x0041, 0x030C, 0x0061, 0x030C, 0x0049, 0x030C, 0x0069, 0x030C, 0x004F, 0x030C, 0x006F, 0x030C, 0x0055, 0x030C,
+			0x0075, 0x030C, 0x0055, 0x0308, 0x0304, 0x0075, 0x0308, 0x0304, 0x0055, 0x0308, 0x0301, 0x0075, 0x0308, 0x0301, 0x0055, 0x0308,
+			0x030C, 0x0075, 0x0308, 0x030C, 0x0055, 0x0308, 0x0300, 0x0075, 0x0308, 0x0300, 0x0041, 0x0308, 0x0304, 0x0061, 0x0308, 0x0304,
+			0x0041, 0x0307, 0x0304, 0x0061, 0x0307, 0x0304, 0x00C6, 0x0304, 0x00E6, 0x0304, 0x0047, 0x030C, 0x0067, 0x030C, 0x004B, 0x030C,
+			0x006B, 0x030C, 0x004F, 0x0328, 0x006F, 0x0328, 0x004F, 0x0328, 0x0304, 0x006F, 0x0328, 0x0304, 0x01B7, 0x030C, 0x0292, 0x030C,
+			0x006A, 0x030C, 0x0044, 0x005A, 0x0044, 0x007A, 0x0064, 0x007A, 0x0047, 0x0301, 0x0067, 0x0301, 0x004E, 0x0300, 0x006E, 0x0300,
+			0x0041, 0x030A, 0x0301, 0x0061, 0x030A, 0x0301, 0x00C6, 0x0301, 0x00E6, 0x0301, 0x00D8, 0x0301, 0x00F8, 0x0301, 0x0041, 0x030F,
+			0x0061, 0x030F, 0x0041, 0x0311, 0x0061, 0x0311, 0x0045, 0x030F, 0x0065, 0x030F, 0x0045, 0x0311, 0x0065, 0x0311, 0x0049, 0x030F,
+			0x0069, 0x030F, 0x0049, 0x0311, 0x0069, 0x0311, 0x004F, 0x030F, 0x006F, 0x030F, 0x004F, 0x0311, 0x006F, 0x0311, 0x0052, 0x030F,
+			0x0072, 0x030F, 0x0052, 0x0311, 0x0072, 0x0311, 0x0055, 0x030F, 0x0075, 0x030F, 0x0055, 0x0311, 0x0075, 0x0311, 0x0053, 0x0326,
+			0x0073, 0x0326, 0x0054, 0x0326, 0x0074, 0x0326, 0x0048, 0x030C, 0x0068, 0x030C, 0x0041, 0x0307, 0x0061, 0x0307, 0x0045, 0x0327,
+			0x0065, 0x0327, 0x004F, 0x0308, 0x0304, 0x006F, 0x0308, 0x0304, 0x004F, 0x0303, 0x0304, 0x006F, 0x0303, 0x0304, 0x004F, 0x0307,
+			0x006F, 0x0307, 0x004F, 0x0307, 0x0304, 0x006F, 0x0307, 0x0304, 0x0059, 0x0304, 0x0079, 0x0304, 0x0068, 0x0266, 0x006A, 0x0072,
+			0x0279, 0x027B, 0x0281, 0x0077, 0x0079, 0x0020, 0x0306, 0x0020, 0x0307, 0x0020, 0x030A, 0x0020, 0x0328, 0x0020, 0x0303, 0x0020,
+			0x030B, 0x0263, 0x006C, 0x0073, 0x0078, 0x0295, 0x0300, 0x0301, 0x0313, 0x0308, 0x0301, 0x02B9, 0x0020, 0x0345, 0x003B, 0x0020,
+			0x0301, 0x00A8, 0x0301, 0x0020, 0x0308, 0x0301, 0x0391, 0x0301, 0x00B7, 0x0395, 0x0301, 0x0397, 0x0301, 0x0399, 0x0301, 0x039F,
+			0x0301, 0x03A5, 0x0301, 0x03A9, 0x0301, 0x03B9, 0x0308, 0x0301, 0x0399, 0x0308, 0x03A5, 0x0308, 0x03B1, 0x0301, 0x03B5, 0x0301,
+			0x03B7, 0x0301, 0x03B9, 0x0301, 0x03C5, 0x0308, 0x0301, 0x03B9, 0x0308, 0x03C5, 0x0308, 0x03BF, 0x0301, 0x03C5, 0x0301, 0x03C9,
+			0x0301, 0x03B2, 0x03B8, 0x03A5, 0x03D2, 0x0301, 0x03A5, 0x0301, 0x03D2, 0x0308, 0x03A5, 0x0308, 0x03C6, 0x03C0, 0x03BA, 0x03C1,
+			0x03C2, 0x0398, 0x03B5, 0x03A3, 0x0415, 0x0300, 0x0415, 0x0308, 0x0413, 0x0301, 0x0406, 0x0308, 0x041A, 0x0301, 0x0418, 0x0300,
+			0x0423, 0x0306, 0x0418, 0x0306, 0x0438, 0x0306, 0x0435, 0x0300, 0x0435, 0x0308, 0x0433, 0x0301, 0x0456, 0x0308, 0x043A, 0x0301,
+			0x0438, 0x0300, 0x0443, 0x0306, 0x0474, 0x030F, 0x0475, 0x030F, 0x0416, 0x0306, 0x0436, 0x0306, 0x0410, 0x0306, 0x0430, 0x0306,
+			0x0410, 0x0308, 0x0430, 0x0308, 0x0415, 0x0306, 0x0435, 0x0306, 0x04D8, 0x0308, 0x04D9, 0x0308, 0x0416, 0x0308, 0x0436, 0x0308,
+			0x0417, 0x0308, 0x0437, 0x0308, 0x0418, 0x0304, 0x0438, 0x0304, 0x0418, 0x0308, 0x0438, 0x0308, 0x041E, 0x0308, 0x043E, 0x0308,
+			0x04E8, 0x0308, 0x04E9, 0x0308, 0x042D, 0x0308, 0x044D, 0x0308, 0x0423, 0x0304, 0x0443, 0x0304, 0x0423, 0x0308, 0x0443, 0x0308,
+			0x0423, 0x030B, 0x0443, 0x030B, 0x0427, 0x0308, 0x0447, 0x0308, 0x042B, 0x0308, 0x044B, 0x0308, 0x0565, 0x0582, 0x0627, 0x0653,
+			0x0627, 0x0654, 0x0648, 0x0654, 0x0627, 0x0655, 0x064A, 0x0654, 0x0627, 0x0674, 0x0648, 0x0674, 0x06C7, 0x0674, 0x064A, 0x0674,
+			0x06D5, 0x0654, 0x06C1, 0x0654, 0x06D2, 0x0654, 0x0928, 0x093C, 0x0930, 0x093C, 0x0933, 0x093C, 0x0915, 0x093C, 0x0916, 0x093C,
+			0x0917, 0x093C, 0x091C, 0x093C, 0x0921, 0x093C, 0x0922, 0x093C, 0x092B, 0x093C, 0x092F, 0x093C, 0x09C7, 0x09BE, 0x09C7, 0x09D7,
+			0x09A1, 0x09BC, 0x09A2, 0x09BC, 0x09AF, 0x09BC, 0x0A32, 0x0A3C, 0x0A38, 0x0A3C, 0x0A16, 0x0A3C, 0x0A17, 0x0A3C, 0x0A1C, 0x0A3C,
+			0x0A2B, 0x0A3C, 0x0B47, 0x0B56, 0x0B47, 0x0B3E, 0x0B47, 0x0B57, 0x0B21, 0x0B3C, 0x0B22, 0x0B3C, 0x0B92, 0x0BD7, 0x0BC6, 0x0BBE,
+			0x0BC7, 0x0BBE, 0x0BC6, 0x0BD7, 0x0C46, 0x0C56, 0x0CBF, 0x0CD5, 0x0CC6, 0x0CD5, 0x0CC6, 0x0CD6, 0x0CC6, 0x0CC2, 0x0CC6, 0x0CC2,
+			0x0CD5, 0x0D46, 0x0D3E, 0x0D47, 0x0D3E, 0x0D46, 0x0D57, 0x0DD9, 0x0DCA, 0x0DD9, 0x0DCF, 0x0DD9, 0x0DCF, 0x0DCA, 0x0DD9, 0x0DDF,
+			0x0E4D, 0x0E32, 0x0ECD, 0x0EB2, 0x0EAB, 0x0E99, 0x0EAB, 0x0EA1, 0x0F0B, 0x0F42, 0x0FB7, 0x0F4C, 0x0FB7, 0x0F51, 0x0FB7, 0x0F56,
+			0x0FB7, 0x0F5B, 0x0FB7, 0x0F40, 0x0FB5, 0x0F71, 0x0F72, 0x0F71, 0x0F74, 0x0FB2, 0x0F80, 0x0FB2, 0x0F71, 0x0F80, 0x0FB3, 0x0F80,
+			0x0FB3, 0x0F71, 0x0F80, 0x0F71, 0x0F80, 0x0F92, 0x0FB7, 0x0F9C, 0x0FB7, 0x0FA1, 0x0FB7, 0x0FA6, 0x0FB7, 0x0FAB, 0x0FB7, 0x0F90,
+			0x0FB5, 0x1025, 0x102E, 0x10DC, 0x1B05, 0x1B35, 0x1B07, 0x1B35, 0x1B09, 0x1B35, 0x1B0B, 0x1B35, 0x1B0D, 0x1B35, 0x1B11, 0x1B35,
+			0x1B3A, 0x1B35, 0x1B3C, 0x1B35, 0x1B3E, 0x1B35, 0x1B3F, 0x1B35, 0x1B42, 0x1B35, 0x0041, 0x00C6, 0x0042, 0x0044, 0x0045, 0x018E,
+			0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0222, 0x0050, 0x0052, 0x0054, 0x0055, 0x0057, 0x0061,
+			0x0250, 0x0251, 0x1D02, 0x0062, 0x0064, 0x0065, 0x0259, 0x025B, 0x025C, 0x0067, 0x006B, 0x006D, 0x014B, 0x006F, 0x0254, 0x1D16,
+			0x1D17, 0x0070, 0x0074, 0x0075, 0x1D1D, 0x026F, 0x0076, 0x1D25, 0x03B2, 0x03B3, 0x03B4, 0x03C6, 0x03C7, 0x0069, 0x0072, 0x0075,
+			0x0076, 0x03B2, 0x03B3, 0x03C1, 0x03C6, 0x03C7, 0x043D, 0x0252, 0x0063, 0x0255, 0x00F0, 0x025C, 0x0066, 0x025F, 0x0261, 0x0265,
+			0x0268, 0x0269, 0x026A, 0x1D7B, 0x029D, 0x026D, 0x1D85, 0x029F, 0x0271, 0x0270, 0x0272, 0x0273, 0x0274, 0x0275, 0x0278, 0x0282,
+			0x0283, 0x01AB, 0x0289, 0x028A, 0x1D1C, 0x028B, 0x028C, 0x007A, 0x0290, 0x0291, 0x0292, 0x03B8, 0x0041, 0x0325, 0x0061, 0x0325,
+			0x0042, 0x0307, 0x0062, 0x0307, 0x0042, 0x0323, 0x0062, 0x0323, 0x0042, 0x0331, 0x0062, 0x0331, 0x0043, 0x0327, 0x0301, 0x0063,
+			0x0327, 0x0301, 0x0044, 0x0307, 0x0064, 0x0307, 0x0044, 0x0323, 0x0064, 0x0323, 0x0044, 0x0331, 0x0064, 0x0331, 0x0044, 0x0327,
+			0x0064, 0x0327, 0x0044, 0x032D, 0x0064, 0x032D, 0x0045, 0x0304, 0x0300, 0x0065, 0x0304, 0x0300, 0x0045, 0x0304, 0x0301, 0x0065,
+			0x0304, 0x0301, 0x0045, 0x032D, 0x0065, 0x032D, 0x0045, 0x0330, 0x0065, 0x0330, 0x0045, 0x0327, 0x0306, 0x0065, 0x0327, 0x0306,
+			0x0046, 0x0307, 0x0066, 0x0307, 0x0047, 0x0304, 0x0067, 0x0304, 0x0048, 0x0307, 0x0068, 0x0307, 0x0048, 0x0323, 0x0068, 0x0323,
+			0x0048, 0x0308, 0x0068, 0x0308, 0x0048, 0x0327, 0x0068, 0x0327, 0x0048, 0x032E, 0x0068, 0x032E, 0x0049, 0x0330, 0x0069, 0x0330,
+			0x0049, 0x0308, 0x0301, 0x0069, 0x0308, 0x0301, 0x004B, 0x0301, 0x006B, 0x0301, 0x004B, 0x0323, 0x006B, 0x0323, 0x004B, 0x0331,
+			0x006B, 0x0331, 0x004C, 0x0323, 0x006C, 0x0323, 0x004C, 0x0323, 0x0304, 0x006C, 0x0323, 0x0304, 0x004C, 0x0331, 0x006C, 0x0331,
+			0x004C, 0x032D, 0x006C, 0x032D, 0x004D, 0x0301, 0x006D, 0x0301, 0x004D, 0x0307, 0x006D, 0x0307, 0x004D, 0x0323, 0x006D, 0x0323,
+			0x004E, 0x0307, 0x006E, 0x0307, 0x004E, 0x0323, 0x006E, 0x0323, 0x004E, 0x0331, 0x006E, 0x0331, 0x004E, 0x032D, 0x006E, 0x032D,
+			0x004F, 0x0303, 0x0301, 0x006F, 0x0303, 0x0301, 0x004F, 0x0303, 0x0308, 0x006F, 0x0303, 0x0308, 0x004F, 0x0304, 0x0300, 0x006F,
+			0x0304, 0x0300, 0x004F, 0x0304, 0x0301, 0x006F, 0x0304, 0x0301, 0x0050, 0x0301, 0x0070, 0x0301, 0x0050, 0x0307, 0x0070, 0x0307,
+			0x0052, 0x0307, 0x0072, 0x0307, 0x0052, 0x0323, 0x0072, 0x0323, 0x0052, 0x0323, 0x0304, 0x0072, 0x0323, 0x0304, 0x0052, 0x0331,
+			0x0072, 0x0331, 0x0053, 0x0307, 0x0073, 0x0307, 0x0053, 0x0323, 0x0073, 0x0323, 0x0053, 0x0301, 0x0307, 0x0073, 0x0301, 0x0307,
+			0x0053, 0x030C, 0x0307, 0x0073, 0x030C, 0x0307, 0x0053, 0x0323, 0x0307, 0x0073, 0x0323, 0x0307, 0x0054, 0x0307, 0x0074, 0x0307,
+			0x0054, 0x0323, 0x0074, 0x0323, 0x0054, 0x0331, 0x0074, 0x0331, 0x0054, 0x032D, 0x0074, 0x032D, 0x0055, 0x0324, 0x0075, 0x0324,
+			0x0055, 0x0330, 0x0075, 0x0330, 0x0055, 0x032D, 0x0075, 0x032D, 0x0055, 0x0303, 0x0301, 0x0075, 0x0303, 0x0301, 0x0055, 0x0304,
+			0x0308, 0x0075, 0x0304, 0x0308, 0x0056, 0x0303, 0x0076, 0x0303, 0x0056, 0x0323, 0x0076, 0x0323, 0x0057, 0x0300, 0x0077, 0x0300,
+			0x0057, 0x0301, 0x0077, 0x0301, 0x0057, 0x0308, 0x0077, 0x0308, 0x0057, 0x0307, 0x0077, 0x0307, 0x0057, 0x0323, 0x0077, 0x0323,
+			0x0058, 0x0307, 0x0078, 0x0307, 0x0058, 0x0308, 0x0078, 0x0308, 0x0059, 0x0307, 0x0079, 0x0307, 0x005A, 0x0302, 0x007A, 0x0302,
+			0x005A, 0x0323, 0x007A, 0x0323, 0x005A, 0x0331, 0x007A, 0x0331, 0x0068, 0x0331, 0x0074, 0x0308, 0x0077, 0x030A, 0x0079, 0x030A,
+			0x0061, 0x02BE, 0x017F, 0x0307, 0x0073, 0x0307, 0x0041, 0x0323, 0x0061, 0x0323, 0x0041, 0x0309, 0x0061, 0x0309, 0x0041, 0x0302,
+			0x0301, 0x0061, 0x0302, 0x0301, 0x0041, 0x0302, 0x0300, 0x0061, 0x0302, 0x0300, 0x0041, 0x0302, 0x0309, 0x0061, 0x0302, 0x0309,
+			0x0041, 0x0302, 0x0303, 0x0061, 0x0302, 0x0303, 0x0041, 0x0323, 0x0302, 0x0061, 0x0323, 0x0302, 0x0041, 0x0306, 0x0301, 0x0061,
+			0x0306, 0x0301, 0x0041, 0x0306, 0x0300, 0x0061, 0x0306, 0x0300, 0x0041, 0x0306, 0x0309, 0x0061, 0x0306, 0x0309, 0x0041, 0x0306,
+			0x0303, 0x0061, 0x0306, 0x0303, 0x0041, 0x0323, 0x0306, 0x0061, 0x0323, 0x0306, 0x0045, 0x0323, 0x0065, 0x0323, 0x0045, 0x0309,
+			0x0065, 0x0309, 0x0045, 0x0303, 0x0065, 0x0303, 0x0045, 0x0302, 0x0301, 0x0065, 0x0302, 0x0301, 0x0045, 0x0302, 0x0300, 0x0065,
+			0x0302, 0x0300, 0x0045, 0x0302, 0x0309, 0x0065, 0x0302, 0x0309, 0x0045, 0x0302, 0x0303, 0x0065, 0x0302, 0x0303, 0x0045, 0x0323,
+			0x0302, 0x0065, 0x0323, 0x0302, 0x0049, 0x0309, 0x0069, 0x0309, 0x0049, 0x0323, 0x0069, 0x0323, 0x004F, 0x0323, 0x006F, 0x0323,
+			0x004F, 0x0309, 0x006F, 0x0309, 0x004F, 0x0302, 0x0301, 0x006F, 0x0302, 0x0301, 0x004F, 0x0302, 0x0300, 0x006F, 0x0302, 0x0300,
+			0x004F, 0x0302, 0x0309, 0x006F, 0x0302, 0x0309, 0x004F, 0x0302, 0x0303, 0x006F, 0x0302, 0x0303, 0x004F, 0x0323, 0x0302, 0x006F,
+			0x0323, 0x0302, 0x004F, 0x031B, 0x0301, 0x006F, 0x031B, 0x0301, 0x004F, 0x031B, 0x0300, 0x006F, 0x031B, 0x0300, 0x004F, 0x031B,
+			0x0309, 0x006F, 0x031B, 0x0309, 0x004F, 0x031B, 0x0303, 0x006F, 0x031B, 0x0303, 0x004F, 0x031B, 0x0323, 0x006F, 0x031B, 0x0323,
+			0x0055, 0x0323, 0x0075, 0x0323, 0x0055, 0x0309, 0x0075, 0x0309, 0x0055, 0x031B, 0x0301, 0x0075, 0x031B, 0x0301, 0x0055, 0x031B,
+			0x0300, 0x0075, 0x031B, 0x0300, 0x0055, 0x031B, 0x0309, 0x0075, 0x031B, 0x0309, 0x0055, 0x031B, 0x0303, 0x0075, 0x031B, 0x0303,
+			0x0055, 0x031B, 0x0323, 0x0075, 0x031B, 0x0323, 0x0059, 0x0300, 0x0079, 0x0300, 0x0059, 0x0323, 0x0079, 0x0323, 0x0059, 0x0309,
+			0x0079, 0x0309, 0x0059, 0x0303, 0x0079, 0x0303, 0x03B1, 0x0313, 0x03B1, 0x0314, 0x03B1, 0x0313, 0x0300, 0x03B1, 0x0314, 0x0300,
+			0x03B1, 0x0313, 0x0301, 0x03B1, 0x0314, 0x0301, 0x03B1, 0x0313, 0x0342, 0x03B1, 0x0314, 0x0342, 0x0391, 0x0313, 0x0391, 0x0314,
+			0x0391, 0x0313, 0x0300, 0x0391, 0x0314, 0x0300, 0x0391, 0x0313, 0x0301, 0x0391, 0x0314, 0x0301, 0x0391, 0x0313, 0x0342, 0x0391,
+			0x0314, 0x0342, 0x03B5, 0x0313, 0x03B5, 0x0314, 0x03B5, 0x0313, 0x0300, 0x03B5, 0x0314, 0x0300, 0x03B5, 0x0313, 0x0301, 0x03B5,
+			0x0314, 0x0301, 0x0395, 0x0313, 0x0395, 0x0314, 0x0395, 0x0313, 0x0300, 0x0395, 0x0314, 0x0300, 0x0395, 0x0313, 0x0301, 0x0395,
+			0x0314, 0x0301, 0x03B7, 0x0313, 0x03B7, 0x0314, 0x03B7, 0x0313, 0x0300, 0x03B7, 0x0314, 0x0300, 0x03B7, 0x0313, 0x0301, 0x03B7,
+			0x0314, 0x0301, 0x03B7, 0x0313, 0x0342, 0x03B7, 0x0314, 0x0342, 0x0397, 0x0313, 0x0397, 0x0314, 0x0397, 0x0313, 0x0300, 0x0397,
+			0x0314, 0x0300, 0x0397, 0x0313, 0x0301, 0x0397, 0x0314, 0x0301, 0x0397, 0x0313, 0x0342, 0x0397, 0x0314, 0x0342, 0x03B9, 0x0313,
+			0x03B9, 0x0314, 0x03B9, 0x0313, 0x0300, 0x03B9, 0x0314, 0x0300, 0x03B9, 0x0313, 0x0301, 0x03B9, 0x0314, 0x0301, 0x03B9, 0x0313,
+			0x0342, 0x03B9, 0x0314, 0x0342, 0x0399, 0x0313, 0x0399, 0x0314, 0x0399, 0x0313, 0x0300, 0x0399, 0x0314, 0x0300, 0x0399, 0x0313,
+			0x0301, 0x0399, 0x0314, 0x0301, 0x0399, 0x0313, 0x0342, 0x0399, 0x0314, 0x0342, 0x03BF, 0x0313, 0x03BF, 0x0314, 0x03BF, 0x0313,
+			0x0300, 0x03BF, 0x0314, 0x0300, 0x03BF, 0x0313, 0x0301, 0x03BF, 0x0314, 0x0301, 0x039F, 0x0313, 0x039F, 0x0314, 0x039F, 0x0313,
+			0x0300, 0x039F, 0x0314, 0x0300, 0x039F, 0x0313, 0x0301, 0x039F, 0x0314, 0x0301, 0x03C5, 0x0313, 0x03C5, 0x0314, 0x03C5, 0x0313,
+			0x0300, 0x03C5, 0x0314, 0x0300, 0x03C5, 0x0313, 0x0301, 0x03C5, 0x0314, 0x0301, 0x03C5, 0x0313, 0x0342, 0x03C5, 0x0314, 0x0342,
+			0x03A5, 0x0314, 0x03A5, 0x0314, 0x0300, 0x03A5, 0x0314, 0x0301, 0x03A5, 0x0314, 0x0342, 0x03C9, 0x0313, 0x03C9, 0x0314, 0x03C9,
+			0x0313, 0x0300, 0x03C9, 0x0314, 0x0300, 0x03C9, 0x0313, 0x0301, 0x03C9, 0x0314, 0x0301, 0x03C9, 0x0313, 0x0342, 0x03C9, 0x0314,
+			0x0342, 0x03A9, 0x0313, 0x03A9, 0x0314, 0x03A9, 0x0313, 0x0300, 0x03A9, 0x0314, 0x0300, 0x03A9, 0x0313, 0x0301, 0x03A9, 0x0314,
+			0x0301, 0x03A9, 0x0313, 0x0342, 0x03A9, 0x0314, 0x0342, 0x03B1, 0x0300, 0x03B1, 0x0301, 0x03B5, 0x0300, 0x03B5, 0x0301, 0x03B7,
+			0x0300, 0x03B7, 0x0301, 0x03B9, 0x0300, 0x03B9, 0x0301, 0x03BF, 0x0300, 0x03BF, 0x0301, 0x03C5, 0x0300, 0x03C5, 0x0301, 0x03C9,
+			0x0300, 0x03C9, 0x0301, 0x03B1, 0x0313, 0x0345, 0x03B1, 0x0314, 0x0345, 0x03B1, 0x0313, 0x0300, 0x0345, 0x03B1, 0x0314, 0x0300,
+			0x0345, 0x03B1, 0x0313, 0x0301, 0x0345, 0x03B1, 0x0314, 0x0301, 0x0345, 0x03B1, 0x0313, 0x0342, 0x0345, 0x03B1, 0x0314, 0x0342,
+			0x0345, 0x0391, 0x0313, 0x0345, 0x0391, 0x0314, 0x0345, 0x0391, 0x0313, 0x0300, 0x0345, 0x0391, 0x0314, 0x0300, 0x0345, 0x0391,
+			0x0313, 0x0301, 0x0345, 0x0391, 0x0314, 0x0301, 0x0345, 0x0391, 0x0313, 0x0342, 0x0345, 0x0391, 0x0314, 0x0342, 0x0345, 0x03B7,
+			0x0313, 0x0345, 0x03B7, 0x0314, 0x0345, 0x03B7, 0x0313, 0x0300, 0x0345, 0x03B7, 0x0314, 0x0300, 0x0345, 0x03B7, 0x0313, 0x0301,
+			0x0345, 0x03B7, 0x0314, 0x0301, 0x0345, 0x03B7, 0x0313, 0x0342, 0x0345, 0x03B7, 0x0314, 0x0342, 0x0345, 0x0397, 0x0313, 0x0345,
+			0x0397, 0x0314, 0x0345, 0x0397, 0x0313, 0x0300, 0x0345, 0x0397, 0x0314, 0x0300, 0x0345, 0x0397, 0x0313, 0x0301, 0x0345, 0x0397,
+			0x0314, 0x0301, 0x0345, 0x0397, 0x0313, 0x0342, 0x0345, 0x0397, 0x0314, 0x0342, 0x0345, 0x03C9, 0x0313, 0x0345, 0x03C9, 0x0314,
+			0x0345, 0x03C9, 0x0313, 0x0300, 0x0345, 0x03C9, 0x0314, 0x0300, 0x0345, 0x03C9, 0x0313, 0x0301, 0x0345, 0x03C9, 0x0314, 0x0301,
+			0x0345, 0x03C9, 0x0313, 0x0342, 0x0345, 0x03C9, 0x0314, 0x0342, 0x0345, 0x03A9, 0x0313, 0x0345, 0x03A9, 0x0314, 0x0345, 0x03A9,
+			0x0313, 0x0300, 0x0345, 0x03A9, 0x0314, 0x0300, 0x0345, 0x03A9, 0x0313, 0x0301, 0x0345, 0x03A9, 0x0314, 0x0301, 0x0345, 0x03A9,
+			0x0313, 0x0342, 0x0345, 0x03A9, 0x0314, 0x0342, 0x0345, 0x03B1, 0x0306, 0x03B1, 0x0304, 0x03B1, 0x0300, 0x0345, 0x03B1, 0x0345,
+			0x03B1, 0x0301, 0x0345, 0x03B1, 0x0342, 0x03B1, 0x0342, 0x0345, 0x0391, 0x0306, 0x0391, 0x0304, 0x0391, 0x0300, 0x0391, 0x0301,
+			0x0391, 0x0345, 0x0020, 0x0313, 0x03B9, 0x0020, 0x0313, 0x0020, 0x0342, 0x00A8, 0x0342, 0x0020, 0x0308, 0x0342, 0x03B7, 0x0300,
+			0x0345, 0x03B7, 0x0345, 0x03B7, 0x0301, 0x0345, 0x03B7, 0x0342, 0x03B7, 0x0342, 0x0345, 0x0395, 0x0300, 0x0395, 0x0301, 0x0397,
+			0x0300, 0x0397, 0x0301, 0x0397, 0x0345, 0x1FBF, 0x0300, 0x0020, 0x0313, 0x0300, 0x1FBF, 0x0301, 0x0020, 0x0313, 0x0301, 0x1FBF,
+			0x0342, 0x0020, 0x0313, 0x0342, 0x03B9, 0x0306, 0x03B9, 0x0304, 0x03B9, 0x0308, 0x0300, 0x03B9, 0x0308, 0x0301, 0x03B9, 0x0342,
+			0x03B9, 0x0308, 0x0342, 0x0399, 0x0306, 0x0399, 0x0304, 0x0399, 0x0300, 0x0399, 0x0301, 0x1FFE, 0x0300, 0x0020, 0x0314, 0x0300,
+			0x1FFE, 0x0301, 0x0020, 0x0314, 0x0301, 0x1FFE, 0x0342, 0x0020, 0x0314, 0x0342, 0x03C5, 0x0306, 0x03C5, 0x0304, 0x03C5, 0x0308,
+			0x0300, 0x03C5, 0x0308, 0x0301, 0x03C1, 0x0313, 0x03C1, 0x0314, 0x03C5, 0x0342, 0x03C5, 0x0308, 0x0342, 0x03A5, 0x0306, 0x03A5,
+			0x0304, 0x03A5, 0x0300, 0x03A5, 0x0301, 0x03A1, 0x0314, 0x00A8, 0x0300, 0x0020, 0x0308, 0x0300, 0x00A8, 0x0301, 0x0020, 0x0308,
+			0x0301, 0x0060, 0x03C9, 0x0300, 0x0345, 0x03C9, 0x0345, 0x03C9, 0x0301, 0x0345, 0x03C9, 0x0342, 0x03C9, 0x0342, 0x0345, 0x039F,
+			0x0300, 0x039F, 0x0301, 0x03A9, 0x0300, 0x03A9, 0x0301, 0x03A9, 0x0345, 0x00B4, 0x0020, 0x0301, 0x0020, 0x0314, 0x2002, 0x0020,
+			0x2003, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x2010, 0x0020, 0x0333, 0x002E, 0x002E,
+			0x002E, 0x002E, 0x002E, 0x002E, 0x0020, 0x2032, 0x2032, 0x2032, 0x2032, 0x2032, 0x2035, 0x2035, 0x2035, 0x2035, 0x2035, 0x0021,
+			0x0021, 0x0020, 0x0305, 0x003F, 0x003F, 0x003F, 0x0021, 0x0021, 0x003F, 0x2032, 0x2032, 0x2032, 0x2032, 0x0020, 0x0030, 0x0069,
+			0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x002B, 0x2212, 0x003D, 0x0028, 0x0029, 0x006E, 0x0030, 0x0031, 0x0032, 0x0033,
+			0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x002B, 0x2212, 0x003D, 0x0028, 0x0029, 0x0061, 0x0065, 0x006F, 0x0078, 0x0259,
+			0x0068, 0x006B, 0x006C, 0x006D, 0x006E, 0x0070, 0x0073, 0x0074, 0x0052, 0x0073, 0x0061, 0x002F, 0x0063, 0x0061, 0x002F, 0x0073,
+			0x0043, 0x00B0, 0x0043, 0x0063, 0x002F, 0x006F, 0x0063, 0x002F, 0x0075, 0x0190, 0x00B0, 0x0046, 0x0067, 0x0048, 0x0048, 0x0048,
+			0x0068, 0x0127, 0x0049, 0x0049, 0x004C, 0x006C, 0x004E, 0x004E, 0x006F, 0x0050, 0x0051, 0x0052, 0x0052, 0x0052, 0x0053, 0x004D,
+			0x0054, 0x0045, 0x004C, 0x0054, 0x004D, 0x005A, 0x03A9, 0x005A, 0x004B, 0x0041, 0x030A, 0x0042, 0x0043, 0x0065, 0x0045, 0x0046,
+			0x004D, 0x006F, 0x05D0, 0x05D1, 0x05D2, 0x05D3, 0x0069, 0x0046, 0x0041, 0x0058, 0x03C0, 0x03B3, 0x0393, 0x03A0, 0x2211, 0x0044,
+			0x0064, 0x0065, 0x0069, 0x006A, 0x0031, 0x2044, 0x0037, 0x0031, 0x2044, 0x0039, 0x0031, 0x2044, 0x0031, 0x0030, 0x0031, 0x2044,
+			0x0033, 0x0032, 0x2044, 0x0033, 0x0031, 0x2044, 0x0035, 0x0032, 0x2044, 0x0035, 0x0033, 0x2044, 0x0035, 0x0034, 0x2044, 0x0035,
+			0x0031, 0x2044, 0x0036, 0x0035, 0x2044, 0x0036, 0x0031, 0x2044, 0x0038, 0x0033, 0x2044, 0x0038, 0x0035, 0x2044, 0x0038, 0x0037,
+			0x2044, 0x0038, 0x0031, 0x2044, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0056, 0x0056, 0x0056, 0x0049, 0x0056,
+			0x0049, 0x0049, 0x0056, 0x0049, 0x0049, 0x0049, 0x0049, 0x0058, 0x0058, 0x0058, 0x0049, 0x0058, 0x0049, 0x0049, 0x004C, 0x0043,
+			0x0044, 0x004D, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x0076, 0x0076, 0x0076, 0x0069, 0x0076, 0x0069, 0x0069,
+			0x0076, 0x0069, 0x0069, 0x0069, 0x0069, 0x0078, 0x0078, 0x0078, 0x0069, 0x0078, 0x0069, 0x0069, 0x006C, 0x0063, 0x0064, 0x006D,
+			0x0030, 0x2044, 0x0033, 0x2190, 0x0338, 0x2192, 0x0338, 0x2194, 0x0338, 0x21D0, 0x0338, 0x21D4, 0x0338, 0x21D2, 0x0338, 0x2203,
+			0x0338, 0x2208, 0x0338, 0x220B, 0x0338, 0x2223, 0x0338, 0x2225, 0x0338, 0x222B, 0x222B, 0x222B, 0x222B, 0x222B, 0x222E, 0x222E,
+			0x222E, 0x222E, 0x222E, 0x223C, 0x0338, 0x2243, 0x0338, 0x2245, 0x0338, 0x2248, 0x0338, 0x003D, 0x0338, 0x2261, 0x0338, 0x224D,
+			0x0338, 0x003C, 0x0338, 0x003E, 0x0338, 0x2264, 0x0338, 0x2265, 0x0338, 0x2272, 0x0338, 0x2273, 0x0338, 0x2276, 0x0338, 0x2277,
+			0x0338, 0x227A, 0x0338, 0x227B, 0x0338, 0x2282, 0x0338, 0x2283, 0x0338, 0x2286, 0x0338, 0x2287, 0x0338, 0x22A2, 0x0338, 0x22A8,
+			0x0338, 0x22A9, 0x0338, 0x22AB, 0x0338, 0x227C, 0x0338, 0x227D, 0x0338, 0x2291, 0x0338, 0x2292, 0x0338, 0x22B2, 0x0338, 0x22B3,
+			0x0338, 0x22B4, 0x0338, 0x22B5, 0x0338, 0x3008, 0x3009, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039,
+			0x0031, 0x0030, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0033, 0x0031, 0x0034, 0x0031, 0x0035, 0x0031, 0x0036, 0x0031, 0x0037,
+			0x0031, 0x0038, 0x0031, 0x0039, 0x0032, 0x0030, 0x0028, 0x0031, 0x0029, 0x0028, 0x0032, 0x0029, 0x0028, 0x0033, 0x0029, 0x0028,
+			0x0034, 0x0029, 0x0028, 0x0035, 0x0029, 0x0028, 0x0036, 0x0029, 0x0028, 0x0037, 0x0029, 0x0028, 0x0038, 0x0029, 0x0028, 0x0039,
+			0x0029, 0x0028, 0x0031, 0x0030, 0x0029, 0x0028, 0x0031, 0x0031, 0x0029, 0x0028, 0x0031, 0x0032, 0x0029, 0x0028, 0x0031, 0x0033,
+			0x0029, 0x0028, 0x0031, 0x0034, 0x0029, 0x0028, 0x0031, 0x0035, 0x0029, 0x0028, 0x0031, 0x0036, 0x0029, 0x0028, 0x0031, 0x0037,
+			0x0029, 0x0028, 0x0031, 0x0038, 0x0029, 0x0028, 0x0031, 0x0039, 0x0029, 0x0028, 0x0032, 0x0030, 0x0029, 0x0031, 0x002E, 0x0032,
+			0x002E, 0x0033, 0x002E, 0x0034, 0x002E, 0x0035, 0x002E, 0x0036, 0x002E, 0x0037, 0x002E, 0x0038, 0x002E, 0x0039, 0x002E, 0x0031,
+			0x0030, 0x002E, 0x0031, 0x0031, 0x002E, 0x0031, 0x0032, 0x002E, 0x0031, 0x0033, 0x002E, 0x0031, 0x0034, 0x002E, 0x0031, 0x0035,
+			0x002E, 0x0031, 0x0036, 0x002E, 0x0031, 0x0037, 0x002E, 0x0031, 0x0038, 0x002E, 0x0031, 0x0039, 0x002E, 0x0032, 0x0030, 0x002E,
+			0x0028, 0x0061, 0x0029, 0x0028, 0x0062, 0x0029, 0x0028, 0x0063, 0x0029, 0x0028, 0x0064, 0x0029, 0x0028, 0x0065, 0x0029, 0x0028,
+			0x0066, 0x0029, 0x0028, 0x0067, 0x0029, 0x0028, 0x0068, 0x0029, 0x0028, 0x0069, 0x0029, 0x0028, 0x006A, 0x0029, 0x0028, 0x006B,
+			0x0029, 0x0028, 0x006C, 0x0029, 0x0028, 0x006D, 0x0029, 0x0028, 0x006E, 0x0029, 0x0028, 0x006F, 0x0029, 0x0028, 0x0070, 0x0029,
+			0x0028, 0x0071, 0x0029, 0x0028, 0x0072, 0x0029, 0x0028, 0x0073, 0x0029, 0x0028, 0x0074, 0x0029, 0x0028, 0x0075, 0x0029, 0x0028,
+			0x0076, 0x0029, 0x0028, 0x0077, 0x0029, 0x0028, 0x0078, 0x0029, 0x0028, 0x0079, 0x0029, 0x0028, 0x007A, 0x0029, 0x0041, 0x0042,
+			0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052,
+			0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068,
+			0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078,
+			0x0079, 0x007A, 0x0030, 0x222B, 0x222B, 0x222B, 0x222B, 0x003A, 0x003A, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x2ADD,
+			0x0338, 0x006A, 0x0056, 0x2D61, 0x6BCD, 0x9F9F, 0x4E00, 0x4E28, 0x4E36, 0x4E3F, 0x4E59, 0x4E85, 0x4E8C, 0x4EA0, 0x4EBA, 0x513F,
+			0x5165, 0x516B, 0x5182, 0x5196, 0x51AB, 0x51E0, 0x51F5, 0x5200, 0x529B, 0x52F9, 0x5315, 0x531A, 0x5338, 0x5341, 0x535C, 0x5369,
+			0x5382, 0x53B6, 0x53C8, 0x53E3, 0x56D7, 0x571F, 0x58EB, 0x5902, 0x590A, 0x5915, 0x5927, 0x5973, 0x5B50, 0x5B80, 0x5BF8, 0x5C0F,
+			0x5C22, 0x5C38, 0x5C6E, 0x5C71, 0x5DDB, 0x5DE5, 0x5DF1, 0x5DFE, 0x5E72, 0x5E7A, 0x5E7F, 0x5EF4, 0x5EFE, 0x5F0B, 0x5F13, 0x5F50,
+			0x5F61, 0x5F73, 0x5FC3, 0x6208, 0x6236, 0x624B, 0x652F, 0x6534, 0x6587, 0x6597, 0x65A4, 0x65B9, 0x65E0, 0x65E5, 0x66F0, 0x6708,
+			0x6728, 0x6B20, 0x6B62, 0x6B79, 0x6BB3, 0x6BCB, 0x6BD4, 0x6BDB, 0x6C0F, 0x6C14, 0x6C34, 0x706B, 0x722A, 0x7236, 0x723B, 0x723F,
+			0x7247, 0x7259, 0x725B, 0x72AC, 0x7384, 0x7389, 0x74DC, 0x74E6, 0x7518, 0x751F, 0x7528, 0x7530, 0x758B, 0x7592, 0x7676, 0x767D,
+			0x76AE, 0x76BF, 0x76EE, 0x77DB, 0x77E2, 0x77F3, 0x793A, 0x79B8, 0x79BE, 0x7A74, 0x7ACB, 0x7AF9, 0x7C73, 0x7CF8, 0x7F36, 0x7F51,
+			0x7F8A, 0x7FBD, 0x8001, 0x800C, 0x8012, 0x8033, 0x807F, 0x8089, 0x81E3, 0x81EA, 0x81F3, 0x81FC, 0x820C, 0x821B, 0x821F, 0x826E,
+			0x8272, 0x8278, 0x864D, 0x866B, 0x8840, 0x884C, 0x8863, 0x897E, 0x898B, 0x89D2, 0x8A00, 0x8C37, 0x8C46, 0x8C55, 0x8C78, 0x8C9D,
+			0x8D64, 0x8D70, 0x8DB3, 0x8EAB, 0x8ECA, 0x8F9B, 0x8FB0, 0x8FB5, 0x9091, 0x9149, 0x91C6, 0x91CC, 0x91D1, 0x9577, 0x9580, 0x961C,
+			0x96B6, 0x96B9, 0x96E8, 0x9751, 0x975E, 0x9762, 0x9769, 0x97CB, 0x97ED, 0x97F3, 0x9801, 0x98A8, 0x98DB, 0x98DF, 0x9996, 0x9999,
+			0x99AC, 0x9AA8, 0x9AD8, 0x9ADF, 0x9B25, 0x9B2F, 0x9B32, 0x9B3C, 0x9B5A, 0x9CE5, 0x9E75, 0x9E7F, 0x9EA5, 0x9EBB, 0x9EC3, 0x9ECD,
+			0x9ED1, 0x9EF9, 0x9EFD, 0x9F0E, 0x9F13, 0x9F20, 0x9F3B, 0x9F4A, 0x9F52, 0x9F8D, 0x9F9C, 0x9FA0, 0x0020, 0x3012, 0x5341, 0x5344,
+			0x5345, 0x304B, 0x3099, 0x304D, 0x3099, 0x304F, 0x3099, 0x3051, 0x3099, 0x3053, 0x3099, 0x3055, 0x3099, 0x3057, 0x3099, 0x3059,
+			0x3099, 0x305B, 0x3099, 0x305D, 0x3099, 0x305F, 0x3099, 0x3061, 0x3099, 0x3064, 0x3099, 0x3066, 0x3099, 0x3068, 0x3099, 0x306F,
+			0x3099, 0x306F, 0x309A, 0x3072, 0x3099, 0x3072, 0x309A, 0x3075, 0x3099, 0x3075, 0x309A, 0x3078, 0x3099, 0x3078, 0x309A, 0x307B,
+			0x3099, 0x307B, 0x309A, 0x3046, 0x3099, 0x0020, 0x3099, 0x0020, 0x309A, 0x309D, 0x3099, 0x3088, 0x308A, 0x30AB, 0x3099, 0x30AD,
+			0x3099, 0x30AF, 0x3099, 0x30B1, 0x3099, 0x30B3, 0x3099, 0x30B5, 0x3099, 0x30B7, 0x3099, 0x30B9, 0x3099, 0x30BB, 0x3099, 0x30BD,
+			0x3099, 0x30BF, 0x3099, 0x30C1, 0x3099, 0x30C4, 0x3099, 0x30C6, 0x3099, 0x30C8, 0x3099, 0x30CF, 0x3099, 0x30CF, 0x309A, 0x30D2,
+			0x3099, 0x30D2, 0x309A, 0x30D5, 0x3099, 0x30D5, 0x309A, 0x30D8, 0x3099, 0x30D8, 0x309A, 0x30DB, 0x3099, 0x30DB, 0x309A, 0x30A6,
+			0x3099, 0x30EF, 0x3099, 0x30F0, 0x3099, 0x30F1, 0x3099, 0x30F2, 0x3099, 0x30FD, 0x3099, 0x30B3, 0x30C8, 0x1100, 0x1101, 0x11AA,
+			0x1102, 0x11AC, 0x11AD, 0x1103, 0x1104, 0x1105, 0x11B0, 0x11B1, 0x11B2, 0x11B3, 0x11B4, 0x11B5, 0x111A, 0x1106, 0x1107, 0x1108,
+			0x1121, 0x1109, 0x110A, 0x110B, 0x110C, 0x110D, 0x110E, 0x110F, 0x1110, 0x1111, 0x1112, 0x1161, 0x1162, 0x1163, 0x1164, 0x1165,
+			0x1166, 0x1167, 0x1168, 0x1169, 0x116A, 0x116B, 0x116C, 0x116D, 0x116E, 0x116F, 0x1170, 0x1171, 0x1172, 0x1173, 0x1174, 0x1175,
+			0x1160, 0x1114, 0x1115, 0x11C7, 0x11C8, 0x11CC, 0x11CE, 0x11D3, 0x11D7, 0x11D9, 0x111C, 0x11DD, 0x11DF, 0x111D, 0x111E, 0x1120,
+			0x1122, 0x1123, 0x1127, 0x1129, 0x112B, 0x112C, 0x112D, 0x112E, 0x112F, 0x1132, 0x1136, 0x1140, 0x1147, 0x114C, 0x11F1, 0x11F2,
+			0x1157, 0x1158, 0x1159, 0x1184, 0x1185, 0x1188, 0x1191, 0x1192, 0x1194, 0x119E, 0x11A1, 0x4E00, 0x4E8C, 0x4E09, 0x56DB, 0x4E0A,
+			0x4E2D, 0x4E0B, 0x7532, 0x4E59, 0x4E19, 0x4E01, 0x5929, 0x5730, 0x4EBA, 0x0028, 0x1100, 0x0029, 0x0028, 0x1102, 0x0029, 0x0028,
+			0x1103, 0x0029, 0x0028, 0x1105, 0x0029, 0x0028, 0x1106, 0x0029, 0x0028, 0x1107, 0x0029, 0x0028, 0x1109, 0x0029, 0x0028, 0x110B,
+			0x0029, 0x0028, 0x110C, 0x0029, 0x0028, 0x110E, 0x0029, 0x0028, 0x110F, 0x0029, 0x0028, 0x1110, 0x0029, 0x0028, 0x1111, 0x0029,
+			0x0028, 0x1112, 0x0029, 0x0028, 0x1100, 0x1161, 0x0029, 0x0028, 0x1102, 0x1161, 0x0029, 0x0028, 0x1103, 0x1161, 0x0029, 0x0028,
+			0x1105, 0x1161, 0x0029, 0x0028, 0x1106, 0x1161, 0x0029, 0x0028, 0x1107, 0x1161, 0x0029, 0x0028, 0x1109, 0x1161, 0x0029, 0x0028,
+			0x110B, 0x1161, 0x0029, 0x0028, 0x110C, 0x1161, 0x0029, 0x0028, 0x110E, 0x1161, 0x0029, 0x0028, 0x110F, 0x1161, 0x0029, 0x0028,
+			0x1110, 0x1161, 0x0029, 0x0028, 0x1111, 0x1161, 0x0029, 0x0028, 0x1112, 0x1161, 0x0029, 0x0028, 0x110C, 0x116E, 0x0029, 0x0028,
+			0x110B, 0x1169, 0x110C, 0x1165, 0x11AB, 0x0029, 0x0028, 0x110B, 0x1169, 0x1112, 0x116E, 0x0029, 0x0028, 0x4E00, 0x0029, 0x0028,
+			0x4E8C, 0x0029, 0x0028, 0x4E09, 0x0029, 0x0028, 0x56DB, 0x0029, 0x0028, 0x4E94, 0x0029, 0x0028, 0x516D, 0x0029, 0x0028, 0x4E03,
+			0x0029, 0x0028, 0x516B, 0x0029, 0x0028, 0x4E5D, 0x0029, 0x0028, 0x5341, 0x0029, 0x0028, 0x6708, 0x0029, 0x0028, 0x706B, 0x0029,
+			0x0028, 0x6C34, 0x0029, 0x0028, 0x6728, 0x0029, 0x0028, 0x91D1, 0x0029, 0x0028, 0x571F, 0x0029, 0x0028, 0x65E5, 0x0029, 0x0028,
+			0x682A, 0x0029, 0x0028, 0x6709, 0x0029, 0x0028, 0x793E, 0x0029, 0x0028, 0x540D, 0x0029, 0x0028, 0x7279, 0x0029, 0x0028, 0x8CA1,
+			0x0029, 0x0028, 0x795D, 0x0029, 0x0028, 0x52B4, 0x0029, 0x0028, 0x4EE3, 0x0029, 0x0028, 0x547C, 0x0029, 0x0028, 0x5B66, 0x0029,
+			0x0028, 0x76E3, 0x0029, 0x0028, 0x4F01, 0x0029, 0x0028, 0x8CC7, 0x0029, 0x0028, 0x5354, 0x0029, 0x0028, 0x796D, 0x0029, 0x0028,
+			0x4F11, 0x0029, 0x0028, 0x81EA, 0x0029, 0x0028, 0x81F3, 0x0029, 0x554F, 0x5E7C, 0x6587, 0x7B8F, 0x0050, 0x0054, 0x0045, 0x0032,
+			0x0031, 0x0032, 0x0032, 0x0032, 0x0033, 0x0032, 0x0034, 0x0032, 0x0035, 0x0032, 0x0036, 0x0032, 0x0037, 0x0032, 0x0038, 0x0032,
+			0x0039, 0x0033, 0x0030, 0x0033, 0x0031, 0x0033, 0x0032, 0x0033, 0x0033, 0x0033, 0x0034, 0x0033, 0x0035, 0x1100, 0x1102, 0x1103,
+			0x1105, 0x1106, 0x1107, 0x1109, 0x110B, 0x110C, 0x110E, 0x110F, 0x1110, 0x1111, 0x1112, 0x1100, 0x1161, 0x1102, 0x1161, 0x1103,
+			0x1161, 0x1105, 0x1161, 0x1106, 0x1161, 0x1107, 0x1161, 0x1109, 0x1161, 0x110B, 0x1161, 0x110C, 0x1161, 0x110E, 0x1161, 0x110F,
+			0x1161, 0x1110, 0x1161, 0x1111, 0x1161, 0x1112, 0x1161, 0x110E, 0x1161, 0x11B7, 0x1100, 0x1169, 0x110C, 0x116E, 0x110B, 0x1174,
+			0x110B, 0x116E, 0x4E00, 0x4E8C, 0x4E09, 0x56DB, 0x4E94, 0x516D, 0x4E03, 0x516B, 0x4E5D, 0x5341, 0x6708, 0x706B, 0x6C34, 0x6728,
+			0x91D1, 0x571F, 0x65E5, 0x682A, 0x6709, 0x793E, 0x540D, 0x7279, 0x8CA1, 0x795D, 0x52B4, 0x79D8, 0x7537, 0x5973, 0x9069, 0x512A,
+			0x5370, 0x6CE8, 0x9805, 0x4F11, 0x5199, 0x6B63, 0x4E0A, 0x4E2D, 0x4E0B, 0x5DE6, 0x53F3, 0x533B, 0x5B97, 0x5B66, 0x76E3, 0x4F01,
+			0x8CC7, 0x5354, 0x591C, 0x0033, 0x0036, 0x0033, 0x0037, 0x0033, 0x0038, 0x0033, 0x0039, 0x0034, 0x0030, 0x0034, 0x0031, 0x0034,
+			0x0032, 0x0034, 0x0033, 0x0034, 0x0034, 0x0034, 0x0035, 0x0034, 0x0036, 0x0034, 0x0037, 0x0034, 0x0038, 0x0034, 0x0039, 0x0035,
+			0x0030, 0x0031, 0x6708, 0x0032, 0x6708, 0x0033, 0x6708, 0x0034, 0x6708, 0x0035, 0x6708, 0x0036, 0x6708, 0x0037, 0x6708, 0x0038,
+			0x6708, 0x0039, 0x6708, 0x0031, 0x0030, 0x6708, 0x0031, 0x0031, 0x6708, 0x0031, 0x0032, 0x6708, 0x0048, 0x0067, 0x0065, 0x0072,
+			0x0067, 0x0065, 0x0056, 0x004C, 0x0054, 0x0044, 0x30A2, 0x30A4, 0x30A6, 0x30A8, 0x30AA, 0x30AB, 0x30AD, 0x30AF, 0x30B1, 0x30B3,
+			0x30B5, 0x30B7, 0x30B9, 0x30BB, 0x30BD, 0x30BF, 0x30C1, 0x30C4, 0x30C6, 0x30C8, 0x30CA, 0x30CB, 0x30CC, 0x30CD, 0x30CE, 0x30CF,
+			0x30D2, 0x30D5, 0x30D8, 0x30DB, 0x30DE, 0x30DF, 0x30E0, 0x30E1, 0x30E2, 0x30E4, 0x30E6, 0x30E8, 0x30E9, 0x30EA, 0x30EB, 0x30EC,
+			0x30ED, 0x30EF, 0x30F0, 0x30F1, 0x30F2, 0x4EE4, 0x548C, 0x30A2, 0x30CF, 0x309A, 0x30FC, 0x30C8, 0x30A2, 0x30EB, 0x30D5, 0x30A1,
+			0x30A2, 0x30F3, 0x30D8, 0x309A, 0x30A2, 0x30A2, 0x30FC, 0x30EB, 0x30A4, 0x30CB, 0x30F3, 0x30AF, 0x3099, 0x30A4, 0x30F3, 0x30C1,
+			0x30A6, 0x30A9, 0x30F3, 0x30A8, 0x30B9, 0x30AF, 0x30FC, 0x30C8, 0x3099, 0x30A8, 0x30FC, 0x30AB, 0x30FC, 0x30AA, 0x30F3, 0x30B9,
+			0x30AA, 0x30FC, 0x30E0, 0x30AB, 0x30A4, 0x30EA, 0x30AB, 0x30E9, 0x30C3, 0x30C8, 0x30AB, 0x30ED, 0x30EA, 0x30FC, 0x30AB, 0x3099,
+			0x30ED, 0x30F3, 0x30AB, 0x3099, 0x30F3, 0x30DE, 0x30AD, 0x3099, 0x30AB, 0x3099, 0x30AD, 0x3099, 0x30CB, 0x30FC, 0x30AD, 0x30E5,
+			0x30EA, 0x30FC, 0x30AD, 0x3099, 0x30EB, 0x30BF, 0x3099, 0x30FC, 0x30AD, 0x30ED, 0x30AD, 0x30ED, 0x30AF, 0x3099, 0x30E9, 0x30E0,
+			0x30AD, 0x30ED, 0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x30AD, 0x30ED, 0x30EF, 0x30C3, 0x30C8, 0x30AF, 0x3099, 0x30E9, 0x30E0, 0x30AF,
+			0x3099, 0x30E9, 0x30E0, 0x30C8, 0x30F3, 0x30AF, 0x30EB, 0x30BB, 0x3099, 0x30A4, 0x30ED, 0x30AF, 0x30ED, 0x30FC, 0x30CD, 0x30B1,
+			0x30FC, 0x30B9, 0x30B3, 0x30EB, 0x30CA, 0x30B3, 0x30FC, 0x30DB, 0x309A, 0x30B5, 0x30A4, 0x30AF, 0x30EB, 0x30B5, 0x30F3, 0x30C1,
+			0x30FC, 0x30E0, 0x30B7, 0x30EA, 0x30F3, 0x30AF, 0x3099, 0x30BB, 0x30F3, 0x30C1, 0x30BB, 0x30F3, 0x30C8, 0x30BF, 0x3099, 0x30FC,
+			0x30B9, 0x30C6, 0x3099, 0x30B7, 0x30C8, 0x3099, 0x30EB, 0x30C8, 0x30F3, 0x30CA, 0x30CE, 0x30CE, 0x30C3, 0x30C8, 0x30CF, 0x30A4,
+			0x30C4, 0x30CF, 0x309A, 0x30FC, 0x30BB, 0x30F3, 0x30C8, 0x30CF, 0x309A, 0x30FC, 0x30C4, 0x30CF, 0x3099, 0x30FC, 0x30EC, 0x30EB,
+			0x30D2, 0x309A, 0x30A2, 0x30B9, 0x30C8, 0x30EB, 0x30D2, 0x309A, 0x30AF, 0x30EB, 0x30D2, 0x309A, 0x30B3, 0x30D2, 0x3099, 0x30EB,
+			0x30D5, 0x30A1, 0x30E9, 0x30C3, 0x30C8, 0x3099, 0x30D5, 0x30A3, 0x30FC, 0x30C8, 0x30D5, 0x3099, 0x30C3, 0x30B7, 0x30A7, 0x30EB,
+			0x30D5, 0x30E9, 0x30F3, 0x30D8, 0x30AF, 0x30BF, 0x30FC, 0x30EB, 0x30D8, 0x309A, 0x30BD, 0x30D8, 0x309A, 0x30CB, 0x30D2, 0x30D8,
+			0x30EB, 0x30C4, 0x30D8, 0x309A, 0x30F3, 0x30B9, 0x30D8, 0x309A, 0x30FC, 0x30B7, 0x3099, 0x30D8, 0x3099, 0x30FC, 0x30BF, 0x30DB,
+			0x309A, 0x30A4, 0x30F3, 0x30C8, 0x30DB, 0x3099, 0x30EB, 0x30C8, 0x30DB, 0x30F3, 0x30DB, 0x309A, 0x30F3, 0x30C8, 0x3099, 0x30DB,
+			0x30FC, 0x30EB, 0x30DB, 0x30FC, 0x30F3, 0x30DE, 0x30A4, 0x30AF, 0x30ED, 0x30DE, 0x30A4, 0x30EB, 0x30DE, 0x30C3, 0x30CF, 0x30DE,
+			0x30EB, 0x30AF, 0x30DE, 0x30F3, 0x30B7, 0x30E7, 0x30F3, 0x30DF, 0x30AF, 0x30ED, 0x30F3, 0x30DF, 0x30EA, 0x30DF, 0x30EA, 0x30CF,
+			0x3099, 0x30FC, 0x30EB, 0x30E1, 0x30AB, 0x3099, 0x30E1, 0x30AB, 0x3099, 0x30C8, 0x30F3, 0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x30E4,
+			0x30FC, 0x30C8, 0x3099, 0x30E4, 0x30FC, 0x30EB, 0x30E6, 0x30A2, 0x30F3, 0x30EA, 0x30C3, 0x30C8, 0x30EB, 0x30EA, 0x30E9, 0x30EB,
+			0x30D2, 0x309A, 0x30FC, 0x30EB, 0x30FC, 0x30D5, 0x3099, 0x30EB, 0x30EC, 0x30E0, 0x30EC, 0x30F3, 0x30C8, 0x30B1, 0x3099, 0x30F3,
+			0x30EF, 0x30C3, 0x30C8, 0x0030, 0x70B9, 0x0031, 0x70B9, 0x0032, 0x70B9, 0x0033, 0x70B9, 0x0034, 0x70B9, 0x0035, 0x70B9, 0x0036,
+			0x70B9, 0x0037, 0x70B9, 0x0038, 0x70B9, 0x0039, 0x70B9, 0x0031, 0x0030, 0x70B9, 0x0031, 0x0031, 0x70B9, 0x0031, 0x0032, 0x70B9,
+			0x0031, 0x0033, 0x70B9, 0x0031, 0x0034, 0x70B9, 0x0031, 0x0035, 0x70B9, 0x0031, 0x0036, 0x70B9, 0x0031, 0x0037, 0x70B9, 0x0031,
+			0x0038, 0x70B9, 0x0031, 0x0039, 0x70B9, 0x0032, 0x0030, 0x70B9, 0x0032, 0x0031, 0x70B9, 0x0032, 0x0032, 0x70B9, 0x0032, 0x0033,
+			0x70B9, 0x0032, 0x0034, 0x70B9, 0x0068, 0x0050, 0x0061, 0x0064, 0x0061, 0x0041, 0x0055, 0x0062, 0x0061, 0x0072, 0x006F, 0x0056,
+			0x0070, 0x0063, 0x0064, 0x006D, 0x0064, 0x006D, 0x0032, 0x0064, 0x006D, 0x0033, 0x0049, 0x0055, 0x5E73, 0x6210, 0x662D, 0x548C,
+			0x5927, 0x6B63, 0x660E, 0x6CBB, 0x682A, 0x5F0F, 0x4F1A, 0x793E, 0x0070, 0x0041, 0x006E, 0x0041, 0x03BC, 0x0041, 0x006D, 0x0041,
+			0x006B, 0x0041, 0x004B, 0x0042, 0x004D, 0x0042, 0x0047, 0x0042, 0x0063, 0x0061, 0x006C, 0x006B, 0x0063, 0x0061, 0x006C, 0x0070,
+			0x0046, 0x006E, 0x0046, 0x03BC, 0x0046, 0x03BC, 0x0067, 0x006D, 0x0067, 0x006B, 0x0067, 0x0048, 0x007A, 0x006B, 0x0048, 0x007A,
+			0x004D, 0x0048, 0x007A, 0x0047, 0x0048, 0x007A, 0x0054, 0x0048, 0x007A, 0x03BC, 0x006C, 0x006D, 0x006C, 0x0064, 0x006C, 0x006B,
+			0x006C, 0x0066, 0x006D, 0x006E, 0x006D, 0x03BC, 0x006D, 0x006D, 0x006D, 0x0063, 0x006D, 0x006B, 0x006D, 0x006D, 0x006D, 0x0032,
+			0x0063, 0x006D, 0x0032, 0x006D, 0x0032, 0x006B, 0x006D, 0x0032, 0x006D, 0x006D, 0x0033, 0x0063, 0x006D, 0x0033, 0x006D, 0x0033,
+			0x006B, 0x006D, 0x0033, 0x006D, 0x2215, 0x0073, 0x006D, 0x2215, 0x0073, 0x0032, 0x0050, 0x0061, 0x006B, 0x0050, 0x0061, 0x004D,
+			0x0050, 0x0061, 0x0047, 0x0050, 0x0061, 0x0072, 0x0061, 0x0064, 0x0072, 0x0061, 0x0064, 0x2215, 0x0073, 0x0072, 0x0061, 0x0064,
+			0x2215, 0x0073, 0x0032, 0x0070, 0x0073, 0x006E, 0x0073, 0x03BC, 0x0073, 0x006D, 0x0073, 0x0070, 0x0056, 0x006E, 0x0056, 0x03BC,
+			0x0056, 0x006D, 0x0056, 0x006B, 0x0056, 0x004D, 0x0056, 0x0070, 0x0057, 0x006E, 0x0057, 0x03BC, 0x0057, 0x006D, 0x0057, 0x006B,
+			0x0057, 0x004D, 0x0057, 0x006B, 0x03A9, 0x004D, 0x03A9, 0x0061, 0x002E, 0x006D, 0x002E, 0x0042, 0x0071, 0x0063, 0x0063, 0x0063,
+			0x0064, 0x0043, 0x2215, 0x006B, 0x0067, 0x0043, 0x006F, 0x002E, 0x0064, 0x0042, 0x0047, 0x0079, 0x0068, 0x0061, 0x0048, 0x0050,
+			0x0069, 0x006E, 0x004B, 0x004B, 0x004B, 0x004D, 0x006B, 0x0074, 0x006C, 0x006D, 0x006C, 0x006E, 0x006C, 0x006F, 0x0067, 0x006C,
+			0x0078, 0x006D, 0x0062, 0x006D, 0x0069, 0x006C, 0x006D, 0x006F, 0x006C, 0x0050, 0x0048, 0x0070, 0x002E, 0x006D, 0x002E, 0x0050,
+			0x0050, 0x004D, 0x0050, 0x0052, 0x0073, 0x0072, 0x0053, 0x0076, 0x0057, 0x0062, 0x0056, 0x2215, 0x006D, 0x0041, 0x2215, 0x006D,
+			0x0031, 0x65E5, 0x0032, 0x65E5, 0x0033, 0x65E5, 0x0034, 0x65E5, 0x0035, 0x65E5, 0x0036, 0x65E5, 0x0037, 0x65E5, 0x0038, 0x65E5,
+			0x0039, 0x65E5, 0x0031, 0x0030, 0x65E5, 0x0031, 0x0031, 0x65E5, 0x0031, 0x0032, 0x65E5, 0x0031, 0x0033, 0x65E5, 0x0031, 0x0034,
+			0x65E5, 0x0031, 0x0035, 0x65E5, 0x0031, 0x0036, 0x65E5, 0x0031, 0x0037, 0x65E5, 0x0031, 0x0038, 0x65E5, 0x0031, 0x0039, 0x65E5,
+			0x0032, 0x0030, 0x65E5, 0x0032, 0x0031, 0x65E5, 0x0032, 0x0032, 0x65E5, 0x0032, 0x0033, 0x65E5, 0x0032, 0x0034, 0x65E5, 0x0032,
+			0x0035, 0x65E5, 0x0032, 0x0036, 0x65E5, 0x0032, 0x0037, 0x65E5, 0x0032, 0x0038, 0x65E5, 0x0032, 0x0039, 0x65E5, 0x0033, 0x0030,
+			0x65E5, 0x0033, 0x0031, 0x65E5, 0x0067, 0x0061, 0x006C, 0x044A, 0x044C, 0xA76F, 0x0043, 0x0046, 0x0051, 0x0126, 0x0153, 0xA727,
+			0xAB37, 0x026B, 0xAB52, 0x028D, 0x8C48, 0x66F4, 0x8ECA, 0x8CC8, 0x6ED1, 0x4E32, 0x53E5, 0x9F9C, 0x9F9C, 0x5951, 0x91D1, 0x5587,
+			0x5948, 0x61F6, 0x7669, 0x7F85, 0x863F, 0x87BA, 0x88F8, 0x908F, 0x6A02, 0x6D1B, 0x70D9, 0x73DE, 0x843D, 0x916A, 0x99F1, 0x4E82,
+			0x5375, 0x6B04, 0x721B, 0x862D, 0x9E1E, 0x5D50, 0x6FEB, 0x85CD, 0x8964, 0x62C9, 0x81D8, 0x881F, 0x5ECA, 0x6717, 0x6D6A, 0x72FC,
+			0x90CE, 0x4F86, 0x51B7, 0x52DE, 0x64C4, 0x6AD3, 0x7210, 0x76E7, 0x8001, 0x8606, 0x865C, 0x8DEF, 0x9732, 0x9B6F, 0x9DFA, 0x788C,
+			0x797F, 0x7DA0, 0x83C9, 0x9304, 0x9E7F, 0x8AD6, 0x58DF, 0x5F04, 0x7C60, 0x807E, 0x7262, 0x78CA, 0x8CC2, 0x96F7, 0x58D8, 0x5C62,
+			0x6A13, 0x6DDA, 0x6F0F, 0x7D2F, 0x7E37, 0x964B, 0x52D2, 0x808B, 0x51DC, 0x51CC, 0x7A1C, 0x7DBE, 0x83F1, 0x9675, 0x8B80, 0x62CF,
+			0x6A02, 0x8AFE, 0x4E39, 0x5BE7, 0x6012, 0x7387, 0x7570, 0x5317, 0x78FB, 0x4FBF, 0x5FA9, 0x4E0D, 0x6CCC, 0x6578, 0x7D22, 0x53C3,
+			0x585E, 0x7701, 0x8449, 0x8AAA, 0x6BBA, 0x8FB0, 0x6C88, 0x62FE, 0x82E5, 0x63A0, 0x7565, 0x4EAE, 0x5169, 0x51C9, 0x6881, 0x7CE7,
+			0x826F, 0x8AD2, 0x91CF, 0x52F5, 0x5442, 0x5973, 0x5EEC, 0x65C5, 0x6FFE, 0x792A, 0x95AD, 0x9A6A, 0x9E97, 0x9ECE, 0x529B, 0x66C6,
+			0x6B77, 0x8F62, 0x5E74, 0x6190, 0x6200, 0x649A, 0x6F23, 0x7149, 0x7489, 0x79CA, 0x7DF4, 0x806F, 0x8F26, 0x84EE, 0x9023, 0x934A,
+			0x5217, 0x52A3, 0x54BD, 0x70C8, 0x88C2, 0x8AAA, 0x5EC9, 0x5FF5, 0x637B, 0x6BAE, 0x7C3E, 0x7375, 0x4EE4, 0x56F9, 0x5BE7, 0x5DBA,
+			0x601C, 0x73B2, 0x7469, 0x7F9A, 0x8046, 0x9234, 0x96F6, 0x9748, 0x9818, 0x4F8B, 0x79AE, 0x91B4, 0x96B8, 0x60E1, 0x4E86, 0x50DA,
+			0x5BEE, 0x5C3F, 0x6599, 0x6A02, 0x71CE, 0x7642, 0x84FC, 0x907C, 0x9F8D, 0x6688, 0x962E, 0x5289, 0x677B, 0x67F3, 0x6D41, 0x6E9C,
+			0x7409, 0x7559, 0x786B, 0x7D10, 0x985E, 0x516D, 0x622E, 0x9678, 0x502B, 0x5D19, 0x6DEA, 0x8F2A, 0x5F8B, 0x6144, 0x6817, 0x7387,
+			0x9686, 0x5229, 0x540F, 0x5C65, 0x6613, 0x674E, 0x68A8, 0x6CE5, 0x7406, 0x75E2, 0x7F79, 0x88CF, 0x88E1, 0x91CC, 0x96E2, 0x533F,
+			0x6EBA, 0x541D, 0x71D0, 0x7498, 0x85FA, 0x96A3, 0x9C57, 0x9E9F, 0x6797, 0x6DCB, 0x81E8, 0x7ACB, 0x7B20, 0x7C92, 0x72C0, 0x7099,
+			0x8B58, 0x4EC0, 0x8336, 0x523A, 0x5207, 0x5EA6, 0x62D3, 0x7CD6, 0x5B85, 0x6D1E, 0x66B4, 0x8F3B, 0x884C, 0x964D, 0x898B, 0x5ED3,
+			0x5140, 0x55C0, 0x585A, 0x6674, 0x51DE, 0x732A, 0x76CA, 0x793C, 0x795E, 0x7965, 0x798F, 0x9756, 0x7CBE, 0x7FBD, 0x8612, 0x8AF8,
+			0x9038, 0x90FD, 0x98EF, 0x98FC, 0x9928, 0x9DB4, 0x90DE, 0x96B7, 0x4FAE, 0x50E7, 0x514D, 0x52C9, 0x52E4, 0x5351, 0x559D, 0x5606,
+			0x5668, 0x5840, 0x58A8, 0x5C64, 0x5C6E, 0x6094, 0x6168, 0x618E, 0x61F2, 0x654F, 0x65E2, 0x6691, 0x6885, 0x6D77, 0x6E1A, 0x6F22,
+			0x716E, 0x722B, 0x7422, 0x7891, 0x793E, 0x7949, 0x7948, 0x7950, 0x7956, 0x795D, 0x798D, 0x798E, 0x7A40, 0x7A81, 0x7BC0, 0x7DF4,
+			0x7E09, 0x7E41, 0x7F72, 0x8005, 0x81ED, 0x8279, 0x8279, 0x8457, 0x8910, 0x8996, 0x8B01, 0x8B39, 0x8CD3, 0x8D08, 0x8FB6, 0x9038,
+			0x96E3, 0x97FF, 0x983B, 0x6075, 0x242EE, 0x8218, 0x4E26, 0x51B5, 0x5168, 0x4F80, 0x5145, 0x5180, 0x52C7, 0x52FA, 0x559D, 0x5555,
+			0x5599, 0x55E2, 0x585A, 0x58B3, 0x5944, 0x5954, 0x5A62, 0x5B28, 0x5ED2, 0x5ED9, 0x5F69, 0x5FAD, 0x60D8, 0x614E, 0x6108, 0x618E,
+			0x6160, 0x61F2, 0x6234, 0x63C4, 0x641C, 0x6452, 0x6556, 0x6674, 0x6717, 0x671B, 0x6756, 0x6B79, 0x6BBA, 0x6D41, 0x6EDB, 0x6ECB,
+			0x6F22, 0x701E, 0x716E, 0x77A7, 0x7235, 0x72AF, 0x732A, 0x7471, 0x7506, 0x753B, 0x761D, 0x761F, 0x76CA, 0x76DB, 0x76F4, 0x774A,
+			0x7740, 0x78CC, 0x7AB1, 0x7BC0, 0x7C7B, 0x7D5B, 0x7DF4, 0x7F3E, 0x8005, 0x8352, 0x83EF, 0x8779, 0x8941, 0x8986, 0x8996, 0x8ABF,
+			0x8AF8, 0x8ACB, 0x8B01, 0x8AFE, 0x8AED, 0x8B39, 0x8B8A, 0x8D08, 0x8F38, 0x9072, 0x9199, 0x9276, 0x967C, 0x96E3, 0x9756, 0x97DB,
+			0x97FF, 0x980B, 0x983B, 0x9B12, 0x9F9C, 0x2284A, 0x22844, 0x233D5, 0x3B9D, 0x4018, 0x4039, 0x25249, 0x25CD0, 0x27ED3, 0x9F43, 0x9F8E,
+			0x0066, 0x0066, 0x0066, 0x0069, 0x0066, 0x006C, 0x0066, 0x0066, 0x0069, 0x0066, 0x0066, 0x006C, 0x0073, 0x0074, 0x0073, 0x0074,
+			0x0574, 0x0576, 0x0574, 0x0565, 0x0574, 0x056B, 0x057E, 0x0576, 0x0574, 0x056D, 0x05D9, 0x05B4, 0x05F2, 0x05B7, 0x05E2, 0x05D0,
+			0x05D3, 0x05D4, 0x05DB, 0x05DC, 0x05DD, 0x05E8, 0x05EA, 0x002B, 0x05E9, 0x05C1, 0x05E9, 0x05C2, 0x05E9, 0x05BC, 0x05C1, 0x05E9,
+			0x05BC, 0x05C2, 0x05D0, 0x05B7, 0x05D0, 0x05B8, 0x05D0, 0x05BC, 0x05D1, 0x05BC, 0x05D2, 0x05BC, 0x05D3, 0x05BC, 0x05D4, 0x05BC,
+			0x05D5, 0x05BC, 0x05D6, 0x05BC, 0x05D8, 0x05BC, 0x05D9, 0x05BC, 0x05DA, 0x05BC, 0x05DB, 0x05BC, 0x05DC, 0x05BC, 0x05DE, 0x05BC,
+			0x05E0, 0x05BC, 0x05E1, 0x05BC, 0x05E3, 0x05BC, 0x05E4, 0x05BC, 0x05E6, 0x05BC, 0x05E7, 0x05BC, 0x05E8, 0x05BC, 0x05E9, 0x05BC,
+			0x05EA, 0x05BC, 0x05D5, 0x05B9, 0x05D1, 0x05BF, 0x05DB, 0x05BF, 0x05E4, 0x05BF, 0x05D0, 0x05DC, 0x0671, 0x0671, 0x067B, 0x067B,
+			0x067B, 0x067B, 0x067E, 0x067E, 0x067E, 0x067E, 0x0680, 0x0680, 0x0680, 0x0680, 0x067A, 0x067A, 0x067A, 0x067A, 0x067F, 0x067F,
+			0x067F, 0x067F, 0x0679, 0x0679, 0x0679, 0x0679, 0x06A4, 0x06A4, 0x06A4, 0x06A4, 0x06A6, 0x06A6, 0x06A6, 0x06A6, 0x0684, 0x0684,
+			0x0684, 0x0684, 0x0683, 0x0683, 0x0683, 0x0683, 0x0686, 0x0686, 0x0686, 0x0686, 0x0687, 0x0687, 0x0687, 0x0687, 0x068D, 0x068D,
+			0x068C, 0x068C, 0x068E, 0x068E, 0x0688, 0x0688, 0x0698, 0x0698, 0x0691, 0x0691, 0x06A9, 0x06A9, 0x06A9, 0x06A9, 0x06AF, 0x06AF,
+			0x06AF, 0x06AF, 0x06B3, 0x06B3, 0x06B3, 0x06B3, 0x06B1, 0x06B1, 0x06B1, 0x06B1, 0x06BA, 0x06BA, 0x06BB, 0x06BB, 0x06BB, 0x06BB,
+			0x06D5, 0x0654, 0x06D5, 0x0654, 0x06C1, 0x06C1, 0x06C1, 0x06C1, 0x06BE, 0x06BE, 0x06BE, 0x06BE, 0x06D2, 0x06D2, 0x06D2, 0x0654,
+			0x06D2, 0x0654, 0x06AD, 0x06AD, 0x06AD, 0x06AD, 0x06C7, 0x06C7, 0x06C6, 0x06C6, 0x06C8, 0x06C8, 0x06C7, 0x0674, 0x06CB, 0x06CB,
+			0x06C5, 0x06C5, 0x06C9, 0x06C9, 0x06D0, 0x06D0, 0x06D0, 0x06D0, 0x0649, 0x0649, 0x064A, 0x0654, 0x0627, 0x064A, 0x0654, 0x0627,
+			0x064A, 0x0654, 0x06D5, 0x064A, 0x0654, 0x06D5, 0x064A, 0x0654, 0x0648, 0x064A, 0x0654, 0x0648, 0x064A, 0x0654, 0x06C7, 0x064A,
+			0x0654, 0x06C7, 0x064A, 0x0654, 0x06C6, 0x064A, 0x0654, 0x06C6, 0x064A, 0x0654, 0x06C8, 0x064A, 0x0654, 0x06C8, 0x064A, 0x0654,
+			0x06D0, 0x064A, 0x0654, 0x06D0, 0x064A, 0x0654, 0x06D0, 0x064A, 0x0654, 0x0649, 0x064A, 0x0654, 0x0649, 0x064A, 0x0654, 0x0649,
+			0x06CC, 0x06CC, 0x06CC, 0x06CC, 0x064A, 0x0654, 0x062C, 0x064A, 0x0654, 0x062D, 0x064A, 0x0654, 0x0645, 0x064A, 0x0654, 0x0649,
+			0x064A, 0x0654, 0x064A, 0x0628, 0x062C, 0x0628, 0x062D, 0x0628, 0x062E, 0x0628, 0x0645, 0x0628, 0x0649, 0x0628, 0x064A, 0x062A,
+			0x062C, 0x062A, 0x062D, 0x062A, 0x062E, 0x062A, 0x0645, 0x062A, 0x0649, 0x062A, 0x064A, 0x062B, 0x062C, 0x062B, 0x0645, 0x062B,
+			0x0649, 0x062B, 0x064A, 0x062C, 0x062D, 0x062C, 0x0645, 0x062D, 0x062C, 0x062D, 0x0645, 0x062E, 0x062C, 0x062E, 0x062D, 0x062E,
+			0x0645, 0x0633, 0x062C, 0x0633, 0x062D, 0x0633, 0x062E, 0x0633, 0x0645, 0x0635, 0x062D, 0x0635, 0x0645, 0x0636, 0x062C, 0x0636,
+			0x062D, 0x0636, 0x062E, 0x0636, 0x0645, 0x0637, 0x062D, 0x0637, 0x0645, 0x0638, 0x0645, 0x0639, 0x062C, 0x0639, 0x0645, 0x063A,
+			0x062C, 0x063A, 0x0645, 0x0641, 0x062C, 0x0641, 0x062D, 0x0641, 0x062E, 0x0641, 0x0645, 0x0641, 0x0649, 0x0641, 0x064A, 0x0642,
+			0x062D, 0x0642, 0x0645, 0x0642, 0x0649, 0x0642, 0x064A, 0x0643, 0x0627, 0x0643, 0x062C, 0x0643, 0x062D, 0x0643, 0x062E, 0x0643,
+			0x0644, 0x0643, 0x0645, 0x0643, 0x0649, 0x0643, 0x064A, 0x0644, 0x062C, 0x0644, 0x062D, 0x0644, 0x062E, 0x0644, 0x0645, 0x0644,
+			0x0649, 0x0644, 0x064A, 0x0645, 0x062C, 0x0645, 0x062D, 0x0645, 0x062E, 0x0645, 0x0645, 0x0645, 0x0649, 0x0645, 0x064A, 0x0646,
+			0x062C, 0x0646, 0x062D, 0x0646, 0x062E, 0x0646, 0x0645, 0x0646, 0x0649, 0x0646, 0x064A, 0x0647, 0x062C, 0x0647, 0x0645, 0x0647,
+			0x0649, 0x0647, 0x064A, 0x064A, 0x062C, 0x064A, 0x062D, 0x064A, 0x062E, 0x064A, 0x0645, 0x064A, 0x0649, 0x064A, 0x064A, 0x0630,
+			0x0670, 0x0631, 0x0670, 0x0649, 0x0670, 0x0020, 0x064C, 0x0651, 0x0020, 0x064D, 0x0651, 0x0020, 0x064E, 0x0651, 0x0020, 0x064F,
+			0x0651, 0x0020, 0x0650, 0x0651, 0x0020, 0x0651, 0x0670, 0x064A, 0x0654, 0x0631, 0x064A, 0x0654, 0x0632, 0x064A, 0x0654, 0x0645,
+			0x064A, 0x0654, 0x0646, 0x064A, 0x0654, 0x0649, 0x064A, 0x0654, 0x064A, 0x0628, 0x0631, 0x0628, 0x0632, 0x0628, 0x0645, 0x0628,
+			0x0646, 0x0628, 0x0649, 0x0628, 0x064A, 0x062A, 0x0631, 0x062A, 0x0632, 0x062A, 0x0645, 0x062A, 0x0646, 0x062A, 0x0649, 0x062A,
+			0x064A, 0x062B, 0x0631, 0x062B, 0x0632, 0x062B, 0x0645, 0x062B, 0x0646, 0x062B, 0x0649, 0x062B, 0x064A, 0x0641, 0x0649, 0x0641,
+			0x064A, 0x0642, 0x0649, 0x0642, 0x064A, 0x0643, 0x0627, 0x0643, 0x0644, 0x0643, 0x0645, 0x0643, 0x0649, 0x0643, 0x064A, 0x0644,
+			0x0645, 0x0644, 0x0649, 0x0644, 0x064A, 0x0645, 0x0627, 0x0645, 0x0645, 0x0646, 0x0631, 0x0646, 0x0632, 0x0646, 0x0645, 0x0646,
+			0x0646, 0x0646, 0x0649, 0x0646, 0x064A, 0x0649, 0x0670, 0x064A, 0x0631, 0x064A, 0x0632, 0x064A, 0x0645, 0x064A, 0x0646, 0x064A,
+			0x0649, 0x064A, 0x064A, 0x064A, 0x0654, 0x062C, 0x064A, 0x0654, 0x062D, 0x064A, 0x0654, 0x062E, 0x064A, 0x0654, 0x0645, 0x064A,
+			0x0654, 0x0647, 0x0628, 0x062C, 0x0628, 0x062D, 0x0628, 0x062E, 0x0628, 0x0645, 0x0628, 0x0647, 0x062A, 0x062C, 0x062A, 0x062D,
+			0x062A, 0x062E, 0x062A, 0x0645, 0x062A, 0x0647, 0x062B, 0x0645, 0x062C, 0x062D, 0x062C, 0x0645, 0x062D, 0x062C, 0x062D, 0x0645,
+			0x062E, 0x062C, 0x062E, 0x0645, 0x0633, 0x062C, 0x0633, 0x062D, 0x0633, 0x062E, 0x0633, 0x0645, 0x0635, 0x062D, 0x0635, 0x062E,
+			0x0635, 0x0645, 0x0636, 0x062C, 0x0636, 0x062D, 0x0636, 0x062E, 0x0636, 0x0645, 0x0637, 0x062D, 0x0638, 0x0645, 0x0639, 0x062C,
+			0x0639, 0x0645, 0x063A, 0x062C, 0x063A, 0x0645, 0x0641, 0x062C, 0x0641, 0x062D, 0x0641, 0x062E, 0x0641, 0x0645, 0x0642, 0x062D,
+			0x0642, 0x0645, 0x0643, 0x062C, 0x0643, 0x062D, 0x0643, 0x062E, 0x0643, 0x0644, 0x0643, 0x0645, 0x0644, 0x062C, 0x0644, 0x062D,
+			0x0644, 0x062E, 0x0644, 0x0645, 0x0644, 0x0647, 0x0645, 0x062C, 0x0645, 0x062D, 0x0645, 0x062E, 0x0645, 0x0645, 0x0646, 0x062C,
+			0x0646, 0x062D, 0x0646, 0x062E, 0x0646, 0x0645, 0x0646, 0x0647, 0x0647, 0x062C, 0x0647, 0x0645, 0x0647, 0x0670, 0x064A, 0x062C,
+			0x064A, 0x062D, 0x064A, 0x062E, 0x064A, 0x0645, 0x064A, 0x0647, 0x064A, 0x0654, 0x0645, 0x064A, 0x0654, 0x0647, 0x0628, 0x0645,
+			0x0628, 0x0647, 0x062A, 0x0645, 0x062A, 0x0647, 0x062B, 0x0645, 0x062B, 0x0647, 0x0633, 0x0645, 0x0633, 0x0647, 0x0634, 0x0645,
+			0x0634, 0x0647, 0x0643, 0x0644, 0x0643, 0x0645, 0x0644, 0x0645, 0x0646, 0x0645, 0x0646, 0x0647, 0x064A, 0x0645, 0x064A, 0x0647,
+			0x0640, 0x064E, 0x0651, 0x0640, 0x064F, 0x0651, 0x0640, 0x0650, 0x0651, 0x0637, 0x0649, 0x0637, 0x064A, 0x0639, 0x0649, 0x0639,
+			0x064A, 0x063A, 0x0649, 0x063A, 0x064A, 0x0633, 0x0649, 0x0633, 0x064A, 0x0634, 0x0649, 0x0634, 0x064A, 0x062D, 0x0649, 0x062D,
+			0x064A, 0x062C, 0x0649, 0x062C, 0x064A, 0x062E, 0x0649, 0x062E, 0x064A, 0x0635, 0x0649, 0x0635, 0x064A, 0x0636, 0x0649, 0x0636,
+			0x064A, 0x0634, 0x062C, 0x0634, 0x062D, 0x0634, 0x062E, 0x0634, 0x0645, 0x0634, 0x0631, 0x0633, 0x0631, 0x0635, 0x0631, 0x0636,
+			0x0631, 0x0637, 0x0649, 0x0637, 0x064A, 0x0639, 0x0649, 0x0639, 0x064A, 0x063A, 0x0649, 0x063A, 0x064A, 0x0633, 0x0649, 0x0633,
+			0x064A, 0x0634, 0x0649, 0x0634, 0x064A, 0x062D, 0x0649, 0x062D, 0x064A, 0x062C, 0x0649, 0x062C, 0x064A, 0x062E, 0x0649, 0x062E,
+			0x064A, 0x0635, 0x0649, 0x0635, 0x064A, 0x0636, 0x0649, 0x0636, 0x064A, 0x0634, 0x062C, 0x0634, 0x062D, 0x0634, 0x062E, 0x0634,
+			0x0645, 0x0634, 0x0631, 0x0633, 0x0631, 0x0635, 0x0631, 0x0636, 0x0631, 0x0634, 0x062C, 0x0634, 0x062D, 0x0634, 0x062E, 0x0634,
+			0x0645, 0x0633, 0x0647, 0x0634, 0x0647, 0x0637, 0x0645, 0x0633, 0x062C, 0x0633, 0x062D, 0x0633, 0x062E, 0x0634, 0x062C, 0x0634,
+			0x062D, 0x0634, 0x062E, 0x0637, 0x0645, 0x0638, 0x0645, 0x0627, 0x064B, 0x0627, 0x064B, 0x062A, 0x062C, 0x0645, 0x062A, 0x062D,
+			0x062C, 0x062A, 0x062D, 0x062C, 0x062A, 0x062D, 0x0645, 0x062A, 0x062E, 0x0645, 0x062A, 0x0645, 0x062C, 0x062A, 0x0645, 0x062D,
+			0x062A, 0x0645, 0x062E, 0x062C, 0x0645, 0x062D, 0x062C, 0x0645, 0x062D, 0x062D, 0x0645, 0x064A, 0x062D, 0x0645, 0x0649, 0x0633,
+			0x062D, 0x062C, 0x0633, 0x062C, 0x062D, 0x0633, 0x062C, 0x0649, 0x0633, 0x0645, 0x062D, 0x0633, 0x0645, 0x062D, 0x0633, 0x0645,
+			0x062C, 0x0633, 0x0645, 0x0645, 0x0633, 0x0645, 0x0645, 0x0635, 0x062D, 0x062D, 0x0635, 0x062D, 0x062D, 0x0635, 0x0645, 0x0645,
+			0x0634, 0x062D, 0x0645, 0x0634, 0x062D, 0x0645, 0x0634, 0x062C, 0x064A, 0x0634, 0x0645, 0x062E, 0x0634, 0x0645, 0x062E, 0x0634,
+			0x0645, 0x0645, 0x0634, 0x0645, 0x0645, 0x0636, 0x062D, 0x0649, 0x0636, 0x062E, 0x0645, 0x0636, 0x062E, 0x0645, 0x0637, 0x0645,
+			0x062D, 0x0637, 0x0645, 0x062D, 0x0637, 0x0645, 0x0645, 0x0637, 0x0645, 0x064A, 0x0639, 0x062C, 0x0645, 0x0639, 0x0645, 0x0645,
+			0x0639, 0x0645, 0x0645, 0x0639, 0x0645, 0x0649, 0x063A, 0x0645, 0x0645, 0x063A, 0x0645, 0x064A, 0x063A, 0x0645, 0x0649, 0x0641,
+			0x062E, 0x0645, 0x0641, 0x062E, 0x0645, 0x0642, 0x0645, 0x062D, 0x0642, 0x0645, 0x0645, 0x0644, 0x062D, 0x0645, 0x0644, 0x062D,
+			0x064A, 0x0644, 0x062D, 0x0649, 0x0644, 0x062C, 0x062C, 0x0644, 0x062C, 0x062C, 0x0644, 0x062E, 0x0645, 0x0644, 0x062E, 0x0645,
+			0x0644, 0x0645, 0x062D, 0x0644, 0x0645, 0x062D, 0x0645, 0x062D, 0x062C, 0x0645, 0x062D, 0x0645, 0x0645, 0x062D, 0x064A, 0x0645,
+			0x062C, 0x062D, 0x0645, 0x062C, 0x0645, 0x0645, 0x062E, 0x062C, 0x0645, 0x062E, 0x0645, 0x0645, 0x062C, 0x062E, 0x0647, 0x0645,
+			0x062C, 0x0647, 0x0645, 0x0645, 0x0646, 0x062D, 0x0645, 0x0646, 0x062D, 0x0649, 0x0646, 0x062C, 0x0645, 0x0646, 0x062C, 0x0645,
+			0x0646, 0x062C, 0x0649, 0x0646, 0x0645, 0x064A, 0x0646, 0x0645, 0x0649, 0x064A, 0x0645, 0x0645, 0x064A, 0x0645, 0x0645, 0x0628,
+			0x062E, 0x064A, 0x062A, 0x062C, 0x064A, 0x062A, 0x062C, 0x0649, 0x062A, 0x062E, 0x064A, 0x062A, 0x062E, 0x0649, 0x062A, 0x0645,
+			0x064A, 0x062A, 0x0645, 0x0649, 0x062C, 0x0645, 0x064A, 0x062C, 0x062D, 0x0649, 0x062C, 0x0645, 0x0649, 0x0633, 0x062E, 0x0649,
+			0x0635, 0x062D, 0x064A, 0x0634, 0x062D, 0x064A, 0x0636, 0x062D, 0x064A, 0x0644, 0x062C, 0x064A, 0x0644, 0x0645, 0x064A, 0x064A,
+			0x062D, 0x064A, 0x064A, 0x062C, 0x064A, 0x064A, 0x0645, 0x064A, 0x0645, 0x0645, 0x064A, 0x0642, 0x0645, 0x064A, 0x0646, 0x062D,
+			0x064A, 0x0642, 0x0645, 0x062D, 0x0644, 0x062D, 0x0645, 0x0639, 0x0645, 0x064A, 0x0643, 0x0645, 0x064A, 0x0646, 0x062C, 0x062D,
+			0x0645, 0x062E, 0x064A, 0x0644, 0x062C, 0x0645, 0x0643, 0x0645, 0x0645, 0x0644, 0x062C, 0x0645, 0x0646, 0x062C, 0x062D, 0x062C,
+			0x062D, 0x064A, 0x062D, 0x062C, 0x064A, 0x0645, 0x062C, 0x064A, 0x0641, 0x0645, 0x064A, 0x0628, 0x062D, 0x064A, 0x0643, 0x0645,
+			0x0645, 0x0639, 0x062C, 0x0645, 0x0635, 0x0645, 0x0645, 0x0633, 0x062E, 0x064A, 0x0646, 0x062C, 0x064A, 0x0635, 0x0644, 0x06D2,
+			0x0642, 0x0644, 0x06D2, 0x0627, 0x0644, 0x0644, 0x0647, 0x0627, 0x0643, 0x0628, 0x0631, 0x0645, 0x062D, 0x0645, 0x062F, 0x0635,
+			0x0644, 0x0639, 0x0645, 0x0631, 0x0633, 0x0648, 0x0644, 0x0639, 0x0644, 0x064A, 0x0647, 0x0648, 0x0633, 0x0644, 0x0645, 0x0635,
+			0x0644, 0x0649, 0x0635, 0x0644, 0x0649, 0x0020, 0x0627, 0x0644, 0x0644, 0x0647, 0x0020, 0x0639, 0x0644, 0x064A, 0x0647, 0x0020,
+			0x0648, 0x0633, 0x0644, 0x0645, 0x062C, 0x0644, 0x0020, 0x062C, 0x0644, 0x0627, 0x0644, 0x0647, 0x0631, 0x06CC, 0x0627, 0x0644,
+			0x002C, 0x3001, 0x3002, 0x003A, 0x003B, 0x0021, 0x003F, 0x3016, 0x3017, 0x002E, 0x002E, 0x002E, 0x002E, 0x002E, 0x2014, 0x2013,
+			0x005F, 0x005F, 0x0028, 0x0029, 0x007B, 0x007D, 0x3014, 0x3015, 0x3010, 0x3011, 0x300A, 0x300B, 0x3008, 0x3009, 0x300C, 0x300D,
+			0x300E, 0x300F, 0x005B, 0x005D, 0x0020, 0x0305, 0x0020, 0x0305, 0x0020, 0x0305, 0x0020, 0x0305, 0x005F, 0x005F, 0x005F, 0x002C,
+			0x3001, 0x002E, 0x003B, 0x003A, 0x003F, 0x0021, 0x2014, 0x0028, 0x0029, 0x007B, 0x007D, 0x3014, 0x3015, 0x0023, 0x0026, 0x002A,
+			0x002B, 0x002D, 0x003C, 0x003E, 0x003D, 0x005C, 0x0024, 0x0025, 0x0040, 0x0020, 0x064B, 0x0640, 0x064B, 0x0020, 0x064C, 0x0020,
+			0x064D, 0x0020, 0x064E, 0x0640, 0x064E, 0x0020, 0x064F, 0x0640, 0x064F, 0x0020, 0x0650, 0x0640, 0x0650, 0x0020, 0x0651, 0x0640,
+			0x0651, 0x0020, 0x0652, 0x0640, 0x0652, 0x0621, 0x0627, 0x0653, 0x0627, 0x0653, 0x0627, 0x0654, 0x0627, 0x0654, 0x0648, 0x0654,
+			0x0648, 0x0654, 0x0627, 0x0655, 0x0627, 0x0655, 0x064A, 0x0654, 0x064A, 0x0654, 0x064A, 0x0654, 0x064A, 0x0654, 0x0627, 0x0627,
+			0x0628, 0x0628, 0x0628, 0x0628, 0x0629, 0x0629, 0x062A, 0x062A, 0x062A, 0x062A, 0x062B, 0x062B, 0x062B, 0x062B, 0x062C, 0x062C,
+			0x062C, 0x062C, 0x062D, 0x062D, 0x062D, 0x062D, 0x062E, 0x062E, 0x062E, 0x062E, 0x062F, 0x062F, 0x0630, 0x0630, 0x0631, 0x0631,
+			0x0632, 0x0632, 0x0633, 0x0633, 0x0633, 0x0633, 0x0634, 0x0634, 0x0634, 0x0634, 0x0635, 0x0635, 0x0635, 0x0635, 0x0636, 0x0636,
+			0x0636, 0x0636, 0x0637, 0x0637, 0x0637, 0x0637, 0x0638, 0x0638, 0x0638, 0x0638, 0x0639, 0x0639, 0x0639, 0x0639, 0x063A, 0x063A,
+			0x063A, 0x063A, 0x0641, 0x0641, 0x0641, 0x0641, 0x0642, 0x0642, 0x0642, 0x0642, 0x0643, 0x0643, 0x0643, 0x0643, 0x0644, 0x0644,
+			0x0644, 0x0644, 0x0645, 0x0645, 0x0645, 0x0645, 0x0646, 0x0646, 0x0646, 0x0646, 0x0647, 0x0647, 0x0647, 0x0647, 0x0648, 0x0648,
+			0x0649, 0x0649, 0x064A, 0x064A, 0x064A, 0x064A, 0x0644, 0x0627, 0x0653, 0x0644, 0x0627, 0x0653, 0x0644, 0x0627, 0x0654, 0x0644,
+			0x0627, 0x0654, 0x0644, 0x0627, 0x0655, 0x0644, 0x0627, 0x0655, 0x0644, 0x0627, 0x0644, 0x0627, 0x0021, 0x0022, 0x0023, 0x0024,
+			0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034,
+			0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044,
+			0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054,
+			0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064,
+			0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074,
+			0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x2985, 0x2986, 0x3002, 0x300C, 0x300D, 0x3001,
+			0x30FB, 0x30F2, 0x30A1, 0x30A3, 0x30A5, 0x30A7, 0x30A9, 0x30E3, 0x30E5, 0x30E7, 0x30C3, 0x30FC, 0x30A2, 0x30A4, 0x30A6, 0x30A8,
+			0x30AA, 0x30AB, 0x30AD, 0x30AF, 0x30B1, 0x30B3, 0x30B5, 0x30B7, 0x30B9, 0x30BB, 0x30BD, 0x30BF, 0x30C1, 0x30C4, 0x30C6, 0x30C8,
+			0x30CA, 0x30CB, 0x30CC, 0x30CD, 0x30CE, 0x30CF, 0x30D2, 0x30D5, 0x30D8, 0x30DB, 0x30DE, 0x30DF, 0x30E0, 0x30E1, 0x30E2, 0x30E4,
+			0x30E6, 0x30E8, 0x30E9, 0x30EA, 0x30EB, 0x30EC, 0x30ED, 0x30EF, 0x30F3, 0x3099, 0x309A, 0x1160, 0x1100, 0x1101, 0x11AA, 0x1102,
+			0x11AC, 0x11AD, 0x1103, 0x1104, 0x1105, 0x11B0, 0x11B1, 0x11B2, 0x11B3, 0x11B4, 0x11B5, 0x111A, 0x1106, 0x1107, 0x1108, 0x1121,
+			0x1109, 0x110A, 0x110B, 0x110C, 0x110D, 0x110E, 0x110F, 0x1110, 0x1111, 0x1112, 0x1161, 0x1162, 0x1163, 0x1164, 0x1165, 0x1166,
+			0x1167, 0x1168, 0x1169, 0x116A, 0x116B, 0x116C, 0x116D, 0x116E, 0x116F, 0x1170, 0x1171, 0x1172, 0x1173, 0x1174, 0x1175, 0x00A2,
+			0x00A3, 0x00AC, 0x0020, 0x0304, 0x00A6, 0x00A5, 0x20A9, 0x2502, 0x2190, 0x2191, 0x2192, 0x2193, 0x25A0, 0x25CB, 0x02D0, 0x02D1,
+			0x00E6, 0x0299, 0x0253, 0x02A3, 0xAB66, 0x02A5, 0x02A4, 0x0256, 0x0257, 0x1D91, 0x0258, 0x025E, 0x02A9, 0x0264, 0x0262, 0x0260,
+			0x029B, 0x0127, 0x029C, 0x0267, 0x0284, 0x02AA, 0x02AB, 0x026C, 0x1DF04, 0xA78E, 0x026E, 0x1DF05, 0x028E, 0x1DF06, 0x00F8, 0x0276,
+			0x0277, 0x0071, 0x027A, 0x1DF08, 0x027D, 0x027E, 0x0280, 0x02A8, 0x02A6, 0xAB67, 0x02A7, 0x0288, 0x2C71, 0x028F, 0x02A1, 0x02A2,
+			0x0298, 0x01C0, 0x01C1, 0x01C2, 0x1DF0A, 0x1DF1E, 0x11099, 0x110BA, 0x1109B, 0x110BA, 0x110A5, 0x110BA, 0x11131, 0x11127, 0x11132, 0x11127,
+			0x11347, 0x1133E, 0x11347, 0x11357, 0x114B9, 0x114BA, 0x114B9, 0x114B0, 0x114B9, 0x114BD, 0x115B8, 0x115AF, 0x115B9, 0x115AF, 0x11935, 0x11930,
+			0x1D157, 0x1D165, 0x1D158, 0x1D165, 0x1D158, 0x1D165, 0x1D16E, 0x1D158, 0x1D165, 0x1D16F, 0x1D158, 0x1D165, 0x1D170, 0x1D158, 0x1D165, 0x1D171,
+			0x1D158, 0x1D165, 0x1D172, 0x1D1B9, 0x1D165, 0x1D1BA, 0x1D165, 0x1D1B9, 0x1D165, 0x1D16E, 0x1D1BA, 0x1D165, 0x1D16E, 0x1D1B9, 0x1D165, 0x1D16F,
+			0x1D1BA, 0x1D165, 0x1D16F, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D,
+			0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x0061, 0x0062, 0x0063,
+			0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073,
+			0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049,
+			0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059,
+			0x005A, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070,
+			0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046,
+			0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056,
+			0x0057, 0x0058, 0x0059, 0x005A, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C,
+			0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x0041, 0x0043,
+			0x0044, 0x0047, 0x004A, 0x004B, 0x004E, 0x004F, 0x0050, 0x0051, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A,
+			0x0061, 0x0062, 0x0063, 0x0064, 0x0066, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x0070, 0x0071, 0x0072, 0x0073,
+			0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049,
+			0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059,
+			0x005A, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+			0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x0041, 0x0042, 0x0044, 0x0045, 0x0046,
+			0x0047, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059,
+			0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070,
+			0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x0041, 0x0042, 0x0044, 0x0045, 0x0046, 0x0047,
+			0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004F, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x0061, 0x0062, 0x0063,
+			0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073,
+			0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049,
+			0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059,
+			0x005A, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+			0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045,
+			0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055,
+			0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B,
+			0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x0041,
+			0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051,
+			0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+			0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+			0x0078, 0x0079, 0x007A, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D,
+			0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x0061, 0x0062, 0x0063,
+			0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073,
+			0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049,
+			0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059,
+			0x005A, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+			0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045,
+			0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055,
+			0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B,
+			0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x0131,
+			0x0237, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F,
+			0x03A0, 0x03A1, 0x0398, 0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x2207, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5,
+			0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C2, 0x03C3, 0x03C4, 0x03C5,
+			0x03C6, 0x03C7, 0x03C8, 0x03C9, 0x2202, 0x03B5, 0x03B8, 0x03BA, 0x03C6, 0x03C1, 0x03C0, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395,
+			0x0396, 0x0397, 0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F, 0x03A0, 0x03A1, 0x0398, 0x03A3, 0x03A4, 0x03A5,
+			0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x2207, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB,
+			0x03BC, 0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C2, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8, 0x03C9, 0x2202, 0x03B5,
+			0x03B8, 0x03BA, 0x03C6, 0x03C1, 0x03C0, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039A, 0x039B,
+			0x039C, 0x039D, 0x039E, 0x039F, 0x03A0, 0x03A1, 0x0398, 0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x2207, 0x03B1,
+			0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03C1,
+			0x03C2, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8, 0x03C9, 0x2202, 0x03B5, 0x03B8, 0x03BA, 0x03C6, 0x03C1, 0x03C0, 0x0391,
+			0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F, 0x03A0, 0x03A1,
+			0x0398, 0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x2207, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7,
+			0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C2, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7,
+			0x03C8, 0x03C9, 0x2202, 0x03B5, 0x03B8, 0x03BA, 0x03C6, 0x03C1, 0x03C0, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397,
+			0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F, 0x03A0, 0x03A1, 0x0398, 0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7,
+			0x03A8, 0x03A9, 0x2207, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD,
+			0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C2, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8, 0x03C9, 0x2202, 0x03B5, 0x03B8, 0x03BA,
+			0x03C6, 0x03C1, 0x03C0, 0x03DC, 0x03DD, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x0030,
+			0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036,
+			0x0037, 0x0038, 0x0039, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x0030, 0x0031, 0x0032,
+			0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x0627, 0x0628, 0x062C, 0x062F, 0x0648, 0x0632, 0x062D, 0x0637, 0x064A,
+			0x0643, 0x0644, 0x0645, 0x0646, 0x0633, 0x0639, 0x0641, 0x0635, 0x0642, 0x0631, 0x0634, 0x062A, 0x062B, 0x062E, 0x0630, 0x0636,
+			0x0638, 0x063A, 0x066E, 0x06BA, 0x06A1, 0x066F, 0x0628, 0x062C, 0x0647, 0x062D, 0x064A, 0x0643, 0x0644, 0x0645, 0x0646, 0x0633,
+			0x0639, 0x0641, 0x0635, 0x0642, 0x0634, 0x062A, 0x062B, 0x062E, 0x0636, 0x063A, 0x062C, 0x062D, 0x064A, 0x0644, 0x0646, 0x0633,
+			0x0639, 0x0635, 0x0642, 0x0634, 0x062E, 0x0636, 0x063A, 0x06BA, 0x066F, 0x0628, 0x062C, 0x0647, 0x062D, 0x0637, 0x064A, 0x0643,
+			0x0645, 0x0646, 0x0633, 0x0639, 0x0641, 0x0635, 0x0642, 0x0634, 0x062A, 0x062B, 0x062E, 0x0636, 0x0638, 0x063A, 0x066E, 0x06A1,
+			0x0627, 0x0628, 0x062C, 0x062F, 0x0647, 0x0648, 0x0632, 0x062D, 0x0637, 0x064A, 0x0644, 0x0645, 0x0646, 0x0633, 0x0639, 0x0641,
+			0x0635, 0x0642, 0x0631, 0x0634, 0x062A, 0x062B, 0x062E, 0x0630, 0x0636, 0x0638, 0x063A, 0x0628, 0x062C, 0x062F, 0x0648, 0x0632,
+			0x062D, 0x0637, 0x064A, 0x0644, 0x0645, 0x0646, 0x0633, 0x0639, 0x0641, 0x0635, 0x0642, 0x0631, 0x0634, 0x062A, 0x062B, 0x062E,
+			0x0630, 0x0636, 0x0638, 0x063A, 0x0030, 0x002E, 0x0030, 0x002C, 0x0031, 0x002C, 0x0032, 0x002C, 0x0033, 0x002C, 0x0034, 0x002C,
+			0x0035, 0x002C, 0x0036, 0x002C, 0x0037, 0x002C, 0x0038, 0x002C, 0x0039, 0x002C, 0x0028, 0x0041, 0x0029, 0x0028, 0x0042, 0x0029,
+			0x0028, 0x0043, 0x0029, 0x0028, 0x0044, 0x0029, 0x0028, 0x0045, 0x0029, 0x0028, 0x0046, 0x0029, 0x0028, 0x0047, 0x0029, 0x0028,
+			0x0048, 0x0029, 0x0028, 0x0049, 0x0029, 0x0028, 0x004A, 0x0029, 0x0028, 0x004B, 0x0029, 0x0028, 0x004C, 0x0029, 0x0028, 0x004D,
+			0x0029, 0x0028, 0x004E, 0x0029, 0x0028, 0x004F, 0x0029, 0x0028, 0x0050, 0x0029, 0x0028, 0x0051, 0x0029, 0x0028, 0x0052, 0x0029,
+			0x0028, 0x0053, 0x0029, 0x0028, 0x0054, 0x0029, 0x0028, 0x0055, 0x0029, 0x0028, 0x0056, 0x0029, 0x0028, 0x0057, 0x0029, 0x0028,
+			0x0058, 0x0029, 0x0028, 0x0059, 0x0029, 0x0028, 0x005A, 0x0029, 0x3014, 0x0053, 0x3015, 0x0043, 0x0052, 0x0043, 0x0044, 0x0057,
+			0x005A, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+			0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x0048, 0x0056, 0x004D, 0x0056, 0x0053,
+			0x0044, 0x0053, 0x0053, 0x0050, 0x0050, 0x0056, 0x0057, 0x0043, 0x004D, 0x0043, 0x004D, 0x0044, 0x004D, 0x0052, 0x0044, 0x004A,
+			0x307B, 0x304B, 0x30B3, 0x30B3, 0x30B5, 0x624B, 0x5B57, 0x53CC, 0x30C6, 0x3099, 0x4E8C, 0x591A, 0x89E3, 0x5929, 0x4EA4, 0x6620,
+			0x7121, 0x6599, 0x524D, 0x5F8C, 0x518D, 0x65B0, 0x521D, 0x7D42, 0x751F, 0x8CA9, 0x58F0, 0x5439, 0x6F14, 0x6295, 0x6355, 0x4E00,
+			0x4E09, 0x904A, 0x5DE6, 0x4E2D, 0x53F3, 0x6307, 0x8D70, 0x6253, 0x7981, 0x7A7A, 0x5408, 0x6E80, 0x6709, 0x6708, 0x7533, 0x5272,
+			0x55B6, 0x914D, 0x3014, 0x672C, 0x3015, 0x3014, 0x4E09, 0x3015, 0x3014, 0x4E8C, 0x3015, 0x3014, 0x5B89, 0x3015, 0x3014, 0x70B9,
+			0x3015, 0x3014, 0x6253, 0x3015, 0x3014, 0x76D7, 0x3015, 0x3014, 0x52DD, 0x3015, 0x3014, 0x6557, 0x3015, 0x5F97, 0x53EF, 0x0030,
+			0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x4E3D, 0x4E38, 0x4E41, 0x20122, 0x4F60, 0x4FAE, 0x4FBB,
+			0x5002, 0x507A, 0x5099, 0x50E7, 0x50CF, 0x349E, 0x2063A, 0x514D, 0x5154, 0x5164, 0x5177, 0x2051C, 0x34B9, 0x5167, 0x518D, 0x2054B,
+			0x5197, 0x51A4, 0x4ECC, 0x51AC, 0x51B5, 0x291DF, 0x51F5, 0x5203, 0x34DF, 0x523B, 0x5246, 0x5272, 0x5277, 0x3515, 0x52C7, 0x52C9,
+			0x52E4, 0x52FA, 0x5305, 0x5306, 0x5317, 0x5349, 0x5351, 0x535A, 0x5373, 0x537D, 0x537F, 0x537F, 0x537F, 0x20A2C, 0x7070, 0x53CA,
+			0x53DF, 0x20B63, 0x53EB, 0x53F1, 0x5406, 0x549E, 0x5438, 0x5448, 0x5468, 0x54A2, 0x54F6, 0x5510, 0x5553, 0x5563, 0x5584, 0x5584,
+			0x5599, 0x55AB, 0x55B3, 0x55C2, 0x5716, 0x5606, 0x5717, 0x5651, 0x5674, 0x5207, 0x58EE, 0x57CE, 0x57F4, 0x580D, 0x578B, 0x5832,
+			0x5831, 0x58AC, 0x214E4, 0x58F2, 0x58F7, 0x5906, 0x591A, 0x5922, 0x5962, 0x216A8, 0x216EA, 0x59EC, 0x5A1B, 0x5A27, 0x59D8, 0x5A66,
+			0x36EE, 0x36FC, 0x5B08, 0x5B3E, 0x5B3E, 0x219C8, 0x5BC3, 0x5BD8, 0x5BE7, 0x5BF3, 0x21B18, 0x5BFF, 0x5C06, 0x5F53, 0x5C22, 0x3781,
+			0x5C60, 0x5C6E, 0x5CC0, 0x5C8D, 0x21DE4, 0x5D43, 0x21DE6, 0x5D6E, 0x5D6B, 0x5D7C, 0x5DE1, 0x5DE2, 0x382F, 0x5DFD, 0x5E28, 0x5E3D,
+			0x5E69, 0x3862, 0x22183, 0x387C, 0x5EB0, 0x5EB3, 0x5EB6, 0x5ECA, 0x2A392, 0x5EFE, 0x22331, 0x22331, 0x8201, 0x5F22, 0x5F22, 0x38C7,
+			0x232B8, 0x261DA, 0x5F62, 0x5F6B, 0x38E3, 0x5F9A, 0x5FCD, 0x5FD7, 0x5FF9, 0x6081, 0x393A, 0x391C, 0x6094, 0x226D4, 0x60C7, 0x6148,
+			0x614C, 0x614E, 0x614C, 0x617A, 0x618E, 0x61B2, 0x61A4, 0x61AF, 0x61DE, 0x61F2, 0x61F6, 0x6210, 0x621B, 0x625D, 0x62B1, 0x62D4,
+			0x6350, 0x22B0C, 0x633D, 0x62FC, 0x6368, 0x6383, 0x63E4, 0x22BF1, 0x6422, 0x63C5, 0x63A9, 0x3A2E, 0x6469, 0x647E, 0x649D, 0x6477,
+			0x3A6C, 0x654F, 0x656C, 0x2300A, 0x65E3, 0x66F8, 0x6649, 0x3B19, 0x6691, 0x3B08, 0x3AE4, 0x5192, 0x5195, 0x6700, 0x669C, 0x80AD,
+			0x43D9, 0x6717, 0x671B, 0x6721, 0x675E, 0x6753, 0x233C3, 0x3B49, 0x67FA, 0x6785, 0x6852, 0x6885, 0x2346D, 0x688E, 0x681F, 0x6914,
+			0x3B9D, 0x6942, 0x69A3, 0x69EA, 0x6AA8, 0x236A3, 0x6ADB, 0x3C18, 0x6B21, 0x238A7, 0x6B54, 0x3C4E, 0x6B72, 0x6B9F, 0x6BBA, 0x6BBB,
+			0x23A8D, 0x21D0B, 0x23AFA, 0x6C4E, 0x23CBC, 0x6CBF, 0x6CCD, 0x6C67, 0x6D16, 0x6D3E, 0x6D77, 0x6D41, 0x6D69, 0x6D78, 0x6D85, 0x23D1E,
+			0x6D34, 0x6E2F, 0x6E6E, 0x3D33, 0x6ECB, 0x6EC7, 0x23ED1, 0x6DF9, 0x6F6E, 0x23F5E, 0x23F8E, 0x6FC6, 0x7039, 0x701E, 0x701B, 0x3D96,
+			0x704A, 0x707D, 0x7077, 0x70AD, 0x20525, 0x7145, 0x24263, 0x719C, 0x243AB, 0x7228, 0x7235, 0x7250, 0x24608, 0x7280, 0x7295, 0x24735,
+			0x24814, 0x737A, 0x738B, 0x3EAC, 0x73A5, 0x3EB8, 0x3EB8, 0x7447, 0x745C, 0x7471, 0x7485, 0x74CA, 0x3F1B, 0x7524, 0x24C36, 0x753E,
+			0x24C92, 0x7570, 0x2219F, 0x7610, 0x24FA1, 0x24FB8, 0x25044, 0x3FFC, 0x4008, 0x76F4, 0x250F3, 0x250F2, 0x25119, 0x25133, 0x771E, 0x771F,
+			0x771F, 0x774A, 0x4039, 0x778B, 0x4046, 0x4096, 0x2541D, 0x784E, 0x788C, 0x78CC, 0x40E3, 0x25626, 0x7956, 0x2569A, 0x256C5, 0x798F,
+			0x79EB, 0x412F, 0x7A40, 0x7A4A, 0x7A4F, 0x2597C, 0x25AA7, 0x25AA7, 0x7AEE, 0x4202, 0x25BAB, 0x7BC6, 0x7BC9, 0x4227, 0x25C80, 0x7CD2,
+			0x42A0, 0x7CE8, 0x7CE3, 0x7D00, 0x25F86, 0x7D63, 0x4301, 0x7DC7, 0x7E02, 0x7E45, 0x4334, 0x26228, 0x26247, 0x4359, 0x262D9, 0x7F7A,
+			0x2633E, 0x7F95, 0x7FFA, 0x8005, 0x264DA, 0x26523, 0x8060, 0x265A8, 0x8070, 0x2335F, 0x43D5, 0x80B2, 0x8103, 0x440B, 0x813E, 0x5AB5,
+			0x267A7, 0x267B5, 0x23393, 0x2339C, 0x8201, 0x8204, 0x8F9E, 0x446B, 0x8291, 0x828B, 0x829D, 0x52B3, 0x82B1, 0x82B3, 0x82BD, 0x82E6,
+			0x26B3C, 0x82E5, 0x831D, 0x8363, 0x83AD, 0x8323, 0x83BD, 0x83E7, 0x8457, 0x8353, 0x83CA, 0x83CC, 0x83DC, 0x26C36, 0x26D6B, 0x26CD5,
+			0x452B, 0x84F1, 0x84F3, 0x8516, 0x273CA, 0x8564, 0x26F2C, 0x455D, 0x4561, 0x26FB1, 0x270D2, 0x456B, 0x8650, 0x865C, 0x8667, 0x8669,
+			0x86A9, 0x8688, 0x870E, 0x86E2, 0x8779, 0x8728, 0x876B, 0x8786, 0x45D7, 0x87E1, 0x8801, 0x45F9, 0x8860, 0x8863, 0x27667, 0x88D7,
+			0x88DE, 0x4635, 0x88FA, 0x34BB, 0x278AE, 0x27966, 0x46BE, 0x46C7, 0x8AA0, 0x8AED, 0x8B8A, 0x8C55, 0x27CA8, 0x8CAB, 0x8CC1, 0x8D1B,
+			0x8D77, 0x27F2F, 0x20804, 0x8DCB, 0x8DBC, 0x8DF0, 0x208DE, 0x8ED4, 0x8F38, 0x285D2, 0x285ED, 0x9094, 0x90F1, 0x9111, 0x2872E, 0x911B,
+			0x9238, 0x92D7, 0x92D8, 0x927C, 0x93F9, 0x9415, 0x28BFA, 0x958B, 0x4995, 0x95B7, 0x28D77, 0x49E6, 0x96C3, 0x5DB2, 0x9723, 0x29145,
+			0x2921A, 0x4A6E, 0x4A76, 0x97E0, 0x2940A, 0x4AB2, 0x29496, 0x980B, 0x980B, 0x9829, 0x295B6, 0x98E2, 0x4B33, 0x9929, 0x99A7, 0x99C2,
+			0x99FE, 0x4BCE, 0x29B30, 0x9B12, 0x9C40, 0x9CFD, 0x4CCE, 0x4CED, 0x9D67, 0x2A0CE, 0x4CF8, 0x2A105, 0x2A20E, 0x2A291, 0x9EBB, 0x4D56,
+			0x9EF9, 0x9EFE, 0x9F05, 0x9F0F, 0x9F16, 0x9F3B, 0x2A600,
+		};
+
+		constexpr unsigned decomposition_shift = 7;
+		inline constexpr std::uint8_t decomposition_stage1[] = {
+			0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 10, 11, 12, 0, 0, 0, 0, 13, 14, 15, 0, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+			26, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0, 29, 30, 31, 32, 33, 34,
+			35, 36, 37, 38, 39, 40, 41, 0, 42, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 45, 0, 0, 46, 0, 47, 0, 0, 48, 49, 50,
+			51, 52, 53, 54, 55, 56, 57, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 60, 61, 0, 0, 0, 0, 0, 0, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 77, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 78, 79, 0, 0, 0, 80, 0, 0, 81, 0, 82, 0, 0, 0, 0, 0, 0, 83, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 84, 85, 0, 0, 0, 0, 86, 87, 88, 89, 90, 91, 92, 93, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 94, 95, 0, 0,
+			0, 0, 96, 97, 98, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 99, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100, 101, 102, 103, 104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		};
+		inline constexpr std::uint16_t decomposition_stage2[] = {
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 0, 0, 0, 4, 0, 0, 5, 6, 7, 8, 0, 0, 9, 10, 11, 0, 12, 13, 14, 0,
+			15, 16, 17, 18, 19, 20, 0, 21, 22, 23, 24, 25, 26, 27, 28, 29, 0, 30, 31, 32, 33, 34, 35, 0, 0, 36, 37, 38, 39, 40, 0, 0,
+			41, 42, 43, 44, 45, 46, 0, 47, 48, 49, 50, 51, 52, 53, 54, 55, 0, 56, 57, 58, 59, 60, 61, 0, 0, 62, 63, 64, 65, 66, 0, 67,
+			68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 0, 0, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97,
+			98, 99, 100, 101, 102, 103, 0, 0, 104, 105, 106, 107, 108, 109, 110, 111, 112, 0, 113, 114, 115, 116, 117, 118, 0, 119, 120, 121, 122, 123, 124, 125,
+			126, 0, 0, 127, 128, 129, 130, 131, 132, 133, 0, 0, 134, 135, 136, 137, 138, 139, 0, 0, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151,
+			152, 153, 154, 155, 156, 157, 0, 0, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			182, 183, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 184, 185, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 0, 211, 212,
+			213, 214, 215, 216, 0, 0, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 0, 0, 233, 234, 235, 236, 237, 238, 239, 240,
+			241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 0, 0, 269, 270,
+			0, 0, 0, 0, 0, 0, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 285, 286, 287, 288, 289, 290, 291, 292, 293, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 294, 295, 296, 297, 298, 299, 0, 0,
+			300, 301, 302, 303, 304, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			305, 306, 0, 307, 308, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 309, 0, 0, 0, 0, 0, 310, 0, 0, 0, 311, 0,
+			0, 0, 0, 0, 312, 313, 314, 315, 316, 317, 318, 0, 319, 0, 320, 321, 322, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 323, 324, 325, 326, 327, 328, 329, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 330, 331, 332, 333, 334, 0, 335, 336, 337, 338, 339, 340, 341, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 342, 343, 344, 0, 345, 346, 0, 0, 0, 347, 0, 0, 0, 0, 0, 0,
+			348, 349, 0, 350, 0, 0, 0, 351, 0, 0, 0, 0, 352, 353, 354, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 355, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 356, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 357, 358, 0, 359, 0, 0, 0, 360, 0, 0, 0, 0, 361, 362, 363, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 364, 365, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 366, 367, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 368, 369, 370, 371, 0, 0, 372, 373, 0, 0, 374, 375, 376, 377, 378, 379,
+			0, 0, 380, 381, 382, 383, 384, 385, 0, 0, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 0, 0, 398, 399, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 400, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 401, 402, 403, 404, 405, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 407, 408, 409, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			410, 0, 411, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 412, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 413, 0, 0, 0, 0, 0, 0, 0, 414, 0, 0, 415, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 416, 417, 418, 419, 420, 421, 422, 423,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 424, 425, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 426, 427, 0, 428,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 429, 0, 0, 430, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 431, 432, 433, 0, 0, 434, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 435, 0, 0, 436, 437, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 438, 439, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 440, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 441, 442, 443, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 444, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			445, 0, 0, 0, 0, 0, 0, 446, 447, 0, 448, 449, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 450, 451, 452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 453, 0, 454, 455, 456, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 457, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 458, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 459, 460, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 461, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 462, 0, 0, 0, 0, 0, 0, 0, 0, 0, 463, 0, 0, 0, 0, 464, 0, 0, 0, 0, 465, 0, 0, 0, 0, 466, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 467, 0, 0, 0, 0, 0, 0, 0, 0, 0, 468, 0, 469, 470, 471, 472, 473, 0, 0, 0, 0, 0, 0,
+			0, 474, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 475, 0, 0, 0, 0, 0, 0, 0, 0, 0, 476, 0, 0,
+			0, 0, 477, 0, 0, 0, 0, 478, 0, 0, 0, 0, 479, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 480, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 481, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 482, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 483, 0, 484, 0, 485, 0, 486, 0, 487, 0, 0, 0, 488, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 489, 0, 490, 0, 0,
+			491, 492, 0, 493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 494, 495, 496, 0, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 0, 508, 509, 510, 511,
+			512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 0, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542,
+			543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 554, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 555, 556, 557, 558, 559,
+			560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623,
+			624, 625, 626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655,
+			656, 657, 658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673, 674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687,
+			688, 689, 690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719,
+			720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735, 736, 737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 0, 0, 0, 0,
+			748, 749, 750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 779,
+			780, 781, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794, 795, 796, 797, 798, 799, 800, 801, 802, 803, 804, 805, 806, 807, 808, 809, 810, 811,
+			812, 813, 814, 815, 816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 830, 831, 832, 833, 834, 835, 836, 837, 0, 0, 0, 0, 0, 0,
+			838, 839, 840, 841, 842, 843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858, 859, 0, 0, 860, 861, 862, 863, 864, 865, 0, 0,
+			866, 867, 868, 869, 870, 871, 872, 873, 874, 875, 876, 877, 878, 879, 880, 881, 882, 883, 884, 885, 886, 887, 888, 889, 890, 891, 892, 893, 894, 895, 896, 897,
+			898, 899, 900, 901, 902, 903, 0, 0, 904, 905, 906, 907, 908, 909, 0, 0, 910, 911, 912, 913, 914, 915, 916, 917, 0, 918, 0, 919, 0, 920, 0, 921,
+			922, 923, 924, 925, 926, 927, 928, 929, 930, 931, 932, 933, 934, 935, 936, 937, 938, 939, 940, 941, 942, 943, 944, 945, 946, 947, 948, 949, 950, 951, 0, 0,
+			952, 953, 954, 955, 956, 957, 958, 959, 960, 961, 962, 963, 964, 965, 966, 967, 968, 969, 970, 971, 972, 973, 974, 975, 976, 977, 978, 979, 980, 981, 982, 983,
+			984, 985, 986, 987, 988, 989, 990, 991, 992, 993, 994, 995, 996, 997, 998, 999, 1000, 1001, 1002, 1003, 1004, 0, 1005, 1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014,
+			1015, 1016, 1017, 1018, 1019, 0, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 0, 0, 1034, 1035, 1036, 1037, 1038, 1039, 0, 1040, 1041, 1042,
+			1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 0, 0, 1059, 1060, 1061, 0, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 0,
+			1071, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 0, 0, 0, 0, 0, 0, 1082, 0, 0, 0, 0, 0, 1083, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 1084, 1085, 1086, 0, 0, 0, 0, 0, 0, 0, 0, 1087, 0, 0, 0, 1088, 1089, 0, 1090, 1091, 0, 0, 0, 0, 1092, 0, 1093, 0,
+			0, 0, 0, 0, 0, 0, 0, 1094, 1095, 1096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1097, 0, 0, 0, 0, 0, 0, 0, 1098,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1099, 1100, 0, 0, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112,
+			1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 0, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 1141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			1142, 1143, 1144, 1145, 0, 1146, 1147, 1148, 0, 1149, 1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 0, 1160, 1161, 0, 0, 1162, 1163, 1164, 1165, 1166, 0, 0,
+			1167, 1168, 1169, 0, 1170, 0, 1171, 0, 1172, 0, 1173, 1174, 1175, 1176, 0, 1177, 1178, 1179, 0, 1180, 1181, 1182, 1183, 1184, 1185, 1186, 0, 1187, 1188, 1189, 1190, 1191,
+			1192, 0, 0, 0, 0, 1193, 1194, 1195, 1196, 1197, 0, 0, 0, 0, 0, 0, 1198, 1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213,
+			1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 1246, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1247, 1248, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1249, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1250, 1251, 1252, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 1253, 0, 0, 0, 0, 1254, 0, 0, 1255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 1256, 0, 1257, 0, 0, 0, 0, 0, 1258, 1259, 0, 1260, 1261, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 1262, 0, 0, 1263, 0, 0, 1264, 0, 1265, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			1266, 0, 1267, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1268, 1269, 1270, 1271, 1272, 0, 0, 1273, 1274, 0, 0, 1275, 1276, 0, 0, 0, 0, 0, 0,
+			1277, 1278, 0, 0, 1279, 1280, 0, 0, 1281, 1282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1283, 1284, 1285, 1286, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			1287, 1288, 1289, 1290, 0, 0, 0, 0, 0, 0, 1291, 1292, 1293, 1294, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 1295, 1296, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327, 1328,
+			1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360,
+			1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392,
+			1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424,
+			1425, 1426, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1437, 1438, 1439, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1440, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1441, 1442, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1443, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1444,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1445, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477,
+			1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507, 1508, 1509,
+			1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1519, 1520, 1521, 1522, 1523, 1524, 1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535, 1536, 1537, 1538, 1539, 1540, 1541,
+			1542, 1543, 1544, 1545, 1546, 1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562, 1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573,
+			1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595, 1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603, 1604, 1605,
+			1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615, 1616, 1617, 1618, 1619, 1620, 1621, 1622, 1623, 1624, 1625, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636, 1637,
+			1638, 1639, 1640, 1641, 1642, 1643, 1644, 1645, 1646, 1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655, 1656, 1657, 1658, 1659, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			1660, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1661, 0, 1662, 1663, 1664, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1665, 0, 1666, 0, 1667, 0, 1668, 0, 1669, 0, 1670, 0, 1671, 0, 1672, 0, 1673, 0, 1674, 0,
+			1675, 0, 1676, 0, 0, 1677, 0, 1678, 0, 1679, 0, 0, 0, 0, 0, 0, 1680, 1681, 0, 1682, 1683, 0, 1684, 1685, 0, 1686, 1687, 0, 1688, 1689, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1690, 0, 0, 0, 0, 0, 0, 1691, 1692, 0, 1693, 1694,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1695, 0, 1696, 0, 1697, 0, 1698, 0, 1699, 0, 1700, 0, 1701, 0, 1702, 0, 1703, 0, 1704, 0,
+			1705, 0, 1706, 0, 0, 1707, 0, 1708, 0, 1709, 0, 0, 0, 0, 0, 0, 1710, 1711, 0, 1712, 1713, 0, 1714, 1715, 0, 1716, 1717, 0, 1718, 1719, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1720, 0, 0, 1721, 1722, 1723, 1724, 0, 0, 0, 1725, 1726,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1727, 1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740, 1741,
+			1742, 1743, 1744, 1745, 1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759, 1760, 1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773,
+			1774, 1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784, 1785, 1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795, 1796, 1797, 1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805,
+			1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815, 1816, 1817, 1818, 1819, 1820, 0, 0, 0, 1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828, 1829, 1830, 1831, 1832, 1833, 1834,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			1835, 1836, 1837, 1838, 1839, 1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848, 1849, 1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865, 0,
+			1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874, 1875, 1876, 1877, 1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897,
+			1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 0, 0, 0, 0, 0, 0, 0, 0, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921,
+			1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951, 1952, 0,
+			1953, 1954, 1955, 1956, 1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983, 1984,
+			1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+			2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034, 2035, 2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047, 2048,
+			2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063, 2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079, 2080,
+			2081, 2082, 2083, 2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093, 2094, 2095, 2096, 2097, 2098, 2099, 2100, 2101, 2102, 2103, 2104, 2105, 2106, 2107, 2108, 2109, 2110, 2111, 2112,
+			2113, 2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124, 2125, 2126, 2127, 2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2140, 2141, 2142, 2143, 2144,
+			2145, 2146, 2147, 2148, 2149, 2150, 2151, 2152, 2153, 2154, 2155, 2156, 2157, 2158, 2159, 2160, 2161, 2162, 2163, 2164, 2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172, 2173, 2174, 2175, 2176,
+			2177, 2178, 2179, 2180, 2181, 2182, 2183, 2184, 2185, 2186, 2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194, 2195, 2196, 2197, 2198, 2199, 2200, 2201, 2202, 2203, 2204, 2205, 2206, 2207, 2208,
+			2209, 2210, 2211, 2212, 2213, 2214, 2215, 2216, 2217, 2218, 2219, 2220, 2221, 2222, 2223, 2224, 2225, 2226, 2227, 2228, 2229, 2230, 2231, 2232, 2233, 2234, 2235, 2236, 2237, 2238, 2239, 2240,
+			2241, 2242, 2243, 2244, 2245, 2246, 2247, 2248, 2249, 2250, 2251, 2252, 2253, 2254, 2255, 2256, 2257, 2258, 2259, 2260, 2261, 2262, 2263, 2264, 2265, 2266, 2267, 2268, 2269, 2270, 2271, 2272,
+			2273, 2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281, 2282, 2283, 2284, 2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292, 2293, 2294, 2295, 2296, 2297, 2298, 2299, 2300, 2301, 2302, 2303, 2304,
+			2305, 2306, 2307, 2308, 2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317, 2318, 2319, 2320, 2321, 2322, 2323, 2324, 2325, 2326, 2327, 2328, 2329, 2330, 2331, 2332, 2333, 2334, 2335, 2336,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2337, 2338, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2339, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2340, 2341, 2342, 0, 0, 0, 2343, 2344, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2345, 2346, 2347, 2348,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 2349, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			2350, 2351, 2352, 2353, 2354, 2355, 2356, 2357, 2358, 2359, 2360, 2361, 2362, 2363, 2364, 2365, 2366, 2367, 2368, 2369, 2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379, 2380, 2381,
+			2382, 2383, 2384, 2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394, 2395, 2396, 2397, 2398, 2399, 2400, 2401, 2402, 2403, 2404, 2405, 2406, 2407, 2408, 2409, 2410, 2411, 2412, 2413,
+			2414, 2415, 2416, 2417, 2418, 2419, 2420, 2421, 2422, 2423, 2424, 2425, 2426, 2427, 2428, 2429, 2430, 2431, 2432, 2433, 2434, 2435, 2436, 2437, 2438, 2439, 2440, 2441, 2442, 2443, 2444, 2445,
+			2446, 2447, 2448, 2449, 2450, 2451, 2452, 2453, 2454, 2455, 2456, 2457, 2458, 2459, 2460, 2461, 2462, 2463, 2464, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472, 2473, 2474, 2475, 2476, 2477,
+			2478, 2479, 2480, 2481, 2482, 2483, 2484, 2485, 2486, 2487, 2488, 2489, 2490, 2491, 2492, 2493, 2494, 2495, 2496, 2497, 2498, 2499, 2500, 2501, 2502, 2503, 2504, 2505, 2506, 2507, 2508, 2509,
+			2510, 2511, 2512, 2513, 2514, 2515, 2516, 2517, 2518, 2519, 2520, 2521, 2522, 2523, 2524, 2525, 2526, 2527, 2528, 2529, 2530, 2531, 2532, 2533, 2534, 2535, 2536, 2537, 2538, 2539, 2540, 2541,
+			2542, 2543, 2544, 2545, 2546, 2547, 2548, 2549, 2550, 2551, 2552, 2553, 2554, 2555, 2556, 2557, 2558, 2559, 2560, 2561, 2562, 2563, 2564, 2565, 2566, 2567, 2568, 2569, 2570, 2571, 2572, 2573,
+			2574, 2575, 2576, 2577, 2578, 2579, 2580, 2581, 2582, 2583, 2584, 2585, 2586, 2587, 2588, 2589, 2590, 2591, 2592, 2593, 2594, 2595, 2596, 2597, 2598, 2599, 2600, 2601, 2602, 2603, 2604, 2605,
+			2606, 2607, 2608, 2609, 2610, 2611, 2612, 2613, 2614, 2615, 2616, 2617, 2618, 2619, 0, 0, 2620, 0, 2621, 0, 0, 2622, 2623, 2624, 2625, 2626, 2627, 2628, 2629, 2630, 2631, 0,
+			2632, 0, 2633, 0, 0, 2634, 2635, 0, 0, 0, 2636, 2637, 2638, 2639, 2640, 2641, 2642, 2643, 2644, 2645, 2646, 2647, 2648, 2649, 2650, 2651, 2652, 2653, 2654, 2655, 2656, 2657,
+			2658, 2659, 2660, 2661, 2662, 2663, 2664, 2665, 2666, 2667, 2668, 2669, 2670, 2671, 2672, 2673, 2674, 2675, 2676, 2677, 2678, 2679, 2680, 2681, 2682, 2683, 2684, 2685, 2686, 2687, 2688, 2689,
+			2690, 2691, 2692, 2693, 2694, 2695, 2696, 2697, 2698, 2699, 2700, 2701, 2702, 2703, 0, 0, 2704, 2705, 2706, 2707, 2708, 2709, 2710, 2711, 2712, 2713, 2714, 2715, 2716, 2717, 2718, 2719,
+			2720, 2721, 2722, 2723, 2724, 2725, 2726, 2727, 2728, 2729, 2730, 2731, 2732, 2733, 2734, 2735, 2736, 2737, 2738, 2739, 2740, 2741, 2742, 2743, 2744, 2745, 2746, 2747, 2748, 2749, 2750, 2751,
+			2752, 2753, 2754, 2755, 2756, 2757, 2758, 2759, 2760, 2761, 2762, 2763, 2764, 2765, 2766, 2767, 2768, 2769, 2770, 2771, 2772, 2773, 2774, 2775, 2776, 2777, 2778, 2779, 2780, 2781, 2782, 2783,
+			2784, 2785, 2786, 2787, 2788, 2789, 2790, 2791, 2792, 2793, 2794, 2795, 2796, 2797, 2798, 2799, 2800, 2801, 2802, 2803, 2804, 2805, 2806, 2807, 2808, 2809, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			2810, 2811, 2812, 2813, 2814, 2815, 2816, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2817, 2818, 2819, 2820, 2821, 0, 0, 0, 0, 0, 2822, 0, 2823,
+			2824, 2825, 2826, 2827, 2828, 2829, 2830, 2831, 2832, 2833, 2834, 2835, 2836, 2837, 2838, 2839, 2840, 2841, 2842, 2843, 2844, 2845, 2846, 0, 2847, 2848, 2849, 2850, 2851, 0, 2852, 0,
+			2853, 2854, 0, 2855, 2856, 0, 2857, 2858, 2859, 2860, 2861, 2862, 2863, 2864, 2865, 2866, 2867, 2868, 2869, 2870, 2871, 2872, 2873, 2874, 2875, 2876, 2877, 2878, 2879, 2880, 2881, 2882,
+			2883, 2884, 2885, 2886, 2887, 2888, 2889, 2890, 2891, 2892, 2893, 2894, 2895, 2896, 2897, 2898, 2899, 2900, 2901, 2902, 2903, 2904, 2905, 2906, 2907, 2908, 2909, 2910, 2911, 2912, 2913, 2914,
+			2915, 2916, 2917, 2918, 2919, 2920, 2921, 2922, 2923, 2924, 2925, 2926, 2927, 2928, 2929, 2930, 2931, 2932, 2933, 2934, 2935, 2936, 2937, 2938, 2939, 2940, 2941, 2942, 2943, 2944, 2945, 2946,
+			2947, 2948, 2949, 2950, 2951, 2952, 2953, 2954, 2955, 2956, 2957, 2958, 2959, 2960, 2961, 2962, 2963, 2964, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2965, 2966, 2967, 2968, 2969, 2970, 2971, 2972, 2973, 2974, 2975, 2976, 2977,
+			2978, 2979, 2980, 2981, 2982, 2983, 2984, 2985, 2986, 2987, 2988, 2989, 2990, 2991, 2992, 2993, 2994, 2995, 2996, 2997, 2998, 2999, 3000, 3001, 3002, 3003, 3004, 3005, 3006, 3007, 3008, 3009,
+			3010, 3011, 3012, 3013, 3014, 3015, 3016, 3017, 3018, 3019, 3020, 3021, 3022, 3023, 3024, 3025, 3026, 3027, 3028, 3029, 3030, 3031, 3032, 3033, 3034, 3035, 3036, 3037, 3038, 3039, 3040, 3041,
+			3042, 3043, 3044, 3045, 3046, 3047, 3048, 3049, 3050, 3051, 3052, 3053, 3054, 3055, 3056, 3057, 3058, 3059, 3060, 3061, 3062, 3063, 3064, 3065, 3066, 3067, 3068, 3069, 3070, 3071, 3072, 3073,
+			3074, 3075, 3076, 3077, 3078, 3079, 3080, 3081, 3082, 3083, 3084, 3085, 3086, 3087, 3088, 3089, 3090, 3091, 3092, 3093, 3094, 3095, 3096, 3097, 3098, 3099, 3100, 3101, 3102, 3103, 3104, 3105,
+			3106, 3107, 3108, 3109, 3110, 3111, 3112, 3113, 3114, 3115, 3116, 3117, 3118, 3119, 3120, 3121, 3122, 3123, 3124, 3125, 3126, 3127, 3128, 3129, 3130, 3131, 3132, 3133, 3134, 3135, 3136, 3137,
+			3138, 3139, 3140, 3141, 3142, 3143, 3144, 3145, 3146, 3147, 3148, 3149, 3150, 3151, 3152, 3153, 3154, 3155, 3156, 3157, 3158, 3159, 3160, 3161, 3162, 3163, 3164, 3165, 3166, 3167, 3168, 3169,
+			3170, 3171, 3172, 3173, 3174, 3175, 3176, 3177, 3178, 3179, 3180, 3181, 3182, 3183, 3184, 3185, 3186, 3187, 3188, 3189, 3190, 3191, 3192, 3193, 3194, 3195, 3196, 3197, 3198, 3199, 3200, 3201,
+			3202, 3203, 3204, 3205, 3206, 3207, 3208, 3209, 3210, 3211, 3212, 3213, 3214, 3215, 3216, 3217, 3218, 3219, 3220, 3221, 3222, 3223, 3224, 3225, 3226, 3227, 3228, 3229, 3230, 3231, 3232, 3233,
+			3234, 3235, 3236, 3237, 3238, 3239, 3240, 3241, 3242, 3243, 3244, 3245, 3246, 3247, 3248, 3249, 3250, 3251, 3252, 3253, 3254, 3255, 3256, 3257, 3258, 3259, 3260, 3261, 3262, 3263, 3264, 3265,
+			3266, 3267, 3268, 3269, 3270, 3271, 3272, 3273, 3274, 3275, 3276, 3277, 3278, 3279, 3280, 3281, 3282, 3283, 3284, 3285, 3286, 3287, 3288, 3289, 3290, 3291, 3292, 3293, 3294, 3295, 3296, 3297,
+			3298, 3299, 3300, 3301, 3302, 3303, 3304, 3305, 3306, 3307, 3308, 3309, 3310, 3311, 3312, 3313, 3314, 3315, 3316, 3317, 3318, 3319, 3320, 3321, 3322, 3323, 3324, 3325, 3326, 3327, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3328, 3329, 3330, 3331, 3332, 3333, 3334, 3335, 3336, 3337, 3338, 3339, 3340, 3341, 3342, 3343,
+			3344, 3345, 3346, 3347, 3348, 3349, 3350, 3351, 3352, 3353, 3354, 3355, 3356, 3357, 3358, 3359, 3360, 3361, 3362, 3363, 3364, 3365, 3366, 3367, 3368, 3369, 3370, 3371, 3372, 3373, 3374, 3375,
+			3376, 3377, 3378, 3379, 3380, 3381, 3382, 3383, 3384, 3385, 3386, 3387, 3388, 3389, 3390, 3391, 0, 0, 3392, 3393, 3394, 3395, 3396, 3397, 3398, 3399, 3400, 3401, 3402, 3403, 3404, 3405,
+			3406, 3407, 3408, 3409, 3410, 3411, 3412, 3413, 3414, 3415, 3416, 3417, 3418, 3419, 3420, 3421, 3422, 3423, 3424, 3425, 3426, 3427, 3428, 3429, 3430, 3431, 3432, 3433, 3434, 3435, 3436, 3437,
+			3438, 3439, 3440, 3441, 3442, 3443, 3444, 3445, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3446, 3447, 3448, 3449, 3450, 3451, 3452, 3453, 3454, 3455, 3456, 3457, 3458, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3459, 3460, 3461, 3462, 3463, 3464, 3465, 3466, 3467, 3468, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3469, 3470, 3471, 3472, 3473, 3474, 3475, 3476, 3477, 3478, 3479, 3480, 3481, 3482, 3483, 3484,
+			3485, 3486, 3487, 3488, 3489, 0, 0, 3490, 3491, 3492, 3493, 3494, 3495, 3496, 3497, 3498, 3499, 3500, 3501, 0, 3502, 3503, 3504, 3505, 3506, 3507, 3508, 3509, 3510, 3511, 3512, 3513,
+			3514, 3515, 3516, 3517, 3518, 3519, 3520, 0, 3521, 3522, 3523, 3524, 0, 0, 0, 0, 3525, 3526, 3527, 0, 3528, 0, 3529, 3530, 3531, 3532, 3533, 3534, 3535, 3536, 3537, 3538,
+			3539, 3540, 3541, 3542, 3543, 3544, 3545, 3546, 3547, 3548, 3549, 3550, 3551, 3552, 3553, 3554, 3555, 3556, 3557, 3558, 3559, 3560, 3561, 3562, 3563, 3564, 3565, 3566, 3567, 3568, 3569, 3570,
+			3571, 3572, 3573, 3574, 3575, 3576, 3577, 3578, 3579, 3580, 3581, 3582, 3583, 3584, 3585, 3586, 3587, 3588, 3589, 3590, 3591, 3592, 3593, 3594, 3595, 3596, 3597, 3598, 3599, 3600, 3601, 3602,
+			3603, 3604, 3605, 3606, 3607, 3608, 3609, 3610, 3611, 3612, 3613, 3614, 3615, 3616, 3617, 3618, 3619, 3620, 3621, 3622, 3623, 3624, 3625, 3626, 3627, 3628, 3629, 3630, 3631, 3632, 3633, 3634,
+			3635, 3636, 3637, 3638, 3639, 3640, 3641, 3642, 3643, 3644, 3645, 3646, 3647, 3648, 3649, 3650, 3651, 3652, 3653, 3654, 3655, 3656, 3657, 3658, 3659, 3660, 3661, 3662, 3663, 0, 0, 0,
+			0, 3664, 3665, 3666, 3667, 3668, 3669, 3670, 3671, 3672, 3673, 3674, 3675, 3676, 3677, 3678, 3679, 3680, 3681, 3682, 3683, 3684, 3685, 3686, 3687, 3688, 3689, 3690, 3691, 3692, 3693, 3694,
+			3695, 3696, 3697, 3698, 3699, 3700, 3701, 3702, 3703, 3704, 3705, 3706, 3707, 3708, 3709, 3710, 3711, 3712, 3713, 3714, 3715, 3716, 3717, 3718, 3719, 3720, 3721, 3722, 3723, 3724, 3725, 3726,
+			3727, 3728, 3729, 3730, 3731, 3732, 3733, 3734, 3735, 3736, 3737, 3738, 3739, 3740, 3741, 3742, 3743, 3744, 3745, 3746, 3747, 3748, 3749, 3750, 3751, 3752, 3753, 3754, 3755, 3756, 3757, 3758,
+			3759, 3760, 3761, 3762, 3763, 3764, 3765, 3766, 3767, 3768, 3769, 3770, 3771, 3772, 3773, 3774, 3775, 3776, 3777, 3778, 3779, 3780, 3781, 3782, 3783, 3784, 3785, 3786, 3787, 3788, 3789, 3790,
+			3791, 3792, 3793, 3794, 3795, 3796, 3797, 3798, 3799, 3800, 3801, 3802, 3803, 3804, 3805, 3806, 3807, 3808, 3809, 3810, 3811, 3812, 3813, 3814, 3815, 3816, 3817, 3818, 3819, 3820, 3821, 3822,
+			3823, 3824, 3825, 3826, 3827, 3828, 3829, 3830, 3831, 3832, 3833, 3834, 3835, 3836, 3837, 3838, 3839, 3840, 3841, 3842, 3843, 3844, 3845, 3846, 3847, 3848, 3849, 3850, 3851, 3852, 3853, 0,
+			0, 0, 3854, 3855, 3856, 3857, 3858, 3859, 0, 0, 3860, 3861, 3862, 3863, 3864, 3865, 0, 0, 3866, 3867, 3868, 3869, 3870, 3871, 0, 0, 3872, 3873, 3874, 0, 0, 0,
+			3875, 3876, 3877, 3878, 3879, 3880, 3881, 0, 3882, 3883, 3884, 3885, 3886, 3887, 3888, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 3889, 3890, 3891, 3892, 3893, 0, 3894, 3895, 3896, 3897, 3898, 3899, 3900, 3901, 3902, 3903, 3904, 3905, 3906, 3907, 3908, 3909, 3910, 3911, 3912, 3913, 3914, 3915, 3916, 3917, 3918,
+			3919, 3920, 3921, 3922, 3923, 3924, 3925, 3926, 3927, 3928, 3929, 3930, 3931, 3932, 3933, 3934, 3935, 0, 3936, 3937, 3938, 3939, 3940, 3941, 3942, 3943, 3944, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3945, 0, 3946, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3947, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3948, 3949, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3950, 3951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3952, 3953, 0, 3954, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3955, 3956, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3957, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3958, 3959,
+			3960, 3961, 3962, 3963, 3964, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3965, 3966, 3967, 3968, 3969,
+			3970, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			3971, 3972, 3973, 3974, 3975, 3976, 3977, 3978, 3979, 3980, 3981, 3982, 3983, 3984, 3985, 3986, 3987, 3988, 3989, 3990, 3991, 3992, 3993, 3994, 3995, 3996, 3997, 3998, 3999, 4000, 4001, 4002,
+			4003, 4004, 4005, 4006, 4007, 4008, 4009, 4010, 4011, 4012, 4013, 4014, 4015, 4016, 4017, 4018, 4019, 4020, 4021, 4022, 4023, 4024, 4025, 4026, 4027, 4028, 4029, 4030, 4031, 4032, 4033, 4034,
+			4035, 4036, 4037, 4038, 4039, 4040, 4041, 4042, 4043, 4044, 4045, 4046, 4047, 4048, 4049, 4050, 4051, 4052, 4053, 4054, 4055, 0, 4056, 4057, 4058, 4059, 4060, 4061, 4062, 4063, 4064, 4065,
+			4066, 4067, 4068, 4069, 4070, 4071, 4072, 4073, 4074, 4075, 4076, 4077, 4078, 4079, 4080, 4081, 4082, 4083, 4084, 4085, 4086, 4087, 4088, 4089, 4090, 4091, 4092, 4093, 4094, 4095, 4096, 4097,
+			4098, 4099, 4100, 4101, 4102, 4103, 4104, 4105, 4106, 4107, 4108, 4109, 4110, 4111, 4112, 4113, 4114, 4115, 4116, 4117, 4118, 4119, 4120, 4121, 4122, 4123, 4124, 4125, 4126, 0, 4127, 4128,
+			0, 0, 4129, 0, 0, 4130, 4131, 0, 0, 4132, 4133, 4134, 4135, 0, 4136, 4137, 4138, 4139, 4140, 4141, 4142, 4143, 4144, 4145, 4146, 4147, 0, 4148, 0, 4149, 4150, 4151,
+			4152, 4153, 4154, 4155, 0, 4156, 4157, 4158, 4159, 4160, 4161, 4162, 4163, 4164, 4165, 4166, 4167, 4168, 4169, 4170, 4171, 4172, 4173, 4174, 4175, 4176, 4177, 4178, 4179, 4180, 4181, 4182,
+			4183, 4184, 4185, 4186, 4187, 4188, 4189, 4190, 4191, 4192, 4193, 4194, 4195, 4196, 4197, 4198, 4199, 4200, 4201, 4202, 4203, 4204, 4205, 4206, 4207, 4208, 4209, 4210, 4211, 4212, 4213, 4214,
+			4215, 4216, 4217, 4218, 4219, 4220, 0, 4221, 4222, 4223, 4224, 0, 0, 4225, 4226, 4227, 4228, 4229, 4230, 4231, 4232, 0, 4233, 4234, 4235, 4236, 4237, 4238, 4239, 0, 4240, 4241,
+			4242, 4243, 4244, 4245, 4246, 4247, 4248, 4249, 4250, 4251, 4252, 4253, 4254, 4255, 4256, 4257, 4258, 4259, 4260, 4261, 4262, 4263, 4264, 4265, 4266, 4267, 0, 4268, 4269, 4270, 4271, 0,
+			4272, 4273, 4274, 4275, 4276, 0, 4277, 0, 0, 0, 4278, 4279, 4280, 4281, 4282, 4283, 4284, 0, 4285, 4286, 4287, 4288, 4289, 4290, 4291, 4292, 4293, 4294, 4295, 4296, 4297, 4298,
+			4299, 4300, 4301, 4302, 4303, 4304, 4305, 4306, 4307, 4308, 4309, 4310, 4311, 4312, 4313, 4314, 4315, 4316, 4317, 4318, 4319, 4320, 4321, 4322, 4323, 4324, 4325, 4326, 4327, 4328, 4329, 4330,
+			4331, 4332, 4333, 4334, 4335, 4336, 4337, 4338, 4339, 4340, 4341, 4342, 4343, 4344, 4345, 4346, 4347, 4348, 4349, 4350, 4351, 4352, 4353, 4354, 4355, 4356, 4357, 4358, 4359, 4360, 4361, 4362,
+			4363, 4364, 4365, 4366, 4367, 4368, 4369, 4370, 4371, 4372, 4373, 4374, 4375, 4376, 4377, 4378, 4379, 4380, 4381, 4382, 4383, 4384, 4385, 4386, 4387, 4388, 4389, 4390, 4391, 4392, 4393, 4394,
+			4395, 4396, 4397, 4398, 4399, 4400, 4401, 4402, 4403, 4404, 4405, 4406, 4407, 4408, 4409, 4410, 4411, 4412, 4413, 4414, 4415, 4416, 4417, 4418, 4419, 4420, 4421, 4422, 4423, 4424, 4425, 4426,
+			4427, 4428, 4429, 4430, 4431, 4432, 4433, 4434, 4435, 4436, 4437, 4438, 4439, 4440, 4441, 4442, 4443, 4444, 4445, 4446, 4447, 4448, 4449, 4450, 4451, 4452, 4453, 4454, 4455, 4456, 4457, 4458,
+			4459, 4460, 4461, 4462, 4463, 4464, 4465, 4466, 4467, 4468, 4469, 4470, 4471, 4472, 4473, 4474, 4475, 4476, 4477, 4478, 4479, 4480, 4481, 4482, 4483, 4484, 4485, 4486, 4487, 4488, 4489, 4490,
+			4491, 4492, 4493, 4494, 4495, 4496, 4497, 4498, 4499, 4500, 4501, 4502, 4503, 4504, 4505, 4506, 4507, 4508, 4509, 4510, 4511, 4512, 4513, 4514, 4515, 4516, 4517, 4518, 4519, 4520, 4521, 4522,
+			4523, 4524, 4525, 4526, 4527, 4528, 4529, 4530, 4531, 4532, 4533, 4534, 4535, 4536, 4537, 4538, 4539, 4540, 4541, 4542, 4543, 4544, 4545, 4546, 4547, 4548, 4549, 4550, 4551, 4552, 4553, 4554,
+			4555, 4556, 4557, 4558, 4559, 4560, 4561, 4562, 4563, 4564, 4565, 4566, 4567, 4568, 4569, 4570, 4571, 4572, 4573, 4574, 4575, 4576, 4577, 4578, 4579, 4580, 4581, 4582, 4583, 4584, 4585, 4586,
+			4587, 4588, 4589, 4590, 4591, 4592, 4593, 4594, 4595, 4596, 4597, 4598, 4599, 4600, 4601, 4602, 4603, 4604, 4605, 4606, 4607, 4608, 4609, 4610, 4611, 4612, 4613, 4614, 4615, 4616, 4617, 4618,
+			4619, 4620, 4621, 4622, 4623, 4624, 0, 0, 4625, 4626, 4627, 4628, 4629, 4630, 4631, 4632, 4633, 4634, 4635, 4636, 4637, 4638, 4639, 4640, 4641, 4642, 4643, 4644, 4645, 4646, 4647, 4648,
+			4649, 4650, 4651, 4652, 4653, 4654, 4655, 4656, 4657, 4658, 4659, 4660, 4661, 4662, 4663, 4664, 4665, 4666, 4667, 4668, 4669, 4670, 4671, 4672, 4673, 4674, 4675, 4676, 4677, 4678, 4679, 4680,
+			4681, 4682, 4683, 4684, 4685, 4686, 4687, 4688, 4689, 4690, 4691, 4692, 4693, 4694, 4695, 4696, 4697, 4698, 4699, 4700, 4701, 4702, 4703, 4704, 4705, 4706, 4707, 4708, 4709, 4710, 4711, 4712,
+			4713, 4714, 4715, 4716, 4717, 4718, 4719, 4720, 4721, 4722, 4723, 4724, 4725, 4726, 4727, 4728, 4729, 4730, 4731, 4732, 4733, 4734, 4735, 4736, 4737, 4738, 4739, 4740, 4741, 4742, 4743, 4744,
+			4745, 4746, 4747, 4748, 4749, 4750, 4751, 4752, 4753, 4754, 4755, 4756, 4757, 4758, 4759, 4760, 4761, 4762, 4763, 4764, 4765, 4766, 4767, 4768, 4769, 4770, 4771, 4772, 4773, 4774, 4775, 4776,
+			4777, 4778, 4779, 4780, 4781, 4782, 4783, 4784, 4785, 4786, 4787, 4788, 4789, 4790, 4791, 4792, 4793, 4794, 4795, 4796, 4797, 4798, 4799, 4800, 4801, 4802, 4803, 4804, 4805, 4806, 4807, 4808,
+			4809, 4810, 4811, 4812, 4813, 4814, 4815, 4816, 4817, 4818, 4819, 4820, 4821, 4822, 4823, 4824, 4825, 4826, 4827, 4828, 4829, 4830, 4831, 4832, 4833, 4834, 4835, 4836, 4837, 4838, 4839, 4840,
+			4841, 4842, 4843, 4844, 4845, 4846, 4847, 4848, 4849, 4850, 4851, 4852, 4853, 4854, 4855, 4856, 4857, 4858, 4859, 4860, 4861, 4862, 4863, 4864, 4865, 4866, 4867, 4868, 4869, 4870, 4871, 4872,
+			4873, 4874, 4875, 4876, 4877, 4878, 4879, 4880, 4881, 4882, 4883, 4884, 4885, 4886, 4887, 4888, 4889, 4890, 4891, 4892, 4893, 4894, 4895, 4896, 4897, 4898, 4899, 4900, 4901, 4902, 4903, 4904,
+			4905, 4906, 4907, 4908, 4909, 4910, 4911, 4912, 4913, 4914, 4915, 4916, 0, 0, 4917, 4918, 4919, 4920, 4921, 4922, 4923, 4924, 4925, 4926, 4927, 4928, 4929, 4930, 4931, 4932, 4933, 4934,
+			4935, 4936, 4937, 4938, 4939, 4940, 4941, 4942, 4943, 4944, 4945, 4946, 4947, 4948, 4949, 4950, 4951, 4952, 4953, 4954, 4955, 4956, 4957, 4958, 4959, 4960, 4961, 4962, 4963, 4964, 4965, 4966,
+			4967, 4968, 4969, 4970, 0, 4971, 4972, 4973, 4974, 4975, 4976, 4977, 4978, 4979, 4980, 4981, 4982, 4983, 4984, 4985, 4986, 4987, 4988, 4989, 4990, 4991, 4992, 4993, 4994, 4995, 4996, 4997,
+			0, 4998, 4999, 0, 5000, 0, 0, 5001, 0, 5002, 5003, 5004, 5005, 5006, 5007, 5008, 5009, 5010, 5011, 0, 5012, 5013, 5014, 5015, 0, 5016, 0, 5017, 0, 0, 0, 0,
+			0, 0, 5018, 0, 0, 0, 0, 5019, 0, 5020, 0, 5021, 0, 5022, 5023, 5024, 0, 5025, 5026, 0, 5027, 0, 0, 5028, 0, 5029, 0, 5030, 0, 5031, 0, 5032,
+			0, 5033, 5034, 0, 5035, 0, 0, 5036, 5037, 5038, 5039, 0, 5040, 5041, 5042, 5043, 5044, 5045, 5046, 0, 5047, 5048, 5049, 5050, 0, 5051, 5052, 5053, 5054, 0, 5055, 0,
+			5056, 5057, 5058, 5059, 5060, 5061, 5062, 5063, 5064, 5065, 0, 5066, 5067, 5068, 5069, 5070, 5071, 5072, 5073, 5074, 5075, 5076, 5077, 5078, 5079, 5080, 5081, 5082, 0, 0, 0, 0,
+			0, 5083, 5084, 5085, 0, 5086, 5087, 5088, 5089, 5090, 0, 5091, 5092, 5093, 5094, 5095, 5096, 5097, 5098, 5099, 5100, 5101, 5102, 5103, 5104, 5105, 5106, 5107, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			5108, 5109, 5110, 5111, 5112, 5113, 5114, 5115, 5116, 5117, 5118, 0, 0, 0, 0, 0, 5119, 5120, 5121, 5122, 5123, 5124, 5125, 5126, 5127, 5128, 5129, 5130, 5131, 5132, 5133, 5134,
+			5135, 5136, 5137, 5138, 5139, 5140, 5141, 5142, 5143, 5144, 5145, 5146, 5147, 5148, 5149, 0, 5150, 5151, 5152, 5153, 5154, 5155, 5156, 5157, 5158, 5159, 5160, 5161, 5162, 5163, 5164, 5165,
+			5166, 5167, 5168, 5169, 5170, 5171, 5172, 5173, 5174, 5175, 5176, 5177, 5178, 5179, 5180, 5181, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5182, 5183, 5184, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5185, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			5186, 5187, 5188, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5189, 5190, 5191, 5192, 5193, 5194, 5195, 5196, 5197, 5198, 5199, 5200, 5201, 5202, 5203, 5204,
+			5205, 5206, 5207, 5208, 5209, 5210, 5211, 5212, 5213, 5214, 5215, 5216, 5217, 5218, 5219, 5220, 5221, 5222, 5223, 5224, 5225, 5226, 5227, 5228, 5229, 5230, 5231, 5232, 0, 0, 0, 0,
+			5233, 5234, 5235, 5236, 5237, 5238, 5239, 5240, 5241, 0, 0, 0, 0, 0, 0, 0, 5242, 5243, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5244, 5245, 5246, 5247, 5248, 5249, 5250, 5251, 5252, 5253, 0, 0, 0, 0, 0, 0,
+			5254, 5255, 5256, 5257, 5258, 5259, 5260, 5261, 5262, 5263, 5264, 5265, 5266, 5267, 5268, 5269, 5270, 5271, 5272, 5273, 5274, 5275, 5276, 5277, 5278, 5279, 5280, 5281, 5282, 5283, 5284, 5285,
+			5286, 5287, 5288, 5289, 5290, 5291, 5292, 5293, 5294, 5295, 5296, 5297, 5298, 5299, 5300, 5301, 5302, 5303, 5304, 5305, 5306, 5307, 5308, 5309, 5310, 5311, 5312, 5313, 5314, 5315, 5316, 5317,
+			5318, 5319, 5320, 5321, 5322, 5323, 5324, 5325, 5326, 5327, 5328, 5329, 5330, 5331, 5332, 5333, 5334, 5335, 5336, 5337, 5338, 5339, 5340, 5341, 5342, 5343, 5344, 5345, 5346, 5347, 5348, 5349,
+			5350, 5351, 5352, 5353, 5354, 5355, 5356, 5357, 5358, 5359, 5360, 5361, 5362, 5363, 5364, 5365, 5366, 5367, 5368, 5369, 5370, 5371, 5372, 5373, 5374, 5375, 5376, 5377, 5378, 5379, 5380, 5381,
+			5382, 5383, 5384, 5385, 5386, 5387, 5388, 5389, 5390, 5391, 5392, 5393, 5394, 5395, 5396, 5397, 5398, 5399, 5400, 5401, 5402, 5403, 5404, 5405, 5406, 5407, 5408, 5409, 5410, 5411, 5412, 5413,
+			5414, 5415, 5416, 5417, 5418, 5419, 5420, 5421, 5422, 5423, 5424, 5425, 5426, 5427, 5428, 5429, 5430, 5431, 5432, 5433, 5434, 5435, 5436, 5437, 5438, 5439, 5440, 5441, 5442, 5443, 5444, 5445,
+			5446, 5447, 5448, 5449, 5450, 5451, 5452, 5453, 5454, 5455, 5456, 5457, 5458, 5459, 5460, 5461, 5462, 5463, 5464, 5465, 5466, 5467, 5468, 5469, 5470, 5471, 5472, 5473, 5474, 5475, 5476, 5477,
+			5478, 5479, 5480, 5481, 5482, 5483, 5484, 5485, 5486, 5487, 5488, 5489, 5490, 5491, 5492, 5493, 5494, 5495, 5496, 5497, 5498, 5499, 5500, 5501, 5502, 5503, 5504, 5505, 5506, 5507, 5508, 5509,
+			5510, 5511, 5512, 5513, 5514, 5515, 5516, 5517, 5518, 5519, 5520, 5521, 5522, 5523, 5524, 5525, 5526, 5527, 5528, 5529, 5530, 5531, 5532, 5533, 5534, 5535, 5536, 5537, 5538, 5539, 5540, 5541,
+			5542, 5543, 5544, 5545, 5546, 5547, 5548, 5549, 5550, 5551, 5552, 5553, 5554, 5555, 5556, 5557, 5558, 5559, 5560, 5561, 5562, 5563, 5564, 5565, 5566, 5567, 5568, 5569, 5570, 5571, 5572, 5573,
+			5574, 5575, 5576, 5577, 5578, 5579, 5580, 5581, 5582, 5583, 5584, 5585, 5586, 5587, 5588, 5589, 5590, 5591, 5592, 5593, 5594, 5595, 5596, 5597, 5598, 5599, 5600, 5601, 5602, 5603, 5604, 5605,
+			5606, 5607, 5608, 5609, 5610, 5611, 5612, 5613, 5614, 5615, 5616, 5617, 5618, 5619, 5620, 5621, 5622, 5623, 5624, 5625, 5626, 5627, 5628, 5629, 5630, 5631, 5632, 5633, 5634, 5635, 5636, 5637,
+			5638, 5639, 5640, 5641, 5642, 5643, 5644, 5645, 5646, 5647, 5648, 5649, 5650, 5651, 5652, 5653, 5654, 5655, 5656, 5657, 5658, 5659, 5660, 5661, 5662, 5663, 5664, 5665, 5666, 5667, 5668, 5669,
+			5670, 5671, 5672, 5673, 5674, 5675, 5676, 5677, 5678, 5679, 5680, 5681, 5682, 5683, 5684, 5685, 5686, 5687, 5688, 5689, 5690, 5691, 5692, 5693, 5694, 5695, 5696, 5697, 5698, 5699, 5700, 5701,
+			5702, 5703, 5704, 5705, 5706, 5707, 5708, 5709, 5710, 5711, 5712, 5713, 5714, 5715, 5716, 5717, 5718, 5719, 5720, 5721, 5722, 5723, 5724, 5725, 5726, 5727, 5728, 5729, 5730, 5731, 5732, 5733,
+			5734, 5735, 5736, 5737, 5738, 5739, 5740, 5741, 5742, 5743, 5744, 5745, 5746, 5747, 5748, 5749, 5750, 5751, 5752, 5753, 5754, 5755, 5756, 5757, 5758, 5759, 5760, 5761, 5762, 5763, 5764, 5765,
+			5766, 5767, 5768, 5769, 5770, 5771, 5772, 5773, 5774, 5775, 5776, 5777, 5778, 5779, 5780, 5781, 5782, 5783, 5784, 5785, 5786, 5787, 5788, 5789, 5790, 5791, 5792, 5793, 5794, 5795, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		};
+
+		// first << 21 | second, sorted, and the composite of each pair
+		inline constexpr std::uint64_t composition_keys[] = {
+			0x7800338, 0x7A00338, 0x7C00338, 0x8200300, 0x8200301, 0x8200302, 0x8200303, 0x8200304,
+			0x8200306, 0x8200307, 0x8200308, 0x8200309, 0x820030A, 0x820030C, 0x820030F, 0x8200311,
+			0x8200323, 0x8200325, 0x8200328, 0x8400307, 0x8400323, 0x8400331, 0x8600301, 0x8600302,
+			0x8600307, 0x860030C, 0x8600327, 0x8800307, 0x880030C, 0x8800323, 0x8800327, 0x880032D,
+			0x8800331, 0x8A00300, 0x8A00301, 0x8A00302, 0x8A00303, 0x8A00304, 0x8A00306, 0x8A00307,
+			0x8A00308, 0x8A00309, 0x8A0030C, 0x8A0030F, 0x8A00311, 0x8A00323, 0x8A00327, 0x8A00328,
+			0x8A0032D, 0x8A00330, 0x8C00307, 0x8E00301, 0x8E00302, 0x8E00304, 0x8E00306, 0x8E00307,
+			0x8E0030C, 0x8E00327, 0x9000302, 0x9000307, 0x9000308, 0x900030C, 0x9000323, 0x9000327,
+			0x900032E, 0x9200300, 0x9200301, 0x9200302, 0x9200303, 0x9200304, 0x9200306, 0x9200307,
+			0x9200308, 0x9200309, 0x920030C, 0x920030F, 0x9200311, 0x9200323, 0x9200328, 0x9200330,
+			0x9400302, 0x9600301, 0x960030C, 0x9600323, 0x9600327, 0x9600331, 0x9800301, 0x980030C,
+			0x9800323, 0x9800327, 0x980032D, 0x9800331, 0x9A00301, 0x9A00307, 0x9A00323, 0x9C00300,
+			0x9C00301, 0x9C00303, 0x9C00307, 0x9C0030C, 0x9C00323, 0x9C00327, 0x9C0032D, 0x9C00331,
+			0x9E00300, 0x9E00301, 0x9E00302, 0x9E00303, 0x9E00304, 0x9E00306, 0x9E00307, 0x9E00308,
+			0x9E00309, 0x9E0030B, 0x9E0030C, 0x9E0030F, 0x9E00311, 0x9E0031B, 0x9E00323, 0x9E00328,
+			0xA000301, 0xA000307, 0xA400301, 0xA400307, 0xA40030C, 0xA40030F, 0xA400311, 0xA400323,
+			0xA400327, 0xA400331, 0xA600301, 0xA600302, 0xA600307, 0xA60030C, 0xA600323, 0xA600326,
+			0xA600327, 0xA800307, 0xA80030C, 0xA800323, 0xA800326, 0xA800327, 0xA80032D, 0xA800331,
+			0xAA00300, 0xAA00301, 0xAA00302, 0xAA00303, 0xAA00304, 0xAA00306, 0xAA00308, 0xAA00309,
+			0xAA0030A, 0xAA0030B, 0xAA0030C, 0xAA0030F, 0xAA00311, 0xAA0031B, 0xAA00323, 0xAA00324,
+			0xAA00328, 0xAA0032D, 0xAA00330, 0xAC00303, 0xAC00323, 0xAE00300, 0xAE00301, 0xAE00302,
+			0xAE00307, 0xAE00308, 0xAE00323, 0xB000307, 0xB000308, 0xB200300, 0xB200301, 0xB200302,
+			0xB200303, 0xB200304, 0xB200307, 0xB200308, 0xB200309, 0xB200323, 0xB400301, 0xB400302,
+			0xB400307, 0xB40030C, 0xB400323, 0xB400331, 0xC200300, 0xC200301, 0xC200302, 0xC200303,
+			0xC200304, 0xC200306, 0xC200307, 0xC200308, 0xC200309, 0xC20030A, 0xC20030C, 0xC20030F,
+			0xC200311, 0xC200323, 0xC200325, 0xC200328, 0xC400307, 0xC400323, 0xC400331, 0xC600301,
+			0xC600302, 0xC600307, 0xC60030C, 0xC600327, 0xC800307, 0xC80030C, 0xC800323, 0xC800327,
+			0xC80032D, 0xC800331, 0xCA00300, 0xCA00301, 0xCA00302, 0xCA00303, 0xCA00304, 0xCA00306,
+			0xCA00307, 0xCA00308, 0xCA00309, 0xCA0030C, 0xCA0030F, 0xCA00311, 0xCA00323, 0xCA00327,
+			0xCA00328, 0xCA0032D, 0xCA00330, 0xCC00307, 0xCE00301, 0xCE00302, 0xCE00304, 0xCE00306,
+			0xCE00307, 0xCE0030C, 0xCE00327, 0xD000302, 0xD000307, 0xD000308, 0xD00030C, 0xD000323,
+			0xD000327, 0xD00032E, 0xD000331, 0xD200300, 0xD200301, 0xD200302, 0xD200303, 0xD200304,
+			0xD200306, 0xD200308, 0xD200309, 0xD20030C, 0xD20030F, 0xD200311, 0xD200323, 0xD200328,
+			0xD200330, 0xD400302, 0xD40030C, 0xD600301, 0xD60030C, 0xD600323, 0xD600327, 0xD600331,
+			0xD800301, 0xD80030C, 0xD800323, 0xD800327, 0xD80032D, 0xD800331, 0xDA00301, 0xDA00307,
+			0xDA00323, 0xDC00300, 0xDC00301, 0xDC00303, 0xDC00307, 0xDC0030C, 0xDC00323, 0xDC00327,
+			0xDC0032D, 0xDC00331, 0xDE00300, 0xDE00301, 0xDE00302, 0xDE00303, 0xDE00304, 0xDE00306,
+			0xDE00307, 0xDE00308, 0xDE00309, 0xDE0030B, 0xDE0030C, 0xDE0030F, 0xDE00311, 0xDE0031B,
+			0xDE00323, 0xDE00328, 0xE000301, 0xE000307, 0xE400301, 0xE400307, 0xE40030C, 0xE40030F,
+			0xE400311, 0xE400323, 0xE400327, 0xE400331, 0xE600301, 0xE600302, 0xE600307, 0xE60030C,
+			0xE600323, 0xE600326, 0xE600327, 0xE800307, 0xE800308, 0xE80030C, 0xE800323, 0xE800326,
+			0xE800327, 0xE80032D, 0xE800331, 0xEA00300, 0xEA00301, 0xEA00302, 0xEA00303, 0xEA00304,
+			0xEA00306, 0xEA00308, 0xEA00309, 0xEA0030A, 0xEA0030B, 0xEA0030C, 0xEA0030F, 0xEA00311,
+			0xEA0031B, 0xEA00323, 0xEA00324, 0xEA00328, 0xEA0032D, 0xEA00330, 0xEC00303, 0xEC00323,
+			0xEE00300, 0xEE00301, 0xEE00302, 0xEE00307, 0xEE00308, 0xEE0030A, 0xEE00323, 0xF000307,
+			0xF000308, 0xF200300, 0xF200301, 0xF200302, 0xF200303, 0xF200304, 0xF200307, 0xF200308,
+			0xF200309, 0xF20030A, 0xF200323, 0xF400301, 0xF400302, 0xF400307, 0xF40030C, 0xF400323,
+			0xF400331, 0x15000300, 0x15000301, 0x15000342, 0x18400300, 0x18400301, 0x18400303, 0x18400309,
+			0x18800304, 0x18A00301, 0x18C00301, 0x18C00304, 0x18E00301, 0x19400300, 0x19400301, 0x19400303,
+			0x19400309, 0x19E00301, 0x1A800300, 0x1A800301, 0x1A800303, 0x1A800309, 0x1AA00301, 0x1AA00304,
+			0x1AA00308, 0x1AC00304, 0x1B000301, 0x1B800300, 0x1B800301, 0x1B800304, 0x1B80030C, 0x1C400300,
+			0x1C400301, 0x1C400303, 0x1C400309, 0x1C800304, 0x1CA00301, 0x1CC00301, 0x1CC00304, 0x1CE00301,
+			0x1D400300, 0x1D400301, 0x1D400303, 0x1D400309, 0x1DE00301, 0x1E800300, 0x1E800301, 0x1E800303,
+			0x1E800309, 0x1EA00301, 0x1EA00304, 0x1EA00308, 0x1EC00304, 0x1F000301, 0x1F800300, 0x1F800301,
+			0x1F800304, 0x1F80030C, 0x20400300, 0x20400301, 0x20400303, 0x20400309, 0x20600300, 0x20600301,
+			0x20600303, 0x20600309, 0x22400300, 0x22400301, 0x22600300, 0x22600301, 0x29800300, 0x29800301,
+			0x29A00300, 0x29A00301, 0x2B400307, 0x2B600307, 0x2C000307, 0x2C200307, 0x2D000301, 0x2D200301,
+			0x2D400308, 0x2D600308, 0x2FE00307, 0x34000300, 0x34000301, 0x34000303, 0x34000309, 0x34000323,
+			0x34200300, 0x34200301, 0x34200303, 0x34200309, 0x34200323, 0x35E00300, 0x35E00301, 0x35E00303,
+			0x35E00309, 0x35E00323, 0x36000300, 0x36000301, 0x36000303, 0x36000309, 0x36000323, 0x36E0030C,
+			0x3D400304, 0x3D600304, 0x44C00304, 0x44E00304, 0x45000306, 0x45200306, 0x45C00304, 0x45E00304,
+			0x5240030C, 0x72200300, 0x72200301, 0x72200304, 0x72200306, 0x72200313, 0x72200314, 0x72200345,
+			0x72A00300, 0x72A00301, 0x72A00313, 0x72A00314, 0x72E00300, 0x72E00301, 0x72E00313, 0x72E00314,
+			0x72E00345, 0x73200300, 0x73200301, 0x73200304, 0x73200306, 0x73200308, 0x73200313, 0x73200314,
+			0x73E00300, 0x73E00301, 0x73E00313, 0x73E00314, 0x74200314, 0x74A00300, 0x74A00301, 0x74A00304,
+			0x74A00306, 0x74A00308, 0x74A00314, 0x75200300, 0x75200301, 0x75200313, 0x75200314, 0x75200345,
+			0x75800345, 0x75C00345, 0x76200300, 0x76200301, 0x76200304, 0x76200306, 0x76200313, 0x76200314,
+			0x76200342, 0x76200345, 0x76A00300, 0x76A00301, 0x76A00313, 0x76A00314, 0x76E00300, 0x76E00301,
+			0x76E00313, 0x76E00314, 0x76E00342, 0x76E00345, 0x77200300, 0x77200301, 0x77200304, 0x77200306,
+			0x77200308, 0x77200313, 0x77200314, 0x77200342, 0x77E00300, 0x77E00301, 0x77E00313, 0x77E00314,
+			0x78200313, 0x78200314, 0x78A00300, 0x78A00301, 0x78A00304, 0x78A00306, 0x78A00308, 0x78A00313,
+			0x78A00314, 0x78A00342, 0x79200300, 0x79200301, 0x79200313, 0x79200314, 0x79200342, 0x79200345,
+			0x79400300, 0x79400301, 0x79400342, 0x79600300, 0x79600301, 0x79600342, 0x79C00345, 0x7A400301,
+			0x7A400308, 0x80C00308, 0x82000306, 0x82000308, 0x82600301, 0x82A00300, 0x82A00306, 0x82A00308,
+			0x82C00306, 0x82C00308, 0x82E00308, 0x83000300, 0x83000304, 0x83000306, 0x83000308, 0x83400301,
+			0x83C00308, 0x84600304, 0x84600306, 0x84600308, 0x8460030B, 0x84E00308, 0x85600308, 0x85A00308,
+			0x86000306, 0x86000308, 0x86600301, 0x86A00300, 0x86A00306, 0x86A00308, 0x86C00306, 0x86C00308,
+			0x86E00308, 0x87000300, 0x87000304, 0x87000306, 0x87000308, 0x87400301, 0x87C00308, 0x88600304,
+			0x88600306, 0x88600308, 0x8860030B, 0x88E00308, 0x89600308, 0x89A00308, 0x8AC00308, 0x8E80030F,
+			0x8EA0030F, 0x9B000308, 0x9B200308, 0x9D000308, 0x9D200308, 0xC4E00653, 0xC4E00654, 0xC4E00655,
+			0xC9000654, 0xC9400654, 0xD8200654, 0xDA400654, 0xDAA00654, 0x12500093C, 0x12600093C, 0x12660093C,
+			0x138E009BE, 0x138E009D7, 0x168E00B3E, 0x168E00B56, 0x168E00B57, 0x172400BD7, 0x178C00BBE, 0x178C00BD7,
+			0x178E00BBE, 0x188C00C56, 0x197E00CD5, 0x198C00CC2, 0x198C00CD5, 0x198C00CD6, 0x199400CD5, 0x1A8C00D3E,
+			0x1A8C00D57, 0x1A8E00D3E, 0x1BB200DCA, 0x1BB200DCF, 0x1BB200DDF, 0x1BB800DCA, 0x204A0102E, 0x360A01B35,
+			0x360E01B35, 0x361201B35, 0x361601B35, 0x361A01B35, 0x362201B35, 0x367401B35, 0x367801B35, 0x367C01B35,
+			0x367E01B35, 0x368401B35, 0x3C6C00304, 0x3C6E00304, 0x3CB400304, 0x3CB600304, 0x3CC400307, 0x3CC600307,
+			0x3D4000302, 0x3D4000306, 0x3D4200302, 0x3D4200306, 0x3D7000302, 0x3D7200302, 0x3D9800302, 0x3D9A00302,
+			0x3E0000300, 0x3E0000301, 0x3E0000342, 0x3E0000345, 0x3E0200300, 0x3E0200301, 0x3E0200342, 0x3E0200345,
+			0x3E0400345, 0x3E0600345, 0x3E0800345, 0x3E0A00345, 0x3E0C00345, 0x3E0E00345, 0x3E1000300, 0x3E1000301,
+			0x3E1000342, 0x3E1000345, 0x3E1200300, 0x3E1200301, 0x3E1200342, 0x3E1200345, 0x3E1400345, 0x3E1600345,
+			0x3E1800345, 0x3E1A00345, 0x3E1C00345, 0x3E1E00345, 0x3E2000300, 0x3E2000301, 0x3E2200300, 0x3E2200301,
+			0x3E3000300, 0x3E3000301, 0x3E3200300, 0x3E3200301, 0x3E4000300, 0x3E4000301, 0x3E4000342, 0x3E4000345,
+			0x3E4200300, 0x3E4200301, 0x3E4200342, 0x3E4200345, 0x3E4400345, 0x3E4600345, 0x3E4800345, 0x3E4A00345,
+			0x3E4C00345, 0x3E4E00345, 0x3E5000300, 0x3E5000301, 0x3E5000342, 0x3E5000345, 0x3E5200300, 0x3E5200301,
+			0x3E5200342, 0x3E5200345, 0x3E5400345, 0x3E5600345, 0x3E5800345, 0x3E5A00345, 0x3E5C00345, 0x3E5E00345,
+			0x3E6000300, 0x3E6000301, 0x3E6000342, 0x3E6200300, 0x3E6200301, 0x3E6200342, 0x3E7000300, 0x3E7000301,
+			0x3E7000342, 0x3E7200300, 0x3E7200301, 0x3E7200342, 0x3E8000300, 0x3E8000301, 0x3E8200300, 0x3E8200301,
+			0x3E9000300, 0x3E9000301, 0x3E9200300, 0x3E9200301, 0x3EA000300, 0x3EA000301, 0x3EA000342, 0x3EA200300,
+			0x3EA200301, 0x3EA200342, 0x3EB200300, 0x3EB200301, 0x3EB200342, 0x3EC000300, 0x3EC000301, 0x3EC000342,
+			0x3EC000345, 0x3EC200300, 0x3EC200301, 0x3EC200342, 0x3EC200345, 0x3EC400345, 0x3EC600345, 0x3EC800345,
+			0x3ECA00345, 0x3ECC00345, 0x3ECE00345, 0x3ED000300, 0x3ED000301, 0x3ED000342, 0x3ED000345, 0x3ED200300,
+			0x3ED200301, 0x3ED200342, 0x3ED200345, 0x3ED400345, 0x3ED600345, 0x3ED800345, 0x3EDA00345, 0x3EDC00345,
+			0x3EDE00345, 0x3EE000345, 0x3EE800345, 0x3EF800345, 0x3F6C00345, 0x3F7E00300, 0x3F7E00301, 0x3F7E00342,
+			0x3F8C00345, 0x3FEC00345, 0x3FFC00300, 0x3FFC00301, 0x3FFC00342, 0x432000338, 0x432400338, 0x432800338,
+			0x43A000338, 0x43A400338, 0x43A800338, 0x440600338, 0x441000338, 0x441600338, 0x444600338, 0x444A00338,
+			0x447800338, 0x448600338, 0x448A00338, 0x449000338, 0x449A00338, 0x44C200338, 0x44C800338, 0x44CA00338,
+			0x44E400338, 0x44E600338, 0x44EC00338, 0x44EE00338, 0x44F400338, 0x44F600338, 0x44F800338, 0x44FA00338,
+			0x450400338, 0x450600338, 0x450C00338, 0x450E00338, 0x452200338, 0x452400338, 0x454400338, 0x455000338,
+			0x455200338, 0x455600338, 0x456400338, 0x456600338, 0x456800338, 0x456A00338, 0x608C03099, 0x609603099,
+			0x609A03099, 0x609E03099, 0x60A203099, 0x60A603099, 0x60AA03099, 0x60AE03099, 0x60B203099, 0x60B603099,
+			0x60BA03099, 0x60BE03099, 0x60C203099, 0x60C803099, 0x60CC03099, 0x60D003099, 0x60DE03099, 0x60DE0309A,
+			0x60E403099, 0x60E40309A, 0x60EA03099, 0x60EA0309A, 0x60F003099, 0x60F00309A, 0x60F603099, 0x60F60309A,
+			0x613A03099, 0x614C03099, 0x615603099, 0x615A03099, 0x615E03099, 0x616203099, 0x616603099, 0x616A03099,
+			0x616E03099, 0x617203099, 0x617603099, 0x617A03099, 0x617E03099, 0x618203099, 0x618803099, 0x618C03099,
+			0x619003099, 0x619E03099, 0x619E0309A, 0x61A403099, 0x61A40309A, 0x61AA03099, 0x61AA0309A, 0x61B003099,
+			0x61B00309A, 0x61B603099, 0x61B60309A, 0x61DE03099, 0x61E003099, 0x61E203099, 0x61E403099, 0x61FA03099,
+			0x22132110BA, 0x22136110BA, 0x2214A110BA, 0x2226211127, 0x2226411127, 0x2268E1133E, 0x2268E11357, 0x22972114B0,
+			0x22972114BA, 0x22972114BD, 0x22B70115AF, 0x22B72115AF, 0x2326A11930,
+		};
+		inline constexpr char32_t composition_values[] = {
+			0x226E, 0x2260, 0x226F, 0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x0100, 0x0102, 0x0226, 0x00C4, 0x1EA2, 0x00C5, 0x01CD, 0x0200, 0x0202,
+			0x1EA0, 0x1E00, 0x0104, 0x1E02, 0x1E04, 0x1E06, 0x0106, 0x0108, 0x010A, 0x010C, 0x00C7, 0x1E0A, 0x010E, 0x1E0C, 0x1E10, 0x1E12,
+			0x1E0E, 0x00C8, 0x00C9, 0x00CA, 0x1EBC, 0x0112, 0x0114, 0x0116, 0x00CB, 0x1EBA, 0x011A, 0x0204, 0x0206, 0x1EB8, 0x0228, 0x0118,
+			0x1E18, 0x1E1A, 0x1E1E, 0x01F4, 0x011C, 0x1E20, 0x011E, 0x0120, 0x01E6, 0x0122, 0x0124, 0x1E22, 0x1E26, 0x021E, 0x1E24, 0x1E28,
+			0x1E2A, 0x00CC, 0x00CD, 0x00CE, 0x0128, 0x012A, 0x012C, 0x0130, 0x00CF, 0x1EC8, 0x01CF, 0x0208, 0x020A, 0x1ECA, 0x012E, 0x1E2C,
+			0x0134, 0x1E30, 0x01E8, 0x1E32, 0x0136, 0x1E34, 0x0139, 0x013D, 0x1E36, 0x013B, 0x1E3C, 0x1E3A, 0x1E3E, 0x1E40, 0x1E42, 0x01F8,
+			0x0143, 0x00D1, 0x1E44, 0x0147, 0x1E46, 0x0145, 0x1E4A, 0x1E48, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x014C, 0x014E, 0x022E, 0x00D6,
+			0x1ECE, 0x0150, 0x01D1, 0x020C, 0x020E, 0x01A0, 0x1ECC, 0x01EA, 0x1E54, 0x1E56, 0x0154, 0x1E58, 0x0158, 0x0210, 0x0212, 0x1E5A,
+			0x0156, 0x1E5E, 0x015A, 0x015C, 0x1E60, 0x0160, 0x1E62, 0x0218, 0x015E, 0x1E6A, 0x0164, 0x1E6C, 0x021A, 0x0162, 0x1E70, 0x1E6E,
+			0x00D9, 0x00DA, 0x00DB, 0x0168, 0x016A, 0x016C, 0x00DC, 0x1EE6, 0x016E, 0x0170, 0x01D3, 0x0214, 0x0216, 0x01AF, 0x1EE4, 0x1E72,
+			0x0172, 0x1E76, 0x1E74, 0x1E7C, 0x1E7E, 0x1E80, 0x1E82, 0x0174, 0x1E86, 0x1E84, 0x1E88, 0x1E8A, 0x1E8C, 0x1EF2, 0x00DD, 0x0176,
+			0x1EF8, 0x0232, 0x1E8E, 0x0178, 0x1EF6, 0x1EF4, 0x0179, 0x1E90, 0x017B, 0x017D, 0x1E92, 0x1E94, 0x00E0, 0x00E1, 0x00E2, 0x00E3,
+			0x0101, 0x0103, 0x0227, 0x00E4, 0x1EA3, 0x00E5, 0x01CE, 0x0201, 0x0203, 0x1EA1, 0x1E01, 0x0105, 0x1E03, 0x1E05, 0x1E07, 0x0107,
+			0x0109, 0x010B, 0x010D, 0x00E7, 0x1E0B, 0x010F, 0x1E0D, 0x1E11, 0x1E13, 0x1E0F, 0x00E8, 0x00E9, 0x00EA, 0x1EBD, 0x0113, 0x0115,
+			0x0117, 0x00EB, 0x1EBB, 0x011B, 0x0205, 0x0207, 0x1EB9, 0x0229, 0x0119, 0x1E19, 0x1E1B, 0x1E1F, 0x01F5, 0x011D, 0x1E21, 0x011F,
+			0x0121, 0x01E7, 0x0123, 0x0125, 0x1E23, 0x1E27, 0x021F, 0x1E25, 0x1E29, 0x1E2B, 0x1E96, 0x00EC, 0x00ED, 0x00EE, 0x0129, 0x012B,
+			0x012D, 0x00EF, 0x1EC9, 0x01D0, 0x0209, 0x020B, 0x1ECB, 0x012F, 0x1E2D, 0x0135, 0x01F0, 0x1E31, 0x01E9, 0x1E33, 0x0137, 0x1E35,
+			0x013A, 0x013E, 0x1E37, 0x013C, 0x1E3D, 0x1E3B, 0x1E3F, 0x1E41, 0x1E43, 0x01F9, 0x0144, 0x00F1, 0x1E45, 0x0148, 0x1E47, 0x0146,
+			0x1E4B, 0x1E49, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x014D, 0x014F, 0x022F, 0x00F6, 0x1ECF, 0x0151, 0x01D2, 0x020D, 0x020F, 0x01A1,
+			0x1ECD, 0x01EB, 0x1E55, 0x1E57, 0x0155, 0x1E59, 0x0159, 0x0211, 0x0213, 0x1E5B, 0x0157, 0x1E5F, 0x015B, 0x015D, 0x1E61, 0x0161,
+			0x1E63, 0x0219, 0x015F, 0x1E6B, 0x1E97, 0x0165, 0x1E6D, 0x021B, 0x0163, 0x1E71, 0x1E6F, 0x00F9, 0x00FA, 0x00FB, 0x0169, 0x016B,
+			0x016D, 0x00FC, 0x1EE7, 0x016F, 0x0171, 0x01D4, 0x0215, 0x0217, 0x01B0, 0x1EE5, 0x1E73, 0x0173, 0x1E77, 0x1E75, 0x1E7D, 0x1E7F,
+			0x1E81, 0x1E83, 0x0175, 0x1E87, 0x1E85, 0x1E98, 0x1E89, 0x1E8B, 0x1E8D, 0x1EF3, 0x00FD, 0x0177, 0x1EF9, 0x0233, 0x1E8F, 0x00FF,
+			0x1EF7, 0x1E99, 0x1EF5, 0x017A, 0x1E91, 0x017C, 0x017E, 0x1E93, 0x1E95, 0x1FED, 0x0385, 0x1FC1, 0x1EA6, 0x1EA4, 0x1EAA, 0x1EA8,
+			0x01DE, 0x01FA, 0x01FC, 0x01E2, 0x1E08, 0x1EC0, 0x1EBE, 0x1EC4, 0x1EC2, 0x1E2E, 0x1ED2, 0x1ED0, 0x1ED6, 0x1ED4, 0x1E4C, 0x022C,
+			0x1E4E, 0x022A, 0x01FE, 0x01DB, 0x01D7, 0x01D5, 0x01D9, 0x1EA7, 0x1EA5, 0x1EAB, 0x1EA9, 0x01DF, 0x01FB, 0x01FD, 0x01E3, 0x1E09,
+			0x1EC1, 0x1EBF, 0x1EC5, 0x1EC3, 0x1E2F, 0x1ED3, 0x1ED1, 0x1ED7, 0x1ED5, 0x1E4D, 0x022D, 0x1E4F, 0x022B, 0x01FF, 0x01DC, 0x01D8,
+			0x01D6, 0x01DA, 0x1EB0, 0x1EAE, 0x1EB4, 0x1EB2, 0x1EB1, 0x1EAF, 0x1EB5, 0x1EB3, 0x1E14, 0x1E16, 0x1E15, 0x1E17, 0x1E50, 0x1E52,
+			0x1E51, 0x1E53, 0x1E64, 0x1E65, 0x1E66, 0x1E67, 0x1E78, 0x1E79, 0x1E7A, 0x1E7B, 0x1E9B, 0x1EDC, 0x1EDA, 0x1EE0, 0x1EDE, 0x1EE2,
+			0x1EDD, 0x1EDB, 0x1EE1, 0x1EDF, 0x1EE3, 0x1EEA, 0x1EE8, 0x1EEE, 0x1EEC, 0x1EF0, 0x1EEB, 0x1EE9, 0x1EEF, 0x1EED, 0x1EF1, 0x01EE,
+			0x01EC, 0x01ED, 0x01E0, 0x01E1, 0x1E1C, 0x1E1D, 0x0230, 0x0231, 0x01EF, 0x1FBA, 0x0386, 0x1FB9, 0x1FB8, 0x1F08, 0x1F09, 0x1FBC,
+			0x1FC8, 0x0388, 0x1F18, 0x1F19, 0x1FCA, 0x0389, 0x1F28, 0x1F29, 0x1FCC, 0x1FDA, 0x038A, 0x1FD9, 0x1FD8, 0x03AA, 0x1F38, 0x1F39,
+			0x1FF8, 0x038C, 0x1F48, 0x1F49, 0x1FEC, 0x1FEA, 0x038E, 0x1FE9, 0x1FE8, 0x03AB, 0x1F59, 0x1FFA, 0x038F, 0x1F68, 0x1F69, 0x1FFC,
+			0x1FB4, 0x1FC4, 0x1F70, 0x03AC, 0x1FB1, 0x1FB0, 0x1F00, 0x1F01, 0x1FB6, 0x1FB3, 0x1F72, 0x03AD, 0x1F10, 0x1F11, 0x1F74, 0x03AE,
+			0x1F20, 0x1F21, 0x1FC6, 0x1FC3, 0x1F76, 0x03AF, 0x1FD1, 0x1FD0, 0x03CA, 0x1F30, 0x1F31, 0x1FD6, 0x1F78, 0x03CC, 0x1F40, 0x1F41,
+			0x1FE4, 0x1FE5, 0x1F7A, 0x03CD, 0x1FE1, 0x1FE0, 0x03CB, 0x1F50, 0x1F51, 0x1FE6, 0x1F7C, 0x03CE, 0x1F60, 0x1F61, 0x1FF6, 0x1FF3,
+			0x1FD2, 0x0390, 0x1FD7, 0x1FE2, 0x03B0, 0x1FE7, 0x1FF4, 0x03D3, 0x03D4, 0x0407, 0x04D0, 0x04D2, 0x0403, 0x0400, 0x04D6, 0x0401,
+			0x04C1, 0x04DC, 0x04DE, 0x040D, 0x04E2, 0x0419, 0x04E4, 0x040C, 0x04E6, 0x04EE, 0x040E, 0x04F0, 0x04F2, 0x04F4, 0x04F8, 0x04EC,
+			0x04D1, 0x04D3, 0x0453, 0x0450, 0x04D7, 0x0451, 0x04C2, 0x04DD, 0x04DF, 0x045D, 0x04E3, 0x0439, 0x04E5, 0x045C, 0x04E7, 0x04EF,
+			0x045E, 0x04F1, 0x04F3, 0x04F5, 0x04F9, 0x04ED, 0x0457, 0x0476, 0x0477, 0x04DA, 0x04DB, 0x04EA, 0x04EB, 0x0622, 0x0623, 0x0625,
+			0x0624, 0x0626, 0x06C2, 0x06D3, 0x06C0, 0x0929, 0x0931, 0x0934, 0x09CB, 0x09CC, 0x0B4B, 0x0B48, 0x0B4C, 0x0B94, 0x0BCA, 0x0BCC,
+			0x0BCB, 0x0C48, 0x0CC0, 0x0CCA, 0x0CC7, 0x0CC8, 0x0CCB, 0x0D4A, 0x0D4C, 0x0D4B, 0x0DDA, 0x0DDC, 0x0DDE, 0x0DDD, 0x1026, 0x1B06,
+			0x1B08, 0x1B0A, 0x1B0C, 0x1B0E, 0x1B12, 0x1B3B, 0x1B3D, 0x1B40, 0x1B41, 0x1B43, 0x1E38, 0x1E39, 0x1E5C, 0x1E5D, 0x1E68, 0x1E69,
+			0x1EAC, 0x1EB6, 0x1EAD, 0x1EB7, 0x1EC6, 0x1EC7, 0x1ED8, 0x1ED9, 0x1F02, 0x1F04, 0x1F06, 0x1F80, 0x1F03, 0x1F05, 0x1F07, 0x1F81,
+			0x1F82, 0x1F83, 0x1F84, 0x1F85, 0x1F86, 0x1F87, 0x1F0A, 0x1F0C, 0x1F0E, 0x1F88, 0x1F0B, 0x1F0D, 0x1F0F, 0x1F89, 0x1F8A, 0x1F8B,
+			0x1F8C, 0x1F8D, 0x1F8E, 0x1F8F, 0x1F12, 0x1F14, 0x1F13, 0x1F15, 0x1F1A, 0x1F1C, 0x1F1B, 0x1F1D, 0x1F22, 0x1F24, 0x1F26, 0x1F90,
+			0x1F23, 0x1F25, 0x1F27, 0x1F91, 0x1F92, 0x1F93, 0x1F94, 0x1F95, 0x1F96, 0x1F97, 0x1F2A, 0x1F2C, 0x1F2E, 0x1F98, 0x1F2B, 0x1F2D,
+			0x1F2F, 0x1F99, 0x1F9A, 0x1F9B, 0x1F9C, 0x1F9D, 0x1F9E, 0x1F9F, 0x1F32, 0x1F34, 0x1F36, 0x1F33, 0x1F35, 0x1F37, 0x1F3A, 0x1F3C,
+			0x1F3E, 0x1F3B, 0x1F3D, 0x1F3F, 0x1F42, 0x1F44, 0x1F43, 0x1F45, 0x1F4A, 0x1F4C, 0x1F4B, 0x1F4D, 0x1F52, 0x1F54, 0x1F56, 0x1F53,
+			0x1F55, 0x1F57, 0x1F5B, 0x1F5D, 0x1F5F, 0x1F62, 0x1F64, 0x1F66, 0x1FA0, 0x1F63, 0x1F65, 0x1F67, 0x1FA1, 0x1FA2, 0x1FA3, 0x1FA4,
+			0x1FA5, 0x1FA6, 0x1FA7, 0x1F6A, 0x1F6C, 0x1F6E, 0x1FA8, 0x1F6B, 0x1F6D, 0x1F6F, 0x1FA9, 0x1FAA, 0x1FAB, 0x1FAC, 0x1FAD, 0x1FAE,
+			0x1FAF, 0x1FB2, 0x1FC2, 0x1FF2, 0x1FB7, 0x1FCD, 0x1FCE, 0x1FCF, 0x1FC7, 0x1FF7, 0x1FDD, 0x1FDE, 0x1FDF, 0x219A, 0x219B, 0x21AE,
+			0x21CD, 0x21CF, 0x21CE, 0x2204, 0x2209, 0x220C, 0x2224, 0x2226, 0x2241, 0x2244, 0x2247, 0x2249, 0x226D, 0x2262, 0x2270, 0x2271,
+			0x2274, 0x2275, 0x2278, 0x2279, 0x2280, 0x2281, 0x22E0, 0x22E1, 0x2284, 0x2285, 0x2288, 0x2289, 0x22E2, 0x22E3, 0x22AC, 0x22AD,
+			0x22AE, 0x22AF, 0x22EA, 0x22EB, 0x22EC, 0x22ED, 0x3094, 0x304C, 0x304E, 0x3050, 0x3052, 0x3054, 0x3056, 0x3058, 0x305A, 0x305C,
+			0x305E, 0x3060, 0x3062, 0x3065, 0x3067, 0x3069, 0x3070, 0x3071, 0x3073, 0x3074, 0x3076, 0x3077, 0x3079, 0x307A, 0x307C, 0x307D,
+			0x309E, 0x30F4, 0x30AC, 0x30AE, 0x30B0, 0x30B2, 0x30B4, 0x30B6, 0x30B8, 0x30BA, 0x30BC, 0x30BE, 0x30C0, 0x30C2, 0x30C5, 0x30C7,
+			0x30C9, 0x30D0, 0x30D1, 0x30D3, 0x30D4, 0x30D6, 0x30D7, 0x30D9, 0x30DA, 0x30DC, 0x30DD, 0x30F7, 0x30F8, 0x30F9, 0x30FA, 0x30FE,
+			0x1109A, 0x1109C, 0x110AB, 0x1112E, 0x1112F, 0x1134B, 0x1134C, 0x114BC, 0x114BB, 0x114BE, 0x115BA, 0x115BB, 0x11938,
+		};
+	}
+}
+
+#endif
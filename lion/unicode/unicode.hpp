@@ -8,5 +8,25 @@
 #include "utf16.hpp"
 #include "utf32.hpp"
 #include "utilities.hpp"
+#include "properties.hpp"
+#include "segmentation.hpp"
+#include "normalization.hpp"
+#include "casing.hpp"
+#include "collation.hpp"
+#include "hash.hpp"
+#include "compare.hpp"
+#include "pipeline.hpp"
+#include "batch.hpp"
+#include "sort.hpp"
+#include "width.hpp"
+#include "identifier.hpp"
+#include "codepoint_set.hpp"
+#include "search.hpp"
+#include "substring.hpp"
+#include "sanitize.hpp"
+#include "error_policy.hpp"
+#include "json.hpp"
+#include "literal.hpp"
+#include "single_byte.hpp"
 
 #endif
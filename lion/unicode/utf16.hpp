@@ -4,17 +4,18 @@
 #include "codepoint.hpp"
 #include "encoding.hpp"
 #include "ustream.hpp"
+#include "utf8.hpp"
+#include "validation.hpp"
 
 #include <string>
 #include <string_view>
 #include <cstddef>
 #include <algorithm>
 #include <iterator>
+#include <type_traits>
 
 namespace lion::unicode
 {
-	class utf8;
-
 	class utf16
 	{
 	public:
@@ -26,7 +27,7 @@ namespace lion::unicode
 		class iterator;
 
 		template<conversion conv = conversion::strict, typename ForwardIterator>
-		static ForwardIterator decode(ForwardIterator first, ForwardIterator last, codepoint& cp)
+		static constexpr ForwardIterator decode(ForwardIterator first, ForwardIterator last, codepoint& cp)
 		{
 			if constexpr(conv == conversion::strict)
 			{
@@ -67,8 +68,43 @@ namespace lion::unicode
 			return first;
 		}
 
+		// Decodes one sequence like decode<conversion::strict> and reports why it is ill-formed, if it is.
+		template<typename ForwardIterator>
+		static constexpr ForwardIterator decode(ForwardIterator first, ForwardIterator last, codepoint& cp, decode_error& error)
+		{
+			const char_type one = *first++;
+			error = decode_error::none;
+			if (is_high_surrogate(one))
+			{
+				if (first == last)
+				{
+					cp = replacement_character();
+					error = decode_error::truncated;
+				}
+				else if (const char_type two = *first; is_low_surrogate(two))
+				{
+					++first;
+					cp = static_cast<codepoint>(((one - 0xD800) << 10) + (two - 0xDC00) + 0x0010000);
+				}
+				else
+				{
+					cp = replacement_character();
+					error = decode_error::surrogate;
+				}
+			}
+			else if (is_low_surrogate(one))
+			{
+				cp = replacement_character();
+				error = decode_error::surrogate;
+			}
+			else {
+				cp = one;
+			}
+			return first;
+		}
+
 		template<typename OutputIterator>
-		static OutputIterator encode(codepoint cp, OutputIterator output)
+		static constexpr OutputIterator encode(codepoint cp, OutputIterator output)
 		{
 			if (cp <= 0xFFFF) {
 				*output++ = static_cast<char_type>(cp);
@@ -83,12 +119,12 @@ namespace lion::unicode
 		}
 
 		template<typename ForwardIterator>
-		static std::size_t length(ForwardIterator first, ForwardIterator last)
+		static constexpr std::size_t length(ForwardIterator first, ForwardIterator last)
 		{
 			std::size_t len = 0;
 			while (first != last)
 			{
-				codepoint cp;
+				codepoint cp = 0;
 				first = decode<conversion::lenient>(first, last, cp);
 				++len;
 			}
@@ -96,11 +132,11 @@ namespace lion::unicode
 		}
 
 		template<conversion conv = conversion::strict, typename ForwardIterator, typename OutputIterator>
-		static OutputIterator to_utf8(ForwardIterator first, ForwardIterator last, OutputIterator output)
+		static constexpr OutputIterator to_utf8(ForwardIterator first, ForwardIterator last, OutputIterator output)
 		{
 			while (first != last)
 			{
-				codepoint cp;
+				codepoint cp = 0;
 				first = decode<conv>(first, last, cp);
 				output = utf8::encode(cp, output);
 			}
@@ -113,17 +149,30 @@ namespace lion::unicode
 		}
 
 		template<conversion conv = conversion::strict, typename ForwardIterator, typename OutputIterator>
-		static OutputIterator to_utf32(ForwardIterator first, ForwardIterator last, OutputIterator output)
+		static constexpr OutputIterator to_utf32(ForwardIterator first, ForwardIterator last, OutputIterator output)
 		{
 			while (first != last)
 			{
-				codepoint cp;
+				codepoint cp = 0;
 				first = decode<conv>(first, last, cp);
 				*output++ = cp;
 			}
 			return output;
 		}
 
+		template<typename ForwardIterator, typename OutputIterator>
+		static OutputIterator to_utf8(ForwardIterator first, ForwardIterator last, OutputIterator output, validation_report& report) {
+			return detail::transcode_reporting<utf16, utf8>(first, last, output, report);
+		}
+
+		template<typename ForwardIterator, typename OutputIterator>
+		static OutputIterator to_utf16(ForwardIterator first, ForwardIterator last, OutputIterator output, validation_report& report) {
+			return detail::transcode_reporting<utf16, utf16>(first, last, output, report);
+		}
+
+		template<typename ForwardIterator, typename OutputIterator>
+		static OutputIterator to_utf32(ForwardIterator first, ForwardIterator last, OutputIterator output, validation_report& report);
+
 		template<typename OutputIterator>
 		static OutputIterator read(uistream& in, OutputIterator output, byte_order order)
 		{
@@ -209,13 +258,13 @@ namespace lion::unicode
 		}
 
 		template<typename ForwardIterator>
-		static ForwardIterator valid_sequence(ForwardIterator first, ForwardIterator last)
+		static constexpr ForwardIterator valid_sequence(ForwardIterator first, ForwardIterator last)
 		{
 			while (first != last)
 			{
 				ForwardIterator temp = first;
 
-				codepoint cp;
+				codepoint cp = 0;
 				first = decode(first, last, cp);
 				if (cp == replacement_character()) {
 					return temp;
@@ -223,8 +272,81 @@ namespace lion::unicode
 			}
 			return first;
 		}
+
+		// replaces every unpaired surrogate of [first, last) with U+FFFD in place and returns how many there were
+		template<typename ForwardIterator>
+		static std::size_t make_well_formed(ForwardIterator first, ForwardIterator last)
+		{
+			std::size_t replaced = 0;
+			const auto repair = [&replaced, last](ForwardIterator it)
+			{
+				const char_type one = *it;
+				ForwardIterator next = std::next(it);
+				if (!is_surrogate(one)) {
+					return next;
+				}
+				if (is_high_surrogate(one) && next != last && is_low_surrogate(*next)) {
+					return std::next(next);
+				}
+				*it = static_cast<char_type>(replacement_character());
+				++replaced;
+				return next;
+			};
+
+			if constexpr(std::is_pointer_v<ForwardIterator>)
+			{
+				while (first != last)
+				{
+					// sixteen units at a time while there is no surrogate
+					for (; last - first >= 16; first += 16)
+					{
+						bool surrogates = false;
+						for (std::size_t i = 0; i < 16; ++i) {
+							surrogates |= (first[i] & 0xF800) == 0xD800;
+						}
+						if (surrogates) {
+							break;
+						}
+					}
+
+					// and one at a time in a block with a surrogate
+					const ForwardIterator end = first + std::min<std::ptrdiff_t>(last - first, 16);
+					while (first < end) {
+						first = repair(first);
+					}
+				}
+			}
+			else
+			{
+				while (first != last) {
+					first = repair(first);
+				}
+			}
+			return replaced;
+		}
+
+		static std::size_t make_well_formed(string_type& str) {
+			return make_well_formed(str.data(), str.data() + str.size());
+		}
 	};
 
+	template<conversion conv, typename ForwardIterator, typename OutputIterator>
+	constexpr OutputIterator utf8::to_utf16(ForwardIterator first, ForwardIterator last, OutputIterator output)
+	{
+		while (first != last)
+		{
+			codepoint cp = 0;
+			first = decode<conv>(first, last, cp);
+			output = utf16::encode(cp, output);
+		}
+		return output;
+	}
+
+	template<typename ForwardIterator, typename OutputIterator>
+	OutputIterator utf8::to_utf16(ForwardIterator first, ForwardIterator last, OutputIterator output, validation_report& report) {
+		return detail::transcode_reporting<utf8, utf16>(first, last, output, report);
+	}
+
 	template<typename Iterator>
 	class utf16::iterator
 	{
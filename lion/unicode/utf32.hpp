@@ -4,6 +4,9 @@
 #include "codepoint.hpp"
 #include "encoding.hpp"
 #include "ustream.hpp"
+#include "utf8.hpp"
+#include "utf16.hpp"
+#include "validation.hpp"
 
 #include <string>
 #include <string_view>
@@ -13,9 +16,6 @@
 
 namespace lion::unicode
 {
-	class utf8;
-	class utf16;
-
 	class utf32
 	{
 	public:
@@ -27,7 +27,7 @@ namespace lion::unicode
 		class iterator;
 
 		template<conversion conv = conversion::strict, typename ForwardIterator>
-		static ForwardIterator decode(ForwardIterator first, ForwardIterator last, codepoint& cp)
+		static constexpr ForwardIterator decode(ForwardIterator first, ForwardIterator last, codepoint& cp)
 		{
 			if constexpr(conv == conversion::strict) {
 				cp = is_valid(*first) ? *first : replacement_character();
@@ -38,20 +38,34 @@ namespace lion::unicode
 			return ++first;
 		}
 
+		// Decodes one codepoint like decode<conversion::strict> and reports why it is invalid, if it is.
+		template<typename ForwardIterator>
+		static constexpr ForwardIterator decode(ForwardIterator first, ForwardIterator, codepoint& cp, decode_error& error)
+		{
+			cp = *first;
+			error = is_surrogate(cp) ? decode_error::surrogate
+				: cp > codepoint_max() ? decode_error::out_of_range
+				: decode_error::none;
+			if (error != decode_error::none) {
+				cp = replacement_character();
+			}
+			return ++first;
+		}
+
 		template<typename OutputIterator>
-		static OutputIterator encode(codepoint cp, OutputIterator output)
+		static constexpr OutputIterator encode(codepoint cp, OutputIterator output)
 		{
 			*output = cp;
 			return ++output;
 		}
 
 		template<typename ForwardIterator>
-		static std::size_t length(ForwardIterator first, ForwardIterator last) {
+		static constexpr std::size_t length(ForwardIterator first, ForwardIterator last) {
 			return std::distance(first, last);
 		}
 
 		template<conversion = conversion::strict, typename ForwardIterator, typename OutputIterator>
-		static OutputIterator to_utf8(ForwardIterator first, ForwardIterator last, OutputIterator output)
+		static constexpr OutputIterator to_utf8(ForwardIterator first, ForwardIterator last, OutputIterator output)
 		{
 			for (; first != last; ++first) {
 				output = utf8::encode(*first, output);
@@ -60,7 +74,7 @@ namespace lion::unicode
 		}
 
 		template<conversion = conversion::strict, typename ForwardIterator, typename OutputIterator>
-		static OutputIterator to_utf16(ForwardIterator first, ForwardIterator last, OutputIterator output)
+		static constexpr OutputIterator to_utf16(ForwardIterator first, ForwardIterator last, OutputIterator output)
 		{
 			for (; first != last; ++first) {
 				output = utf16::encode(*first, output);
@@ -73,6 +87,21 @@ namespace lion::unicode
 			return std::copy(first, last, output);
 		}
 
+		template<typename ForwardIterator, typename OutputIterator>
+		static OutputIterator to_utf8(ForwardIterator first, ForwardIterator last, OutputIterator output, validation_report& report) {
+			return detail::transcode_reporting<utf32, utf8>(first, last, output, report);
+		}
+
+		template<typename ForwardIterator, typename OutputIterator>
+		static OutputIterator to_utf16(ForwardIterator first, ForwardIterator last, OutputIterator output, validation_report& report) {
+			return detail::transcode_reporting<utf32, utf16>(first, last, output, report);
+		}
+
+		template<typename ForwardIterator, typename OutputIterator>
+		static OutputIterator to_utf32(ForwardIterator first, ForwardIterator last, OutputIterator output, validation_report& report) {
+			return detail::transcode_reporting<utf32, utf32>(first, last, output, report);
+		}
+
 		template<typename OutputIterator>
 		static OutputIterator read(uistream& in, OutputIterator output, byte_order order)
 		{
@@ -172,13 +201,13 @@ namespace lion::unicode
 		}
 
 		template<typename ForwardIterator>
-		static ForwardIterator valid_sequence(ForwardIterator first, ForwardIterator last)
+		static constexpr ForwardIterator valid_sequence(ForwardIterator first, ForwardIterator last)
 		{
 			while (first != last)
 			{
 				ForwardIterator temp = first;
 
-				codepoint cp;
+				codepoint cp = 0;
 				first = decode(first, last, cp);
 				if (cp == replacement_character()) {
 					return temp;
@@ -188,6 +217,16 @@ namespace lion::unicode
 		}
 	};
 
+	template<typename ForwardIterator, typename OutputIterator>
+	OutputIterator utf8::to_utf32(ForwardIterator first, ForwardIterator last, OutputIterator output, validation_report& report) {
+		return detail::transcode_reporting<utf8, utf32>(first, last, output, report);
+	}
+
+	template<typename ForwardIterator, typename OutputIterator>
+	OutputIterator utf16::to_utf32(ForwardIterator first, ForwardIterator last, OutputIterator output, validation_report& report) {
+		return detail::transcode_reporting<utf16, utf32>(first, last, output, report);
+	}
+
 	template<typename Iterator>
 	class utf32::iterator
 	{
@@ -265,6 +304,22 @@ namespace lion::unicode
 	bool operator!=(const utf32::iterator<Iterator>& lhs, const utf32::iterator<Iterator>& rhs) noexcept {
 		return lhs.base() != rhs.base();
 	}
+
+	namespace detail
+	{
+		// the encoding of a string_view_type
+		template<typename Char>
+		struct encoding_of;
+
+		template<>
+		struct encoding_of<utf8::string_view_type::value_type> { using type = utf8; };
+
+		template<>
+		struct encoding_of<utf16::string_view_type::value_type> { using type = utf16; };
+
+		template<>
+		struct encoding_of<utf32::string_view_type::value_type> { using type = utf32; };
+	}
 }
 
 #endif
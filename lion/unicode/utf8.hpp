@@ -4,6 +4,7 @@
 #include "codepoint.hpp"
 #include "encoding.hpp"
 #include "ustream.hpp"
+#include "validation.hpp"
 
 #include <string>
 #include <string_view>
@@ -26,23 +27,8 @@ namespace lion::unicode
 		class iterator;
 
 		template<conversion conv = conversion::strict, typename ForwardIterator>
-		static ForwardIterator decode(ForwardIterator first, ForwardIterator last, codepoint& cp)
+		static constexpr ForwardIterator decode(ForwardIterator first, ForwardIterator last, codepoint& cp)
 		{
-			static constexpr char trailing[256] =
-			{
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-				1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-				2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5
-			};
-			static constexpr codepoint offsets[4] = {
-				0x00000000, 0x00003080, 0x000E2080, 0x03C82080
-			};
-
 			if constexpr(conv == conversion::strict)
 			{
 				// the well_formedi functions are based on table 3-7 of the unicode 10.0 standard
@@ -247,13 +233,96 @@ namespace lion::unicode
 			return first;
 		}
 
-		template<typename OutputIterator>
-		static OutputIterator encode(codepoint codepoint, OutputIterator output)
+		// Decodes one sequence like decode<conversion::strict>, but always replaces the maximal subpart of an
+		// ill-formed sequence (as recommended in chapter 3.9 of the unicode standard) and reports the reason.
+		template<typename ForwardIterator>
+		static constexpr ForwardIterator decode(ForwardIterator first, ForwardIterator last, codepoint& cp, decode_error& error)
 		{
-			static constexpr unsigned char firsts[4] = {
-				0x00, 0xC0, 0xE0, 0xF0
-			};
+			const unsigned char byte1 = static_cast<unsigned char>(*first++);
+			if (byte1 < 0x80)
+			{
+				cp = byte1;
+				error = decode_error::none;
+				return first;
+			}
 
+			cp = replacement_character();
+
+			// the number of continuation bytes and the range of the second byte, from table 3-7
+			std::size_t extra = 0;
+			unsigned char low = 0x80;
+			unsigned char high = 0xBF;
+			decode_error outside = decode_error::none;
+			if (byte1 >= 0xC2 && byte1 <= 0xDF) {
+				extra = 1;
+			}
+			else if (byte1 >= 0xE0 && byte1 <= 0xEF)
+			{
+				extra = 2;
+				if (byte1 == 0xE0)
+				{
+					low = 0xA0;
+					outside = decode_error::overlong;
+				}
+				else if (byte1 == 0xED)
+				{
+					high = 0x9F;
+					outside = decode_error::surrogate;
+				}
+			}
+			else if (byte1 >= 0xF0 && byte1 <= 0xF4)
+			{
+				extra = 3;
+				if (byte1 == 0xF0)
+				{
+					low = 0x90;
+					outside = decode_error::overlong;
+				}
+				else if (byte1 == 0xF4)
+				{
+					high = 0x8F;
+					outside = decode_error::out_of_range;
+				}
+			}
+			else
+			{
+				error = byte1 == 0xC0 || byte1 == 0xC1 ? decode_error::overlong
+					: byte1 >= 0xF5 && byte1 <= 0xF7 ? decode_error::out_of_range
+					: decode_error::invalid;
+				return first;
+			}
+
+			codepoint value = byte1 & (0x3F >> extra);
+			for (std::size_t i = 0; i < extra; ++i)
+			{
+				if (first == last)
+				{
+					error = decode_error::truncated;
+					return first;
+				}
+				const unsigned char byte = static_cast<unsigned char>(*first);
+				if (byte < 0x80 || byte > 0xBF)
+				{
+					error = decode_error::truncated;
+					return first;
+				}
+				if (i == 0 && (byte < low || byte > high))
+				{
+					error = outside;
+					return first;
+				}
+				value = (value << 6) | (byte & 0x3F);
+				++first;
+			}
+
+			cp = value;
+			error = decode_error::none;
+			return first;
+		}
+
+		template<typename OutputIterator>
+		static constexpr OutputIterator encode(codepoint codepoint, OutputIterator output)
+		{
 			std::size_t nbytes = 0;
 			if (codepoint < 0x80) {
 				nbytes = 0;
@@ -268,7 +337,7 @@ namespace lion::unicode
 				nbytes = 3;
 			}
 
-			unsigned char bytes[4];
+			unsigned char bytes[4] = {};
 			switch (nbytes)
 			{
 			case 3:
@@ -283,16 +352,19 @@ namespace lion::unicode
 			case 0:
 				bytes[0] = static_cast<unsigned char>(codepoint | firsts[nbytes]);
 			}
-			return std::copy(bytes, bytes + nbytes + 1, output);
+			for (std::size_t i = 0; i <= nbytes; ++i) {
+				*output++ = bytes[i];
+			}
+			return output;
 		}
 
 		template<typename ForwardIterator>
-		static std::size_t length(ForwardIterator first, ForwardIterator last)
+		static constexpr std::size_t length(ForwardIterator first, ForwardIterator last)
 		{
 			std::size_t len = 0;
 			while (first != last)
 			{
-				codepoint cp;
+				codepoint cp = 0;
 				first = decode<conversion::lenient>(first, last, cp);
 				++len;
 			}
@@ -304,30 +376,33 @@ namespace lion::unicode
 			return std::copy(first, last, output);
 		}
 
+		// defined in utf16.hpp, as it needs the complete utf16 type
 		template<conversion conv = conversion::strict, typename ForwardIterator, typename OutputIterator>
-		static OutputIterator to_utf16(ForwardIterator first, ForwardIterator last, OutputIterator output)
-		{
-			while (first != last)
-			{
-				codepoint cp;
-				first = decode<conv>(first, last, cp);
-				output = utf16::encode(cp, output);
-			}
-			return output;
-		}
+		static constexpr OutputIterator to_utf16(ForwardIterator first, ForwardIterator last, OutputIterator output);
 
 		template<conversion conv = conversion::strict, typename ForwardIterator, typename OutputIterator>
-		static OutputIterator to_utf32(ForwardIterator first, ForwardIterator last, OutputIterator output)
+		static constexpr OutputIterator to_utf32(ForwardIterator first, ForwardIterator last, OutputIterator output)
 		{
 			while (first != last)
 			{
-				codepoint cp;
+				codepoint cp = 0;
 				first = decode<conv>(first, last, cp);
 				*output++ = cp;
 			}
 			return output;
 		}
 
+		template<typename ForwardIterator, typename OutputIterator>
+		static OutputIterator to_utf8(ForwardIterator first, ForwardIterator last, OutputIterator output, validation_report& report) {
+			return detail::transcode_reporting<utf8, utf8>(first, last, output, report);
+		}
+
+		template<typename ForwardIterator, typename OutputIterator>
+		static OutputIterator to_utf16(ForwardIterator first, ForwardIterator last, OutputIterator output, validation_report& report);
+
+		template<typename ForwardIterator, typename OutputIterator>
+		static OutputIterator to_utf32(ForwardIterator first, ForwardIterator last, OutputIterator output, validation_report& report);
+
 		template<typename OutputIterator>
 		static OutputIterator read(uistream& in, OutputIterator output, byte_order order = byte_order::none)
 		{
@@ -362,13 +437,13 @@ namespace lion::unicode
 		}
 
 		template<typename ForwardIterator>
-		static ForwardIterator valid_sequence(ForwardIterator first, ForwardIterator last)
+		static constexpr ForwardIterator valid_sequence(ForwardIterator first, ForwardIterator last)
 		{
 			while (first != last)
 			{
 				ForwardIterator temp = first;
 
-				codepoint cp;
+				codepoint cp = 0;
 				first = decode(first, last, cp);
 				if (cp == replacement_character()) {
 					return temp;
@@ -376,6 +451,26 @@ namespace lion::unicode
 			}
 			return first;
 		}
+
+	private:
+		// the tables of decode and encode, which can't be static variables of constexpr functions
+		static constexpr char trailing[256] =
+		{
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+			2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5
+		};
+		static constexpr codepoint offsets[4] = {
+			0x00000000, 0x00003080, 0x000E2080, 0x03C82080
+		};
+		static constexpr unsigned char firsts[4] = {
+			0x00, 0xC0, 0xE0, 0xF0
+		};
 	};
 
 	template<typename Iterator>
@@ -6,6 +6,8 @@
 #include "utf32.hpp"
 #include "encoding.hpp"
 #include "ustream.hpp"
+#include "validation.hpp"
+#include "single_byte.hpp"
 
 #include <string_view>
 #include <type_traits>
@@ -75,6 +77,91 @@ namespace lion::unicode
 		return res;
 	}
 
+	// converts with conversion::strict, recording every ill-formed sequence of the input in report
+	template<typename UTF = default_utf>
+	typename UTF::string_type convert(const utf8::string_type& str, validation_report& report)
+	{
+		static_assert(std::is_same_v<UTF, utf8> || std::is_same_v<UTF, utf16> || std::is_same_v<UTF, utf32>,
+			"convert<UTF> requires UTF to be one of utf8, utf16, utf32");
+
+		typename UTF::string_type res;
+		res.reserve(str.size());
+
+		if constexpr(std::is_same_v<UTF, utf8>) {
+			utf8::to_utf8(str.begin(), str.end(), std::back_inserter(res), report);
+		}
+		else if constexpr(std::is_same_v<UTF, utf16>) {
+			utf8::to_utf16(str.begin(), str.end(), std::back_inserter(res), report);
+		}
+		else if constexpr(std::is_same_v<UTF, utf32>) {
+			utf8::to_utf32(str.begin(), str.end(), std::back_inserter(res), report);
+		}
+		return res;
+	}
+
+	// converts with conversion::strict, recording every ill-formed sequence of the input in report
+	template<typename UTF = default_utf>
+	typename UTF::string_type convert(const utf16::string_type& str, validation_report& report)
+	{
+		static_assert(std::is_same_v<UTF, utf8> || std::is_same_v<UTF, utf16> || std::is_same_v<UTF, utf32>,
+			"convert<UTF> requires UTF to be one of utf8, utf16, utf32");
+
+		typename UTF::string_type res;
+		res.reserve(str.size());
+
+		if constexpr(std::is_same_v<UTF, utf8>) {
+			utf16::to_utf8(str.begin(), str.end(), std::back_inserter(res), report);
+		}
+		else if constexpr(std::is_same_v<UTF, utf16>) {
+			utf16::to_utf16(str.begin(), str.end(), std::back_inserter(res), report);
+		}
+		else if constexpr(std::is_same_v<UTF, utf32>) {
+			utf16::to_utf32(str.begin(), str.end(), std::back_inserter(res), report);
+		}
+		return res;
+	}
+
+	// converts with conversion::strict, recording every ill-formed sequence of the input in report
+	template<typename UTF = default_utf>
+	typename UTF::string_type convert(const utf32::string_type& str, validation_report& report)
+	{
+		static_assert(std::is_same_v<UTF, utf8> || std::is_same_v<UTF, utf16> || std::is_same_v<UTF, utf32>,
+			"convert<UTF> requires UTF to be one of utf8, utf16, utf32");
+
+		typename UTF::string_type res;
+		res.reserve(str.size());
+
+		if constexpr(std::is_same_v<UTF, utf8>) {
+			utf32::to_utf8(str.begin(), str.end(), std::back_inserter(res), report);
+		}
+		else if constexpr(std::is_same_v<UTF, utf16>) {
+			utf32::to_utf16(str.begin(), str.end(), std::back_inserter(res), report);
+		}
+		else if constexpr(std::is_same_v<UTF, utf32>) {
+			utf32::to_utf32(str.begin(), str.end(), std::back_inserter(res), report);
+		}
+		return res;
+	}
+
+	namespace detail
+	{
+		template<typename UTF>
+		typename UTF::string_type read_single_byte(uistream& in, format charset)
+		{
+			utf8::string_type bytes;
+			utf8::read(in, std::back_inserter(bytes));
+			switch (charset)
+			{
+			case format::ascii:
+				return widen<ascii, UTF>(bytes);
+			case format::latin1:
+				return widen<latin1, UTF>(bytes);
+			default:
+				return widen<windows1252, UTF>(bytes);
+			}
+		}
+	}
+
 	template<typename UTF = default_utf, conversion conv = conversion::strict>
 	typename UTF::string_type read_file(uistream& in)
 	{
@@ -103,6 +190,13 @@ namespace lion::unicode
 				utf16::to_utf8<conv>(u16.begin(), u16.end(), std::back_inserter(str));
 				break;
 			}
+			case format::ascii:
+			case format::latin1:
+			case format::windows1252:
+			{
+				str = detail::read_single_byte<UTF>(in, encoding.format);
+				break;
+			}
 			case format::unknown: // assume ASCII, same as utf8 - only one byte
 			case format::utf8:
 			{
@@ -127,6 +221,13 @@ namespace lion::unicode
 				utf16::read(in, std::back_inserter(str), encoding.order);
 				break;
 			}
+			case format::ascii:
+			case format::latin1:
+			case format::windows1252:
+			{
+				str = detail::read_single_byte<UTF>(in, encoding.format);
+				break;
+			}
 			case format::unknown: // assume ASCII, same as utf8 - only one byte
 			case format::utf8:
 			{
@@ -153,6 +254,13 @@ namespace lion::unicode
 				utf16::to_utf32<conv>(u16.begin(), u16.end(), std::back_inserter(str));
 				break;
 			}
+			case format::ascii:
+			case format::latin1:
+			case format::windows1252:
+			{
+				str = detail::read_single_byte<UTF>(in, encoding.format);
+				break;
+			}
 			case format::unknown: // assume ASCII, same as utf8 - only one byte
 			case format::utf8:
 			{
@@ -0,0 +1,102 @@
+#ifndef LION_UNICODE_VALIDATION_HPP
+#define LION_UNICODE_VALIDATION_HPP
+
+#include "codepoint.hpp"
+
+#include <vector>
+#include <cstddef>
+#include <iterator>
+
+namespace lion::unicode
+{
+	enum class decode_error : unsigned char
+	{
+		none,
+		truncated,    // a sequence which ends before it is complete
+		overlong,     // a longer encoding than needed (C0, C1, E0 80..9F, F0 80..8F)
+		surrogate,    // an encoded or unpaired surrogate
+		out_of_range, // a codepoint above codepoint_max()
+		invalid       // a code unit which can't start a sequence
+	};
+
+	// the result of a checked conversion: where and why the input was ill-formed
+	class validation_report
+	{
+	public:
+		struct error
+		{
+			std::size_t offset; // in code units of the input
+			decode_error kind;
+		};
+
+		explicit validation_report(std::size_t max_errors = 16)
+			: max_errors_(max_errors)
+		{}
+
+		// the first max_errors() ill-formed sequences
+		const std::vector<error>& errors() const noexcept { return errors_; }
+		std::size_t max_errors() const noexcept { return max_errors_; }
+
+		// the number of ill-formed sequences, each of which was replaced with replacement_character()
+		std::size_t replacements() const noexcept { return replacements_; }
+
+		bool valid() const noexcept { return replacements_ == 0; }
+		bool ascii() const noexcept { return ascii_; }
+
+		void add(std::size_t offset, decode_error kind)
+		{
+			if (errors_.size() < max_errors_) {
+				errors_.push_back(error{ offset, kind });
+			}
+			++replacements_;
+			ascii_ = false;
+		}
+
+		void add_non_ascii() noexcept {
+			ascii_ = false;
+		}
+
+		void clear() noexcept
+		{
+			errors_.clear();
+			replacements_ = 0;
+			ascii_ = true;
+		}
+
+	private:
+		std::vector<error> errors_;
+		std::size_t max_errors_;
+		std::size_t replacements_ = 0;
+		bool ascii_ = true;
+	};
+
+	namespace detail
+	{
+		// converts [first, last) from UTFI to UTFO like UTFI::to_utf8/16/32 with a report, adding the ill-formed
+		// sequences and whether there is anything but ascii to report
+		template<typename UTFI, typename UTFO, typename ForwardIterator, typename OutputIterator>
+		OutputIterator transcode_reporting(ForwardIterator first, ForwardIterator last, OutputIterator output, validation_report& report)
+		{
+			std::size_t offset = 0;
+			while (first != last)
+			{
+				const ForwardIterator begin = first;
+
+				codepoint cp;
+				decode_error error;
+				first = UTFI::decode(first, last, cp, error);
+				if (error != decode_error::none) {
+					report.add(offset, error);
+				}
+				else if (cp >= 0x80) {
+					report.add_non_ascii();
+				}
+				offset += static_cast<std::size_t>(std::distance(begin, first));
+				output = UTFO::encode(cp, output);
+			}
+			return output;
+		}
+	}
+}
+
+#endif
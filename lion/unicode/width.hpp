@@ -0,0 +1,216 @@
+#ifndef LION_UNICODE_WIDTH_HPP
+#define LION_UNICODE_WIDTH_HPP
+
+#include "codepoint.hpp"
+#include "validation.hpp"
+#include "utf8.hpp"
+#include "utf16.hpp"
+#include "utf32.hpp"
+#include "tables/width.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace lion::unicode
+{
+	// the columns of the characters whose East_Asian_Width is Ambiguous, which depend on the terminal
+	enum class ambiguous_width : unsigned char
+	{
+		narrow,
+		wide
+	};
+
+	namespace detail
+	{
+		constexpr unsigned width_value(codepoint cp) noexcept
+		{
+			if (cp > codepoint_max()) {
+				cp = codepoint_max();
+			}
+			const std::size_t block = width_stage1[cp >> width_shift];
+			return width_stage2[(block << width_shift) + (cp & ((1u << width_shift) - 1))];
+		}
+
+		template<ambiguous_width ambiguous>
+		constexpr unsigned columns_of(unsigned value) noexcept
+		{
+			const unsigned columns = value & 3;
+			if (columns == 3) {
+				return ambiguous == ambiguous_width::wide ? 2 : 1;
+			}
+			return columns;
+		}
+
+		// whether the eight bytes are printable ascii, one column each
+		inline bool printable_ascii(std::uint64_t word) noexcept
+		{
+			constexpr std::uint64_t ones = 0x0101010101010101ull;
+			constexpr std::uint64_t high = 0x8080808080808080ull;
+			const std::uint64_t del = word ^ (ones * 0x7F);
+			const std::uint64_t below_space = (word - ones * 0x20) & ~word;
+			const std::uint64_t is_del = (del - ones) & ~del;
+			return ((word | below_space | is_del) & high) == 0;
+		}
+
+		// the columns of each codepoint given those before it: emoji sequences are as wide as their first emoji
+		template<ambiguous_width ambiguous>
+		class width_state
+		{
+		public:
+			unsigned columns(codepoint cp, unsigned value) noexcept
+			{
+				unsigned columns = columns_of<ambiguous>(value);
+				if (cp == 0xFE0F && (previous & 4) != 0) {
+					columns = previous_columns == 1 ? 1 : 0; // emoji presentation of a text emoji
+				}
+				else if (joined && (value & 8) != 0) {
+					columns = 0; // an emoji after a zero width joiner
+				}
+				else if ((value & 16) != 0 && (previous & 32) != 0) {
+					columns = 0; // a skin tone after its emoji
+				}
+
+				// a pair of regional indicators is a flag
+				if (cp >= 0x1F1E6 && cp <= 0x1F1FF)
+				{
+					columns = regional ? 0 : 2;
+					regional = !regional;
+				}
+				else {
+					regional = false;
+				}
+
+				const bool extends = cp == 0x200D || cp == 0xFE0F || (value & 16) != 0;
+				sequence = (value & 8) != 0 || (extends && sequence);
+				joined = cp == 0x200D && sequence;
+				previous = value;
+				previous_columns = columns;
+				return columns;
+			}
+
+			// after a run of printable ascii ending with c
+			void ascii(unsigned char c) noexcept
+			{
+				previous = width_stage2[c];
+				previous_columns = 1;
+				sequence = false;
+				joined = false;
+				regional = false;
+			}
+
+		private:
+			unsigned previous = 0;
+			unsigned previous_columns = 0;
+			bool sequence = false; // an emoji, possibly followed by modifiers, variation selectors and joiners
+			bool joined = false;
+			bool regional = false;
+		};
+
+		// the columns of [first, last) and where it would exceed 'limit' columns
+		template<typename UTF, ambiguous_width ambiguous, typename ForwardIterator>
+		ForwardIterator measure_columns(ForwardIterator first, ForwardIterator last, std::size_t limit, std::size_t& columns)
+		{
+			width_state<ambiguous> state;
+			columns = 0;
+			while (first != last)
+			{
+				if constexpr(std::is_same_v<UTF, utf8> && std::is_pointer_v<ForwardIterator>)
+				{
+					std::uint64_t word;
+					for (; last - first >= 8 && limit - columns >= 8; first += 8, columns += 8)
+					{
+						std::memcpy(&word, first, 8);
+						if (!printable_ascii(word)) {
+							break;
+						}
+						state.ascii(static_cast<unsigned char>(first[7]));
+					}
+					if (first == last) {
+						break;
+					}
+				}
+
+				codepoint cp = static_cast<typename UTF::char_type>(*first);
+				ForwardIterator next = first;
+				unsigned value;
+				if (cp < 0x80)
+				{
+					// the ascii block is the first of the trie
+					value = width_stage2[cp];
+					++next;
+				}
+				else
+				{
+					decode_error error;
+					next = UTF::decode(first, last, cp, error);
+					value = width_value(cp);
+				}
+				const unsigned width = state.columns(cp, value);
+				if (width > limit - columns) {
+					break;
+				}
+				columns += width;
+				first = next;
+			}
+			return first;
+		}
+	}
+
+	// the number of terminal columns of a codepoint by itself: 0 for marks, format and control characters, 2 for wide and
+	// fullwidth characters and emoji, 1 for everything else
+	template<ambiguous_width ambiguous = ambiguous_width::narrow>
+	constexpr unsigned codepoint_width(codepoint cp) noexcept {
+		return detail::columns_of<ambiguous>(detail::width_value(cp));
+	}
+
+	// the number of terminal columns of a sequence, ill-formed sequences are counted as U+FFFD
+	template<typename UTF, ambiguous_width ambiguous = ambiguous_width::narrow, typename ForwardIterator>
+	std::size_t display_width(ForwardIterator first, ForwardIterator last)
+	{
+		std::size_t columns;
+		detail::measure_columns<UTF, ambiguous>(first, last, static_cast<std::size_t>(-1), columns);
+		return columns;
+	}
+
+	// the end of the longest prefix of [first, last) which fits in 'columns' columns
+	template<typename UTF, ambiguous_width ambiguous = ambiguous_width::narrow, typename ForwardIterator>
+	ForwardIterator truncate_to_columns(ForwardIterator first, ForwardIterator last, std::size_t columns)
+	{
+		std::size_t used;
+		return detail::measure_columns<UTF, ambiguous>(first, last, columns, used);
+	}
+
+	template<ambiguous_width ambiguous = ambiguous_width::narrow>
+	std::size_t display_width(utf8::string_view_type view) {
+		return display_width<utf8, ambiguous>(view.data(), view.data() + view.size());
+	}
+
+	template<ambiguous_width ambiguous = ambiguous_width::narrow>
+	std::size_t display_width(utf16::string_view_type view) {
+		return display_width<utf16, ambiguous>(view.data(), view.data() + view.size());
+	}
+
+	template<ambiguous_width ambiguous = ambiguous_width::narrow>
+	std::size_t display_width(utf32::string_view_type view) {
+		return display_width<utf32, ambiguous>(view.data(), view.data() + view.size());
+	}
+
+	template<ambiguous_width ambiguous = ambiguous_width::narrow>
+	utf8::string_view_type truncate_to_columns(utf8::string_view_type view, std::size_t columns) {
+		return view.substr(0, static_cast<std::size_t>(truncate_to_columns<utf8, ambiguous>(view.data(), view.data() + view.size(), columns) - view.data()));
+	}
+
+	template<ambiguous_width ambiguous = ambiguous_width::narrow>
+	utf16::string_view_type truncate_to_columns(utf16::string_view_type view, std::size_t columns) {
+		return view.substr(0, static_cast<std::size_t>(truncate_to_columns<utf16, ambiguous>(view.data(), view.data() + view.size(), columns) - view.data()));
+	}
+
+	template<ambiguous_width ambiguous = ambiguous_width::narrow>
+	utf32::string_view_type truncate_to_columns(utf32::string_view_type view, std::size_t columns) {
+		return view.substr(0, static_cast<std::size_t>(truncate_to_columns<utf32, ambiguous>(view.data(), view.data() + view.size(), columns) - view.data()));
+	}
+}
+
+#endif
@@ -0,0 +1,549 @@
+#!/usr/bin/perl
+# gen_tables.pl - generates the property tables in lion/unicode/tables
+#
+#     perl tools/gen_tables.pl [output directory [allkeys.txt]]
+#
+# The data comes from the Unicode Character Database which ships with perl (Unicode::UCD), so the
+# tables match the Unicode version of the perl that runs this script. The collation table comes from
+# the allkeys.txt of Unicode::Collate, which may be of an older version.
+
+use strict;
+use warnings;
+use feature qw(fc unicode_strings);
+use Unicode::UCD qw(prop_invmap prop_value_aliases charinfo);
+use Unicode::Normalize qw(getCanon getCompat getCombinClass isComp_Ex);
+use Unicode::Collate;
+
+my $out = shift // 'lion/unicode/tables';
+my ($allkeys) = @ARGV ? @ARGV : grep { -f } map { "$_/Unicode/Collate/allkeys.txt" } @INC;
+my $version = Unicode::UCD::UnicodeVersion();
+
+# the value of property $name for every codepoint, as a reference to an array of 0x110000 values
+sub expand
+{
+	my ($name) = @_;
+	my ($list, $map, $format, $default) = prop_invmap($name);
+	die "unknown property $name\n" unless defined $list;
+	my @values;
+	for my $i (0 .. $#$list)
+	{
+		my $end = $i < $#$list ? $list->[$i + 1] : 0x110000;
+		my $value = $map->[$i];
+		$value = $default if $format =~ /^a/ && $value eq '0';
+		@values[$list->[$i] .. $end - 1] = ($value) x ($end - $list->[$i]);
+	}
+	return \@values;
+}
+
+# splits the values of all codepoints into blocks of 1 << $shift values and merges identical blocks:
+# value(cp) == stage2[(stage1[cp >> shift] << shift) + (cp & mask)]
+sub trie
+{
+	my ($values, $shift) = @_;
+	my $size = 1 << $shift;
+	my (@stage1, @stage2, %blocks);
+	for (my $cp = 0; $cp < @$values; $cp += $size)
+	{
+		my @block = @$values[$cp .. $cp + $size - 1];
+		my $key = join(',', @block);
+		unless (exists $blocks{$key})
+		{
+			$blocks{$key} = @stage2 >> $shift;
+			push @stage2, @block;
+		}
+		push @stage1, $blocks{$key};
+	}
+	return (\@stage1, \@stage2);
+}
+
+sub type_for
+{
+	my ($max) = @_;
+	return $max < 0x100 ? 'std::uint8_t' : $max < 0x10000 ? 'std::uint16_t' : 'std::uint32_t';
+}
+
+sub array
+{
+	my ($type, $name, $values) = @_;
+	my $width = 0;
+	for (@$values) { $width = length if length > $width; }
+	my $columns = $width <= 4 ? 32 : $width <= 7 ? 16 : 8;
+	my $text = "\t\tinline constexpr $type ${name}[] = {\n";
+	for (my $i = 0; $i < @$values; $i += $columns)
+	{
+		my $last = $i + $columns - 1 < $#$values ? $i + $columns - 1 : $#$values;
+		$text .= "\t\t\t" . join(', ', @$values[$i .. $last]) . ",\n";
+	}
+	return $text . "\t\t};\n";
+}
+
+sub trie_arrays
+{
+	my ($name, $values, $shift) = @_;
+	my ($stage1, $stage2) = trie($values, $shift);
+	my $max = 0;
+	for (@$stage2) { $max = $_ if $_ > $max; }
+	return "\t\tconstexpr unsigned ${name}_shift = $shift;\n"
+		. array(type_for($#$stage2 >> $shift), "${name}_stage1", $stage1)
+		. array(type_for($max), "${name}_stage2", $stage2);
+}
+
+sub enumeration
+{
+	my ($name, $comment, @names) = @_;
+	my $text = "\t// $comment\n\tenum class $name : unsigned char\n\t{\n";
+	$text .= join(",\n", map { "\t\t$_" } @names) . "\n\t};\n";
+	return $text;
+}
+
+sub identifier
+{
+	my ($name) = @_;
+	$name = lc $name;
+	$name =~ s/[^a-z0-9]+/_/g;
+	return $name;
+}
+
+sub header
+{
+	my ($file, $guard, $body, $source) = @_;
+	$source //= "the Unicode Character Database $version";
+	my $text = "// generated by tools/gen_tables.pl from $source, do not edit\n\n"
+		. "#ifndef $guard\n#define $guard\n\n#include <cstdint>\n\nnamespace lion::unicode\n{\n$body}\n\n#endif\n";
+	$text =~ s/\n/\r\n/g;
+	open(my $fh, '>:raw', "$out/$file") or die "can't write $out/$file: $!\n";
+	print $fh $text;
+	close($fh);
+}
+
+sub properties
+{
+	my @categories = qw(Lu Ll Lt Lm Lo Mn Mc Me Nd Nl No Pc Pd Ps Pe Pi Pf Po Sm Sc Sk So Zs Zl Zp Cc Cf Cs Co Cn);
+	my %category;
+	@category{@categories} = 0 .. $#categories;
+
+	my $scripts = expand('Script');
+	my %seen;
+	$seen{$_} = 1 for @$scripts;
+	my @names = ('Unknown', 'Common', 'Inherited');
+	push @names, sort grep { !/^(Unknown|Common|Inherited)$/ } keys %seen;
+	my %script;
+	@script{@names} = 0 .. $#names;
+
+	my $gc = expand('General_Category');
+	my $white_space = expand('White_Space');
+	my $default_ignorable = expand('Default_Ignorable_Code_Point');
+	my $emoji = expand('Emoji');
+
+	# every distinct combination of the properties is stored once, the trie maps codepoints to them
+	my (@records, %records, @values);
+	for my $cp (0 .. 0x10FFFF)
+	{
+		my $flags = ($white_space->[$cp] eq 'Y' ? 1 : 0) | ($default_ignorable->[$cp] eq 'Y' ? 2 : 0)
+			| ($emoji->[$cp] eq 'Y' ? 4 : 0);
+		my $record = "{ $category{$gc->[$cp]}, $script{$scripts->[$cp]}, $flags }";
+		unless (exists $records{$record})
+		{
+			$records{$record} = @records;
+			push @records, $record;
+		}
+		push @values, $records{$record};
+	}
+
+	my $body = enumeration('general_category', 'the values of the General_Category property',
+		map { identifier(scalar prop_value_aliases('gc', $_)) } @categories);
+	$body .= "\n" . enumeration('script', 'the values of the Script property', map { identifier($_) } @names);
+	$body .= "\n\tnamespace detail\n\t{\n";
+	$body .= "\t\t// general category, script, flags (1 White_Space, 2 Default_Ignorable_Code_Point, 4 Emoji)\n";
+	$body .= "\t\tinline constexpr std::uint8_t property_records[][3] = {\n";
+	$body .= join('', map { "\t\t\t$_,\n" } @records) . "\t\t};\n\n";
+	$body .= trie_arrays('property', \@values, 7);
+	$body .= "\t}\n";
+	header('properties.hpp', 'LION_UNICODE_TABLES_PROPERTIES_HPP', $body);
+}
+
+sub breaks
+{
+	my @graphemes = qw(Other CR LF Control Extend ZWJ Regional_Indicator Prepend SpacingMark L V T LV LVT);
+	my @words = qw(Other CR LF Newline Extend ZWJ Regional_Indicator Format Katakana Hebrew_Letter ALetter
+		Single_Quote Double_Quote MidNumLet MidLetter MidNum Numeric ExtendNumLet WSegSpace);
+	my (%grapheme, %word);
+	@grapheme{@graphemes} = 0 .. $#graphemes;
+	@word{@words} = 0 .. $#words;
+
+	my $gcb = expand('Grapheme_Cluster_Break');
+	my $wb = expand('Word_Break');
+	my $pictographic = expand('Extended_Pictographic');
+	my $gc = expand('General_Category');
+	my $lb = expand('Line_Break');
+
+	my @values;
+	for my $cp (0 .. 0x10FFFF)
+	{
+		# perl tailors a few values, these are mapped back to the ones in the UCD files
+		my $g = $gcb->[$cp] eq 'ExtPict_XX' ? 'Other' : $gcb->[$cp];
+		my $w = $wb->[$cp];
+		$w = 'ALetter' if $w eq 'ExtPict_LE';
+		$w = 'Other' if $w eq 'ExtPict_XX';
+		$w = $gc->[$cp] eq 'Zs' && $lb->[$cp] ne 'GL' ? 'WSegSpace' : 'Other' if $w eq 'Perl_Tailored_HSpace';
+		die "unknown break value $g or $w\n" unless exists $grapheme{$g} && exists $word{$w};
+		push @values, $grapheme{$g} | ($word{$w} << 4) | ($pictographic->[$cp] eq 'Y' ? 1 << 9 : 0);
+	}
+
+	my %names = (CR => 'cr', LF => 'lf', ZWJ => 'zwj', SpacingMark => 'spacing_mark', LV => 'lv', LVT => 'lvt',
+		ALetter => 'aletter', MidNumLet => 'mid_num_let', MidLetter => 'mid_letter', MidNum => 'mid_num',
+		ExtendNumLet => 'extend_num_let', WSegSpace => 'wseg_space');
+	my $body = enumeration('grapheme_cluster_break', 'the values of the Grapheme_Cluster_Break property',
+		map { $names{$_} // identifier($_) } @graphemes);
+	$body .= "\n" . enumeration('word_break', 'the values of the Word_Break property',
+		map { $names{$_} // identifier($_) } @words);
+	$body .= "\n\tnamespace detail\n\t{\n";
+	$body .= "\t\t// Grapheme_Cluster_Break | Word_Break << 4 | Extended_Pictographic << 9\n";
+	$body .= trie_arrays('break', \@values, 7);
+	$body .= "\t}\n";
+	header('breaks.hpp', 'LION_UNICODE_TABLES_BREAKS_HPP', $body);
+}
+
+sub hex_array
+{
+	my ($type, $name, $values) = @_;
+	return array($type, $name, [map { sprintf('0x%04X', $_) } @$values]);
+}
+
+sub normalization
+{
+	my %quick_check = (Yes => 0, N => 1, M => 2);
+	my $nfc = expand('NFC_Quick_Check');
+	my $nfd = expand('NFD_Quick_Check');
+	my $nfkc = expand('NFKC_Quick_Check');
+	my $nfkd = expand('NFKD_Quick_Check');
+
+	# the first codepoint which isn't both a starter and quick check Yes, for nfc, nfd, nfkc, nfkd
+	my @minimum = (0x110000) x 4;
+	my @values;
+	for my $cp (0 .. 0x10FFFF)
+	{
+		my $ccc = getCombinClass($cp);
+		my @forms = ($nfc->[$cp], $nfd->[$cp], $nfkc->[$cp], $nfkd->[$cp]);
+		for my $i (0 .. 3) {
+			$minimum[$i] = $cp if $minimum[$i] > $cp && ($ccc != 0 || $forms[$i] ne 'Yes');
+		}
+		push @values, $ccc | ($quick_check{$forms[1]} << 8) | ($quick_check{$forms[3]} << 9)
+			| ($quick_check{$forms[0]} << 10) | ($quick_check{$forms[2]} << 12);
+	}
+
+	# the full decompositions, hangul syllables are decomposed algorithmically
+	my (@data, @records, @indices);
+	push @records, '{ 0, 0, 0, 0 }';
+	for my $cp (0 .. 0x10FFFF)
+	{
+		my $canonical = getCanon($cp);
+		my $compatibility = getCompat($cp);
+		if (!defined $compatibility || ($cp >= 0xAC00 && $cp <= 0xD7A3))
+		{
+			push @indices, 0;
+			next;
+		}
+		my ($canonical_offset, $canonical_length) = (0, 0);
+		if (defined $canonical)
+		{
+			$canonical_offset = @data;
+			$canonical_length = length $canonical;
+			push @data, map { ord } split //, $canonical;
+		}
+		my ($compatibility_offset, $compatibility_length) = ($canonical_offset, $canonical_length);
+		if (!defined $canonical || $canonical ne $compatibility)
+		{
+			$compatibility_offset = @data;
+			$compatibility_length = length $compatibility;
+			push @data, map { ord } split //, $compatibility;
+		}
+		push @indices, scalar @records;
+		push @records, "{ $canonical_offset, $canonical_length, $compatibility_offset, $compatibility_length }";
+	}
+	die "too many decompositions\n" if @data > 0xFFFF || @records > 0xFFFF;
+
+	# the primary composites: canonical decompositions into two codepoints, which aren't excluded
+	my %compositions;
+	for my $cp (0 .. 0x10FFFF)
+	{
+		next if ($cp >= 0xAC00 && $cp <= 0xD7A3) || !defined getCanon($cp) || isComp_Ex($cp);
+		my $info = charinfo($cp);
+		next unless $info && $info->{decomposition} =~ /^([0-9A-F]+) ([0-9A-F]+)$/;
+		$compositions{(hex($1) << 21) | hex($2)} = $cp;
+	}
+	my @keys = sort { $a <=> $b } keys %compositions;
+
+	my $body = "\tnamespace detail\n\t{\n";
+	$body .= "\t\t// Canonical_Combining_Class | NFD_QC << 8 | NFKD_QC << 9 | NFC_QC << 10 | NFKC_QC << 12, 0 Yes 1 No 2 Maybe\n";
+	$body .= trie_arrays('normalization', \@values, 7);
+	$body .= "\n\t\t// the first codepoint which is not a starter with quick check Yes, for NFC, NFD, NFKC and NFKD\n";
+	$body .= hex_array('char32_t', 'quick_check_minimum', \@minimum);
+	$body .= "\n\t\t// offset and length of the canonical, then of the compatibility decomposition in decomposition_data\n";
+	$body .= "\t\tinline constexpr std::uint16_t decomposition_records[][4] = {\n";
+	$body .= join('', map { "\t\t\t$_,\n" } @records) . "\t\t};\n\n";
+	$body .= hex_array('char32_t', 'decomposition_data', \@data);
+	$body .= "\n" . trie_arrays('decomposition', \@indices, 7);
+	$body .= "\n\t\t// first << 21 | second, sorted, and the composite of each pair\n";
+	$body .= array('std::uint64_t', 'composition_keys', [map { sprintf('0x%X', $_) } @keys]);
+	$body .= hex_array('char32_t', 'composition_values', [map { $compositions{$_} } @keys]);
+	$body .= "\t}\n";
+	header('normalization.hpp', 'LION_UNICODE_TABLES_NORMALIZATION_HPP', $body);
+}
+
+sub casing
+{
+	my $cased = expand('Cased');
+	my $ignorable = expand('Case_Ignorable');
+
+	# a mapping to one codepoint is stored as the difference to it, a longer one as offset << 2 | length in case_data
+	my (@data, %sequences, @records, %records, @values);
+	for my $cp (0 .. 0x10FFFF)
+	{
+		my @fields;
+		my $flags = ($cased->[$cp] eq 'Y' ? 8 : 0) | ($ignorable->[$cp] eq 'Y' ? 16 : 0);
+		if ($cp >= 0xD800 && $cp <= 0xDFFF) {
+			@fields = (0, 0, 0);
+		}
+		else
+		{
+			my $c = chr($cp);
+			my @mappings = (lc $c, uc $c, fc $c);
+			for my $i (0 .. 2)
+			{
+				my @cps = map { ord } split //, $mappings[$i];
+				if (@cps == 1)
+				{
+					push @fields, $cps[0] - $cp;
+					next;
+				}
+				my $key = join(',', @cps);
+				unless (exists $sequences{$key})
+				{
+					$sequences{$key} = @data;
+					push @data, @cps;
+				}
+				push @fields, ($sequences{$key} << 2) | scalar(@cps);
+				$flags |= 1 << $i;
+			}
+		}
+		my $record = '{ ' . join(', ', @fields, $flags) . ' }';
+		unless (exists $records{$record})
+		{
+			$records{$record} = @records;
+			push @records, $record;
+		}
+		push @values, $records{$record};
+	}
+
+	my $body = "\tnamespace detail\n\t{\n";
+	$body .= "\t\t// lowercase, uppercase and case folding of a codepoint, then the flags: 1, 2, 4 if the corresponding mapping\n";
+	$body .= "\t\t// is longer than one codepoint, 8 Cased, 16 Case_Ignorable\n";
+	$body .= "\t\tinline constexpr std::int32_t case_records[][4] = {\n";
+	$body .= join('', map { "\t\t\t$_,\n" } @records) . "\t\t};\n\n";
+	$body .= hex_array('char32_t', 'case_data', \@data);
+	$body .= "\n" . trie_arrays('case', \@values, 7);
+	$body .= "\t}\n";
+	header('casing.hpp', 'LION_UNICODE_TABLES_CASING_HPP', $body);
+}
+
+sub collation
+{
+	# every collation element as primary << 16 | secondary << 5 | tertiary, the variable weighting is non-ignorable
+	die "can't find allkeys.txt\n" unless defined $allkeys;
+	open(my $fh, '<', $allkeys) or die "can't read $allkeys: $!\n";
+	my ($ducet, @blocks, %mappings);
+	while (my $line = <$fh>)
+	{
+		$line =~ s/\s*#.*//s;
+		if ($line =~ /^\@version (\S+)/) {
+			$ducet = $1;
+		}
+		elsif ($line =~ /^\@implicitweights ([0-9A-F]+)\.\.([0-9A-F]+); ([0-9A-F]+)/) {
+			push @blocks, [hex $1, hex $2, hex $3];
+		}
+		elsif ($line =~ /^([0-9A-F ]+?)\s*;\s*(.*)$/)
+		{
+			my ($cps, $elements) = ($1, $2);
+			my @elements;
+			while ($elements =~ /\[[.*]([0-9A-F]+)\.([0-9A-F]+)\.([0-9A-F]+)\]/g) {
+				push @elements, (hex($1) << 16) | (hex($2) << 5) | hex($3);
+			}
+			$mappings{join(' ', map { hex } split / /, $cps)} = \@elements;
+		}
+	}
+	close($fh);
+	die "no \@version in $allkeys\n" unless defined $ducet;
+
+	# the most collation elements of one codepoint, which bounds the size of a sort key: the longest mapping, which
+	# includes the contractions, a hangul syllable with the elements of its three jamo, or the two implicit weights
+	my $most = sub
+	{
+		my $count = 0;
+		for my $cp (@_) {
+			$count = @{$mappings{$cp}} if exists $mappings{$cp} && @{$mappings{$cp}} > $count;
+		}
+		return $count;
+	};
+	my $longest = $most->(0x1100 .. 0x1112) + $most->(0x1161 .. 0x1175) + $most->(0x11A8 .. 0x11C2);
+	for my $elements (values %mappings) {
+		$longest = @$elements if @$elements > $longest;
+	}
+	$longest = 2 if $longest < 2;
+
+	# value: offset << 6 | number of elements << 1 | 1 if a contraction starts with the codepoint
+	my (@data, %sequences);
+	my $value = sub
+	{
+		my ($elements) = @_;
+		my $key = join(',', @$elements);
+		unless (exists $sequences{$key})
+		{
+			$sequences{$key} = @data;
+			push @data, @$elements;
+		}
+		return ($sequences{$key} << 6) | (@$elements << 1);
+	};
+
+	my @values = (0) x 0x110000;
+	my @contractions;
+	for my $key (sort { $a cmp $b } keys %mappings)
+	{
+		my @cps = split / /, $key;
+		if (@cps == 1) {
+			$values[$cps[0]] |= $value->($mappings{$key});
+		}
+		else
+		{
+			$values[$cps[0]] |= 1;
+			push @contractions, [@cps, (0) x (3 - @cps), $value->($mappings{$key})];
+		}
+	}
+	@contractions = sort { $a->[0] <=> $b->[0] || $a->[1] <=> $b->[1] || $a->[2] <=> $b->[2] } @contractions;
+
+	# the unified ideographs of the version of the table, whose implicit weights start at FB40 or FB80
+	my $ideograph = expand('Unified_Ideograph');
+	my $block = expand('Block');
+	my $age = expand('Age');
+	my (@ideographs, $previous);
+	for my $cp (0 .. 0x10FFFF)
+	{
+		my $base = 0;
+		if ($ideograph->[$cp] eq 'Y' && $age->[$cp] ne 'Unassigned' && $age->[$cp] <= ($ducet =~ /^(\d+\.\d+)/)[0]) {
+			$base = $block->[$cp] =~ /^CJK (Unified|Compatibility) Ideographs$/ ? 0xFB40 : 0xFB80;
+		}
+		if ($base && $previous && $previous->[1] == $cp - 1 && $previous->[2] == $base) {
+			$previous->[1] = $cp;
+		}
+		elsif ($base) {
+			push @ideographs, $previous = [$cp, $cp, $base];
+		}
+	}
+
+	my $body = "\tnamespace detail\n\t{\n";
+	$body .= "\t\t// primary << 16 | secondary << 5 | tertiary\n";
+	$body .= array('std::uint32_t', 'collation_elements', [map { sprintf('0x%08X', $_) } @data]);
+	$body .= "\n\t\t// the most collation elements of one codepoint, of its mapping, its jamo or its implicit weights\n";
+	$body .= "\t\tconstexpr unsigned collation_longest_expansion = $longest;\n";
+	$body .= "\n\t\t// offset << 6 | number of elements << 1 | 1 if a contraction starts with the codepoint, 0 for implicit weights\n";
+	$body .= trie_arrays('collation', \@values, 7);
+	$body .= "\n\t\t// the codepoints of every contraction, sorted, and its value\n";
+	$body .= "\t\tinline constexpr std::uint32_t collation_contractions[][4] = {\n";
+	$body .= join('', map { sprintf("\t\t\t{ 0x%04X, 0x%04X, 0x%04X, 0x%X },\n", @$_) } @contractions) . "\t\t};\n";
+	$body .= "\n\t\t// first, last and the base of the implicit weights of the unified ideographs\n";
+	$body .= "\t\tinline constexpr char32_t collation_ideographs[][3] = {\n";
+	$body .= join('', map { sprintf("\t\t\t{ 0x%04X, 0x%04X, 0x%04X },\n", @$_) } @ideographs) . "\t\t};\n";
+	$body .= "\n\t\t// first, last and the primary of the scripts with implicit weights relative to their first codepoint\n";
+	$body .= "\t\tinline constexpr char32_t collation_implicit_blocks[][3] = {\n";
+	$body .= join('', map { sprintf("\t\t\t{ 0x%04X, 0x%04X, 0x%04X },\n", @$_) } sort { $a->[0] <=> $b->[0] } @blocks) . "\t\t};\n";
+	$body .= "\t}\n";
+	header('collation.hpp', 'LION_UNICODE_TABLES_COLLATION_HPP', $body, "allkeys.txt $ducet of the Unicode Collation Algorithm");
+}
+
+sub widths
+{
+	my $gc = expand('General_Category');
+	my $eaw = expand('East_Asian_Width');
+	my $default_ignorable = expand('Default_Ignorable_Code_Point');
+	my $gcb = expand('Grapheme_Cluster_Break');
+	my $emoji = expand('Emoji');
+	my $presentation = expand('Emoji_Presentation');
+	my $pictographic = expand('Extended_Pictographic');
+	my $modifier = expand('Emoji_Modifier');
+	my $modifier_base = expand('Emoji_Modifier_Base');
+	my $concatenation_mark = expand('Prepended_Concatenation_Mark');
+
+	my @values;
+	for my $cp (0 .. 0x10FFFF)
+	{
+		# marks, format and control characters, default ignorables and the jamo which join a syllable take no column, except
+		# the soft hyphen, the visible concatenation marks and the wide hangul fillers
+		my $width = 1;
+		my $wide = $eaw->[$cp] =~ /^(W|F|Wide|Fullwidth)$/;
+		if ($cp != 0xAD && $concatenation_mark->[$cp] ne 'Y' && ($gc->[$cp] =~ /^(Mn|Me|Cf|Cc|Zl|Zp)$/
+			|| ($default_ignorable->[$cp] eq 'Y' && !$wide) || $gcb->[$cp] =~ /^(V|T)$/)) {
+			$width = 0;
+		}
+		elsif ($wide) {
+			$width = 2;
+		}
+		elsif ($eaw->[$cp] =~ /^(A|Ambiguous)$/) {
+			$width = 3;
+		}
+		push @values, $width | ($emoji->[$cp] eq 'Y' && $presentation->[$cp] ne 'Y' ? 4 : 0)
+			| ($pictographic->[$cp] eq 'Y' ? 8 : 0) | ($modifier->[$cp] eq 'Y' ? 16 : 0) | ($modifier_base->[$cp] eq 'Y' ? 32 : 0);
+	}
+
+	my $body = "\tnamespace detail\n\t{\n";
+	$body .= "\t\t// columns (0, 1, 2 or 3 if East_Asian_Width is Ambiguous) | 4 text presentation emoji | 8 Extended_Pictographic\n";
+	$body .= "\t\t// | 16 Emoji_Modifier | 32 Emoji_Modifier_Base\n";
+	$body .= trie_arrays('width', \@values, 7);
+	$body .= "\t}\n";
+	header('width.hpp', 'LION_UNICODE_TABLES_WIDTH_HPP', $body);
+}
+
+sub identifiers
+{
+	my @properties = map { expand($_) } qw(XID_Start XID_Continue);
+
+	# a bitset of 256 codepoints per block and property, with identical blocks merged
+	my (@stage1, @words, %blocks);
+	for (my $cp = 0; $cp < 0x110000; $cp += 256)
+	{
+		my @block;
+		for my $property (@properties)
+		{
+			for (my $first = $cp; $first < $cp + 256; $first += 64)
+			{
+				my $bits = 0;
+				for my $bit (0 .. 63) {
+					$bits |= 1 << $bit if $property->[$first + $bit] eq 'Y';
+				}
+				push @block, sprintf('0x%016Xull', $bits);
+			}
+		}
+		my $key = join(',', @block);
+		unless (exists $blocks{$key})
+		{
+			$blocks{$key} = @words / 8;
+			push @words, @block;
+		}
+		push @stage1, $blocks{$key};
+	}
+
+	my $body = "\tnamespace detail\n\t{\n";
+	$body .= "\t\t// bit cp & 63 of identifier_bits[8 * identifier_stage1[cp >> 8] + 4 * property + (cp >> 6 & 3)], for the\n";
+	$body .= "\t\t// properties XID_Start (0) and XID_Continue (1)\n";
+	$body .= array(type_for(@words / 8 - 1), 'identifier_stage1', \@stage1);
+	$body .= array('std::uint64_t', 'identifier_bits', \@words);
+	$body .= "\t}\n";
+	header('identifier.hpp', 'LION_UNICODE_TABLES_IDENTIFIER_HPP', $body);
+}
+
+properties();
+breaks();
+normalization();
+casing();
+collation();
+widths();
+identifiers();
@@ -0,0 +1,289 @@
+// lion-iconv - converts a Unicode file or stream to another encoding scheme
+//
+//     c++ -std=c++17 -O2 -pthread -I. tools/lion-iconv.cpp -o lion-iconv
+
+#include <lion/unicode/unicode.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+namespace uni = lion::unicode;
+
+namespace
+{
+	struct options
+	{
+		uni::format to = uni::format::utf8;
+		uni::byte_order order = uni::byte_order::none;
+		bool order_given = false;
+		bool bom = true;
+		bool strict = true;
+		bool stats = false;
+		std::size_t block_size = uni::default_block_size;
+		std::string input = "-";
+		std::string output = "-";
+	};
+
+	void usage(std::FILE* out)
+	{
+		std::fputs(
+			"usage: lion-iconv [options] [input [output]]\n"
+			"\n"
+			"Converts 'input' (or the standard input) to 'output' (or the standard output).\n"
+			"The encoding of the input is detected as by lion::unicode::encoding::get.\n"
+			"\n"
+			"  -t, --to utf8|utf16|utf32     encoding scheme of the output (default utf8)\n"
+			"  -e, --endian big|little       byte order of UTF-16/UTF-32 output (default big)\n"
+			"      --bom, --no-bom           whether to write a BOM (default --bom)\n"
+			"      --strict, --lenient       replace ill-formed sequences with U+FFFD, or don't check (default --strict)\n"
+			"  -b, --block-size BYTES        size of the blocks the input is processed in\n"
+			"  -s, --stats                   print the throughput and error count to the standard error\n"
+			"  -h, --help                    print this message\n", out);
+	}
+
+	bool parse(int argc, char** argv, options& opts)
+	{
+		int positional = 0;
+		for (int i = 1; i < argc; ++i)
+		{
+			const std::string_view arg = argv[i];
+			const auto value = [&]() -> std::string_view {
+				return i + 1 < argc ? std::string_view(argv[++i]) : std::string_view();
+			};
+
+			if (arg == "-t" || arg == "--to")
+			{
+				const std::string_view to = value();
+				if (to == "utf8" || to == "UTF-8") {
+					opts.to = uni::format::utf8;
+				}
+				else if (to == "utf16" || to == "UTF-16") {
+					opts.to = uni::format::utf16;
+				}
+				else if (to == "utf32" || to == "UTF-32") {
+					opts.to = uni::format::utf32;
+				}
+				else {
+					return false;
+				}
+			}
+			else if (arg == "-e" || arg == "--endian")
+			{
+				const std::string_view order = value();
+				if (order == "big") {
+					opts.order = uni::byte_order::big;
+				}
+				else if (order == "little") {
+					opts.order = uni::byte_order::little;
+				}
+				else {
+					return false;
+				}
+				opts.order_given = true;
+			}
+			else if (arg == "--bom") {
+				opts.bom = true;
+			}
+			else if (arg == "--no-bom") {
+				opts.bom = false;
+			}
+			else if (arg == "--strict") {
+				opts.strict = true;
+			}
+			else if (arg == "--lenient") {
+				opts.strict = false;
+			}
+			else if (arg == "-b" || arg == "--block-size")
+			{
+				const std::string_view size = value();
+				opts.block_size = std::strtoull(std::string(size).c_str(), nullptr, 10);
+				if (opts.block_size == 0) {
+					return false;
+				}
+			}
+			else if (arg == "-s" || arg == "--stats") {
+				opts.stats = true;
+			}
+			else if (arg == "-h" || arg == "--help")
+			{
+				usage(stdout);
+				std::exit(0);
+			}
+			else if (arg.size() > 1 && arg[0] == '-') {
+				return false;
+			}
+			else if (positional == 0)
+			{
+				opts.input = arg;
+				++positional;
+			}
+			else if (positional == 1)
+			{
+				opts.output = arg;
+				++positional;
+			}
+			else {
+				return false;
+			}
+		}
+
+		if (opts.to == uni::format::utf8)
+		{
+			if (opts.order_given) {
+				return false;
+			}
+			opts.order = uni::byte_order::none;
+		}
+		else if (!opts.order_given) {
+			opts.order = uni::default_byte_order;
+		}
+		return true;
+	}
+
+	// converts between two C streams (e.g. pipes) in bounded memory, one block at a time
+	template<typename UTFO, uni::conversion conv, uni::write_bom wrbom>
+	bool convert_stream(std::FILE* in, std::FILE* out, const options& opts, uni::conversion_stats& stats)
+	{
+		std::string block(opts.block_size, '\0');
+		std::string head;
+		std::string output;
+
+		// the encoding is determined from the beginning of the stream
+		while (head.size() <= uni::encoding::sample_size)
+		{
+			const std::size_t n = std::fread(&block[0], 1, block.size(), in);
+			if (n == 0) {
+				break;
+			}
+			head.append(block, 0, n);
+		}
+
+		bool last = std::feof(in) || std::ferror(in);
+		uni::block_transcoder<UTFO, conv, wrbom> transcode(uni::encoding::get(head, last), opts.order);
+		transcode(head, output, last);
+		while (!last)
+		{
+			if (std::fwrite(output.data(), 1, output.size(), out) != output.size()) {
+				return false;
+			}
+			output.clear();
+
+			const std::size_t n = std::fread(&block[0], 1, block.size(), in);
+			last = n < block.size() && (std::feof(in) || std::ferror(in));
+			transcode(std::string_view(block.data(), n), output, last);
+		}
+		if (std::fwrite(output.data(), 1, output.size(), out) != output.size() || std::ferror(in)) {
+			return false;
+		}
+
+		stats = transcode.stats();
+		return std::fflush(out) == 0;
+	}
+
+	template<typename UTFO, uni::conversion conv, uni::write_bom wrbom>
+	int run(const options& opts)
+	{
+		const auto start = std::chrono::steady_clock::now();
+
+		uni::conversion_stats stats;
+		bool ok = true;
+		if (opts.input != "-" && opts.output != "-")
+		{
+			// regular files are converted by convert_file, which reads, transcodes and writes in parallel
+			uni::uistream in(opts.input);
+			if (!in.is_open())
+			{
+				std::fprintf(stderr, "lion-iconv: cannot open '%s'\n", opts.input.c_str());
+				return 1;
+			}
+			uni::uostream out(opts.output);
+			if (!out.is_open())
+			{
+				std::fprintf(stderr, "lion-iconv: cannot open '%s'\n", opts.output.c_str());
+				return 1;
+			}
+			stats = uni::convert_file<UTFO, conv, wrbom>(in, out, opts.order, opts.block_size);
+			out.flush();
+			ok = !out.fail();
+		}
+		else
+		{
+			std::FILE* in = opts.input == "-" ? stdin : std::fopen(opts.input.c_str(), "rb");
+			if (in == nullptr)
+			{
+				std::fprintf(stderr, "lion-iconv: cannot open '%s'\n", opts.input.c_str());
+				return 1;
+			}
+			std::FILE* out = opts.output == "-" ? stdout : std::fopen(opts.output.c_str(), "wb");
+			if (out == nullptr)
+			{
+				std::fprintf(stderr, "lion-iconv: cannot open '%s'\n", opts.output.c_str());
+				return 1;
+			}
+			ok = convert_stream<UTFO, conv, wrbom>(in, out, opts, stats);
+			if (in != stdin) {
+				std::fclose(in);
+			}
+			if (out != stdout && std::fclose(out) != 0) {
+				ok = false;
+			}
+		}
+
+		if (!ok) {
+			std::fprintf(stderr, "lion-iconv: I/O error\n");
+		}
+		if (opts.stats)
+		{
+			const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			std::fprintf(stderr, "read %llu bytes, wrote %llu bytes in %.3f s (%.1f MB/s), %llu ill-formed sequences\n",
+				static_cast<unsigned long long>(stats.bytes_read), static_cast<unsigned long long>(stats.bytes_written),
+				seconds, seconds > 0 ? stats.bytes_read / seconds / 1e6 : 0.0, static_cast<unsigned long long>(stats.errors));
+		}
+		return ok ? 0 : 1;
+	}
+
+	template<typename UTFO>
+	int dispatch(const options& opts)
+	{
+		if (opts.strict) {
+			return opts.bom ? run<UTFO, uni::conversion::strict, uni::write_bom::yes>(opts)
+				: run<UTFO, uni::conversion::strict, uni::write_bom::no>(opts);
+		}
+		return opts.bom ? run<UTFO, uni::conversion::lenient, uni::write_bom::yes>(opts)
+			: run<UTFO, uni::conversion::lenient, uni::write_bom::no>(opts);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	options opts;
+	if (!parse(argc, argv, opts))
+	{
+		usage(stderr);
+		return 2;
+	}
+
+#if defined(_WIN32)
+	_setmode(_fileno(stdin), _O_BINARY);
+	_setmode(_fileno(stdout), _O_BINARY);
+#endif
+
+	switch (opts.to)
+	{
+	case uni::format::utf32:
+		return dispatch<uni::utf32>(opts);
+	case uni::format::utf16:
+		return dispatch<uni::utf16>(opts);
+	default:
+		return dispatch<uni::utf8>(opts);
+	}
+}